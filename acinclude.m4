@@ -6,6 +6,30 @@ dnl Function to detect if libbde dependencies are available
 AC_DEFUN([AX_LIBBDE_CHECK_LOCAL],
   [dnl Check for internationalization functions in libbde/libbde_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Check for high resolution timer functions in libbde/libbde_statistics.c
+  AC_CHECK_HEADERS([time.h])
+  AC_SEARCH_LIBS([clock_gettime], [rt])
+  AC_CHECK_FUNCS([clock_gettime])
+
+  dnl Check for memory mapped file functions in libbde/libbde_mapped_file_io_handle.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_HEADERS([fcntl.h sys/mman.h sys/stat.h unistd.h])
+    AC_CHECK_FUNCS([madvise mmap munmap])
+  ])
+
+  dnl Check for direct IO functions in libbde/libbde_direct_file_io_handle.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_FUNCS([fcntl lseek posix_fadvise read])
+  ])
+
+  dnl Check for positional read functions in libbde/libbde_positional_file.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_FUNCS([pread])
+  ])
 ])
 
 dnl Function to check if DLL support is needed
@@ -0,0 +1,1547 @@
+/*
+ * Batch handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_DIRENT_H )
+#include <dirent.h>
+#endif
+
+#include "batch_handle.h"
+#include "bdetools_libcdata.h"
+#include "bdetools_libcerror.h"
+#include "bdetools_libcnotify.h"
+#include "bdetools_libcpath.h"
+#include "bdetools_libcthreads.h"
+#include "bdetools_unused.h"
+#include "info_handle.h"
+
+/* Creates a batch handle
+ * Make sure the value batch_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_initialize(
+     batch_handle_t **batch_handle,
+     FILE *output_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_handle_initialize";
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output stream.",
+		 function );
+
+		return( -1 );
+	}
+	*batch_handle = memory_allocate_structure(
+	                 batch_handle_t );
+
+	if( *batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batch handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *batch_handle,
+	     0,
+	     sizeof( batch_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch handle.",
+		 function );
+
+		memory_free(
+		 *batch_handle );
+
+		*batch_handle = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( ( *batch_handle )->sources_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize sources array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *batch_handle )->output_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize output mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *batch_handle )->output_stream     = output_stream;
+	( *batch_handle )->number_of_workers = 1;
+
+	return( 1 );
+
+on_error:
+	if( *batch_handle != NULL )
+	{
+		if( ( *batch_handle )->sources_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *batch_handle )->sources_array ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 *batch_handle );
+
+		*batch_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a batch handle
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_free(
+     batch_handle_t **batch_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_handle_free";
+	int result            = 1;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch_handle != NULL )
+	{
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+		if( ( *batch_handle )->workers_thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *batch_handle )->workers_thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join workers thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *batch_handle )->output_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libcdata_array_free(
+		     &( ( *batch_handle )->sources_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &batch_handle_free_source,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sources array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *batch_handle );
+
+		*batch_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the batch handle to abort
+ * Sources that have not been processed yet are skipped
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_signal_abort(
+     batch_handle_t *batch_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_handle_signal_abort";
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	batch_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Sets the number of workers
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_set_number_of_workers(
+     batch_handle_t *batch_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_handle_set_number_of_workers";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( bdetools_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > BATCH_HANDLE_MAXIMUM_NUMBER_OF_WORKERS ) )
+#else
+	if( value_64bit != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of workers.",
+		 function );
+
+		return( -1 );
+	}
+	batch_handle->number_of_workers = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Frees a source
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_free_source(
+     system_character_t **source,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_handle_free_source";
+
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( *source != NULL )
+	{
+		memory_free(
+		 *source );
+
+		*source = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a copy of a source to the batch handle
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_append_source(
+     batch_handle_t *batch_handle,
+     const system_character_t *source,
+     size_t source_length,
+     libcerror_error_t **error )
+{
+	system_character_t *source_copy = NULL;
+	static char *function           = "batch_handle_append_source";
+	int entry_index                 = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( source_length == 0 )
+	 || ( source_length > (size_t) ( ( SSIZE_MAX / sizeof( system_character_t ) ) - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	source_copy = system_string_allocate(
+	               source_length + 1 );
+
+	if( source_copy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     source_copy,
+	     source,
+	     source_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source.",
+		 function );
+
+		goto on_error;
+	}
+	source_copy[ source_length ] = 0;
+
+	if( libcdata_array_append_entry(
+	     batch_handle->sources_array,
+	     &entry_index,
+	     (intptr_t *) source_copy,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append source to array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( source_copy != NULL )
+	{
+		memory_free(
+		 source_copy );
+	}
+	return( -1 );
+}
+
+/* Reads the sources from a list file
+ * The list file contains one source per line, empty lines and lines
+ * starting with # are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_read_list_file(
+     batch_handle_t *batch_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	system_character_t line[ BATCH_HANDLE_MAXIMUM_LINE_SIZE ];
+
+	FILE *list_stream     = NULL;
+	static char *function = "batch_handle_read_list_file";
+	size_t line_length    = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	list_stream = file_stream_open_wide(
+	               filename,
+	               _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+	list_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_OPEN_READ );
+#endif
+	if( list_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open list file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	while( file_stream_get_string_wide(
+	        list_stream,
+	        line,
+	        BATCH_HANDLE_MAXIMUM_LINE_SIZE ) != NULL )
+#else
+	while( file_stream_get_string(
+	        list_stream,
+	        line,
+	        BATCH_HANDLE_MAXIMUM_LINE_SIZE ) != NULL )
+#endif
+	{
+		line_length = system_string_length(
+		               line );
+
+		while( ( line_length > 0 )
+		    && ( ( line[ line_length - 1 ] == (system_character_t) '\n' )
+		     ||  ( line[ line_length - 1 ] == (system_character_t) '\r' ) ) )
+		{
+			line_length--;
+		}
+		if( ( line_length == 0 )
+		 || ( line[ 0 ] == (system_character_t) '#' ) )
+		{
+			continue;
+		}
+		if( batch_handle_append_source(
+		     batch_handle,
+		     line,
+		     line_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     list_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close list file.",
+		 function );
+
+		list_stream = NULL;
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( list_stream != NULL )
+	{
+		file_stream_close(
+		 list_stream );
+	}
+	return( -1 );
+}
+
+/* Appends a directory entry as a source if it is a regular file
+ * Returns 1 if successful, 0 if the entry was skipped or -1 on error
+ */
+int batch_handle_append_directory_entry(
+     batch_handle_t *batch_handle,
+     const system_character_t *path,
+     size_t path_length,
+     const system_character_t *name,
+     libcerror_error_t **error )
+{
+#if !defined( WINAPI ) && defined( HAVE_SYS_STAT_H )
+	struct stat file_statistics;
+#endif
+
+	system_character_t *source = NULL;
+	static char *function      = "batch_handle_append_directory_entry";
+	size_t source_size         = 0;
+	int result                 = 0;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcpath_path_join_wide(
+	          &source,
+	          &source_size,
+	          path,
+	          path_length,
+	          name,
+	          system_string_length(
+	           name ),
+	          error );
+#else
+	result = libcpath_path_join(
+	          &source,
+	          &source_size,
+	          path,
+	          path_length,
+	          name,
+	          system_string_length(
+	           name ),
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create source path.",
+		 function );
+
+		goto on_error;
+	}
+#if !defined( WINAPI ) && defined( HAVE_SYS_STAT_H )
+	/* Only regular files are processed, which also skips . and ..
+	 */
+	if( ( stat(
+	       source,
+	       &file_statistics ) != 0 )
+	 || ( S_ISREG( file_statistics.st_mode ) == 0 ) )
+	{
+		memory_free(
+		 source );
+
+		return( 0 );
+	}
+#endif
+	if( batch_handle_append_source(
+	     batch_handle,
+	     source,
+	     source_size - 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append source.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 source );
+
+	return( 1 );
+
+on_error:
+	if( source != NULL )
+	{
+		memory_free(
+		 source );
+	}
+	return( -1 );
+}
+
+#if defined( WINAPI )
+
+/* Reads the sources from the regular files in a directory
+ * Sub directories are not traversed
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_read_directory(
+     batch_handle_t *batch_handle,
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	WIN32_FIND_DATAW find_data;
+#else
+	WIN32_FIND_DATAA find_data;
+#endif
+
+	system_character_t *search_pattern = NULL;
+	static char *function              = "batch_handle_read_directory";
+	HANDLE find_handle                 = INVALID_HANDLE_VALUE;
+	size_t path_length                 = 0;
+	size_t search_pattern_size         = 0;
+	int result                         = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = system_string_length(
+	               path );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcpath_path_join_wide(
+	          &search_pattern,
+	          &search_pattern_size,
+	          path,
+	          path_length,
+	          L"*",
+	          1,
+	          error );
+#else
+	result = libcpath_path_join(
+	          &search_pattern,
+	          &search_pattern_size,
+	          path,
+	          path_length,
+	          "*",
+	          1,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create search pattern.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	find_handle = FindFirstFileW(
+	               search_pattern,
+	               &find_data );
+#else
+	find_handle = FindFirstFileA(
+	               search_pattern,
+	               &find_data );
+#endif
+	if( find_handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	do
+	{
+		if( ( find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) != 0 )
+		{
+			continue;
+		}
+		if( batch_handle_append_directory_entry(
+		     batch_handle,
+		     path,
+		     path_length,
+		     find_data.cFileName,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append directory entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	while( FindNextFileW(
+	        find_handle,
+	        &find_data ) != 0 );
+#else
+	while( FindNextFileA(
+	        find_handle,
+	        &find_data ) != 0 );
+#endif
+
+	FindClose(
+	 find_handle );
+
+	memory_free(
+	 search_pattern );
+
+	return( 1 );
+
+on_error:
+	if( find_handle != INVALID_HANDLE_VALUE )
+	{
+		FindClose(
+		 find_handle );
+	}
+	if( search_pattern != NULL )
+	{
+		memory_free(
+		 search_pattern );
+	}
+	return( -1 );
+}
+
+#elif defined( HAVE_DIRENT_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+
+/* Reads the sources from the regular files in a directory
+ * Sub directories are not traversed
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_read_directory(
+     batch_handle_t *batch_handle,
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+	struct dirent *directory_entry = NULL;
+	DIR *directory                 = NULL;
+	static char *function          = "batch_handle_read_directory";
+	size_t path_length             = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = system_string_length(
+	               path );
+
+	directory = opendir(
+	             path );
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	while( ( directory_entry = readdir(
+	                            directory ) ) != NULL )
+	{
+		if( batch_handle_append_directory_entry(
+		     batch_handle,
+		     path,
+		     path_length,
+		     directory_entry->d_name,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append directory entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( closedir(
+	     directory ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close directory.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( directory != NULL )
+	{
+		closedir(
+		 directory );
+	}
+	return( -1 );
+}
+
+#else
+
+/* Reads the sources from the regular files in a directory
+ * Returns -1 since reading directories is not supported
+ */
+int batch_handle_read_directory(
+     batch_handle_t *batch_handle BDETOOLS_ATTRIBUTE_UNUSED,
+     const system_character_t *path BDETOOLS_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_handle_read_directory";
+
+	BDETOOLS_UNREFERENCED_PARAMETER( batch_handle )
+	BDETOOLS_UNREFERENCED_PARAMETER( path )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: reading directories is not supported.",
+	 function );
+
+	return( -1 );
+}
+
+#endif /* defined( WINAPI ) */
+
+/* Opens the sources from a path
+ * If the path refers to a directory the regular files in the directory are used
+ * otherwise the path is read as a list file
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_open_sources(
+     batch_handle_t *batch_handle,
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+#if !defined( WINAPI ) && defined( HAVE_SYS_STAT_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	struct stat file_statistics;
+#elif defined( WINAPI )
+	DWORD file_attributes = 0;
+#endif
+
+	static char *function = "batch_handle_open_sources";
+	int is_directory      = 0;
+	int result            = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_attributes = GetFileAttributesW(
+	                   path );
+#else
+	file_attributes = GetFileAttributesA(
+	                   path );
+#endif
+	if( ( file_attributes != INVALID_FILE_ATTRIBUTES )
+	 && ( ( file_attributes & FILE_ATTRIBUTE_DIRECTORY ) != 0 ) )
+	{
+		is_directory = 1;
+	}
+#elif defined( HAVE_SYS_STAT_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( ( stat(
+	       path,
+	       &file_statistics ) == 0 )
+	 && ( S_ISDIR( file_statistics.st_mode ) != 0 ) )
+	{
+		is_directory = 1;
+	}
+#endif
+	if( is_directory != 0 )
+	{
+		result = batch_handle_read_directory(
+		          batch_handle,
+		          path,
+		          error );
+	}
+	else
+	{
+		result = batch_handle_read_list_file(
+		          batch_handle,
+		          path,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sources from: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of sources
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_get_number_of_sources(
+     batch_handle_t *batch_handle,
+     int *number_of_sources,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_handle_get_number_of_sources";
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     batch_handle->sources_array,
+	     number_of_sources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sources.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Processes a single source
+ * The volume metadata is read without unlocking the volume and printed
+ * as a single JSON line, if the source cannot be read an error line is printed
+ * Returns 1 if the source was processed, 0 if the source could not be read or -1 on error
+ */
+int batch_handle_process_source(
+     batch_handle_t *batch_handle,
+     const system_character_t *source,
+     libcerror_error_t **error )
+{
+	char error_string[ 512 ];
+
+	info_volume_values_t volume_values;
+
+	info_handle_t *info_handle      = NULL;
+	libcerror_error_t *source_error = NULL;
+	static char *function           = "batch_handle_process_source";
+	int has_volume_values           = 0;
+	int result                      = 0;
+
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	int output_mutex_grabbed        = 0;
+#endif
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	error_string[ 0 ] = 0;
+
+	/* The info handle is used in unattended mode without any keys
+	 * so that only the unencrypted metadata is read
+	 */
+	result = info_handle_initialize(
+	          &info_handle,
+	          1,
+	          &source_error );
+
+	if( ( result == 1 )
+	 && ( batch_handle->volume_offset_string != NULL ) )
+	{
+		result = info_handle_set_volume_offset(
+		          info_handle,
+		          batch_handle->volume_offset_string,
+		          &source_error );
+	}
+	if( result == 1 )
+	{
+		result = info_handle_open(
+		          info_handle,
+		          source,
+		          &source_error );
+	}
+	if( result == 1 )
+	{
+		result = info_handle_get_volume_values(
+		          info_handle,
+		          &volume_values,
+		          &source_error );
+
+		if( result == 1 )
+		{
+			has_volume_values = 1;
+		}
+		if( info_handle_close(
+		     info_handle,
+		     ( source_error == NULL ) ? &source_error : NULL ) != 0 )
+		{
+			result = -1;
+		}
+	}
+	if( info_handle != NULL )
+	{
+		if( info_handle_free(
+		     &info_handle,
+		     ( source_error == NULL ) ? &source_error : NULL ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( source_error != NULL )
+	{
+		if( libcerror_error_sprint(
+		     source_error,
+		     error_string,
+		     512 ) <= 0 )
+		{
+			error_string[ 0 ] = 0;
+		}
+		libcerror_error_free(
+		 &source_error );
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     batch_handle->output_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab output mutex.",
+		 function );
+
+		goto on_error;
+	}
+	output_mutex_grabbed = 1;
+#endif
+	if( result == 1 )
+	{
+		if( info_handle_volume_values_json_fprint(
+		     &volume_values,
+		     source,
+		     batch_handle->output_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print volume values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		batch_handle->number_of_failures += 1;
+
+		if( info_handle_error_json_fprint(
+		     source,
+		     error_string,
+		     batch_handle->output_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print error.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	output_mutex_grabbed = 0;
+
+	if( libcthreads_mutex_release(
+	     batch_handle->output_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release output mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( has_volume_values != 0 )
+	{
+		if( info_handle_clear_volume_values(
+		     &volume_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear volume values.",
+			 function );
+
+			has_volume_values = 0;
+
+			goto on_error;
+		}
+	}
+	if( result != 1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( output_mutex_grabbed != 0 )
+	{
+		libcthreads_mutex_release(
+		 batch_handle->output_mutex,
+		 NULL );
+	}
+#endif
+	if( has_volume_values != 0 )
+	{
+		info_handle_clear_volume_values(
+		 &volume_values,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Processes a source on a worker thread
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_source_callback(
+     system_character_t *source,
+     batch_handle_t *batch_handle )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "batch_handle_source_callback";
+
+	if( batch_handle == NULL )
+	{
+		return( -1 );
+	}
+	if( batch_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	if( batch_handle_process_source(
+	     batch_handle,
+	     source,
+	     &error ) == -1 )
+	{
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to process source.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Processes the sources
+ * The order of the output lines is not guaranteed when more than 1 worker is used
+ * Returns 1 if all sources were processed, 0 if one or more sources could not be read or -1 on error
+ */
+int batch_handle_process(
+     batch_handle_t *batch_handle,
+     libcerror_error_t **error )
+{
+	system_character_t *source = NULL;
+	static char *function      = "batch_handle_process";
+	int number_of_sources      = 0;
+	int number_of_workers      = 0;
+	int source_index           = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     batch_handle->sources_array,
+	     &number_of_sources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sources.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_workers = batch_handle->number_of_workers;
+
+	if( number_of_workers > number_of_sources )
+	{
+		number_of_workers = number_of_sources;
+	}
+	batch_handle->number_of_failures = 0;
+
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( number_of_workers > 1 )
+	{
+		if( libcthreads_thread_pool_create(
+		     &( batch_handle->workers_thread_pool ),
+		     NULL,
+		     number_of_workers,
+		     number_of_workers * 2,
+		     (int (*)(intptr_t *, void *)) &batch_handle_source_callback,
+		     (void *) batch_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create workers thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	for( source_index = 0;
+	     source_index < number_of_sources;
+	     source_index++ )
+	{
+		if( batch_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libcdata_array_get_entry_by_index(
+		     batch_handle->sources_array,
+		     source_index,
+		     (intptr_t **) &source,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source: %d.",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+		if( batch_handle->workers_thread_pool != NULL )
+		{
+			/* The push blocks while the queue is full
+			 */
+			if( libcthreads_thread_pool_push(
+			     batch_handle->workers_thread_pool,
+			     (intptr_t *) source,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push source: %d onto workers thread pool.",
+				 function,
+				 source_index );
+
+				goto on_error;
+			}
+			continue;
+		}
+#endif
+		if( batch_handle_process_source(
+		     batch_handle,
+		     source,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process source: %d.",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( batch_handle->workers_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( batch_handle->workers_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join workers thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( batch_handle->number_of_failures > 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( batch_handle->workers_thread_pool != NULL )
+	{
+		batch_handle->abort = 1;
+
+		libcthreads_thread_pool_join(
+		 &( batch_handle->workers_thread_pool ),
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
@@ -0,0 +1,157 @@
+/*
+ * Batch handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _BATCH_HANDLE_H )
+#define _BATCH_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "bdetools_libcdata.h"
+#include "bdetools_libcerror.h"
+#include "bdetools_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of workers
+ */
+#define BATCH_HANDLE_MAXIMUM_NUMBER_OF_WORKERS		64
+
+/* The maximum size of a line in a list file
+ */
+#define BATCH_HANDLE_MAXIMUM_LINE_SIZE			4096
+
+typedef struct batch_handle batch_handle_t;
+
+struct batch_handle
+{
+	/* The sources array
+	 */
+	libcdata_array_t *sources_array;
+
+	/* The volume offset string
+	 */
+	const system_character_t *volume_offset_string;
+
+	/* The output stream
+	 */
+	FILE *output_stream;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* The number of sources that could not be processed
+	 */
+	int number_of_failures;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	/* The workers thread pool
+	 */
+	libcthreads_thread_pool_t *workers_thread_pool;
+
+	/* The output mutex
+	 */
+	libcthreads_mutex_t *output_mutex;
+#endif
+};
+
+int batch_handle_initialize(
+     batch_handle_t **batch_handle,
+     FILE *output_stream,
+     libcerror_error_t **error );
+
+int batch_handle_free(
+     batch_handle_t **batch_handle,
+     libcerror_error_t **error );
+
+int batch_handle_signal_abort(
+     batch_handle_t *batch_handle,
+     libcerror_error_t **error );
+
+int batch_handle_set_number_of_workers(
+     batch_handle_t *batch_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int batch_handle_free_source(
+     system_character_t **source,
+     libcerror_error_t **error );
+
+int batch_handle_append_source(
+     batch_handle_t *batch_handle,
+     const system_character_t *source,
+     size_t source_length,
+     libcerror_error_t **error );
+
+int batch_handle_read_list_file(
+     batch_handle_t *batch_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int batch_handle_append_directory_entry(
+     batch_handle_t *batch_handle,
+     const system_character_t *path,
+     size_t path_length,
+     const system_character_t *name,
+     libcerror_error_t **error );
+
+int batch_handle_read_directory(
+     batch_handle_t *batch_handle,
+     const system_character_t *path,
+     libcerror_error_t **error );
+
+int batch_handle_open_sources(
+     batch_handle_t *batch_handle,
+     const system_character_t *path,
+     libcerror_error_t **error );
+
+int batch_handle_get_number_of_sources(
+     batch_handle_t *batch_handle,
+     int *number_of_sources,
+     libcerror_error_t **error );
+
+int batch_handle_process_source(
+     batch_handle_t *batch_handle,
+     const system_character_t *source,
+     libcerror_error_t **error );
+
+int batch_handle_source_callback(
+     system_character_t *source,
+     batch_handle_t *batch_handle );
+
+int batch_handle_process(
+     batch_handle_t *batch_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _BATCH_HANDLE_H ) */
+
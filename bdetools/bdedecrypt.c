@@ -0,0 +1,712 @@
+/*
+ * Decrypts a BitLocker Drive Encrypted (BDE) volume to a raw image.
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "bdetools_getopt.h"
+#include "bdetools_i18n.h"
+#include "bdetools_libbde.h"
+#include "bdetools_libcerror.h"
+#include "bdetools_libclocale.h"
+#include "bdetools_libcnotify.h"
+#include "bdetools_output.h"
+#include "bdetools_signal.h"
+#include "bdetools_unused.h"
+#include "decrypt_handle.h"
+#include "hash_handle.h"
+#include "mount_handle.h"
+
+decrypt_handle_t *bdedecrypt_decrypt_handle = NULL;
+hash_handle_t *bdedecrypt_hash_handle       = NULL;
+mount_handle_t *bdedecrypt_mount_handle     = NULL;
+int bdedecrypt_abort                        = 0;
+
+/* Signal handler for bdedecrypt
+ */
+void bdedecrypt_signal_handler(
+      bdetools_signal_t signal BDETOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "bdedecrypt_signal_handler";
+
+	BDETOOLS_UNREFERENCED_PARAMETER( signal )
+
+	bdedecrypt_abort = 1;
+
+	if( bdedecrypt_decrypt_handle != NULL )
+	{
+		if( decrypt_handle_signal_abort(
+		     bdedecrypt_decrypt_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal decrypt handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	if( bdedecrypt_mount_handle != NULL )
+	{
+		if( mount_handle_signal_abort(
+		     bdedecrypt_mount_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal mount handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use bdedecrypt to decrypt a BitLocker Drive Encrypted (BDE) volume "
+		"to a raw image.";
+
+	bdetools_option_t options[ ] = {
+		{ 'b', "block_size", "specify the size of the blocks that are decrypted at once, which must be a multiple of 4096, default is 1048576" },
+		{ 'd', NULL, "calculate the MD5, SHA1 and SHA256 hashes of the decrypted data while it is written, which cannot be combined with resuming" },
+		{ 'h', NULL, "shows this help" },
+		{ 'k', "keys", "specify the full volume encryption key and tweak key formatted in base16 and separated by a : character e.g. FVEK:TWEAK" },
+		{ 'o', "offset", "specify the volume offset in bytes" },
+		{ 'p', "password", "specify the password (or passphrase)" },
+		{ 'q', NULL, "quiet shows minimal status information" },
+		{ 'r', "recovery_password", "specify the recovery password (or passphrase)" },
+		{ 's', "startup_key_path", "specify the path of the file containing the startup key. Typically this file has the extension .BEK" },
+		{ 't', "target", "specify the target file to write the decrypted data to, decryption is resumed if target.checkpoint exists" },
+		{ 'u', NULL, "unattended mode (disables user interaction)" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 'w', "number_of_workers", "specify the number of workers that decrypt blocks concurrently, where each worker reads from its own unlocked copy of the volume, default is 1" },
+		{ 0, "volume", "a BitLocker Drive Encrypted (BDE) volume" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libbde_error_t *error                        = NULL;
+	system_character_t *option_block_size        = NULL;
+	system_character_t *option_keys              = NULL;
+	system_character_t *option_number_of_workers = NULL;
+	system_character_t *option_offset            = NULL;
+	system_character_t *option_password          = NULL;
+	system_character_t *option_recovery_password = NULL;
+	system_character_t *option_startup_key_path  = NULL;
+	system_character_t *option_target            = NULL;
+	system_character_t *source                   = NULL;
+	char *program                                = "bdedecrypt";
+	system_integer_t option                      = 0;
+	uint8_t calculate_hashes                     = 0;
+	uint8_t print_status                         = 1;
+	int number_of_options                        = (int) ( sizeof( options ) / sizeof( bdetools_option_t ) );
+	int number_of_workers                        = 1;
+	int result                                   = 0;
+	int unattended_mode                          = 0;
+	int verbose                                  = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "bdetools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( bdetools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	bdetools_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( bdetools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = bdetools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				bdetools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'b':
+				option_block_size = optarg;
+
+				break;
+
+			case (system_integer_t) 'd':
+				calculate_hashes = 1;
+
+				break;
+
+			case (system_integer_t) 'h':
+				bdetools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'k':
+				option_keys = optarg;
+
+				break;
+
+			case (system_integer_t) 'o':
+				option_offset = optarg;
+
+				break;
+
+			case (system_integer_t) 'p':
+				option_password = optarg;
+
+				break;
+
+			case (system_integer_t) 'q':
+				print_status = 0;
+
+				break;
+
+			case (system_integer_t) 'r':
+				option_recovery_password = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_startup_key_path = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_target = optarg;
+
+				break;
+
+			case (system_integer_t) 'u':
+				unattended_mode = 1;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				bdetools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'w':
+				option_number_of_workers = optarg;
+
+				break;
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source volume.\n" );
+
+		bdetools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	if( option_target == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Missing target.\n" );
+
+		bdetools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libbde_notify_set_stream(
+	 stderr,
+	 NULL );
+	libbde_notify_set_verbose(
+	 verbose );
+
+	if( mount_handle_initialize(
+	     &bdedecrypt_mount_handle,
+	     unattended_mode,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize mount handle.\n" );
+
+		goto on_error;
+	}
+	if( option_keys != NULL )
+	{
+		if( mount_handle_set_keys(
+		     bdedecrypt_mount_handle,
+		     option_keys,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set keys.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_offset != NULL )
+	{
+		if( mount_handle_set_offset(
+		     bdedecrypt_mount_handle,
+		     option_offset,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set volume offset.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_number_of_workers != NULL )
+	{
+		if( mount_handle_set_number_of_workers(
+		     bdedecrypt_mount_handle,
+		     option_number_of_workers,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of workers.\n" );
+
+			goto on_error;
+		}
+		if( mount_handle_get_number_of_workers(
+		     bdedecrypt_mount_handle,
+		     &number_of_workers,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve number of workers.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_password != NULL )
+	{
+		if( mount_handle_set_password(
+		     bdedecrypt_mount_handle,
+		     option_password,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set password.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_recovery_password != NULL )
+	{
+		if( mount_handle_set_recovery_password(
+		     bdedecrypt_mount_handle,
+		     option_recovery_password,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set recovery password.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_startup_key_path != NULL )
+	{
+		if( mount_handle_set_startup_key(
+		     bdedecrypt_mount_handle,
+		     option_startup_key_path,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set startup key.\n" );
+
+			goto on_error;
+		}
+	}
+	if( mount_handle_open(
+	     bdedecrypt_mount_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source volume\n" );
+
+		goto on_error;
+	}
+	if( mount_handle_is_locked(
+	     bdedecrypt_mount_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to unlock source volume\n" );
+
+		goto on_error;
+	}
+	if( decrypt_handle_initialize(
+	     &bdedecrypt_decrypt_handle,
+	     bdedecrypt_mount_handle->file_system,
+	     print_status,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize decrypt handle.\n" );
+
+		goto on_error;
+	}
+	if( option_block_size != NULL )
+	{
+		if( decrypt_handle_set_block_size(
+		     bdedecrypt_decrypt_handle,
+		     option_block_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set block size.\n" );
+
+			goto on_error;
+		}
+	}
+	if( decrypt_handle_open_target(
+	     bdedecrypt_decrypt_handle,
+	     option_target,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open target: %" PRIs_SYSTEM ".\n",
+		 option_target );
+
+		goto on_error;
+	}
+	if( bdedecrypt_decrypt_handle->resume_offset > 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Resuming decryption at offset: %" PRIi64 ".\n",
+		 bdedecrypt_decrypt_handle->resume_offset );
+	}
+	if( calculate_hashes != 0 )
+	{
+		if( hash_handle_initialize(
+		     &bdedecrypt_hash_handle,
+		     (uint8_t) ( number_of_workers > 1 ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize hash handle.\n" );
+
+			goto on_error;
+		}
+		bdedecrypt_decrypt_handle->hash_handle = bdedecrypt_hash_handle;
+	}
+	if( bdetools_signal_attach(
+	     bdedecrypt_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	result = decrypt_handle_decrypt(
+	          bdedecrypt_decrypt_handle,
+	          number_of_workers,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to decrypt volume.\n" );
+
+		goto on_error;
+	}
+	if( bdetools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( decrypt_handle_close_target(
+	     bdedecrypt_decrypt_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close target.\n" );
+
+		goto on_error;
+	}
+	if( ( bdedecrypt_hash_handle != NULL )
+	 && ( result == 1 ) )
+	{
+		if( hash_handle_finalize(
+		     bdedecrypt_hash_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to finalize hashes.\n" );
+
+			goto on_error;
+		}
+		fprintf(
+		 stdout,
+		 "\n" );
+
+		if( hash_handle_hashes_fprint(
+		     bdedecrypt_hash_handle,
+		     stdout,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print hashes.\n" );
+
+			goto on_error;
+		}
+	}
+	if( decrypt_handle_free(
+	     &bdedecrypt_decrypt_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free decrypt handle.\n" );
+
+		goto on_error;
+	}
+	if( bdedecrypt_hash_handle != NULL )
+	{
+		if( hash_handle_free(
+		     &bdedecrypt_hash_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free hash handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( mount_handle_close(
+	     bdedecrypt_mount_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close mount handle.\n" );
+
+		goto on_error;
+	}
+	if( mount_handle_free(
+	     &bdedecrypt_mount_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free mount handle.\n" );
+
+		goto on_error;
+	}
+	if( result == 0 )
+	{
+		fprintf(
+		 stdout,
+		 "%s: ABORTED, run again with the same target to resume.\n",
+		 program );
+
+		return( EXIT_FAILURE );
+	}
+	fprintf(
+	 stdout,
+	 "Decryption completed.\n" );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( bdedecrypt_decrypt_handle != NULL )
+	{
+		decrypt_handle_free(
+		 &bdedecrypt_decrypt_handle,
+		 NULL );
+	}
+	if( bdedecrypt_hash_handle != NULL )
+	{
+		hash_handle_free(
+		 &bdedecrypt_hash_handle,
+		 NULL );
+	}
+	if( bdedecrypt_mount_handle != NULL )
+	{
+		mount_handle_free(
+		 &bdedecrypt_mount_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -40,6 +40,7 @@
 #include <unistd.h>
 #endif
 
+#include "batch_handle.h"
 #include "bdetools_getopt.h"
 #include "bdetools_libbde.h"
 #include "bdetools_libcerror.h"
@@ -50,8 +51,9 @@
 #include "bdetools_unused.h"
 #include "info_handle.h"
 
-info_handle_t *bdeinfo_info_handle = NULL;
-int bdeinfo_abort                  = 0;
+batch_handle_t *bdeinfo_batch_handle = NULL;
+info_handle_t *bdeinfo_info_handle   = NULL;
+int bdeinfo_abort                    = 0;
 
 /* Signal handler for bdeinfo
  */
@@ -65,6 +67,22 @@ void bdeinfo_signal_handler(
 
 	bdeinfo_abort = 1;
 
+	if( bdeinfo_batch_handle != NULL )
+	{
+		if( batch_handle_signal_abort(
+		     bdeinfo_batch_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal batch handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
 	if( bdeinfo_info_handle != NULL )
 	{
 		if( info_handle_signal_abort(
@@ -111,19 +129,24 @@ int main( int argc, char * const argv[] )
 	bdetools_option_t options[ ] = {
 		{ 'h', NULL, "shows this help" },
 		{ 'k', "keys", "specify the full volume encryption key and tweak key formatted in base16 and separated by a : character e.g. FVEK:TWEAK" },
+		{ 'l', "list", "batch mode, processes the volumes in a list file, with one volume per line, or the files in a directory and prints the unencrypted metadata of each volume as a single JSON line, no keys are used" },
 		{ 'o', "offset", "specify the volume offset in bytes" },
 		{ 'p', "password", "specify the password (or passphrase)" },
 		{ 'r', "recovery_password", "specify the recovery password (or passphrase)" },
 		{ 's', "startup_key_path", "specify the file containing the startup key. typically this file has the extension .BEK" },
+		{ 'S', NULL, "print statistics" },
 		{ 'u', NULL, "unattended mode (disables user interaction)" },
 		{ 'v', NULL, "verbose output to stderr" },
 		{ 'V', NULL, "print version" },
+		{ 'w', "number_of_workers", "specify the number of workers that process volumes concurrently in batch mode, default is 1" },
 		{ 0, "source", "the source volume" },
 	};
 	system_character_t options_string[ 32 ];
 
 	libbde_error_t *error                        = NULL;
 	system_character_t *option_keys              = NULL;
+	system_character_t *option_list              = NULL;
+	system_character_t *option_number_of_workers = NULL;
 	system_character_t *option_password          = NULL;
 	system_character_t *option_recovery_password = NULL;
 	system_character_t *option_startup_key_path  = NULL;
@@ -132,6 +155,7 @@ int main( int argc, char * const argv[] )
 	char *program                                = "bdeinfo";
 	system_integer_t option                      = 0;
 	int number_of_options                        = (int) ( sizeof( options ) / sizeof( bdetools_option_t ) );
+	int print_statistics                         = 0;
 	int result                                   = 0;
 	int unattended_mode                          = 0;
 	int verbose                                  = 0;
@@ -167,10 +191,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	bdetools_output_version_fprint(
-	 stdout,
-	 program );
-
 	if( bdetools_getopt_get_options_string(
 	     options,
 	     number_of_options,
@@ -192,6 +212,10 @@ int main( int argc, char * const argv[] )
 		{
 			case (system_integer_t) '?':
 			default:
+				bdetools_output_version_fprint(
+				 stdout,
+				 program );
+
 				fprintf(
 				 stderr,
 				 "Invalid argument: %" PRIs_SYSTEM "\n",
@@ -207,6 +231,10 @@ int main( int argc, char * const argv[] )
 				return( EXIT_FAILURE );
 
 			case (system_integer_t) 'h':
+				bdetools_output_version_fprint(
+				 stdout,
+				 program );
+
 				bdetools_getopt_usage_fprint(
 				 stdout,
 				 program,
@@ -221,6 +249,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'l':
+				option_list = optarg;
+
+				break;
+
 			case (system_integer_t) 'o':
 				option_volume_offset = optarg;
 
@@ -241,6 +274,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'S':
+				print_statistics = 1;
+
+				break;
+
 			case (system_integer_t) 'u':
 				unattended_mode = 1;
 
@@ -252,12 +290,141 @@ int main( int argc, char * const argv[] )
 				break;
 
 			case (system_integer_t) 'V':
+				bdetools_output_version_fprint(
+				 stdout,
+				 program );
+
 				bdetools_output_copyright_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'w':
+				option_number_of_workers = optarg;
+
+				break;
+		}
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libbde_notify_set_stream(
+	 stderr,
+	 NULL );
+	libbde_notify_set_verbose(
+	 verbose );
+
+	/* In batch mode stdout only contains JSON lines
+	 */
+	if( option_list != NULL )
+	{
+		if( ( option_keys != NULL )
+		 || ( option_password != NULL )
+		 || ( option_recovery_password != NULL )
+		 || ( option_startup_key_path != NULL ) )
+		{
+			fprintf(
+			 stderr,
+			 "Keys and passwords are not supported in batch mode.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		if( batch_handle_initialize(
+		     &bdeinfo_batch_handle,
+		     stdout,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize batch handle.\n" );
+
+			goto on_error;
+		}
+		bdeinfo_batch_handle->volume_offset_string = option_volume_offset;
+
+		if( option_number_of_workers != NULL )
+		{
+			if( batch_handle_set_number_of_workers(
+			     bdeinfo_batch_handle,
+			     option_number_of_workers,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set number of workers.\n" );
+
+				goto on_error;
+			}
+		}
+		if( batch_handle_open_sources(
+		     bdeinfo_batch_handle,
+		     option_list,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open list: %" PRIs_SYSTEM ".\n",
+			 option_list );
+
+			goto on_error;
+		}
+		if( bdetools_signal_attach(
+		     bdeinfo_signal_handler,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to attach signal handler.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		result = batch_handle_process(
+		          bdeinfo_batch_handle,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to process volumes.\n" );
+
+			goto on_error;
+		}
+		if( bdetools_signal_detach(
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to detach signal handler.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		if( batch_handle_free(
+		     &bdeinfo_batch_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free batch handle.\n" );
+
+			goto on_error;
+		}
+		if( ( result != 1 )
+		 || ( bdeinfo_abort != 0 ) )
+		{
+			return( EXIT_FAILURE );
 		}
+		return( EXIT_SUCCESS );
 	}
+	bdetools_output_version_fprint(
+	 stdout,
+	 program );
+
 	if( optind == argc )
 	{
 		fprintf(
@@ -275,14 +442,6 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
-	libcnotify_verbose_set(
-	 verbose );
-	libbde_notify_set_stream(
-	 stderr,
-	 NULL );
-	libbde_notify_set_verbose(
-	 verbose );
-
 	if( info_handle_initialize(
 	     &bdeinfo_info_handle,
 	     unattended_mode,
@@ -388,6 +547,19 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( print_statistics != 0 )
+	{
+		if( info_handle_statistics_fprint(
+		     bdeinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print statistics.\n" );
+
+			goto on_error;
+		}
+	}
 	if( info_handle_close(
 	     bdeinfo_info_handle,
 	     &error ) != 0 )
@@ -418,6 +590,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( bdeinfo_batch_handle != NULL )
+	{
+		batch_handle_free(
+		 &bdeinfo_batch_handle,
+		 NULL );
+	}
 	if( bdeinfo_info_handle != NULL )
 	{
 		info_handle_free(
@@ -124,8 +124,9 @@ int main( int argc, char * const argv[] )
 		{ 'u', NULL, "unattended mode (disables user interaction)" },
 		{ 'v', NULL, "verbose output to stderr, while bdemount will remain running in the foreground" },
 		{ 'V', NULL, "print version" },
+		{ 'w', "number_of_workers", "specify the number of workers that handle read requests concurrently, where each worker reads from its own unlocked copy of the volume, default is 1" },
 #if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
-		{ 'X', "extended_options", "extended options to pass to sub system" },
+		{ 'X', "extended_options", "extended options to pass to sub system, these override the default options: " MOUNT_FUSE_DEFAULT_OPTIONS " and " MOUNT_FUSE_DEFAULT_CACHE_OPTION " unless a cache option such as direct_io is specified" },
 #endif
 		{ 0, "volume", "a BitLocker Drive Encrypted (BDE) volume" },
 		{ 0, "mount_point", "the directory to serve as mount point" },
@@ -136,6 +137,7 @@ int main( int argc, char * const argv[] )
 	libbde_error_t *error                        = NULL;
 	size_t path_prefix_size                      = 0;
 	system_character_t *option_keys              = NULL;
+	system_character_t *option_number_of_workers = NULL;
 	system_character_t *option_offset            = NULL;
 	system_character_t *option_password          = NULL;
 	system_character_t *option_recovery_password = NULL;
@@ -144,6 +146,7 @@ int main( int argc, char * const argv[] )
 	char *program                                = "bdemount";
 	system_integer_t option                      = 0;
 	int number_of_options                        = (int) ( sizeof( options ) / sizeof( bdetools_option_t ) );
+	int number_of_workers                        = 1;
 	int unattended_mode                          = 0;
 	int verbose                                  = 0;
 
@@ -169,6 +172,10 @@ int main( int argc, char * const argv[] )
 #endif
 	struct fuse *bdemount_fuse_handle            = NULL;
 
+#if defined( HAVE_LIBFUSE3 ) && ( FUSE_USE_VERSION >= 32 ) && ( FUSE_USE_VERSION < 312 )
+	struct fuse_loop_config bdemount_fuse_loop_config;
+#endif
+
 #elif defined( HAVE_LIBDOKAN )
 	DOKAN_OPERATIONS bdemount_dokan_operations;
 	DOKAN_OPTIONS bdemount_dokan_options;
@@ -295,6 +302,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'w':
+				option_number_of_workers = optarg;
+
+				break;
+
 #if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
 			case (system_integer_t) 'X':
 				option_extended_options = optarg;
@@ -385,6 +397,31 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( option_number_of_workers != NULL )
+	{
+		if( mount_handle_set_number_of_workers(
+		     bdemount_mount_handle,
+		     option_number_of_workers,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of workers.\n" );
+
+			goto on_error;
+		}
+		if( mount_handle_get_number_of_workers(
+		     bdemount_mount_handle,
+		     &number_of_workers,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve number of workers.\n" );
+
+			goto on_error;
+		}
+	}
 	if( option_password != NULL )
 	{
 		if( mount_handle_set_password(
@@ -469,18 +506,71 @@ int main( int argc, char * const argv[] )
 		goto on_error;
 	}
 #if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
-	if( option_extended_options != NULL )
-	{
 #if defined( HAVE_LIBFUSE3 )
-		// fuse_opt_add_arg: Assertion `!args->argv || args->allocated' failed.
-		bdemount_fuse_arguments.argc = 0;
-		bdemount_fuse_arguments.argv = NULL;
+	// fuse_opt_add_arg: Assertion `!args->argv || args->allocated' failed.
+	bdemount_fuse_arguments.argc = 0;
+	bdemount_fuse_arguments.argv = NULL;
 #endif
-		/* This argument is required but ignored
-		 */
+	/* This argument is required but ignored
+	 */
+	if( fuse_opt_add_arg(
+	     &bdemount_fuse_arguments,
+	     "" ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable add fuse arguments.\n" );
+
+		goto on_error;
+	}
+	/* The default options are passed first so that they can be overridden
+	 * by the extended options
+	 */
+	if( fuse_opt_add_arg(
+	     &bdemount_fuse_arguments,
+	     "-o" ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable add fuse arguments.\n" );
+
+		goto on_error;
+	}
+	if( fuse_opt_add_arg(
+	     &bdemount_fuse_arguments,
+	     MOUNT_FUSE_DEFAULT_OPTIONS ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable add fuse arguments.\n" );
+
+		goto on_error;
+	}
+	/* The default cache option conflicts with cache options in the extended
+	 * options, such as direct_io, hence it is only used when there are none
+	 */
+	result = 0;
+
+	if( option_extended_options != NULL )
+	{
+		result = mount_fuse_options_has_cache_option(
+		          option_extended_options,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine if extended options contain a cache option.\n" );
+
+			goto on_error;
+		}
+	}
+	if( result == 0 )
+	{
 		if( fuse_opt_add_arg(
 		     &bdemount_fuse_arguments,
-		     "" ) != 0 )
+		     "-o" ) != 0 )
 		{
 			fprintf(
 			 stderr,
@@ -488,6 +578,19 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
+		if( fuse_opt_add_arg(
+		     &bdemount_fuse_arguments,
+		     MOUNT_FUSE_DEFAULT_CACHE_OPTION ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable add fuse arguments.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_extended_options != NULL )
+	{
 		if( fuse_opt_add_arg(
 		     &bdemount_fuse_arguments,
 		     "-o" ) != 0 )
@@ -527,6 +630,7 @@ int main( int argc, char * const argv[] )
 	bdemount_fuse_operations.readdir    = &mount_fuse_readdir;
 	bdemount_fuse_operations.releasedir = &mount_fuse_releasedir;
 	bdemount_fuse_operations.getattr    = &mount_fuse_getattr;
+	bdemount_fuse_operations.init       = &mount_fuse_init;
 	bdemount_fuse_operations.destroy    = &mount_fuse_destroy;
 
 #if defined( HAVE_LIBFUSE3 )
@@ -598,8 +702,32 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
-	result = fuse_loop(
-	          bdemount_fuse_handle );
+	if( number_of_workers > 1 )
+	{
+		/* The FUSE multi-threaded loop starts worker threads on demand,
+		 * concurrent reads are limited by the number of volumes
+		 */
+#if defined( HAVE_LIBFUSE3 ) && ( FUSE_USE_VERSION >= 32 ) && ( FUSE_USE_VERSION < 312 )
+		bdemount_fuse_loop_config.clone_fd         = 0;
+		bdemount_fuse_loop_config.max_idle_threads = (unsigned int) number_of_workers;
+
+		result = fuse_loop_mt(
+		          bdemount_fuse_handle,
+		          &bdemount_fuse_loop_config );
+#elif defined( HAVE_LIBFUSE3 )
+		result = fuse_loop_mt(
+		          bdemount_fuse_handle,
+		          0 );
+#else
+		result = fuse_loop_mt(
+		          bdemount_fuse_handle );
+#endif
+	}
+	else
+	{
+		result = fuse_loop(
+		          bdemount_fuse_handle );
+	}
 
 	if( result != 0 )
 	{
@@ -647,9 +775,9 @@ int main( int argc, char * const argv[] )
 	bdemount_dokan_options.MountPoint = mount_point;
 
 #if DOKAN_MINIMUM_COMPATIBLE_VERSION >= 200
-	bdemount_dokan_options.SingleThread = TRUE;
+	bdemount_dokan_options.SingleThread = ( number_of_workers > 1 ) ? FALSE : TRUE;
 #else
-	bdemount_dokan_options.ThreadCount  = 0;
+	bdemount_dokan_options.ThreadCount  = (USHORT) ( ( number_of_workers > 1 ) ? number_of_workers : 0 );
 #endif
 	if( verbose != 0 )
 	{
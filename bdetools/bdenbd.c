@@ -0,0 +1,652 @@
+/*
+ * Exports a BitLocker Drive Encrypted (BDE) volume as a Network Block Device (NBD).
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "bdetools_getopt.h"
+#include "bdetools_i18n.h"
+#include "bdetools_libbde.h"
+#include "bdetools_libcerror.h"
+#include "bdetools_libclocale.h"
+#include "bdetools_libcnotify.h"
+#include "bdetools_output.h"
+#include "bdetools_signal.h"
+#include "bdetools_unused.h"
+#include "mount_handle.h"
+#include "nbd_server.h"
+
+#if defined( HAVE_SYS_SOCKET_H ) && !defined( WINAPI )
+#define HAVE_BDENBD_SOCKET_SUPPORT
+#endif
+
+mount_handle_t *bdenbd_mount_handle = NULL;
+nbd_server_t *bdenbd_nbd_server     = NULL;
+int bdenbd_abort                    = 0;
+
+/* Signal handler for bdenbd
+ */
+void bdenbd_signal_handler(
+      bdetools_signal_t signal BDETOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "bdenbd_signal_handler";
+
+	BDETOOLS_UNREFERENCED_PARAMETER( signal )
+
+	bdenbd_abort = 1;
+
+	if( bdenbd_nbd_server != NULL )
+	{
+		if( nbd_server_signal_abort(
+		     bdenbd_nbd_server,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal NBD server to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	if( bdenbd_mount_handle != NULL )
+	{
+		if( mount_handle_signal_abort(
+		     bdenbd_mount_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal mount handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use bdenbd to export a BitLocker Drive Encrypted (BDE) volume read-only "
+		"using the Network Block Device (NBD) protocol.";
+
+	bdetools_option_t options[ ] = {
+		{ 'h', NULL, "shows this help" },
+		{ 'k', "keys", "specify the full volume encryption key and tweak key formatted in base16 and separated by a : character e.g. FVEK:TWEAK" },
+		{ 'n', "export_name", "specify the name of the export, default is bde1" },
+		{ 'o', "offset", "specify the volume offset in bytes" },
+		{ 'p', "password", "specify the password (or passphrase)" },
+		{ 'P', "port", "specify the TCP port to listen on the loopback address, default is 10809" },
+		{ 'r', "recovery_password", "specify the recovery password (or passphrase)" },
+		{ 's', "startup_key_path", "specify the path of the file containing the startup key. Typically this file has the extension .BEK" },
+		{ 'S', "socket_path", "specify the path of an Unix domain socket to listen on instead of TCP" },
+		{ 'u', NULL, "unattended mode (disables user interaction)" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 'w', "number_of_workers", "specify the number of workers that handle read requests concurrently, where each worker reads from its own unlocked copy of the volume, default is 1" },
+		{ 0, "volume", "a BitLocker Drive Encrypted (BDE) volume" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libbde_error_t *error                        = NULL;
+	system_character_t *option_export_name       = NULL;
+	system_character_t *option_keys              = NULL;
+	system_character_t *option_number_of_workers = NULL;
+	system_character_t *option_offset            = NULL;
+	system_character_t *option_password          = NULL;
+	system_character_t *option_port              = NULL;
+	system_character_t *option_recovery_password = NULL;
+	system_character_t *option_socket_path       = NULL;
+	system_character_t *option_startup_key_path  = NULL;
+	system_character_t *source                   = NULL;
+	char *program                                = "bdenbd";
+	system_integer_t option                      = 0;
+	size_t string_length                         = 0;
+	uint64_t port                                = NBD_SERVER_DEFAULT_PORT;
+	int number_of_options                        = (int) ( sizeof( options ) / sizeof( bdetools_option_t ) );
+	int number_of_workers                        = 1;
+	int unattended_mode                          = 0;
+	int verbose                                  = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "bdetools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( bdetools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	bdetools_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( bdetools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = bdetools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				bdetools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				bdetools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'k':
+				option_keys = optarg;
+
+				break;
+
+			case (system_integer_t) 'n':
+				option_export_name = optarg;
+
+				break;
+
+			case (system_integer_t) 'o':
+				option_offset = optarg;
+
+				break;
+
+			case (system_integer_t) 'p':
+				option_password = optarg;
+
+				break;
+
+			case (system_integer_t) 'P':
+				option_port = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				option_recovery_password = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_startup_key_path = optarg;
+
+				break;
+
+			case (system_integer_t) 'S':
+				option_socket_path = optarg;
+
+				break;
+
+			case (system_integer_t) 'u':
+				unattended_mode = 1;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				bdetools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'w':
+				option_number_of_workers = optarg;
+
+				break;
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source volume.\n" );
+
+		bdetools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	if( ( option_port != NULL )
+	 && ( option_socket_path != NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Port and socket path cannot be combined.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libbde_notify_set_stream(
+	 stderr,
+	 NULL );
+	libbde_notify_set_verbose(
+	 verbose );
+
+	if( option_port != NULL )
+	{
+		string_length = system_string_length(
+		                 option_port );
+
+		if( ( mount_handle_system_string_copy_from_64_bit_in_decimal(
+		       option_port,
+		       string_length + 1,
+		       &port,
+		       &error ) != 1 )
+		 || ( port == 0 )
+		 || ( port > 65535 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported port: %" PRIs_SYSTEM ".\n",
+			 option_port );
+
+			goto on_error;
+		}
+	}
+	if( mount_handle_initialize(
+	     &bdenbd_mount_handle,
+	     unattended_mode,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize mount handle.\n" );
+
+		goto on_error;
+	}
+	if( option_keys != NULL )
+	{
+		if( mount_handle_set_keys(
+		     bdenbd_mount_handle,
+		     option_keys,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set keys.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_offset != NULL )
+	{
+		if( mount_handle_set_offset(
+		     bdenbd_mount_handle,
+		     option_offset,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set volume offset.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_number_of_workers != NULL )
+	{
+		if( mount_handle_set_number_of_workers(
+		     bdenbd_mount_handle,
+		     option_number_of_workers,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of workers.\n" );
+
+			goto on_error;
+		}
+		if( mount_handle_get_number_of_workers(
+		     bdenbd_mount_handle,
+		     &number_of_workers,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve number of workers.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_password != NULL )
+	{
+		if( mount_handle_set_password(
+		     bdenbd_mount_handle,
+		     option_password,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set password.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_recovery_password != NULL )
+	{
+		if( mount_handle_set_recovery_password(
+		     bdenbd_mount_handle,
+		     option_recovery_password,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set recovery password.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_startup_key_path != NULL )
+	{
+		if( mount_handle_set_startup_key(
+		     bdenbd_mount_handle,
+		     option_startup_key_path,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set startup key.\n" );
+
+			goto on_error;
+		}
+	}
+	if( mount_handle_open(
+	     bdenbd_mount_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source volume\n" );
+
+		goto on_error;
+	}
+	if( mount_handle_is_locked(
+	     bdenbd_mount_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to unlock source volume\n" );
+
+		goto on_error;
+	}
+#if defined( HAVE_BDENBD_SOCKET_SUPPORT )
+	/* On these platforms system_character_t is a narrow character
+	 */
+	if( nbd_server_initialize(
+	     &bdenbd_nbd_server,
+	     bdenbd_mount_handle->file_system,
+	     ( option_export_name != NULL ) ? (const char *) option_export_name : "bde1",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize NBD server.\n" );
+
+		goto on_error;
+	}
+	if( option_socket_path != NULL )
+	{
+		if( nbd_server_open_unix_socket(
+		     bdenbd_nbd_server,
+		     (const char *) option_socket_path,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to listen on socket: %" PRIs_SYSTEM ".\n",
+			 option_socket_path );
+
+			goto on_error;
+		}
+		fprintf(
+		 stdout,
+		 "Serving volume on socket: %" PRIs_SYSTEM "\n",
+		 option_socket_path );
+	}
+	else
+	{
+		if( nbd_server_open_tcp_socket(
+		     bdenbd_nbd_server,
+		     (uint16_t) port,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to listen on port: %" PRIu64 ".\n",
+			 port );
+
+			goto on_error;
+		}
+		fprintf(
+		 stdout,
+		 "Serving volume on: 127.0.0.1:%" PRIu64 "\n",
+		 port );
+	}
+	if( bdetools_signal_attach(
+	     bdenbd_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( nbd_server_run(
+	     bdenbd_nbd_server,
+	     number_of_workers,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to run NBD server.\n" );
+
+		goto on_error;
+	}
+	if( bdetools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( nbd_server_free(
+	     &bdenbd_nbd_server,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free NBD server.\n" );
+
+		goto on_error;
+	}
+	if( mount_handle_close(
+	     bdenbd_mount_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close mount handle.\n" );
+
+		goto on_error;
+	}
+	if( mount_handle_free(
+	     &bdenbd_mount_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free mount handle.\n" );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+#else
+	fprintf(
+	 stderr,
+	 "No socket support to export BitLocker Drive Encryption (BDE) volume.\n" );
+
+	goto on_error;
+
+#endif /* defined( HAVE_BDENBD_SOCKET_SUPPORT ) */
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( bdenbd_nbd_server != NULL )
+	{
+		nbd_server_free(
+		 &bdenbd_nbd_server,
+		 NULL );
+	}
+	if( bdenbd_mount_handle != NULL )
+	{
+		mount_handle_free(
+		 &bdenbd_mount_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,2218 @@
+/*
+ * Decrypt handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "bdetools_libbde.h"
+#include "bdetools_libcerror.h"
+#include "bdetools_libcfile.h"
+#include "bdetools_libcnotify.h"
+#include "bdetools_libcthreads.h"
+#include "bdetools_unused.h"
+#include "decrypt_handle.h"
+#include "hash_handle.h"
+#include "mount_file_system.h"
+#include "mount_handle.h"
+
+#if !defined( SEEK_SET )
+#define SEEK_SET	0
+#endif
+
+/* The checkpoint signature
+ */
+const uint8_t decrypt_handle_checkpoint_signature[ 8 ] = {
+	'b', 'd', 'e', 'c', 'k', 'p', 't', '2' };
+
+/* Creates a decrypt handle
+ * Make sure the value decrypt_handle is referencing, is set to NULL
+ * The first volume of the file system is decrypted
+ * Returns 1 if successful or -1 on error
+ */
+int decrypt_handle_initialize(
+     decrypt_handle_t **decrypt_handle,
+     mount_file_system_t *file_system,
+     uint8_t print_status,
+     libcerror_error_t **error )
+{
+	static char *function = "decrypt_handle_initialize";
+
+	if( decrypt_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decrypt handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decrypt_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decrypt handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	*decrypt_handle = memory_allocate_structure(
+	                   decrypt_handle_t );
+
+	if( *decrypt_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decrypt handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *decrypt_handle,
+	     0,
+	     sizeof( decrypt_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decrypt handle.",
+		 function );
+
+		memory_free(
+		 *decrypt_handle );
+
+		*decrypt_handle = NULL;
+
+		return( -1 );
+	}
+	( *decrypt_handle )->file_system   = file_system;
+	( *decrypt_handle )->block_size    = DECRYPT_HANDLE_DEFAULT_BLOCK_SIZE;
+	( *decrypt_handle )->write_sparse  = 1;
+	( *decrypt_handle )->print_status  = print_status;
+	( *decrypt_handle )->notify_stream = stdout;
+
+	if( mount_file_system_get_volume_by_index(
+	     file_system,
+	     0,
+	     &( ( *decrypt_handle )->bde_volume ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume: 0.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbde_volume_get_size(
+	     ( *decrypt_handle )->bde_volume,
+	     &( ( *decrypt_handle )->volume_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbde_volume_get_volume_identifier(
+	     ( *decrypt_handle )->bde_volume,
+	     ( *decrypt_handle )->volume_identifier,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume identifier.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *decrypt_handle != NULL )
+	{
+		memory_free(
+		 *decrypt_handle );
+
+		*decrypt_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a decrypt handle
+ * Returns 1 if successful or -1 on error
+ */
+int decrypt_handle_free(
+     decrypt_handle_t **decrypt_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "decrypt_handle_free";
+	int result            = 1;
+
+	if( decrypt_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decrypt handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decrypt_handle != NULL )
+	{
+		if( ( *decrypt_handle )->target_file != NULL )
+		{
+			if( decrypt_handle_close_target(
+			     *decrypt_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close target.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *decrypt_handle )->target_filename != NULL )
+		{
+			memory_free(
+			 ( *decrypt_handle )->target_filename );
+		}
+		if( ( *decrypt_handle )->checkpoint_filename != NULL )
+		{
+			memory_free(
+			 ( *decrypt_handle )->checkpoint_filename );
+		}
+		memory_free(
+		 *decrypt_handle );
+
+		*decrypt_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the decrypt handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int decrypt_handle_signal_abort(
+     decrypt_handle_t *decrypt_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "decrypt_handle_signal_abort";
+
+	if( decrypt_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decrypt handle.",
+		 function );
+
+		return( -1 );
+	}
+	decrypt_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Sets the block size
+ * Returns 1 if successful or -1 on error
+ */
+int decrypt_handle_set_block_size(
+     decrypt_handle_t *decrypt_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "decrypt_handle_set_block_size";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( decrypt_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decrypt handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( mount_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) DECRYPT_HANDLE_MAXIMUM_BLOCK_SIZE )
+	 || ( ( value_64bit % DECRYPT_HANDLE_BLOCK_SIZE_ALIGNMENT ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported block size.",
+		 function );
+
+		return( -1 );
+	}
+	decrypt_handle->block_size = (size_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Opens the target
+ * If a matching checkpoint exists of a previous run decryption is resumed
+ * Returns 1 if successful or -1 on error
+ */
+int decrypt_handle_open_target(
+     decrypt_handle_t *decrypt_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function     = "decrypt_handle_open_target";
+	size_t filename_length    = 0;
+	off64_t checkpoint_offset = 0;
+	int access_flags          = LIBCFILE_OPEN_WRITE_TRUNCATE;
+	int result                = 0;
+
+	if( decrypt_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decrypt handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( decrypt_handle->target_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decrypt handle - target file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	if( decrypt_handle->target_filename != NULL )
+	{
+		memory_free(
+		 decrypt_handle->target_filename );
+
+		decrypt_handle->target_filename = NULL;
+	}
+	if( decrypt_handle->checkpoint_filename != NULL )
+	{
+		memory_free(
+		 decrypt_handle->checkpoint_filename );
+
+		decrypt_handle->checkpoint_filename = NULL;
+	}
+	decrypt_handle->target_filename = system_string_allocate(
+	                                   filename_length + 1 );
+
+	if( decrypt_handle->target_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create target filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     decrypt_handle->target_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy target filename.",
+		 function );
+
+		goto on_error;
+	}
+	decrypt_handle->target_filename[ filename_length ] = 0;
+
+	decrypt_handle->checkpoint_filename = system_string_allocate(
+	                                       filename_length + 12 );
+
+	if( decrypt_handle->checkpoint_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create checkpoint filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     decrypt_handle->checkpoint_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     &( decrypt_handle->checkpoint_filename[ filename_length ] ),
+	     _SYSTEM_STRING( ".checkpoint" ),
+	     11 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy checkpoint filename extension.",
+		 function );
+
+		goto on_error;
+	}
+	decrypt_handle->checkpoint_filename[ filename_length + 11 ] = 0;
+
+	result = decrypt_handle_read_checkpoint(
+	          decrypt_handle,
+	          &checkpoint_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcfile_file_exists_wide(
+		          filename,
+		          error );
+#else
+		result = libcfile_file_exists(
+		          filename,
+		          error );
+#endif
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to determine if target exists.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			access_flags = LIBCFILE_OPEN_READ_WRITE;
+
+			decrypt_handle->resume_offset = checkpoint_offset;
+		}
+	}
+	if( libcfile_file_initialize(
+	     &( decrypt_handle->target_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize target file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          decrypt_handle->target_file,
+	          filename,
+	          access_flags,
+	          error );
+#else
+	result = libcfile_file_open(
+	          decrypt_handle->target_file,
+	          filename,
+	          access_flags,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open target file.",
+		 function );
+
+		goto on_error;
+	}
+	result = libcfile_file_is_device(
+	          decrypt_handle->target_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if target file is a device.",
+		 function );
+
+		goto on_error;
+	}
+	/* A device retains its previous content where blocks are skipped
+	 * hence only regular files are written sparse
+	 */
+	else if( result != 0 )
+	{
+		decrypt_handle->write_sparse = 0;
+	}
+	if( decrypt_handle->resume_offset > 0 )
+	{
+		/* Discard data written after the checkpoint so that skipped sparse
+		 * blocks are guaranteed to read back as 0-byte values
+		 */
+		if( decrypt_handle->write_sparse != 0 )
+		{
+			if( libcfile_file_resize(
+			     decrypt_handle->target_file,
+			     (size64_t) decrypt_handle->resume_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize target file.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libcfile_file_seek_offset(
+		     decrypt_handle->target_file,
+		     decrypt_handle->resume_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek resume offset: %" PRIi64 " (0x%08" PRIx64 ") in target file.",
+			 function,
+			 decrypt_handle->resume_offset,
+			 decrypt_handle->resume_offset );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( decrypt_handle->target_file != NULL )
+	{
+		libcfile_file_free(
+		 &( decrypt_handle->target_file ),
+		 NULL );
+	}
+	decrypt_handle->resume_offset = 0;
+
+	return( -1 );
+}
+
+/* Closes the target
+ * Returns the 0 if successful or -1 on error
+ */
+int decrypt_handle_close_target(
+     decrypt_handle_t *decrypt_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "decrypt_handle_close_target";
+	int result            = 0;
+
+	if( decrypt_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decrypt handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( decrypt_handle->target_file == NULL )
+	{
+		return( 0 );
+	}
+	if( libcfile_file_close(
+	     decrypt_handle->target_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close target file.",
+		 function );
+
+		result = -1;
+	}
+	if( libcfile_file_free(
+	     &( decrypt_handle->target_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free target file.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Synchronizes the data written to the target with the underlying storage
+ * libcfile does not provide a synchronize function, hence the target is
+ * opened again, which synchronizes the data of all its file handles
+ * Returns 1 if successful or -1 on error
+ */
+int decrypt_handle_sync_target(
+     decrypt_handle_t *decrypt_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "decrypt_handle_sync_target";
+
+#if defined( WINAPI )
+	HANDLE file_handle    = INVALID_HANDLE_VALUE;
+	DWORD error_code      = 0;
+#elif defined( HAVE_FSYNC ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int file_descriptor   = -1;
+#endif
+
+	if( decrypt_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decrypt handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( decrypt_handle->target_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid decrypt handle - missing target filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_handle = CreateFileW(
+	               (LPCWSTR) decrypt_handle->target_filename,
+	               GENERIC_WRITE,
+	               FILE_SHARE_READ | FILE_SHARE_WRITE,
+	               NULL,
+	               OPEN_EXISTING,
+	               FILE_ATTRIBUTE_NORMAL,
+	               NULL );
+#else
+	file_handle = CreateFileA(
+	               (LPCSTR) decrypt_handle->target_filename,
+	               GENERIC_WRITE,
+	               FILE_SHARE_READ | FILE_SHARE_WRITE,
+	               NULL,
+	               OPEN_EXISTING,
+	               FILE_ATTRIBUTE_NORMAL,
+	               NULL );
+#endif
+	if( file_handle == INVALID_HANDLE_VALUE )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 error_code,
+		 "%s: unable to open target file.",
+		 function );
+
+		return( -1 );
+	}
+	if( FlushFileBuffers(
+	     file_handle ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 error_code,
+		 "%s: unable to flush target file.",
+		 function );
+
+		CloseHandle(
+		 file_handle );
+
+		return( -1 );
+	}
+	if( CloseHandle(
+	     file_handle ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 error_code,
+		 "%s: unable to close target file.",
+		 function );
+
+		return( -1 );
+	}
+#elif defined( HAVE_FSYNC ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_descriptor = open(
+	                   decrypt_handle->target_filename,
+	                   O_WRONLY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open target file.",
+		 function );
+
+		return( -1 );
+	}
+	if( fsync(
+	     file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 errno,
+		 "%s: unable to synchronize target file.",
+		 function );
+
+		close(
+		 file_descriptor );
+
+		return( -1 );
+	}
+	if( close(
+	     file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close target file.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Reads the checkpoint
+ * The checkpoint is only used if it matches the volume identifier, volume size and block size
+ * Returns 1 if successful, 0 if no matching checkpoint is available or -1 on error
+ */
+int decrypt_handle_read_checkpoint(
+     decrypt_handle_t *decrypt_handle,
+     off64_t *checkpoint_offset,
+     libcerror_error_t **error )
+{
+	uint8_t checkpoint_data[ DECRYPT_HANDLE_CHECKPOINT_DATA_SIZE ];
+
+	libcfile_file_t *checkpoint_file = NULL;
+	static char *function            = "decrypt_handle_read_checkpoint";
+	ssize_t read_count               = 0;
+	uint64_t block_size              = 0;
+	uint64_t safe_checkpoint_offset  = 0;
+	uint64_t volume_size             = 0;
+	int result                       = 0;
+
+	if( decrypt_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decrypt handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( decrypt_handle->checkpoint_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid decrypt handle - missing checkpoint filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_exists_wide(
+	          decrypt_handle->checkpoint_filename,
+	          error );
+#else
+	result = libcfile_file_exists(
+	          decrypt_handle->checkpoint_filename,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if checkpoint file exists.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libcfile_file_initialize(
+	     &checkpoint_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize checkpoint file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          checkpoint_file,
+	          decrypt_handle->checkpoint_filename,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#else
+	result = libcfile_file_open(
+	          checkpoint_file,
+	          decrypt_handle->checkpoint_filename,
+	          LIBCFILE_OPEN_READ,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open checkpoint file.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libcfile_file_read_buffer(
+	              checkpoint_file,
+	              checkpoint_data,
+	              DECRYPT_HANDLE_CHECKPOINT_DATA_SIZE,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read checkpoint data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_close(
+	     checkpoint_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close checkpoint file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &checkpoint_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free checkpoint file.",
+		 function );
+
+		goto on_error;
+	}
+	if( read_count != (ssize_t) DECRYPT_HANDLE_CHECKPOINT_DATA_SIZE )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     checkpoint_data,
+	     decrypt_handle_checkpoint_signature,
+	     8 ) != 0 )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     &( checkpoint_data[ 8 ] ),
+	     decrypt_handle->volume_identifier,
+	     16 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 &( checkpoint_data[ 24 ] ),
+	 volume_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( checkpoint_data[ 32 ] ),
+	 block_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( checkpoint_data[ 40 ] ),
+	 safe_checkpoint_offset );
+
+	if( ( volume_size != (uint64_t) decrypt_handle->volume_size )
+	 || ( block_size != (uint64_t) decrypt_handle->block_size )
+	 || ( safe_checkpoint_offset > volume_size )
+	 || ( ( safe_checkpoint_offset % block_size ) != 0 ) )
+	{
+		return( 0 );
+	}
+	*checkpoint_offset = (off64_t) safe_checkpoint_offset;
+
+	return( 1 );
+
+on_error:
+	if( checkpoint_file != NULL )
+	{
+		libcfile_file_free(
+		 &checkpoint_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the checkpoint
+ * The checkpoint offset indicates the data before it was written to the target
+ * The target is synchronized first so that the checkpoint never refers to data
+ * that is not stored yet
+ * Returns 1 if successful or -1 on error
+ */
+int decrypt_handle_write_checkpoint(
+     decrypt_handle_t *decrypt_handle,
+     off64_t checkpoint_offset,
+     libcerror_error_t **error )
+{
+	uint8_t checkpoint_data[ DECRYPT_HANDLE_CHECKPOINT_DATA_SIZE ];
+
+	libcfile_file_t *checkpoint_file = NULL;
+	static char *function            = "decrypt_handle_write_checkpoint";
+	ssize_t write_count              = 0;
+	int result                       = 0;
+
+	if( decrypt_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decrypt handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( decrypt_handle->checkpoint_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid decrypt handle - missing checkpoint filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( checkpoint_offset < 0 )
+	 || ( (size64_t) checkpoint_offset > decrypt_handle->volume_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid checkpoint offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     checkpoint_data,
+	     decrypt_handle_checkpoint_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy checkpoint signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( checkpoint_data[ 8 ] ),
+	     decrypt_handle->volume_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy volume identifier.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 &( checkpoint_data[ 24 ] ),
+	 (uint64_t) decrypt_handle->volume_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( checkpoint_data[ 32 ] ),
+	 (uint64_t) decrypt_handle->block_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( checkpoint_data[ 40 ] ),
+	 (uint64_t) checkpoint_offset );
+
+	if( decrypt_handle->target_filename != NULL )
+	{
+		if( decrypt_handle_sync_target(
+		     decrypt_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to synchronize target.",
+			 function );
+
+			return( -1 );
+		}
+	}
+
+	if( libcfile_file_initialize(
+	     &checkpoint_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize checkpoint file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_open_wide(
+	          checkpoint_file,
+	          decrypt_handle->checkpoint_filename,
+	          LIBCFILE_OPEN_WRITE_TRUNCATE,
+	          error );
+#else
+	result = libcfile_file_open(
+	          checkpoint_file,
+	          decrypt_handle->checkpoint_filename,
+	          LIBCFILE_OPEN_WRITE_TRUNCATE,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open checkpoint file.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = libcfile_file_write_buffer(
+	               checkpoint_file,
+	               checkpoint_data,
+	               DECRYPT_HANDLE_CHECKPOINT_DATA_SIZE,
+	               error );
+
+	if( write_count != (ssize_t) DECRYPT_HANDLE_CHECKPOINT_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write checkpoint data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_close(
+	     checkpoint_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close checkpoint file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &checkpoint_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free checkpoint file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( checkpoint_file != NULL )
+	{
+		libcfile_file_free(
+		 &checkpoint_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Removes the checkpoint
+ * Returns 1 if successful or -1 on error
+ */
+int decrypt_handle_remove_checkpoint(
+     decrypt_handle_t *decrypt_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "decrypt_handle_remove_checkpoint";
+	int result            = 0;
+
+	if( decrypt_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decrypt handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( decrypt_handle->checkpoint_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid decrypt handle - missing checkpoint filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_exists_wide(
+	          decrypt_handle->checkpoint_filename,
+	          error );
+#else
+	result = libcfile_file_exists(
+	          decrypt_handle->checkpoint_filename,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if checkpoint file exists.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcfile_file_remove_wide(
+		          decrypt_handle->checkpoint_filename,
+		          error );
+#else
+		result = libcfile_file_remove(
+		          decrypt_handle->checkpoint_filename,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+			 "%s: unable to remove checkpoint file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines if the data only contains 0-byte values
+ * Returns 1 if the data is sparse or 0 if not
+ */
+int decrypt_handle_is_sparse_data(
+     const uint8_t *data,
+     size_t data_size )
+{
+	size_t data_offset = 0;
+
+	if( data == NULL )
+	{
+		return( 0 );
+	}
+	/* The data is compared per 64-bit value since blocks are allocated aligned
+	 */
+	while( ( data_offset + 8 ) <= data_size )
+	{
+		if( *( (uint64_t *) &( data[ data_offset ] ) ) != 0 )
+		{
+			return( 0 );
+		}
+		data_offset += 8;
+	}
+	while( data_offset < data_size )
+	{
+		if( data[ data_offset ] != 0 )
+		{
+			return( 0 );
+		}
+		data_offset++;
+	}
+	return( 1 );
+}
+
+/* Reads and decrypts a block
+ * Returns 1 if successful or -1 on error
+ */
+int decrypt_handle_decrypt_block(
+     decrypt_handle_t *decrypt_handle,
+     decrypt_block_t *decrypt_block,
+     libcerror_error_t **error )
+{
+	static char *function = "decrypt_handle_decrypt_block";
+	ssize_t read_count    = 0;
+
+	if( decrypt_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decrypt handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( decrypt_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decrypt block.",
+		 function );
+
+		return( -1 );
+	}
+	/* The read is handled by an idle reader volume, where every reader volume
+	 * has its own encryption context, and bypasses the sector data cache
+	 */
+	read_count = mount_file_system_read_buffer_at_offset(
+	              decrypt_handle->file_system,
+	              decrypt_handle->bde_volume,
+	              decrypt_block->data,
+	              decrypt_block->data_size,
+	              decrypt_block->offset,
+	              error );
+
+	if( read_count != (ssize_t) decrypt_block->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 decrypt_block->offset,
+		 decrypt_block->offset );
+
+		return( -1 );
+	}
+	decrypt_block->is_sparse = 0;
+
+	if( ( decrypt_handle->target_file != NULL )
+	 && ( decrypt_handle->write_sparse != 0 ) )
+	{
+		decrypt_block->is_sparse = (uint8_t) decrypt_handle_is_sparse_data(
+		                                      decrypt_block->data,
+		                                      decrypt_block->data_size );
+	}
+	return( 1 );
+}
+
+/* Callback function to decrypt a block by a worker
+ * Returns 1 if successful or -1 on error
+ */
+int decrypt_handle_block_callback(
+     decrypt_block_t *decrypt_block,
+     void *arguments BDETOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error         = NULL;
+	decrypt_handle_t *decrypt_handle = NULL;
+	static char *function            = "decrypt_handle_block_callback";
+	int result                       = 1;
+	int state                        = DECRYPT_BLOCK_STATE_DECRYPTED;
+
+	BDETOOLS_UNREFERENCED_PARAMETER( arguments )
+
+	if( decrypt_block == NULL )
+	{
+		return( -1 );
+	}
+	decrypt_handle = decrypt_block->decrypt_handle;
+
+	if( decrypt_handle->abort != 0 )
+	{
+		state = DECRYPT_BLOCK_STATE_FAILED;
+	}
+	else if( decrypt_handle_decrypt_block(
+	          decrypt_handle,
+	          decrypt_block,
+	          &error ) != 1 )
+	{
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to decrypt block.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+		libcerror_error_free(
+		 &error );
+
+		state  = DECRYPT_BLOCK_STATE_FAILED;
+		result = -1;
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     decrypt_handle->blocks_mutex,
+	     NULL ) == 1 )
+	{
+		decrypt_block->state = state;
+
+		libcthreads_condition_broadcast(
+		 decrypt_handle->blocks_condition,
+		 NULL );
+
+		libcthreads_mutex_release(
+		 decrypt_handle->blocks_mutex,
+		 NULL );
+	}
+#else
+	decrypt_block->state = state;
+#endif
+	return( result );
+}
+
+/* Writes a decrypted block to the target
+ * Sparse blocks are skipped when the target is written sparse
+ * Returns 1 if successful or -1 on error
+ */
+int decrypt_handle_write_block(
+     decrypt_handle_t *decrypt_handle,
+     decrypt_block_t *decrypt_block,
+     libcerror_error_t **error )
+{
+	static char *function = "decrypt_handle_write_block";
+	ssize_t write_count   = 0;
+
+	if( decrypt_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decrypt handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( decrypt_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decrypt block.",
+		 function );
+
+		return( -1 );
+	}
+	if( decrypt_block->is_sparse != 0 )
+	{
+		if( libcfile_file_seek_offset(
+		     decrypt_handle->target_file,
+		     decrypt_block->offset + decrypt_block->data_size,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek end of sparse block at offset: %" PRIi64 " (0x%08" PRIx64 ") in target file.",
+			 function,
+			 decrypt_block->offset,
+			 decrypt_block->offset );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	write_count = libcfile_file_write_buffer(
+	               decrypt_handle->target_file,
+	               decrypt_block->data,
+	               decrypt_block->data_size,
+	               error );
+
+	if( write_count != (ssize_t) decrypt_block->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write block at offset: %" PRIi64 " (0x%08" PRIx64 ") to target file.",
+		 function,
+		 decrypt_block->offset,
+		 decrypt_block->offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints the decryption status
+ */
+void decrypt_handle_print_status(
+      decrypt_handle_t *decrypt_handle,
+      off64_t write_offset,
+      int *last_percentage )
+{
+	int percentage = 100;
+
+	if( ( decrypt_handle == NULL )
+	 || ( decrypt_handle->print_status == 0 )
+	 || ( decrypt_handle->notify_stream == NULL )
+	 || ( last_percentage == NULL ) )
+	{
+		return;
+	}
+	if( decrypt_handle->volume_size > 0 )
+	{
+		percentage = (int) ( ( (uint64_t) write_offset * 100 ) / decrypt_handle->volume_size );
+	}
+	if( percentage == *last_percentage )
+	{
+		return;
+	}
+	*last_percentage = percentage;
+
+	fprintf(
+	 decrypt_handle->notify_stream,
+	 "Status: at %d%%, decrypted: %" PRIu64 " of %" PRIu64 " bytes.\n",
+	 percentage,
+	 (uint64_t) write_offset,
+	 decrypt_handle->volume_size );
+}
+
+/* Frees the blocks
+ * Returns 1 if successful or -1 on error
+ */
+int decrypt_handle_free_blocks(
+     decrypt_handle_t *decrypt_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "decrypt_handle_free_blocks";
+	int block_index       = 0;
+	int result            = 1;
+
+	if( decrypt_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decrypt handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( decrypt_handle->blocks != NULL )
+	{
+		for( block_index = 0;
+		     block_index < decrypt_handle->number_of_blocks;
+		     block_index++ )
+		{
+			if( decrypt_handle->blocks[ block_index ].data != NULL )
+			{
+				memory_free(
+				 decrypt_handle->blocks[ block_index ].data );
+			}
+		}
+		memory_free(
+		 decrypt_handle->blocks );
+
+		decrypt_handle->blocks           = NULL;
+		decrypt_handle->number_of_blocks = 0;
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( decrypt_handle->blocks_condition != NULL )
+	{
+		if( libcthreads_condition_free(
+		     &( decrypt_handle->blocks_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free blocks condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( decrypt_handle->blocks_mutex != NULL )
+	{
+		if( libcthreads_mutex_free(
+		     &( decrypt_handle->blocks_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free blocks mutex.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	return( result );
+}
+
+/* Decrypts the volume to the target and/or the hash handle
+ * The blocks are read and decrypted by the workers and hashed and written in order,
+ * a checkpoint is written periodically and when decryption to a target is aborted
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int decrypt_handle_decrypt(
+     decrypt_handle_t *decrypt_handle,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	decrypt_block_t *decrypt_block      = NULL;
+	static char *function               = "decrypt_handle_decrypt";
+	size64_t remaining_size             = 0;
+	uint64_t number_of_queued_blocks    = 0;
+	uint64_t number_of_written_blocks   = 0;
+	off64_t checkpoint_offset           = 0;
+	off64_t read_offset                 = 0;
+	off64_t write_offset                = 0;
+	int block_index                     = 0;
+	int last_percentage                 = -1;
+	int result                          = 1;
+
+	if( decrypt_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decrypt handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( decrypt_handle->target_file == NULL )
+	 && ( decrypt_handle->hash_handle == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid decrypt handle - missing target file and hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The hashes cannot be calculated over part of the data
+	 */
+	if( ( decrypt_handle->hash_handle != NULL )
+	 && ( decrypt_handle->resume_offset != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to calculate hashes when resuming decryption.",
+		 function );
+
+		return( -1 );
+	}
+	if( decrypt_handle->blocks != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decrypt handle - blocks value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers <= 0 )
+	 || ( number_of_workers > ( MOUNT_FILE_SYSTEM_MAXIMUM_NUMBER_OF_READER_VOLUMES + 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	decrypt_handle->number_of_blocks = number_of_workers * DECRYPT_HANDLE_NUMBER_OF_BLOCKS_PER_WORKER;
+
+	decrypt_handle->blocks = (decrypt_block_t *) memory_allocate(
+	                                              sizeof( decrypt_block_t ) * decrypt_handle->number_of_blocks );
+
+	if( decrypt_handle->blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create blocks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     decrypt_handle->blocks,
+	     0,
+	     sizeof( decrypt_block_t ) * decrypt_handle->number_of_blocks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear blocks.",
+		 function );
+
+		memory_free(
+		 decrypt_handle->blocks );
+
+		decrypt_handle->blocks = NULL;
+
+		goto on_error;
+	}
+	for( block_index = 0;
+	     block_index < decrypt_handle->number_of_blocks;
+	     block_index++ )
+	{
+		decrypt_block = &( decrypt_handle->blocks[ block_index ] );
+
+		decrypt_block->decrypt_handle = decrypt_handle;
+		decrypt_block->data           = (uint8_t *) memory_allocate(
+		                                             sizeof( uint8_t ) * decrypt_handle->block_size );
+
+		if( decrypt_block->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block: %d data.",
+			 function,
+			 block_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( number_of_workers > 1 )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( decrypt_handle->blocks_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize blocks mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_condition_initialize(
+		     &( decrypt_handle->blocks_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize blocks condition.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_thread_pool_create(
+		     &( decrypt_handle->workers_thread_pool ),
+		     NULL,
+		     number_of_workers,
+		     decrypt_handle->number_of_blocks,
+		     (int (*)(intptr_t *, void *)) &decrypt_handle_block_callback,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create workers thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT ) */
+
+	read_offset       = decrypt_handle->resume_offset;
+	write_offset      = decrypt_handle->resume_offset;
+	checkpoint_offset = decrypt_handle->resume_offset;
+
+	while( (size64_t) write_offset < decrypt_handle->volume_size )
+	{
+		if( decrypt_handle->abort != 0 )
+		{
+			result = 0;
+
+			break;
+		}
+		/* Keep the workers busy by queuing blocks until all blocks are in flight
+		 */
+		while( ( (size64_t) read_offset < decrypt_handle->volume_size )
+		    && ( ( number_of_queued_blocks - number_of_written_blocks ) < (uint64_t) decrypt_handle->number_of_blocks ) )
+		{
+			block_index   = (int) ( number_of_queued_blocks % decrypt_handle->number_of_blocks );
+			decrypt_block = &( decrypt_handle->blocks[ block_index ] );
+
+			remaining_size = decrypt_handle->volume_size - (size64_t) read_offset;
+
+			decrypt_block->offset    = read_offset;
+			decrypt_block->data_size = decrypt_handle->block_size;
+			decrypt_block->state     = DECRYPT_BLOCK_STATE_QUEUED;
+
+			if( remaining_size < (size64_t) decrypt_block->data_size )
+			{
+				decrypt_block->data_size = (size_t) remaining_size;
+			}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+			if( decrypt_handle->workers_thread_pool != NULL )
+			{
+				if( libcthreads_thread_pool_push(
+				     decrypt_handle->workers_thread_pool,
+				     (intptr_t *) decrypt_block,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push block onto workers thread pool.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			else
+#endif
+			{
+				if( decrypt_handle_decrypt_block(
+				     decrypt_handle,
+				     decrypt_block,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to decrypt block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 read_offset,
+					 read_offset );
+
+					goto on_error;
+				}
+				decrypt_block->state = DECRYPT_BLOCK_STATE_DECRYPTED;
+			}
+			read_offset += decrypt_block->data_size;
+
+			number_of_queued_blocks++;
+		}
+		/* Write the blocks in order
+		 */
+		block_index   = (int) ( number_of_written_blocks % decrypt_handle->number_of_blocks );
+		decrypt_block = &( decrypt_handle->blocks[ block_index ] );
+
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+		if( decrypt_handle->workers_thread_pool != NULL )
+		{
+			if( libcthreads_mutex_grab(
+			     decrypt_handle->blocks_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab blocks mutex.",
+				 function );
+
+				goto on_error;
+			}
+			while( decrypt_block->state == DECRYPT_BLOCK_STATE_QUEUED )
+			{
+				if( libcthreads_condition_wait(
+				     decrypt_handle->blocks_condition,
+				     decrypt_handle->blocks_mutex,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to wait for block.",
+					 function );
+
+					libcthreads_mutex_release(
+					 decrypt_handle->blocks_mutex,
+					 NULL );
+
+					goto on_error;
+				}
+			}
+			if( libcthreads_mutex_release(
+			     decrypt_handle->blocks_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release blocks mutex.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif /* defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT ) */
+
+		if( decrypt_block->state != DECRYPT_BLOCK_STATE_DECRYPTED )
+		{
+			if( decrypt_handle->abort != 0 )
+			{
+				result = 0;
+
+				break;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to decrypt block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 decrypt_block->offset,
+			 decrypt_block->offset );
+
+			goto on_error;
+		}
+		if( decrypt_handle->hash_handle != NULL )
+		{
+			if( hash_handle_update(
+			     decrypt_handle->hash_handle,
+			     decrypt_block->data,
+			     decrypt_block->data_size,
+			     decrypt_block->offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update hashes.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( decrypt_handle->target_file != NULL )
+		{
+			if( decrypt_handle_write_block(
+			     decrypt_handle,
+			     decrypt_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write block.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		decrypt_block->state = DECRYPT_BLOCK_STATE_FREE;
+
+		write_offset += decrypt_block->data_size;
+
+		number_of_written_blocks++;
+
+		if( ( decrypt_handle->checkpoint_filename != NULL )
+		 && ( ( write_offset - checkpoint_offset ) >= DECRYPT_HANDLE_CHECKPOINT_INTERVAL ) )
+		{
+			if( decrypt_handle_write_checkpoint(
+			     decrypt_handle,
+			     write_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write checkpoint.",
+				 function );
+
+				goto on_error;
+			}
+			checkpoint_offset = write_offset;
+		}
+		decrypt_handle_print_status(
+		 decrypt_handle,
+		 write_offset,
+		 &last_percentage );
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( decrypt_handle->workers_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( decrypt_handle->workers_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join workers thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	/* Without a target there is no checkpoint to maintain
+	 */
+	if( decrypt_handle->target_file != NULL )
+	{
+		if( result == 0 )
+		{
+			if( decrypt_handle_write_checkpoint(
+			     decrypt_handle,
+			     write_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write checkpoint.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			/* Extend the target when it ends with sparse blocks
+			 */
+			if( decrypt_handle->write_sparse != 0 )
+			{
+				if( libcfile_file_resize(
+				     decrypt_handle->target_file,
+				     decrypt_handle->volume_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_RESIZE_FAILED,
+					 "%s: unable to resize target file.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( decrypt_handle_remove_checkpoint(
+			     decrypt_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+				 "%s: unable to remove checkpoint.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( decrypt_handle_free_blocks(
+	     decrypt_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free blocks.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	decrypt_handle->abort = 1;
+
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( decrypt_handle->workers_thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &( decrypt_handle->workers_thread_pool ),
+		 NULL );
+	}
+#endif
+	/* Allow decryption to be resumed from the last block written
+	 */
+	if( ( decrypt_handle->checkpoint_filename != NULL )
+	 && ( write_offset > decrypt_handle->resume_offset ) )
+	{
+		decrypt_handle_write_checkpoint(
+		 decrypt_handle,
+		 write_offset,
+		 NULL );
+	}
+	decrypt_handle_free_blocks(
+	 decrypt_handle,
+	 NULL );
+
+	return( -1 );
+}
+
@@ -0,0 +1,266 @@
+/*
+ * Decrypt handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DECRYPT_HANDLE_H )
+#define _DECRYPT_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "bdetools_libbde.h"
+#include "bdetools_libcerror.h"
+#include "bdetools_libcfile.h"
+#include "bdetools_libcthreads.h"
+#include "hash_handle.h"
+#include "mount_file_system.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default block size
+ */
+#define DECRYPT_HANDLE_DEFAULT_BLOCK_SIZE		( 1024 * 1024 )
+
+/* The maximum block size
+ */
+#define DECRYPT_HANDLE_MAXIMUM_BLOCK_SIZE		( 256 * 1024 * 1024 )
+
+/* The block size alignment
+ */
+#define DECRYPT_HANDLE_BLOCK_SIZE_ALIGNMENT		4096
+
+/* The number of blocks in flight per worker
+ */
+#define DECRYPT_HANDLE_NUMBER_OF_BLOCKS_PER_WORKER	2
+
+/* The number of bytes written between checkpoints
+ */
+#define DECRYPT_HANDLE_CHECKPOINT_INTERVAL		( 256 * 1024 * 1024 )
+
+/* The size of the checkpoint data
+ */
+#define DECRYPT_HANDLE_CHECKPOINT_DATA_SIZE		48
+
+enum DECRYPT_BLOCK_STATES
+{
+	DECRYPT_BLOCK_STATE_FREE	= 0,
+	DECRYPT_BLOCK_STATE_QUEUED	= 1,
+	DECRYPT_BLOCK_STATE_DECRYPTED	= 2,
+	DECRYPT_BLOCK_STATE_FAILED	= 3
+};
+
+typedef struct decrypt_handle decrypt_handle_t;
+typedef struct decrypt_block decrypt_block_t;
+
+struct decrypt_block
+{
+	/* The decrypt handle
+	 */
+	decrypt_handle_t *decrypt_handle;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The offset of the data in the volume
+	 */
+	off64_t offset;
+
+	/* The size of the data
+	 */
+	size_t data_size;
+
+	/* The state
+	 */
+	int state;
+
+	/* Value to indicate the data only contains 0-byte values
+	 */
+	uint8_t is_sparse;
+};
+
+struct decrypt_handle
+{
+	/* The file system
+	 */
+	mount_file_system_t *file_system;
+
+	/* The BDE volume
+	 */
+	libbde_volume_t *bde_volume;
+
+	/* The volume identifier
+	 */
+	uint8_t volume_identifier[ 16 ];
+
+	/* The volume size
+	 */
+	size64_t volume_size;
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The target file
+	 */
+	libcfile_file_t *target_file;
+
+	/* The target filename
+	 */
+	system_character_t *target_filename;
+
+	/* The checkpoint filename
+	 */
+	system_character_t *checkpoint_filename;
+
+	/* Value to indicate sparse blocks are skipped instead of written
+	 */
+	uint8_t write_sparse;
+
+	/* The hash handle, which is updated with the decrypted data in order
+	 */
+	hash_handle_t *hash_handle;
+
+	/* The offset to resume decryption from
+	 */
+	off64_t resume_offset;
+
+	/* The blocks
+	 */
+	decrypt_block_t *blocks;
+
+	/* The number of blocks
+	 */
+	int number_of_blocks;
+
+	/* Value to indicate if the status should be printed
+	 */
+	uint8_t print_status;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	/* The workers thread pool
+	 */
+	libcthreads_thread_pool_t *workers_thread_pool;
+
+	/* The blocks mutex
+	 */
+	libcthreads_mutex_t *blocks_mutex;
+
+	/* The blocks condition
+	 */
+	libcthreads_condition_t *blocks_condition;
+#endif
+};
+
+int decrypt_handle_initialize(
+     decrypt_handle_t **decrypt_handle,
+     mount_file_system_t *file_system,
+     uint8_t print_status,
+     libcerror_error_t **error );
+
+int decrypt_handle_free(
+     decrypt_handle_t **decrypt_handle,
+     libcerror_error_t **error );
+
+int decrypt_handle_signal_abort(
+     decrypt_handle_t *decrypt_handle,
+     libcerror_error_t **error );
+
+int decrypt_handle_set_block_size(
+     decrypt_handle_t *decrypt_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int decrypt_handle_open_target(
+     decrypt_handle_t *decrypt_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int decrypt_handle_close_target(
+     decrypt_handle_t *decrypt_handle,
+     libcerror_error_t **error );
+
+int decrypt_handle_sync_target(
+     decrypt_handle_t *decrypt_handle,
+     libcerror_error_t **error );
+
+int decrypt_handle_read_checkpoint(
+     decrypt_handle_t *decrypt_handle,
+     off64_t *checkpoint_offset,
+     libcerror_error_t **error );
+
+int decrypt_handle_write_checkpoint(
+     decrypt_handle_t *decrypt_handle,
+     off64_t checkpoint_offset,
+     libcerror_error_t **error );
+
+int decrypt_handle_remove_checkpoint(
+     decrypt_handle_t *decrypt_handle,
+     libcerror_error_t **error );
+
+int decrypt_handle_is_sparse_data(
+     const uint8_t *data,
+     size_t data_size );
+
+int decrypt_handle_decrypt_block(
+     decrypt_handle_t *decrypt_handle,
+     decrypt_block_t *decrypt_block,
+     libcerror_error_t **error );
+
+int decrypt_handle_block_callback(
+     decrypt_block_t *decrypt_block,
+     void *arguments );
+
+int decrypt_handle_write_block(
+     decrypt_handle_t *decrypt_handle,
+     decrypt_block_t *decrypt_block,
+     libcerror_error_t **error );
+
+void decrypt_handle_print_status(
+      decrypt_handle_t *decrypt_handle,
+      off64_t write_offset,
+      int *last_percentage );
+
+int decrypt_handle_free_blocks(
+     decrypt_handle_t *decrypt_handle,
+     libcerror_error_t **error );
+
+int decrypt_handle_decrypt(
+     decrypt_handle_t *decrypt_handle,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DECRYPT_HANDLE_H ) */
+
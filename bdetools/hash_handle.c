@@ -0,0 +1,1065 @@
+/*
+ * Hash handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "bdetools_libcerror.h"
+#include "bdetools_libcnotify.h"
+#include "bdetools_libcthreads.h"
+#include "bdetools_libhmac.h"
+#include "bdetools_unused.h"
+#include "digest_hash.h"
+#include "hash_handle.h"
+
+/* Creates a hash handle
+ * Make sure the value hash_handle is referencing, is set to NULL
+ * If use_parallel_lanes is set every hash is calculated by its own thread
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_initialize(
+     hash_handle_t **hash_handle,
+     uint8_t use_parallel_lanes,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_handle_initialize";
+	int lane_index        = 0;
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*hash_handle = memory_allocate_structure(
+	                hash_handle_t );
+
+	if( *hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *hash_handle,
+	     0,
+	     sizeof( hash_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash handle.",
+		 function );
+
+		memory_free(
+		 *hash_handle );
+
+		*hash_handle = NULL;
+
+		return( -1 );
+	}
+	if( libhmac_md5_initialize(
+	     &( ( *hash_handle )->md5_context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize MD5 context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha1_initialize(
+	     &( ( *hash_handle )->sha1_context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize SHA1 context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha256_initialize(
+	     &( ( *hash_handle )->sha256_context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize SHA256 context.",
+		 function );
+
+		goto on_error;
+	}
+	for( lane_index = 0;
+	     lane_index < HASH_HANDLE_MAXIMUM_NUMBER_OF_LANES;
+	     lane_index++ )
+	{
+		( *hash_handle )->lanes[ lane_index ].hash_handle = *hash_handle;
+		( *hash_handle )->lanes[ lane_index ].type        = lane_index;
+	}
+	/* The chunk lane is only used when a hash list is written
+	 */
+	( *hash_handle )->number_of_lanes = HASH_LANE_TYPE_CHUNK;
+
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( use_parallel_lanes != 0 )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( ( *hash_handle )->lanes_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize lanes mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_condition_initialize(
+		     &( ( *hash_handle )->lanes_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize lanes condition.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_thread_pool_create(
+		     &( ( *hash_handle )->lanes_thread_pool ),
+		     NULL,
+		     HASH_HANDLE_MAXIMUM_NUMBER_OF_LANES,
+		     HASH_HANDLE_MAXIMUM_NUMBER_OF_LANES,
+		     (int (*)(intptr_t *, void *)) &hash_handle_lane_callback,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create lanes thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#else
+	BDETOOLS_UNREFERENCED_PARAMETER( use_parallel_lanes )
+#endif
+	return( 1 );
+
+on_error:
+	if( *hash_handle != NULL )
+	{
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+		if( ( *hash_handle )->lanes_condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( ( *hash_handle )->lanes_condition ),
+			 NULL );
+		}
+		if( ( *hash_handle )->lanes_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *hash_handle )->lanes_mutex ),
+			 NULL );
+		}
+#endif
+		if( ( *hash_handle )->sha256_context != NULL )
+		{
+			libhmac_sha256_free(
+			 &( ( *hash_handle )->sha256_context ),
+			 NULL );
+		}
+		if( ( *hash_handle )->sha1_context != NULL )
+		{
+			libhmac_sha1_free(
+			 &( ( *hash_handle )->sha1_context ),
+			 NULL );
+		}
+		if( ( *hash_handle )->md5_context != NULL )
+		{
+			libhmac_md5_free(
+			 &( ( *hash_handle )->md5_context ),
+			 NULL );
+		}
+		memory_free(
+		 *hash_handle );
+
+		*hash_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a hash handle
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_free(
+     hash_handle_t **hash_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_handle_free";
+	int result            = 1;
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_handle != NULL )
+	{
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+		if( ( *hash_handle )->lanes_thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *hash_handle )->lanes_thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join lanes thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *hash_handle )->lanes_condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *hash_handle )->lanes_condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free lanes condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *hash_handle )->lanes_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *hash_handle )->lanes_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free lanes mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( ( *hash_handle )->hash_list_stream != NULL )
+		{
+			if( hash_handle_close_hash_list(
+			     *hash_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close hash list.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libhmac_sha256_free(
+		     &( ( *hash_handle )->sha256_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free SHA256 context.",
+			 function );
+
+			result = -1;
+		}
+		if( libhmac_sha1_free(
+		     &( ( *hash_handle )->sha1_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free SHA1 context.",
+			 function );
+
+			result = -1;
+		}
+		if( libhmac_md5_free(
+		     &( ( *hash_handle )->md5_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free MD5 context.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *hash_handle );
+
+		*hash_handle = NULL;
+	}
+	return( result );
+}
+
+/* Opens the hash list
+ * The hash list contains the offset, size and SHA256 hash of every chunk
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_open_hash_list(
+     hash_handle_t *hash_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_handle_open_hash_list";
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_handle->hash_list_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash handle - hash list stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	hash_handle->hash_list_stream = file_stream_open_wide(
+	                                 filename,
+	                                 _SYSTEM_STRING( FILE_STREAM_OPEN_WRITE ) );
+#else
+	hash_handle->hash_list_stream = file_stream_open(
+	                                 filename,
+	                                 FILE_STREAM_OPEN_WRITE );
+#endif
+	if( hash_handle->hash_list_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open hash list: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	hash_handle->number_of_lanes = HASH_HANDLE_MAXIMUM_NUMBER_OF_LANES;
+
+	return( 1 );
+}
+
+/* Closes the hash list
+ * Returns the 0 if successful or -1 on error
+ */
+int hash_handle_close_hash_list(
+     hash_handle_t *hash_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_handle_close_hash_list";
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_handle->hash_list_stream != NULL )
+	{
+		if( file_stream_close(
+		     hash_handle->hash_list_stream ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close hash list.",
+			 function );
+
+			hash_handle->hash_list_stream = NULL;
+
+			return( -1 );
+		}
+		hash_handle->hash_list_stream = NULL;
+	}
+	hash_handle->number_of_lanes = HASH_LANE_TYPE_CHUNK;
+
+	return( 0 );
+}
+
+/* Updates the hash of a lane with the data of the current chunk
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_lane_update(
+     hash_lane_t *hash_lane,
+     libcerror_error_t **error )
+{
+	hash_handle_t *hash_handle = NULL;
+	static char *function      = "hash_handle_lane_update";
+	int result                 = 0;
+
+	if( hash_lane == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash lane.",
+		 function );
+
+		return( -1 );
+	}
+	hash_handle = hash_lane->hash_handle;
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hash lane - missing hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	switch( hash_lane->type )
+	{
+		case HASH_LANE_TYPE_MD5:
+			result = libhmac_md5_update(
+			          hash_handle->md5_context,
+			          hash_lane->data,
+			          hash_lane->data_size,
+			          error );
+			break;
+
+		case HASH_LANE_TYPE_SHA1:
+			result = libhmac_sha1_update(
+			          hash_handle->sha1_context,
+			          hash_lane->data,
+			          hash_lane->data_size,
+			          error );
+			break;
+
+		case HASH_LANE_TYPE_SHA256:
+			result = libhmac_sha256_update(
+			          hash_handle->sha256_context,
+			          hash_lane->data,
+			          hash_lane->data_size,
+			          error );
+			break;
+
+		case HASH_LANE_TYPE_CHUNK:
+			result = libhmac_sha256_calculate(
+			          hash_lane->data,
+			          hash_lane->data_size,
+			          hash_handle->chunk_hash,
+			          LIBHMAC_SHA256_HASH_SIZE,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported hash lane type: %d.",
+			 function,
+			 hash_lane->type );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update hash of lane: %d.",
+		 function,
+		 hash_lane->type );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Callback function to update the hash of a lane by a thread
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_lane_callback(
+     hash_lane_t *hash_lane,
+     void *arguments BDETOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "hash_handle_lane_callback";
+
+	BDETOOLS_UNREFERENCED_PARAMETER( arguments )
+
+	if( hash_lane == NULL )
+	{
+		return( -1 );
+	}
+	hash_lane->result = hash_handle_lane_update(
+	                     hash_lane,
+	                     &error );
+
+	if( hash_lane->result != 1 )
+	{
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to update hash lane.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     hash_lane->hash_handle->lanes_mutex,
+	     NULL ) == 1 )
+	{
+		hash_lane->hash_handle->number_of_busy_lanes -= 1;
+
+		libcthreads_condition_broadcast(
+		 hash_lane->hash_handle->lanes_condition,
+		 NULL );
+
+		libcthreads_mutex_release(
+		 hash_lane->hash_handle->lanes_mutex,
+		 NULL );
+	}
+#endif
+	return( hash_lane->result );
+}
+
+/* Updates the hashes with the next chunk of data
+ * The lanes are updated in parallel when a lanes thread pool is available,
+ * where every lane processes the chunks in order
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_update(
+     hash_handle_t *hash_handle,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t data_offset,
+     libcerror_error_t **error )
+{
+	system_character_t chunk_hash_string[ ( 2 * LIBHMAC_SHA256_HASH_SIZE ) + 1 ];
+
+	static char *function = "hash_handle_update";
+	int lane_index        = 0;
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_handle->hashes_finalized != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash handle - hashes already finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( lane_index = 0;
+	     lane_index < hash_handle->number_of_lanes;
+	     lane_index++ )
+	{
+		hash_handle->lanes[ lane_index ].data      = data;
+		hash_handle->lanes[ lane_index ].data_size = data_size;
+		hash_handle->lanes[ lane_index ].result    = 0;
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( hash_handle->lanes_thread_pool != NULL )
+	{
+		hash_handle->number_of_busy_lanes = hash_handle->number_of_lanes;
+
+		for( lane_index = 0;
+		     lane_index < hash_handle->number_of_lanes;
+		     lane_index++ )
+		{
+			if( libcthreads_thread_pool_push(
+			     hash_handle->lanes_thread_pool,
+			     (intptr_t *) &( hash_handle->lanes[ lane_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push lane: %d onto lanes thread pool.",
+				 function,
+				 lane_index );
+
+				break;
+			}
+		}
+		/* The data must remain available until every lane has processed it
+		 */
+		if( libcthreads_mutex_grab(
+		     hash_handle->lanes_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab lanes mutex.",
+			 function );
+
+			return( -1 );
+		}
+		/* Only wait for the lanes that were pushed
+		 */
+		if( lane_index < hash_handle->number_of_lanes )
+		{
+			hash_handle->number_of_busy_lanes -= hash_handle->number_of_lanes - lane_index;
+		}
+		while( hash_handle->number_of_busy_lanes > 0 )
+		{
+			if( libcthreads_condition_wait(
+			     hash_handle->lanes_condition,
+			     hash_handle->lanes_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to wait for lanes.",
+				 function );
+
+				libcthreads_mutex_release(
+				 hash_handle->lanes_mutex,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+		if( libcthreads_mutex_release(
+		     hash_handle->lanes_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release lanes mutex.",
+			 function );
+
+			return( -1 );
+		}
+		if( lane_index < hash_handle->number_of_lanes )
+		{
+			return( -1 );
+		}
+	}
+	else
+#endif /* defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT ) */
+	{
+		for( lane_index = 0;
+		     lane_index < hash_handle->number_of_lanes;
+		     lane_index++ )
+		{
+			hash_handle->lanes[ lane_index ].result = hash_handle_lane_update(
+			                                           &( hash_handle->lanes[ lane_index ] ),
+			                                           error );
+
+			if( hash_handle->lanes[ lane_index ].result != 1 )
+			{
+				break;
+			}
+		}
+	}
+	for( lane_index = 0;
+	     lane_index < hash_handle->number_of_lanes;
+	     lane_index++ )
+	{
+		if( hash_handle->lanes[ lane_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update lane: %d.",
+			 function,
+			 lane_index );
+
+			return( -1 );
+		}
+	}
+	if( hash_handle->hash_list_stream != NULL )
+	{
+		if( digest_hash_copy_to_string(
+		     hash_handle->chunk_hash,
+		     LIBHMAC_SHA256_HASH_SIZE,
+		     chunk_hash_string,
+		     ( 2 * LIBHMAC_SHA256_HASH_SIZE ) + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to create chunk hash string.",
+			 function );
+
+			return( -1 );
+		}
+		if( fprintf(
+		     hash_handle->hash_list_stream,
+		     "%" PRIi64 "\t%" PRIzu "\t%" PRIs_SYSTEM "\n",
+		     data_offset,
+		     data_size,
+		     chunk_hash_string ) < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write chunk hash to hash list.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Finalizes the hashes
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_finalize(
+     hash_handle_t *hash_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_handle_finalize";
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_handle->hashes_finalized != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash handle - hashes already finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhmac_md5_finalize(
+	     hash_handle->md5_context,
+	     hash_handle->md5_hash,
+	     LIBHMAC_MD5_HASH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to finalize MD5 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhmac_sha1_finalize(
+	     hash_handle->sha1_context,
+	     hash_handle->sha1_hash,
+	     LIBHMAC_SHA1_HASH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to finalize SHA1 hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhmac_sha256_finalize(
+	     hash_handle->sha256_context,
+	     hash_handle->sha256_hash,
+	     LIBHMAC_SHA256_HASH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to finalize SHA256 hash.",
+		 function );
+
+		return( -1 );
+	}
+	hash_handle->hashes_finalized = 1;
+
+	return( 1 );
+}
+
+/* Prints the hashes
+ * Returns 1 if successful or -1 on error
+ */
+int hash_handle_hashes_fprint(
+     hash_handle_t *hash_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	system_character_t hash_string[ ( 2 * LIBHMAC_SHA256_HASH_SIZE ) + 1 ];
+
+	static char *function = "hash_handle_hashes_fprint";
+
+	if( hash_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_handle->hashes_finalized == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hash handle - hashes not finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_hash_copy_to_string(
+	     hash_handle->md5_hash,
+	     LIBHMAC_MD5_HASH_SIZE,
+	     hash_string,
+	     ( 2 * LIBHMAC_SHA256_HASH_SIZE ) + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to create MD5 hash string.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stream,
+	 "MD5 hash calculated over data:\t\t%" PRIs_SYSTEM "\n",
+	 hash_string );
+
+	if( digest_hash_copy_to_string(
+	     hash_handle->sha1_hash,
+	     LIBHMAC_SHA1_HASH_SIZE,
+	     hash_string,
+	     ( 2 * LIBHMAC_SHA256_HASH_SIZE ) + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to create SHA1 hash string.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stream,
+	 "SHA1 hash calculated over data:\t\t%" PRIs_SYSTEM "\n",
+	 hash_string );
+
+	if( digest_hash_copy_to_string(
+	     hash_handle->sha256_hash,
+	     LIBHMAC_SHA256_HASH_SIZE,
+	     hash_string,
+	     ( 2 * LIBHMAC_SHA256_HASH_SIZE ) + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to create SHA256 hash string.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stream,
+	 "SHA256 hash calculated over data:\t%" PRIs_SYSTEM "\n",
+	 hash_string );
+
+	return( 1 );
+}
+
@@ -0,0 +1,187 @@
+/*
+ * Hash handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _HASH_HANDLE_H )
+#define _HASH_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "bdetools_libcerror.h"
+#include "bdetools_libcthreads.h"
+#include "bdetools_libhmac.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of hash lanes
+ */
+#define HASH_HANDLE_MAXIMUM_NUMBER_OF_LANES	4
+
+enum HASH_LANE_TYPES
+{
+	HASH_LANE_TYPE_MD5	= 0,
+	HASH_LANE_TYPE_SHA1	= 1,
+	HASH_LANE_TYPE_SHA256	= 2,
+	HASH_LANE_TYPE_CHUNK	= 3
+};
+
+typedef struct hash_handle hash_handle_t;
+typedef struct hash_lane hash_lane_t;
+
+struct hash_lane
+{
+	/* The hash handle
+	 */
+	hash_handle_t *hash_handle;
+
+	/* The type
+	 */
+	int type;
+
+	/* The data of the current chunk
+	 */
+	const uint8_t *data;
+
+	/* The size of the data of the current chunk
+	 */
+	size_t data_size;
+
+	/* The result of the last update
+	 */
+	int result;
+};
+
+struct hash_handle
+{
+	/* The MD5 context
+	 */
+	libhmac_md5_context_t *md5_context;
+
+	/* The SHA1 context
+	 */
+	libhmac_sha1_context_t *sha1_context;
+
+	/* The SHA256 context
+	 */
+	libhmac_sha256_context_t *sha256_context;
+
+	/* The MD5 hash
+	 */
+	uint8_t md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
+
+	/* The SHA1 hash
+	 */
+	uint8_t sha1_hash[ LIBHMAC_SHA1_HASH_SIZE ];
+
+	/* The SHA256 hash
+	 */
+	uint8_t sha256_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	/* The SHA256 hash of the current chunk
+	 */
+	uint8_t chunk_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	/* Value to indicate the hashes were finalized
+	 */
+	uint8_t hashes_finalized;
+
+	/* The hash list stream
+	 */
+	FILE *hash_list_stream;
+
+	/* The lanes
+	 */
+	hash_lane_t lanes[ HASH_HANDLE_MAXIMUM_NUMBER_OF_LANES ];
+
+	/* The number of lanes
+	 */
+	int number_of_lanes;
+
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	/* The lanes thread pool
+	 */
+	libcthreads_thread_pool_t *lanes_thread_pool;
+
+	/* The lanes mutex
+	 */
+	libcthreads_mutex_t *lanes_mutex;
+
+	/* The lanes condition
+	 */
+	libcthreads_condition_t *lanes_condition;
+
+	/* The number of lanes that are busy
+	 */
+	int number_of_busy_lanes;
+#endif
+};
+
+int hash_handle_initialize(
+     hash_handle_t **hash_handle,
+     uint8_t use_parallel_lanes,
+     libcerror_error_t **error );
+
+int hash_handle_free(
+     hash_handle_t **hash_handle,
+     libcerror_error_t **error );
+
+int hash_handle_open_hash_list(
+     hash_handle_t *hash_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int hash_handle_close_hash_list(
+     hash_handle_t *hash_handle,
+     libcerror_error_t **error );
+
+int hash_handle_lane_update(
+     hash_lane_t *hash_lane,
+     libcerror_error_t **error );
+
+int hash_handle_lane_callback(
+     hash_lane_t *hash_lane,
+     void *arguments );
+
+int hash_handle_update(
+     hash_handle_t *hash_handle,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t data_offset,
+     libcerror_error_t **error );
+
+int hash_handle_finalize(
+     hash_handle_t *hash_handle,
+     libcerror_error_t **error );
+
+int hash_handle_hashes_fprint(
+     hash_handle_t *hash_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _HASH_HANDLE_H ) */
+
@@ -1280,6 +1280,166 @@ int info_handle_close(
 	return( result );
 }
 
+/* Retrieves a string representation of the encryption method
+ * Returns a string or NULL if not available
+ */
+const char *info_handle_get_encryption_method_string(
+             uint16_t encryption_method )
+{
+	switch( encryption_method )
+	{
+		case LIBBDE_ENCRYPTION_METHOD_AES_128_CBC_DIFFUSER:
+			return( "AES-CBC 128-bit with Diffuser" );
+
+		case LIBBDE_ENCRYPTION_METHOD_AES_256_CBC_DIFFUSER:
+			return( "AES-CBC 256-bit with Diffuser" );
+
+		case LIBBDE_ENCRYPTION_METHOD_AES_128_CBC:
+			return( "AES-CBC 128-bit" );
+
+		case LIBBDE_ENCRYPTION_METHOD_AES_256_CBC:
+			return( "AES-CBC 256-bit" );
+
+		case LIBBDE_ENCRYPTION_METHOD_AES_128_XTS:
+			return( "AES-XTS 128-bit" );
+
+		case LIBBDE_ENCRYPTION_METHOD_AES_256_XTS:
+			return( "AES-XTS 256-bit" );
+
+		case LIBBDE_ENCRYPTION_METHOD_NONE:
+			return( "None" );
+
+		default:
+			break;
+	}
+	return( NULL );
+}
+
+/* Retrieves a string representation of the key protector type
+ * Returns a string or NULL if not available
+ */
+const char *info_handle_get_key_protector_type_string(
+             uint16_t key_protector_type )
+{
+	switch( key_protector_type )
+	{
+		case LIBBDE_KEY_PROTECTION_TYPE_CLEAR_KEY:
+			return( "Clear key" );
+
+		case LIBBDE_KEY_PROTECTION_TYPE_TPM:
+			return( "TPM" );
+
+		case LIBBDE_KEY_PROTECTION_TYPE_STARTUP_KEY:
+			return( "Startup key" );
+
+		case LIBBDE_KEY_PROTECTION_TYPE_TPM_AND_PIN:
+			return( "TPM and PIN" );
+
+		case LIBBDE_KEY_PROTECTION_TYPE_RECOVERY_PASSWORD:
+			return( "Recovery password" );
+
+		case LIBBDE_KEY_PROTECTION_TYPE_PASSWORD:
+			return( "Password" );
+
+		default:
+			break;
+	}
+	return( NULL );
+}
+
+/* Copies a GUID to a string
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_guid_copy_to_string(
+     const uint8_t *guid_data,
+     system_character_t *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	libfguid_identifier_t *guid = NULL;
+	static char *function       = "info_handle_guid_copy_to_string";
+	int result                  = 0;
+
+	if( libfguid_identifier_initialize(
+	     &guid,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create GUID.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfguid_identifier_copy_from_byte_stream(
+	     guid,
+	     guid_data,
+	     16,
+	     LIBFGUID_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy byte stream to GUID.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfguid_identifier_copy_to_utf16_string(
+		  guid,
+		  (uint16_t *) string,
+		  string_size,
+		  LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
+		  error );
+#else
+	result = libfguid_identifier_copy_to_utf8_string(
+		  guid,
+		  (uint8_t *) string,
+		  string_size,
+		  LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy GUID to string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfguid_identifier_free(
+	     &guid,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free GUID.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( guid != NULL )
+	{
+		libfguid_identifier_free(
+		 &guid,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Prints a FILETIME value
  * Returns 1 if successful or -1 on error
  */
@@ -1411,9 +1571,7 @@ int info_handle_guid_value_fprint(
 {
 	system_character_t guid_string[ 48 ];
 
-	libfguid_identifier_t *guid = NULL;
-	static char *function       = "info_handle_guid_value_fprint";
-	int result                  = 0;
+	static char *function = "info_handle_guid_value_fprint";
 
 	if( info_handle == NULL )
 	{
@@ -1426,51 +1584,11 @@ int info_handle_guid_value_fprint(
 
 		return( -1 );
 	}
-	if( libfguid_identifier_initialize(
-	     &guid,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create GUID.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfguid_identifier_copy_from_byte_stream(
-	     guid,
+	if( info_handle_guid_copy_to_string(
 	     guid_data,
-	     16,
-	     LIBFGUID_ENDIAN_LITTLE,
+	     guid_string,
+	     48,
 	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy byte stream to GUID.",
-		 function );
-
-		goto on_error;
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libfguid_identifier_copy_to_utf16_string(
-		  guid,
-		  (uint16_t *) guid_string,
-		  48,
-		  LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
-		  error );
-#else
-	result = libfguid_identifier_copy_to_utf8_string(
-		  guid,
-		  (uint8_t *) guid_string,
-		  48,
-		  LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
-		  error );
-#endif
-	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1479,7 +1597,7 @@ int info_handle_guid_value_fprint(
 		 "%s: unable to copy GUID to string.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	fprintf(
 	 info_handle->notify_stream,
@@ -1487,50 +1605,21 @@ int info_handle_guid_value_fprint(
 	 value_name,
 	 guid_string );
 
-	if( libfguid_identifier_free(
-	     &guid,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free GUID.",
-		 function );
-
-		goto on_error;
-	}
 	return( 1 );
-
-on_error:
-	if( guid != NULL )
-	{
-		libfguid_identifier_free(
-		 &guid,
-		 NULL );
-	}
-	return( -1 );
 }
 
-/* Prints the volume information to a stream
+/* Retrieves the volume values
+ * The volume values must be cleared with info_handle_clear_volume_values
  * Returns 1 if successful or -1 on error
  */
-int info_handle_volume_fprint(
+int info_handle_get_volume_values(
      info_handle_t *info_handle,
+     info_volume_values_t *volume_values,
      libcerror_error_t **error )
 {
-        system_character_t byte_size_string[ 16 ];
-	uint8_t guid_data[ 16 ];
-
 	libbde_key_protector_t *key_protector = NULL;
-	system_character_t *value_string      = NULL;
-	static char *function                 = "bdeinfo_volume_info_fprint";
-	size64_t volume_size                  = 0;
+	static char *function                 = "info_handle_get_volume_values";
 	size_t value_string_size              = 0;
-	uint64_t value_64bit                  = 0;
-	uint16_t encryption_method            = 0;
-	uint16_t key_protector_type           = 0;
-	int is_locked                         = 0;
 	int key_protector_index               = 0;
 	int number_of_key_protectors          = 0;
 	int result                            = 0;
@@ -1546,10 +1635,31 @@ int info_handle_volume_fprint(
 
 		return( -1 );
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "BitLocker Drive Encryption information:\n" );
+	if( volume_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume values.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     volume_values,
+	     0,
+	     sizeof( info_volume_values_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear volume values.",
+		 function );
 
+		return( -1 );
+	}
 	result = libbde_volume_is_locked(
 	          info_handle->volume,
 	          error );
@@ -1563,13 +1673,13 @@ int info_handle_volume_fprint(
 		 "%s: unable to determine if volume is locked.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	is_locked = result;
+	volume_values->is_locked = result;
 
 	if( libbde_volume_get_volume_identifier(
 	     info_handle->volume,
-	     guid_data,
+	     volume_values->volume_identifier,
 	     16,
 	     error ) != 1 )
 	{
@@ -1582,26 +1692,11 @@ int info_handle_volume_fprint(
 
 		goto on_error;
 	}
-	if( info_handle_guid_value_fprint(
-	     info_handle,
-	     "\tVolume identifier\t\t",
-	     guid_data,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-		 "%s: unable to print GUID value.",
-		 function );
-
-		goto on_error;
-	}
-	if( is_locked == 0 )
+	if( volume_values->is_locked == 0 )
 	{
 		if( libbde_volume_get_size(
 		     info_handle->volume,
-		     &volume_size,
+		     &( volume_values->volume_size ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1611,144 +1706,33 @@ int info_handle_volume_fprint(
 			 "%s: unable to retrieve volume size.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "\tSize\t\t\t\t: " );
-
-		result = byte_size_string_create(
-		          byte_size_string,
-		          16,
-		          volume_size,
-		          BYTE_SIZE_STRING_UNIT_MEBIBYTE,
-		          NULL );
-
-		if( result == 1 )
-		{
-			fprintf(
-			 info_handle->notify_stream,
-			 "%" PRIs_SYSTEM " (%" PRIu64 " bytes)",
-			 byte_size_string,
-			 volume_size );
-		}
-		else
-		{
-			fprintf(
-			 info_handle->notify_stream,
-			 "%" PRIu64 " bytes",
-			 volume_size );
-		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "\n" );
-	}
-	if( libbde_volume_get_encryption_method(
-	     info_handle->volume,
-	     &encryption_method,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve encryption method.",
-		 function );
+	}
+	if( libbde_volume_get_encryption_method(
+	     info_handle->volume,
+	     &( volume_values->encryption_method ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve encryption method.",
+		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tEncryption method\t\t: " );
-
-	switch( encryption_method )
-	{
-		case LIBBDE_ENCRYPTION_METHOD_AES_128_CBC_DIFFUSER:
-			fprintf(
-			 info_handle->notify_stream,
-			 "AES-CBC 128-bit with Diffuser" );
-
-			break;
-
-		case LIBBDE_ENCRYPTION_METHOD_AES_256_CBC_DIFFUSER:
-			fprintf(
-			 info_handle->notify_stream,
-			 "AES-CBC 256-bit with Diffuser" );
-
-			break;
-
-		case LIBBDE_ENCRYPTION_METHOD_AES_128_CBC:
-			fprintf(
-			 info_handle->notify_stream,
-			 "AES-CBC 128-bit" );
-
-			break;
-
-		case LIBBDE_ENCRYPTION_METHOD_AES_256_CBC:
-			fprintf(
-			 info_handle->notify_stream,
-			 "AES-CBC 256-bit" );
-
-			break;
-
-		case LIBBDE_ENCRYPTION_METHOD_AES_128_XTS:
-			fprintf(
-			 info_handle->notify_stream,
-			 "AES-XTS 128-bit" );
-
-			break;
-
-		case LIBBDE_ENCRYPTION_METHOD_AES_256_XTS:
-			fprintf(
-			 info_handle->notify_stream,
-			 "AES-XTS 256-bit" );
-
-			break;
-
-		case LIBBDE_ENCRYPTION_METHOD_NONE:
-			fprintf(
-			 info_handle->notify_stream,
-			 "None" );
-
-			break;
-
-		default:
-			fprintf(
-			 info_handle->notify_stream,
-			 "Unknown (0x%04" PRIx16 ")",
-			 encryption_method );
-
-			break;
-	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\n" );
-
 	if( libbde_volume_get_creation_time(
 	     info_handle->volume,
-	     &value_64bit,
+	     &( volume_values->creation_time ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve volume identifier.",
-		 function );
-
-		goto on_error;
-	}
-	if( info_handle_filetime_value_fprint(
-	     info_handle,
-	     "\tCreation time\t\t\t",
-	     value_64bit,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-		 "%s: unable to print FILETIME value.",
+		 "%s: unable to retrieve creation time.",
 		 function );
 
 		goto on_error;
@@ -1789,10 +1773,10 @@ int info_handle_volume_fprint(
 
 			goto on_error;
 		}
-		value_string = system_string_allocate(
-		                value_string_size );
+		volume_values->description = system_string_allocate(
+		                              value_string_size );
 
-		if( value_string == NULL )
+		if( volume_values->description == NULL )
 		{
 			libcerror_error_set(
 			 error,
@@ -1806,13 +1790,13 @@ int info_handle_volume_fprint(
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 		result = libbde_volume_get_utf16_description(
 		          info_handle->volume,
-		          (uint16_t *) value_string,
+		          (uint16_t *) volume_values->description,
 		          value_string_size,
 		          error );
 #else
 		result = libbde_volume_get_utf8_description(
 		          info_handle->volume,
-		          (uint8_t *) value_string,
+		          (uint8_t *) volume_values->description,
 		          value_string_size,
 		          error );
 #endif
@@ -1827,15 +1811,6 @@ int info_handle_volume_fprint(
 
 			goto on_error;
 		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "\tDescription\t\t\t: %" PRIs_SYSTEM "\n",
-		 value_string );
-
-		memory_free(
-		 value_string );
-
-		value_string = NULL;
 	}
 	if( libbde_volume_get_number_of_key_protectors(
 	     info_handle->volume,
@@ -1851,32 +1826,26 @@ int info_handle_volume_fprint(
 
 		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tNumber of key protectors\t: %d\n",
-	 number_of_key_protectors );
-
-	if( is_locked != 0 )
-	{
-		fprintf(
-		 info_handle->notify_stream,
-		 "\tIs locked\n" );
-	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\n" );
-
 	if( number_of_key_protectors > 0 )
 	{
+		volume_values->key_protectors = (info_key_protector_values_t *) memory_allocate(
+		                                                                 sizeof( info_key_protector_values_t ) * number_of_key_protectors );
+
+		if( volume_values->key_protectors == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create key protectors.",
+			 function );
+
+			goto on_error;
+		}
 		for( key_protector_index = 0;
 		     key_protector_index < number_of_key_protectors;
 		     key_protector_index++ )
 		{
-			fprintf(
-			 info_handle->notify_stream,
-			 "Key protector %d:\n",
-			 key_protector_index );
-
 			if( libbde_volume_get_key_protector_by_index(
 			     info_handle->volume,
 			     key_protector_index,
@@ -1895,7 +1864,7 @@ int info_handle_volume_fprint(
 			}
 			if( libbde_key_protector_get_identifier(
 			     key_protector,
-			     guid_data,
+			     volume_values->key_protectors[ key_protector_index ].identifier,
 			     16,
 			     error ) != 1 )
 			{
@@ -1909,24 +1878,9 @@ int info_handle_volume_fprint(
 
 				goto on_error;
 			}
-			if( info_handle_guid_value_fprint(
-			     info_handle,
-			     "\tIdentifier\t\t\t",
-			     guid_data,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print GUID value.",
-				 function );
-
-				goto on_error;
-			}
 			if( libbde_key_protector_get_type(
 			     key_protector,
-			     &key_protector_type,
+			     &( volume_values->key_protectors[ key_protector_index ].type ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -1939,66 +1893,6 @@ int info_handle_volume_fprint(
 
 				goto on_error;
 			}
-			fprintf(
-			 info_handle->notify_stream,
-			 "\tType\t\t\t\t: " );
-
-			switch( key_protector_type )
-			{
-				case LIBBDE_KEY_PROTECTION_TYPE_CLEAR_KEY:
-					fprintf(
-					 info_handle->notify_stream,
-					 "Clear key" );
-
-					break;
-
-				case LIBBDE_KEY_PROTECTION_TYPE_TPM:
-					fprintf(
-					 info_handle->notify_stream,
-					 "TPM" );
-
-					break;
-
-				case LIBBDE_KEY_PROTECTION_TYPE_STARTUP_KEY:
-					fprintf(
-					 info_handle->notify_stream,
-					 "Startup key" );
-
-					break;
-
-				case LIBBDE_KEY_PROTECTION_TYPE_TPM_AND_PIN:
-					fprintf(
-					 info_handle->notify_stream,
-					 "TPM and PIN" );
-
-					break;
-
-				case LIBBDE_KEY_PROTECTION_TYPE_RECOVERY_PASSWORD:
-					fprintf(
-					 info_handle->notify_stream,
-					 "Recovery password" );
-
-					break;
-
-				case LIBBDE_KEY_PROTECTION_TYPE_PASSWORD:
-					fprintf(
-					 info_handle->notify_stream,
-					 "Password" );
-
-					break;
-
-				default:
-					fprintf(
-					 info_handle->notify_stream,
-					 "Unknown (0x%04" PRIx16 ")",
-					 key_protector_type );
-
-					break;
-			}
-			fprintf(
-			 info_handle->notify_stream,
-			 "\n" );
-
 			if( libbde_key_protector_free(
 			     &key_protector,
 			     error ) != 1 )
@@ -2013,9 +1907,7 @@ int info_handle_volume_fprint(
 
 				goto on_error;
 			}
-			fprintf(
-			 info_handle->notify_stream,
-			 "\n" );
+			volume_values->number_of_key_protectors += 1;
 		}
 	}
 	return( 1 );
@@ -2027,11 +1919,706 @@ on_error:
 		 &key_protector,
 		 NULL );
 	}
-	if( value_string != NULL )
+	info_handle_clear_volume_values(
+	 volume_values,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Clears the volume values
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_clear_volume_values(
+     info_volume_values_t *volume_values,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_clear_volume_values";
+
+	if( volume_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume values.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_values->key_protectors != NULL )
 	{
 		memory_free(
-		 value_string );
+		 volume_values->key_protectors );
+
+		volume_values->key_protectors = NULL;
 	}
-	return( -1 );
+	if( volume_values->description != NULL )
+	{
+		memory_free(
+		 volume_values->description );
+
+		volume_values->description = NULL;
+	}
+	volume_values->number_of_key_protectors = 0;
+
+	return( 1 );
+}
+
+/* Prints a string as a JSON string value
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_json_string_fprint(
+     FILE *stream,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_json_string_fprint";
+	size_t string_index   = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stream,
+	 "\"" );
+
+	while( string[ string_index ] != 0 )
+	{
+		if( ( string[ string_index ] == (system_character_t) '"' )
+		 || ( string[ string_index ] == (system_character_t) '\\' ) )
+		{
+			fprintf(
+			 stream,
+			 "\\%" PRIc_SYSTEM "",
+			 string[ string_index ] );
+		}
+		else if( (uint32_t) string[ string_index ] < 0x20 )
+		{
+			fprintf(
+			 stream,
+			 "\\u%04" PRIx32 "",
+			 (uint32_t) string[ string_index ] );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "%" PRIc_SYSTEM "",
+			 string[ string_index ] );
+		}
+		string_index++;
+	}
+	fprintf(
+	 stream,
+	 "\"" );
+
+	return( 1 );
+}
+
+/* Prints the volume values as a single line JSON object
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_volume_values_json_fprint(
+     const info_volume_values_t *volume_values,
+     const system_character_t *source,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	system_character_t guid_string[ 48 ];
+
+	const char *value_string = NULL;
+	static char *function    = "info_handle_volume_values_json_fprint";
+	int key_protector_index  = 0;
+
+	if( volume_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume values.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stream,
+	 "{\"source\": " );
+
+	if( info_handle_json_string_fprint(
+	     stream,
+	     source,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print source.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_guid_copy_to_string(
+	     volume_values->volume_identifier,
+	     guid_string,
+	     48,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy volume identifier to string.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stream,
+	 ", \"volume_identifier\": \"%" PRIs_SYSTEM "\"",
+	 guid_string );
+
+	if( volume_values->is_locked == 0 )
+	{
+		fprintf(
+		 stream,
+		 ", \"size\": %" PRIu64 "",
+		 volume_values->volume_size );
+	}
+	fprintf(
+	 stream,
+	 ", \"encryption_method\": %" PRIu16 "",
+	 volume_values->encryption_method );
+
+	value_string = info_handle_get_encryption_method_string(
+	                volume_values->encryption_method );
+
+	if( value_string != NULL )
+	{
+		fprintf(
+		 stream,
+		 ", \"encryption_method_name\": \"%s\"",
+		 value_string );
+	}
+	fprintf(
+	 stream,
+	 ", \"creation_time\": %" PRIu64 "",
+	 volume_values->creation_time );
+
+	if( volume_values->description != NULL )
+	{
+		fprintf(
+		 stream,
+		 ", \"description\": " );
+
+		if( info_handle_json_string_fprint(
+		     stream,
+		     volume_values->description,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print description.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	fprintf(
+	 stream,
+	 ", \"is_locked\": %s, \"key_protectors\": [",
+	 ( volume_values->is_locked != 0 ) ? "true" : "false" );
+
+	for( key_protector_index = 0;
+	     key_protector_index < volume_values->number_of_key_protectors;
+	     key_protector_index++ )
+	{
+		if( info_handle_guid_copy_to_string(
+		     volume_values->key_protectors[ key_protector_index ].identifier,
+		     guid_string,
+		     48,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy key protector: %d identifier to string.",
+			 function,
+			 key_protector_index );
+
+			return( -1 );
+		}
+		fprintf(
+		 stream,
+		 "%s{\"identifier\": \"%" PRIs_SYSTEM "\", \"type\": %" PRIu16 "",
+		 ( key_protector_index > 0 ) ? ", " : "",
+		 guid_string,
+		 volume_values->key_protectors[ key_protector_index ].type );
+
+		value_string = info_handle_get_key_protector_type_string(
+		                volume_values->key_protectors[ key_protector_index ].type );
+
+		if( value_string != NULL )
+		{
+			fprintf(
+			 stream,
+			 ", \"type_name\": \"%s\"",
+			 value_string );
+		}
+		fprintf(
+		 stream,
+		 "}" );
+	}
+	fprintf(
+	 stream,
+	 "]}\n" );
+
+	return( 1 );
+}
+
+/* Prints an error as a single line JSON object
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_error_json_fprint(
+     const system_character_t *source,
+     const char *error_string,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_error_json_fprint";
+	size_t string_index   = 0;
+
+	if( error_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error string.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stream,
+	 "{\"source\": " );
+
+	if( info_handle_json_string_fprint(
+	     stream,
+	     source,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print source.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 stream,
+	 ", \"error\": \"" );
+
+	while( error_string[ string_index ] != 0 )
+	{
+		if( ( error_string[ string_index ] == '"' )
+		 || ( error_string[ string_index ] == '\\' ) )
+		{
+			fprintf(
+			 stream,
+			 "\\%c",
+			 error_string[ string_index ] );
+		}
+		else if( (uint8_t) error_string[ string_index ] < 0x20 )
+		{
+			fprintf(
+			 stream,
+			 "\\u%04" PRIx8 "",
+			 (uint8_t) error_string[ string_index ] );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "%c",
+			 error_string[ string_index ] );
+		}
+		string_index++;
+	}
+	fprintf(
+	 stream,
+	 "\"}\n" );
+
+	return( 1 );
+}
+
+/* Prints the volume information to a stream
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_volume_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	system_character_t byte_size_string[ 16 ];
+
+	info_volume_values_t volume_values;
+
+	const char *value_string = NULL;
+	static char *function    = "info_handle_volume_fprint";
+	int key_protector_index  = 0;
+	int result               = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "BitLocker Drive Encryption information:\n" );
+
+	if( info_handle_get_volume_values(
+	     info_handle,
+	     &volume_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume values.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_guid_value_fprint(
+	     info_handle,
+	     "\tVolume identifier\t\t",
+	     volume_values.volume_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print GUID value.",
+		 function );
+
+		goto on_error;
+	}
+	if( volume_values.is_locked == 0 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tSize\t\t\t\t: " );
+
+		result = byte_size_string_create(
+		          byte_size_string,
+		          16,
+		          volume_values.volume_size,
+		          BYTE_SIZE_STRING_UNIT_MEBIBYTE,
+		          NULL );
+
+		if( result == 1 )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "%" PRIs_SYSTEM " (%" PRIu64 " bytes)",
+			 byte_size_string,
+			 volume_values.volume_size );
+		}
+		else
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "%" PRIu64 " bytes",
+			 volume_values.volume_size );
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\n" );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tEncryption method\t\t: " );
+
+	value_string = info_handle_get_encryption_method_string(
+	                volume_values.encryption_method );
+
+	if( value_string != NULL )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "%s",
+		 value_string );
+	}
+	else
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "Unknown (0x%04" PRIx16 ")",
+		 volume_values.encryption_method );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	if( info_handle_filetime_value_fprint(
+	     info_handle,
+	     "\tCreation time\t\t\t",
+	     volume_values.creation_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print FILETIME value.",
+		 function );
+
+		goto on_error;
+	}
+	if( volume_values.description != NULL )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tDescription\t\t\t: %" PRIs_SYSTEM "\n",
+		 volume_values.description );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of key protectors\t: %d\n",
+	 volume_values.number_of_key_protectors );
+
+	if( volume_values.is_locked != 0 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tIs locked\n" );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	for( key_protector_index = 0;
+	     key_protector_index < volume_values.number_of_key_protectors;
+	     key_protector_index++ )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "Key protector %d:\n",
+		 key_protector_index );
+
+		if( info_handle_guid_value_fprint(
+		     info_handle,
+		     "\tIdentifier\t\t\t",
+		     volume_values.key_protectors[ key_protector_index ].identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print GUID value.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tType\t\t\t\t: " );
+
+		value_string = info_handle_get_key_protector_type_string(
+		                volume_values.key_protectors[ key_protector_index ].type );
+
+		if( value_string != NULL )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "%s",
+			 value_string );
+		}
+		else
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "Unknown (0x%04" PRIx16 ")",
+			 volume_values.key_protectors[ key_protector_index ].type );
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\n\n" );
+	}
+	if( info_handle_clear_volume_values(
+	     &volume_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear volume values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	info_handle_clear_volume_values(
+	 &volume_values,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Prints the volume statistics
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_statistics_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	uint64_t values[ LIBBDE_NUMBER_OF_STATISTICS_VALUES ];
+
+	static char *function = "info_handle_statistics_fprint";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbde_volume_get_statistics(
+	     info_handle->volume,
+	     values,
+	     LIBBDE_NUMBER_OF_STATISTICS_VALUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Statistics:\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of read calls\t\t: %" PRIu64 "\n",
+	 values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_READ_CALLS ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of cache hits\t\t: %" PRIu64 "\n",
+	 values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_CACHE_HITS ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of cache misses\t\t: %" PRIu64 "\n",
+	 values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_CACHE_MISSES ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of bytes read\t\t: %" PRIu64 "\n",
+	 values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_BYTES_READ ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of bytes decrypted\t: %" PRIu64 "\n",
+	 values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_BYTES_DECRYPTED ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tDecrypted AES-CBC\t\t: %" PRIu64 "\n",
+	 values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_BYTES_DECRYPTED_AES_CBC ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tDecrypted AES-CBC diffuser\t: %" PRIu64 "\n",
+	 values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_BYTES_DECRYPTED_AES_CBC_DIFFUSER ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tDecrypted AES-XTS\t\t: %" PRIu64 "\n",
+	 values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_BYTES_DECRYPTED_AES_XTS ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tRead time\t\t\t: %" PRIu64 " ns\n",
+	 values[ LIBBDE_STATISTICS_VALUE_READ_TIME ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tDecryption time\t\t\t: %" PRIu64 " ns\n",
+	 values[ LIBBDE_STATISTICS_VALUE_DECRYPTION_TIME ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tUnlock time\t\t\t: %" PRIu64 " ns\n",
+	 values[ LIBBDE_STATISTICS_VALUE_UNLOCK_TIME ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of block cache hits\t: %" PRIu64 "\n",
+	 values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_BLOCK_CACHE_HITS ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of block cache misses\t: %" PRIu64 "\n",
+	 values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_BLOCK_CACHE_MISSES ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of warmup bytes\t\t: %" PRIu64 "\n",
+	 values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_WARMUP_BYTES ] );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
 }
 
@@ -35,6 +35,54 @@ extern "C" {
 #endif
 
 typedef struct info_handle info_handle_t;
+typedef struct info_key_protector_values info_key_protector_values_t;
+typedef struct info_volume_values info_volume_values_t;
+
+struct info_key_protector_values
+{
+	/* The identifier
+	 */
+	uint8_t identifier[ 16 ];
+
+	/* The type
+	 */
+	uint16_t type;
+};
+
+struct info_volume_values
+{
+	/* The volume identifier
+	 */
+	uint8_t volume_identifier[ 16 ];
+
+	/* Value to indicate if the volume is locked
+	 */
+	int is_locked;
+
+	/* The volume size, which is only available if the volume is unlocked
+	 */
+	size64_t volume_size;
+
+	/* The encryption method
+	 */
+	uint16_t encryption_method;
+
+	/* The creation time
+	 */
+	uint64_t creation_time;
+
+	/* The description
+	 */
+	system_character_t *description;
+
+	/* The number of key protectors
+	 */
+	int number_of_key_protectors;
+
+	/* The key protectors
+	 */
+	info_key_protector_values_t *key_protectors;
+};
 
 struct info_handle
 {
@@ -148,6 +196,18 @@ int info_handle_close(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+const char *info_handle_get_encryption_method_string(
+             uint16_t encryption_method );
+
+const char *info_handle_get_key_protector_type_string(
+             uint16_t key_protector_type );
+
+int info_handle_guid_copy_to_string(
+     const uint8_t *guid_data,
+     system_character_t *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
 int info_handle_filetime_value_fprint(
      info_handle_t *info_handle,
      const char *value_name,
@@ -160,10 +220,40 @@ int info_handle_guid_value_fprint(
      const uint8_t *guid_data,
      libcerror_error_t **error );
 
+int info_handle_get_volume_values(
+     info_handle_t *info_handle,
+     info_volume_values_t *volume_values,
+     libcerror_error_t **error );
+
+int info_handle_clear_volume_values(
+     info_volume_values_t *volume_values,
+     libcerror_error_t **error );
+
+int info_handle_json_string_fprint(
+     FILE *stream,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int info_handle_volume_values_json_fprint(
+     const info_volume_values_t *volume_values,
+     const system_character_t *source,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int info_handle_error_json_fprint(
+     const system_character_t *source,
+     const char *error_string,
+     FILE *stream,
+     libcerror_error_t **error );
+
 int info_handle_volume_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_statistics_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
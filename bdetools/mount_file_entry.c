@@ -904,7 +904,8 @@ ssize_t mount_file_entry_read_buffer_at_offset(
 
 		return( -1 );
 	}
-	read_count = libbde_volume_read_buffer_at_offset(
+	read_count = mount_file_system_read_buffer_at_offset(
+	              file_entry->file_system,
 	              file_entry->bde_volume,
 	              buffer,
 	              buffer_size,
@@ -39,6 +39,8 @@
 #include "bdetools_libbde.h"
 #include "bdetools_libcdata.h"
 #include "bdetools_libcerror.h"
+#include "bdetools_libcthreads.h"
+#include "bdetools_unused.h"
 #include "mount_file_system.h"
 
 /* Creates a file system
@@ -120,6 +122,8 @@ int mount_file_system_initialize(
 
 		return( -1 );
 	}
+	( *file_system )->streaming_read_size = MOUNT_FILE_SYSTEM_STREAMING_READ_SIZE;
+
 	if( libcdata_array_initialize(
 	     &( ( *file_system )->volumes_array ),
 	     0,
@@ -134,6 +138,20 @@ int mount_file_system_initialize(
 
 		goto on_error;
 	}
+	if( libcdata_array_initialize(
+	     &( ( *file_system )->reader_volumes_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize reader volumes array.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( WINAPI )
 	if( memory_set(
 	     &systemtime,
@@ -213,6 +231,20 @@ int mount_file_system_initialize(
 on_error:
 	if( *file_system != NULL )
 	{
+		if( ( *file_system )->reader_volumes_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *file_system )->reader_volumes_array ),
+			 NULL,
+			 NULL );
+		}
+		if( ( *file_system )->volumes_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *file_system )->volumes_array ),
+			 NULL,
+			 NULL );
+		}
 		memory_free(
 		 *file_system );
 
@@ -263,6 +295,39 @@ int mount_file_system_free(
 
 			result = -1;
 		}
+		if( libcdata_array_free(
+		     &( ( *file_system )->reader_volumes_array ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free reader volumes array.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+		if( ( *file_system )->idle_volumes_queue != NULL )
+		{
+			if( libcthreads_queue_free(
+			     &( ( *file_system )->idle_volumes_queue ),
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free idle volumes queue.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
 		memory_free(
 		 *file_system );
 
@@ -343,6 +408,55 @@ int mount_file_system_signal_abort(
 			return( -1 );
 		}
 	}
+	if( libcdata_array_get_number_of_entries(
+	     file_system->reader_volumes_array,
+	     &number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of reader volumes.",
+		 function );
+
+		return( -1 );
+	}
+	for( volume_index = number_of_volumes - 1;
+	     volume_index >= 0;
+	     volume_index-- )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     file_system->reader_volumes_array,
+		     volume_index,
+		     (intptr_t **) &bde_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve reader volume: %d.",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+		if( libbde_volume_signal_abort(
+		     bde_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal reader volume: %d to abort.",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -755,6 +869,518 @@ int mount_file_system_append_volume(
 	return( 1 );
 }
 
+/* Retrieves the number of reader volumes
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_get_number_of_reader_volumes(
+     mount_file_system_t *file_system,
+     int *number_of_reader_volumes,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_get_number_of_reader_volumes";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     file_system->reader_volumes_array,
+	     number_of_reader_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of reader volumes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific reader volume
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_get_reader_volume_by_index(
+     mount_file_system_t *file_system,
+     int reader_volume_index,
+     libbde_volume_t **bde_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_get_reader_volume_by_index";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     file_system->reader_volumes_array,
+	     reader_volume_index,
+	     (intptr_t **) bde_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve reader volume: %d.",
+		 function,
+		 reader_volume_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a reader volume to the file system
+ * A reader volume is an additional volume opened on the same source as the first volume.
+ * Reads of the first volume are distributed over the first volume and the reader volumes,
+ * so that they can be handled concurrently.
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_append_reader_volume(
+     mount_file_system_t *file_system,
+     libbde_volume_t *bde_volume,
+     libcerror_error_t **error )
+{
+	static char *function             = "mount_file_system_append_reader_volume";
+
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	libbde_volume_t *first_bde_volume = NULL;
+	int entry_index                   = 0;
+	int number_of_reader_volumes      = 0;
+#endif
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( bde_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( libcdata_array_get_number_of_entries(
+	     file_system->reader_volumes_array,
+	     &number_of_reader_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of reader volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_reader_volumes >= MOUNT_FILE_SYSTEM_MAXIMUM_NUMBER_OF_READER_VOLUMES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of reader volumes value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->idle_volumes_queue == NULL )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     file_system->volumes_array,
+		     0,
+		     (intptr_t **) &first_bde_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first volume.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcthreads_queue_initialize(
+		     &( file_system->idle_volumes_queue ),
+		     MOUNT_FILE_SYSTEM_MAXIMUM_NUMBER_OF_READER_VOLUMES + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create idle volumes queue.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcthreads_queue_push(
+		     file_system->idle_volumes_queue,
+		     (intptr_t *) first_bde_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push first volume onto idle volumes queue.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_append_entry(
+	     file_system->reader_volumes_array,
+	     &entry_index,
+	     (intptr_t *) bde_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append reader volume to array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_queue_push(
+	     file_system->idle_volumes_queue,
+	     (intptr_t *) bde_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push reader volume onto idle volumes queue.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: reader volumes require multi-threading support.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT ) */
+}
+
+/* Empties the reader volumes
+ * The idle volumes queue is freed so that reads of the first volume are no longer
+ * handled by the reader volumes, the reader volumes are freed using volume_free_function
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_empty_reader_volumes(
+     mount_file_system_t *file_system,
+     int (*volume_free_function)(
+            libbde_volume_t **bde_volume,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_empty_reader_volumes";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( file_system->idle_volumes_queue != NULL )
+	{
+		if( libcthreads_queue_free(
+		     &( file_system->idle_volumes_queue ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free idle volumes queue.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( libcdata_array_empty(
+	     file_system->reader_volumes_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) volume_free_function,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty reader volumes array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the streaming read size
+ * Reads of at least the streaming read size bypass the sector data cache
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_set_streaming_read_size(
+     mount_file_system_t *file_system,
+     size_t streaming_read_size,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_set_streaming_read_size";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( streaming_read_size == 0 )
+	 || ( streaming_read_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid streaming read size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_system->streaming_read_size = streaming_read_size;
+
+	return( 1 );
+}
+
+/* Retrieves the read flags for a read of a specific size
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_get_read_flags(
+     mount_file_system_t *file_system,
+     size_t read_size,
+     uint8_t *read_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_get_read_flags";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read flags.",
+		 function );
+
+		return( -1 );
+	}
+	*read_flags = 0;
+
+	if( read_size >= file_system->streaming_read_size )
+	{
+		*read_flags = LIBBDE_READ_FLAG_STREAMING;
+	}
+	return( 1 );
+}
+
+/* Reads data of a volume at a specific offset
+ * If the file system has reader volumes, reads of the first volume are handled
+ * by an idle volume, otherwise the read waits for a volume to become idle.
+ * Reads of at least the streaming read size bypass the sector data cache
+ * and are decrypted directly into the buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t mount_file_system_read_buffer_at_offset(
+         mount_file_system_t *file_system,
+         libbde_volume_t *bde_volume,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libbde_volume_t *read_bde_volume  = NULL;
+	static char *function             = "mount_file_system_read_buffer_at_offset";
+	ssize_t read_count                = 0;
+	uint8_t read_flags                = 0;
+
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	libbde_volume_t *first_bde_volume = NULL;
+	int is_pooled                     = 0;
+#endif
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_system_get_read_flags(
+	     file_system,
+	     buffer_size,
+	     &read_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve read flags.",
+		 function );
+
+		return( -1 );
+	}
+	read_bde_volume = bde_volume;
+
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( file_system->idle_volumes_queue != NULL )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     file_system->volumes_array,
+		     0,
+		     (intptr_t **) &first_bde_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first volume.",
+			 function );
+
+			return( -1 );
+		}
+		is_pooled = ( bde_volume == first_bde_volume );
+	}
+	if( is_pooled != 0 )
+	{
+		if( libcthreads_queue_pop(
+		     file_system->idle_volumes_queue,
+		     (intptr_t **) &read_bde_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop volume from idle volumes queue.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT ) */
+
+	read_count = libbde_volume_read_buffer_at_offset_with_flags(
+	              read_bde_volume,
+	              buffer,
+	              buffer_size,
+	              offset,
+	              read_flags,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") from volume.",
+		 function,
+		 offset,
+		 offset );
+
+		read_count = -1;
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( is_pooled != 0 )
+	{
+		if( libcthreads_queue_push(
+		     file_system->idle_volumes_queue,
+		     (intptr_t *) read_bde_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push volume onto idle volumes queue.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT ) */
+
+	return( read_count );
+}
+
 /* Retrieves the path from a volume index.
  * Returns 1 if successful or -1 on error
  */
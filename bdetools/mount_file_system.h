@@ -27,11 +27,33 @@
 
 #include "bdetools_libcdata.h"
 #include "bdetools_libcerror.h"
+#include "bdetools_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The maximum number of reader volumes
+ * Every reader volume is a separately opened volume with its own open file,
+ * metadata, copy of the keys and sector data caches, which is up to 24 sectors
+ * of decrypted data. The reader volumes do not share this data, hence their
+ * number is limited to the maximum number of read workers of the library
+ */
+#define MOUNT_FILE_SYSTEM_MAXIMUM_NUMBER_OF_READER_VOLUMES	16
+
+/* The maximum size of a read request
+ * This corresponds with the FUSE max_read option
+ */
+#define MOUNT_FILE_SYSTEM_MAXIMUM_READ_SIZE			1048576
+
+/* The default minimum read size for which the sector data is not cached
+ * Only sequential reads, for which the kernel reads ahead, result in read
+ * requests of the largest size the kernel sends, these are already cached
+ * by the kernel. The FUSE kernel module splits reads into requests of at most
+ * 32 pages by default, regardless of the max_read option
+ */
+#define MOUNT_FILE_SYSTEM_STREAMING_READ_SIZE			131072
+
 typedef struct mount_file_system mount_file_system_t;
 
 struct mount_file_system
@@ -51,6 +73,22 @@ struct mount_file_system
 	/* The volumes array
 	 */
 	libcdata_array_t *volumes_array;
+
+	/* The reader volumes array
+	 * Contains additional volumes opened on the same source as the first volume
+	 */
+	libcdata_array_t *reader_volumes_array;
+
+	/* The minimum read size for which the sector data is not cached
+	 */
+	size_t streaming_read_size;
+
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	/* The idle volumes queue
+	 * Contains the first volume and the reader volumes that are not being read
+	 */
+	libcthreads_queue_t *idle_volumes_queue;
+#endif
 };
 
 int mount_file_system_initialize(
@@ -99,6 +137,48 @@ int mount_file_system_append_volume(
      libbde_volume_t *bde_volume,
      libcerror_error_t **error );
 
+int mount_file_system_get_number_of_reader_volumes(
+     mount_file_system_t *file_system,
+     int *number_of_reader_volumes,
+     libcerror_error_t **error );
+
+int mount_file_system_get_reader_volume_by_index(
+     mount_file_system_t *file_system,
+     int reader_volume_index,
+     libbde_volume_t **bde_volume,
+     libcerror_error_t **error );
+
+int mount_file_system_append_reader_volume(
+     mount_file_system_t *file_system,
+     libbde_volume_t *bde_volume,
+     libcerror_error_t **error );
+
+int mount_file_system_empty_reader_volumes(
+     mount_file_system_t *file_system,
+     int (*volume_free_function)(
+            libbde_volume_t **bde_volume,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int mount_file_system_set_streaming_read_size(
+     mount_file_system_t *file_system,
+     size_t streaming_read_size,
+     libcerror_error_t **error );
+
+int mount_file_system_get_read_flags(
+     mount_file_system_t *file_system,
+     size_t read_size,
+     uint8_t *read_flags,
+     libcerror_error_t **error );
+
+ssize_t mount_file_system_read_buffer_at_offset(
+         mount_file_system_t *file_system,
+         libbde_volume_t *bde_volume,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 int mount_file_system_get_path_from_volume_index(
      mount_file_system_t *file_system,
      int volume_index,
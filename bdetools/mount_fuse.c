@@ -148,6 +148,69 @@ int mount_fuse_set_stat_info(
 	return( 1 );
 }
 
+/* Determines if the options contain an option that controls the kernel page cache
+ * The options are a comma separated list such as passed with -o
+ * Returns 1 if the options contain a cache option, 0 if not or -1 on error
+ */
+int mount_fuse_options_has_cache_option(
+     const char *options,
+     libcerror_error_t **error )
+{
+	const char *cache_options[ 4 ] = {
+		"auto_cache",
+		"direct_io",
+		"kernel_cache",
+		"noauto_cache" };
+
+	static char *function          = "mount_fuse_options_has_cache_option";
+	size_t cache_option_length     = 0;
+	size_t option_length           = 0;
+	size_t options_index           = 0;
+	size_t option_start_index      = 0;
+	int cache_option_index         = 0;
+
+	if( options == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid options.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		if( ( options[ options_index ] == ',' )
+		 || ( options[ options_index ] == 0 ) )
+		{
+			option_length = options_index - option_start_index;
+
+			for( cache_option_index = 0;
+			     cache_option_index < 4;
+			     cache_option_index++ )
+			{
+				cache_option_length = narrow_string_length(
+				                       cache_options[ cache_option_index ] );
+
+				if( ( option_length == cache_option_length )
+				 && ( narrow_string_compare(
+				       &( options[ option_start_index ] ),
+				       cache_options[ cache_option_index ],
+				       cache_option_length ) == 0 ) )
+				{
+					return( 1 );
+				}
+			}
+			option_start_index = options_index + 1;
+		}
+	}
+	while( options[ options_index++ ] != 0 );
+
+	return( 0 );
+}
+
 /* Fills a directory entry
  * Returns 1 if successful or -1 on error
  */
@@ -1342,6 +1405,92 @@ on_error:
 	return( result );
 }
 
+/* Initializes the file system
+ * Returns the private data of the FUSE context
+ */
+#if defined( HAVE_LIBFUSE3 )
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_information,
+       struct fuse_config *configuration BDETOOLS_ATTRIBUTE_UNUSED )
+#else
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_information )
+#endif
+{
+	struct fuse_context *fuse_context = NULL;
+	libcerror_error_t *error          = NULL;
+	static char *function             = "mount_fuse_init";
+	size_t streaming_read_size        = 0;
+
+#if defined( HAVE_LIBFUSE3 )
+	BDETOOLS_UNREFERENCED_PARAMETER( configuration )
+#endif
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s\n",
+		 function );
+	}
+#endif
+	if( connection_information != NULL )
+	{
+		/* The kernel proposes the maximum read-ahead it supports, read-ahead
+		 * requests are never larger than this or the maximum read size,
+		 * hence the largest requests are the ones of sequential reads
+		 */
+		streaming_read_size = (size_t) connection_information->max_readahead;
+
+#if defined( HAVE_LIBFUSE3 )
+		if( ( connection_information->max_read != 0 )
+		 && ( (size_t) connection_information->max_read < streaming_read_size ) )
+		{
+			streaming_read_size = (size_t) connection_information->max_read;
+		}
+#endif
+		if( streaming_read_size > MOUNT_FILE_SYSTEM_STREAMING_READ_SIZE )
+		{
+			streaming_read_size = MOUNT_FILE_SYSTEM_STREAMING_READ_SIZE;
+		}
+		if( ( streaming_read_size > 0 )
+		 && ( bdemount_mount_handle != NULL ) )
+		{
+			if( mount_handle_set_streaming_read_size(
+			     bdemount_mount_handle,
+			     streaming_read_size,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set streaming read size.",
+				 function );
+
+				libcnotify_print_error_backtrace(
+				 error );
+				libcerror_error_free(
+				 &error );
+			}
+		}
+		/* Allow the kernel to read ahead in large requests, the kernel limits
+		 * the read-ahead to the maximum it supports
+		 */
+		if( connection_information->max_readahead < MOUNT_FUSE_MAXIMUM_READ_SIZE )
+		{
+			connection_information->max_readahead = MOUNT_FUSE_MAXIMUM_READ_SIZE;
+		}
+	}
+	fuse_context = fuse_get_context();
+
+	if( fuse_context == NULL )
+	{
+		return( NULL );
+	}
+	return( fuse_context->private_data );
+}
+
 /* Cleans up when fuse is done
  */
 void mount_fuse_destroy(
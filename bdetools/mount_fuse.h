@@ -74,6 +74,31 @@ typedef struct stat mount_fuse_stat_t;
 
 #if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
 
+/* The maximum size of a read request
+ */
+#define MOUNT_FUSE_MAXIMUM_READ_SIZE		MOUNT_FILE_SYSTEM_MAXIMUM_READ_SIZE
+
+#define MOUNT_FUSE_STRING( value )		#value
+#define MOUNT_FUSE_VALUE_STRING( value )	MOUNT_FUSE_STRING( value )
+
+/* The default FUSE cache option
+ * The decrypted volume does not change while mounted, hence the data can be
+ * kept cached by the kernel. The option is only used when the extended options
+ * do not contain a cache option, such as direct_io, since these conflict
+ */
+#define MOUNT_FUSE_DEFAULT_CACHE_OPTION		"kernel_cache"
+
+/* The default FUSE options
+ * The attributes can be kept cached by the kernel for as long as possible
+ */
+#define MOUNT_FUSE_DEFAULT_TIMEOUT_OPTIONS	"attr_timeout=86400,entry_timeout=86400,negative_timeout=86400"
+
+#if defined( __linux__ )
+#define MOUNT_FUSE_DEFAULT_OPTIONS		MOUNT_FUSE_DEFAULT_TIMEOUT_OPTIONS ",max_read=" MOUNT_FUSE_VALUE_STRING( MOUNT_FUSE_MAXIMUM_READ_SIZE )
+#else
+#define MOUNT_FUSE_DEFAULT_OPTIONS		MOUNT_FUSE_DEFAULT_TIMEOUT_OPTIONS
+#endif
+
 int mount_fuse_set_stat_info(
      mount_fuse_stat_t *stat_info,
      size64_t size,
@@ -83,6 +108,10 @@ int mount_fuse_set_stat_info(
      int64_t modification_time,
      libcerror_error_t **error );
 
+int mount_fuse_options_has_cache_option(
+     const char *options,
+     libcerror_error_t **error );
+
 int mount_fuse_filldir(
      void *buffer,
      mount_fuse_fill_dir_t filler,
@@ -142,6 +171,15 @@ int mount_fuse_getattr(
      mount_fuse_stat_t *stat_info );
 #endif
 
+#if defined( HAVE_LIBFUSE3 )
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_information,
+       struct fuse_config *configuration );
+#else
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_information );
+#endif
+
 void mount_fuse_destroy(
       void *private_data );
 
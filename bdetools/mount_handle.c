@@ -29,6 +29,7 @@
 #include "bdetools_input.h"
 #include "bdetools_libbde.h"
 #include "bdetools_libbfio.h"
+#include "bdetools_libcdata.h"
 #include "bdetools_libcerror.h"
 #include "bdetools_libcpath.h"
 #include "bdetools_libcsplit.h"
@@ -239,14 +240,35 @@ int mount_handle_initialize(
 
 		goto on_error;
 	}
-	( *mount_handle )->notify_stream   = MOUNT_HANDLE_NOTIFY_STREAM;
-	( *mount_handle )->unattended_mode = unattended_mode;
+	if( libcdata_array_initialize(
+	     &( ( *mount_handle )->reader_file_io_handles_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize reader file IO handles array.",
+		 function );
+
+		goto on_error;
+	}
+	( *mount_handle )->notify_stream     = MOUNT_HANDLE_NOTIFY_STREAM;
+	( *mount_handle )->unattended_mode   = unattended_mode;
+	( *mount_handle )->number_of_workers = 1;
 
 	return( 1 );
 
 on_error:
 	if( *mount_handle != NULL )
 	{
+		if( ( *mount_handle )->file_system != NULL )
+		{
+			mount_file_system_free(
+			 &( ( *mount_handle )->file_system ),
+			 NULL );
+		}
 		memory_free(
 		 *mount_handle );
 
@@ -307,6 +329,20 @@ int mount_handle_free(
 
 			result = -1;
 		}
+		if( libcdata_array_free(
+		     &( ( *mount_handle )->reader_file_io_handles_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libbfio_handle_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free reader file IO handles array.",
+			 function );
+
+			result = -1;
+		}
 		if( memory_set(
 		     ( *mount_handle )->key_data,
 		     0,
@@ -768,6 +804,105 @@ int mount_handle_set_offset(
 	return( 1 );
 }
 
+/* Sets the number of workers
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_set_number_of_workers(
+     mount_handle_t *mount_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_set_number_of_workers";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( mount_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > ( MOUNT_FILE_SYSTEM_MAXIMUM_NUMBER_OF_READER_VOLUMES + 1 ) ) )
+#else
+	if( value_64bit != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of workers.",
+		 function );
+
+		return( -1 );
+	}
+	mount_handle->number_of_workers = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Retrieves the number of workers
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_get_number_of_workers(
+     mount_handle_t *mount_handle,
+     int *number_of_workers,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_get_number_of_workers";
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of workers.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_workers = mount_handle->number_of_workers;
+
+	return( 1 );
+}
+
 /* Sets the password
  * Returns 1 if successful or -1 on error
  */
@@ -929,22 +1064,15 @@ int mount_handle_set_path_prefix(
 	return( 1 );
 }
 
-/* Opens the mount handle
- * Returns 1 if successful, 0 if not or -1 on error
+/* Sets the minimum read size for which the sector data is not cached
+ * Returns 1 if successful or -1 on error
  */
-int mount_handle_open(
+int mount_handle_set_streaming_read_size(
      mount_handle_t *mount_handle,
-     const system_character_t *filename,
+     size_t streaming_read_size,
      libcerror_error_t **error )
 {
-	system_character_t password[ 64 ];
-
-	libbde_volume_t *bde_volume      = NULL;
-	libbfio_handle_t *file_io_handle = NULL;
-	static char *function            = "mount_handle_open";
-	size_t filename_length           = 0;
-	size_t password_length           = 0;
-	int result                       = 0;
+	static char *function = "mount_handle_set_streaming_read_size";
 
 	if( mount_handle == NULL )
 	{
@@ -957,83 +1085,43 @@ int mount_handle_open(
 
 		return( -1 );
 	}
-	if( filename == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
-		 function );
-
-		return( -1 );
-	}
-	filename_length = system_string_length(
-	                   filename );
-
-	if( libbfio_file_range_initialize(
-	     &file_io_handle,
+	if( mount_file_system_set_streaming_read_size(
+	     mount_handle->file_system,
+	     streaming_read_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set streaming read size.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libbfio_file_range_set_name_wide(
-	     file_io_handle,
-	     filename,
-	     filename_length,
-	     error ) != 1 )
-#else
-	if( libbfio_file_range_set_name(
-	     file_io_handle,
-	     filename,
-	     filename_length,
-	     error ) != 1 )
-#endif
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to set file range name.",
-		 function );
+	return( 1 );
+}
 
-		goto on_error;
-	}
-	if( libbfio_file_range_set(
-	     file_io_handle,
-	     mount_handle->volume_offset,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to set file range offset.",
-		 function );
+/* Sets the credentials, such as the keys and passwords, of a volume
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_set_volume_credentials(
+     mount_handle_t *mount_handle,
+     libbde_volume_t *bde_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_set_volume_credentials";
 
-		goto on_error;
-	}
-	if( libbde_volume_initialize(
-	     &bde_volume,
-	     error ) != 1 )
+	if( mount_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize volume.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( mount_handle->full_volume_encryption_key_size > 0 )
 	{
@@ -1052,7 +1140,7 @@ int mount_handle_open(
 			 "%s: unable to set keys.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
 	if( mount_handle->password != NULL )
@@ -1078,7 +1166,7 @@ int mount_handle_open(
 			 "%s: unable to set password.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
 	if( mount_handle->recovery_password != NULL )
@@ -1104,7 +1192,7 @@ int mount_handle_open(
 			 "%s: unable to set recovery password.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
 	if( mount_handle->startup_key_path != NULL )
@@ -1128,41 +1216,166 @@ int mount_handle_open(
 			 "%s: unable to read startup key.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	if( libbde_volume_open_file_io_handle(
-	     bde_volume,
-	     file_io_handle,
-	     LIBBDE_OPEN_READ,
-	     error ) != 1 )
+	return( 1 );
+}
+
+/* Opens the mount handle
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int mount_handle_open(
+     mount_handle_t *mount_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	system_character_t password[ 64 ];
+
+	libbde_volume_t *bde_volume       = NULL;
+	libbde_volume_t *first_bde_volume = NULL;
+	libbfio_handle_t *file_io_handle  = NULL;
+	static char *function             = "mount_handle_open";
+	size_t filename_length            = 0;
+	size_t password_length            = 0;
+	int result                        = 0;
+	int worker_index                  = 0;
+
+	if( mount_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open volume.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	result = libbde_volume_is_locked(
-	          bde_volume,
-	          error );
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
 
-	if( result == -1 )
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	if( libbfio_file_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if volume is locked.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	else if( ( result != 0 )
-	      && ( mount_handle->unattended_mode == 0 ) )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_range_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_range_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to set file range name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_range_set(
+	     file_io_handle,
+	     mount_handle->volume_offset,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to set file range offset.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbde_volume_initialize(
+	     &bde_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( mount_handle_set_volume_credentials(
+	     mount_handle,
+	     bde_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set volume credentials.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbde_volume_open_file_io_handle(
+	     bde_volume,
+	     file_io_handle,
+	     LIBBDE_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	result = libbde_volume_is_locked(
+	          bde_volume,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if volume is locked.",
+		 function );
+
+		goto on_error;
+	}
+	else if( ( result != 0 )
+	      && ( mount_handle->unattended_mode == 0 ) )
 	{
 		fprintf(
 		 stdout,
@@ -1209,10 +1422,6 @@ int mount_handle_open(
 
 				goto on_error;
 			}
-			memory_set(
-			 password,
-			 0,
-			 64 );
 		}
 		fprintf(
 		 stdout,
@@ -1269,9 +1478,48 @@ int mount_handle_open(
 	}
 	mount_handle->file_io_handle = file_io_handle;
 
+	first_bde_volume = bde_volume;
+	bde_volume       = NULL;
+	file_io_handle   = NULL;
+
+	/* Every additional worker reads from its own volume, hence the volume
+	 * is opened once more for every additional worker, using the keys of
+	 * the first volume
+	 */
+	for( worker_index = 1;
+	     worker_index < mount_handle->number_of_workers;
+	     worker_index++ )
+	{
+		if( mount_handle_open_reader_volume(
+		     mount_handle,
+		     filename,
+		     first_bde_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open reader volume: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+	memory_set(
+	 password,
+	 0,
+	 64 );
+
 	return( 1 );
 
 on_error:
+	memory_set(
+	 password,
+	 0,
+	 64 );
+
 	if( bde_volume != NULL )
 	{
 		libbde_volume_free(
@@ -1287,6 +1535,294 @@ on_error:
 	return( -1 );
 }
 
+/* Opens an additional volume on the same source to read concurrently
+ * The volume is unlocked with the keys of the first volume, which must be unlocked,
+ * so that the keys are not derived from the credentials again
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_open_reader_volume(
+     mount_handle_t *mount_handle,
+     const system_character_t *filename,
+     libbde_volume_t *first_bde_volume,
+     libcerror_error_t **error )
+{
+	libbde_volume_t *bde_volume      = NULL;
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "mount_handle_open_reader_volume";
+	size_t filename_length           = 0;
+	int entry_index                  = 0;
+	int result                       = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_bde_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first volume.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	if( libbfio_file_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_range_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_range_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to set file range name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_range_set(
+	     file_io_handle,
+	     mount_handle->volume_offset,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to set file range offset.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbde_volume_initialize(
+	     &bde_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize volume.",
+		 function );
+
+		goto on_error;
+	}
+	result = libbde_volume_set_keys_from_volume(
+	          bde_volume,
+	          first_bde_volume,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set keys from first volume.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing keys in first volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbde_volume_open_file_io_handle(
+	     bde_volume,
+	     file_io_handle,
+	     LIBBDE_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	result = libbde_volume_is_locked(
+	          bde_volume,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if volume is locked.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable unlock volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     mount_handle->reader_file_io_handles_array,
+	     &entry_index,
+	     (intptr_t *) file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file IO handle to array.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle = NULL;
+
+	if( mount_file_system_append_reader_volume(
+	     mount_handle->file_system,
+	     bde_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append reader volume to file system.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( bde_volume != NULL )
+	{
+		libbde_volume_free(
+		 &bde_volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes and frees a reader volume
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_reader_volume_free(
+     libbde_volume_t **bde_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_reader_volume_free";
+	int result            = 1;
+
+	if( bde_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bde_volume != NULL )
+	{
+		if( libbde_volume_close(
+		     *bde_volume,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close volume.",
+			 function );
+
+			result = -1;
+		}
+		if( libbde_volume_free(
+		     bde_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volume.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
 /* Closes the mount handle
  * Returns the 0 if successful or -1 on error
  */
@@ -1310,6 +1846,34 @@ int mount_handle_close(
 
 		return( -1 );
 	}
+	if( mount_file_system_empty_reader_volumes(
+	     mount_handle->file_system,
+	     &mount_handle_reader_volume_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free reader volumes.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_empty(
+	     mount_handle->reader_file_io_handles_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libbfio_handle_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free reader file IO handles.",
+		 function );
+
+		goto on_error;
+	}
 	if( mount_file_system_get_number_of_volumes(
 	     mount_handle->file_system,
 	     &number_of_volumes,
@@ -28,6 +28,7 @@
 
 #include "bdetools_libbde.h"
 #include "bdetools_libbfio.h"
+#include "bdetools_libcdata.h"
 #include "bdetools_libcerror.h"
 #include "mount_file_entry.h"
 #include "mount_file_system.h"
@@ -95,6 +96,14 @@ struct mount_handle
 	/* Value to indicate if user interaction is disabled
 	 */
 	int unattended_mode;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* The reader file IO handles array
+	 */
+	libcdata_array_t *reader_file_io_handles_array;
 };
 
 int mount_handle_system_string_copy_from_64_bit_in_decimal(
@@ -126,6 +135,16 @@ int mount_handle_set_offset(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int mount_handle_set_number_of_workers(
+     mount_handle_t *mount_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int mount_handle_get_number_of_workers(
+     mount_handle_t *mount_handle,
+     int *number_of_workers,
+     libcerror_error_t **error );
+
 int mount_handle_set_password(
      mount_handle_t *mount_handle,
      const system_character_t *string,
@@ -147,11 +166,31 @@ int mount_handle_set_path_prefix(
      size_t path_prefix_size,
      libcerror_error_t **error );
 
+int mount_handle_set_streaming_read_size(
+     mount_handle_t *mount_handle,
+     size_t streaming_read_size,
+     libcerror_error_t **error );
+
+int mount_handle_set_volume_credentials(
+     mount_handle_t *mount_handle,
+     libbde_volume_t *bde_volume,
+     libcerror_error_t **error );
+
 int mount_handle_open(
      mount_handle_t *mount_handle,
      const system_character_t *filename,
      libcerror_error_t **error );
 
+int mount_handle_open_reader_volume(
+     mount_handle_t *mount_handle,
+     const system_character_t *filename,
+     libbde_volume_t *first_bde_volume,
+     libcerror_error_t **error );
+
+int mount_handle_reader_volume_free(
+     libbde_volume_t **bde_volume,
+     libcerror_error_t **error );
+
 int mount_handle_close(
      mount_handle_t *mount_handle,
      libcerror_error_t **error );
@@ -0,0 +1,1957 @@
+/*
+ * Network Block Device (NBD) connection
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_POLL_H )
+#include <poll.h>
+#endif
+
+#if defined( HAVE_SYS_SOCKET_H )
+#include <sys/socket.h>
+#endif
+
+#include "bdetools_libcerror.h"
+#include "bdetools_libcnotify.h"
+#include "bdetools_libcthreads.h"
+#include "bdetools_unused.h"
+#include "mount_file_system.h"
+#include "nbd_connection.h"
+#include "nbd_server.h"
+
+#if !defined( MSG_NOSIGNAL )
+#define MSG_NOSIGNAL	0
+#endif
+
+/* The handshake magic: "NBDMAGIC" followed by "IHAVEOPT"
+ */
+uint8_t nbd_connection_handshake_magic[ 16 ] = {
+	'N', 'B', 'D', 'M', 'A', 'G', 'I', 'C', 'I', 'H', 'A', 'V', 'E', 'O', 'P', 'T' };
+
+/* The option reply magic
+ */
+uint8_t nbd_connection_option_reply_magic[ 8 ] = {
+	0x00, 0x03, 0xe8, 0x89, 0x04, 0x55, 0x65, 0xa9 };
+
+/* Creates a connection
+ * Make sure the value connection is referencing, is set to NULL
+ * The connection takes over ownership of the socket descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int nbd_connection_initialize(
+     nbd_connection_t **connection,
+     nbd_server_t *nbd_server,
+     int socket_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "nbd_connection_initialize";
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( *connection != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid connection value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( nbd_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid NBD server.",
+		 function );
+
+		return( -1 );
+	}
+	if( socket_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid socket descriptor value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	*connection = memory_allocate_structure(
+	               nbd_connection_t );
+
+	if( *connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create connection.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *connection,
+	     0,
+	     sizeof( nbd_connection_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear connection.",
+		 function );
+
+		memory_free(
+		 *connection );
+
+		*connection = NULL;
+
+		return( -1 );
+	}
+	( *connection )->nbd_server        = nbd_server;
+	( *connection )->socket_descriptor = -1;
+
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *connection )->write_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create write mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *connection )->requests_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create requests mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *connection )->requests_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create requests condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT ) */
+
+	( *connection )->socket_descriptor = socket_descriptor;
+
+	return( 1 );
+
+on_error:
+	if( *connection != NULL )
+	{
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+		if( ( *connection )->requests_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *connection )->requests_mutex ),
+			 NULL );
+		}
+		if( ( *connection )->write_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *connection )->write_mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 *connection );
+
+		*connection = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a connection
+ * This closes the socket descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int nbd_connection_free(
+     nbd_connection_t **connection,
+     libcerror_error_t **error )
+{
+	static char *function = "nbd_connection_free";
+	int result            = 1;
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( *connection != NULL )
+	{
+		if( ( *connection )->socket_descriptor >= 0 )
+		{
+			if( close(
+			     ( *connection )->socket_descriptor ) != 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 errno,
+				 "%s: unable to close socket.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_free(
+		     &( ( *connection )->requests_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free requests condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *connection )->requests_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free requests mutex.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *connection )->write_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free write mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif /* defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT ) */
+
+		memory_free(
+		 *connection );
+
+		*connection = NULL;
+	}
+	return( result );
+}
+
+/* Reads data from the connection
+ * Returns 1 if successful, 0 if the connection was closed by the client or -1 on error
+ */
+int nbd_connection_read_data(
+     nbd_connection_t *connection,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "nbd_connection_read_data";
+	size_t data_offset    = 0;
+	ssize_t read_count    = 0;
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		read_count = recv(
+		              connection->socket_descriptor,
+		              &( data[ data_offset ] ),
+		              data_size - data_offset,
+		              0 );
+
+		if( read_count < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to read data.",
+			 function );
+
+			return( -1 );
+		}
+		else if( read_count == 0 )
+		{
+			return( 0 );
+		}
+		data_offset += (size_t) read_count;
+	}
+	return( 1 );
+}
+
+/* Writes data to the connection
+ * Set has_more_data to indicate more data directly follows, which allows
+ * the data to be combined into a single packet
+ * Returns 1 if successful or -1 on error
+ */
+int nbd_connection_write_data(
+     nbd_connection_t *connection,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t has_more_data,
+     libcerror_error_t **error )
+{
+	static char *function = "nbd_connection_write_data";
+	size_t data_offset    = 0;
+	ssize_t write_count   = 0;
+	int send_flags        = MSG_NOSIGNAL;
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( MSG_MORE )
+	if( has_more_data != 0 )
+	{
+		send_flags |= MSG_MORE;
+	}
+#endif
+	while( data_offset < data_size )
+	{
+		write_count = send(
+		               connection->socket_descriptor,
+		               &( data[ data_offset ] ),
+		               data_size - data_offset,
+		               send_flags );
+
+		if( write_count < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 errno,
+			 "%s: unable to write data.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset += (size_t) write_count;
+	}
+	return( 1 );
+}
+
+/* Writes an option reply to the connection
+ * Returns 1 if successful or -1 on error
+ */
+int nbd_connection_write_option_reply(
+     nbd_connection_t *connection,
+     uint32_t option,
+     uint32_t reply_type,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t reply_header[ 20 ];
+
+	static char *function = "nbd_connection_write_option_reply";
+
+	if( data_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     reply_header,
+	     nbd_connection_option_reply_magic,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy option reply magic.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_big_endian(
+	 &( reply_header[ 8 ] ),
+	 option );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( reply_header[ 12 ] ),
+	 reply_type );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( reply_header[ 16 ] ),
+	 (uint32_t) data_size );
+
+	if( nbd_connection_write_data(
+	     connection,
+	     reply_header,
+	     20,
+	     (uint8_t) ( data_size > 0 ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write option reply header.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > 0 )
+	{
+		if( nbd_connection_write_data(
+		     connection,
+		     data,
+		     data_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write option reply data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Negotiates the export with the client using the fixed newstyle handshake
+ * Returns 1 if the connection entered the transmission phase, 0 if the connection
+ * should be closed or -1 on error
+ */
+int nbd_connection_negotiate(
+     nbd_connection_t *connection,
+     libcerror_error_t **error )
+{
+	uint8_t option_data[ NBD_CONNECTION_MAXIMUM_OPTION_DATA_SIZE ];
+	uint8_t reply_data[ 124 + 12 ];
+
+	nbd_server_t *nbd_server          = NULL;
+	static char *function             = "nbd_connection_negotiate";
+	size_t export_name_offset         = 0;
+	size_t reply_data_size            = 0;
+	uint32_t client_flags             = 0;
+	uint32_t export_name_length       = 0;
+	uint32_t option                   = 0;
+	uint32_t option_data_size         = 0;
+	uint16_t information_type         = 0;
+	uint16_t number_of_information    = 0;
+	uint16_t information_index        = 0;
+	uint16_t transmission_flags       = 0;
+	uint8_t block_size_was_requested  = 0;
+	int result                        = 0;
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( connection->nbd_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid connection - missing NBD server.",
+		 function );
+
+		return( -1 );
+	}
+	nbd_server = connection->nbd_server;
+
+	/* The volume is exported read-only and since its content does not change
+	 * multiple connections can be used concurrently
+	 */
+	transmission_flags = NBD_FLAG_HAS_FLAGS
+	                   | NBD_FLAG_READ_ONLY
+	                   | NBD_FLAG_SEND_FLUSH
+	                   | NBD_FLAG_CAN_MULTI_CONN;
+
+	if( memory_copy(
+	     option_data,
+	     nbd_connection_handshake_magic,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy handshake magic.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint16_big_endian(
+	 &( option_data[ 16 ] ),
+	 NBD_FLAG_FIXED_NEWSTYLE | NBD_FLAG_NO_ZEROES );
+
+	if( nbd_connection_write_data(
+	     connection,
+	     option_data,
+	     18,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write handshake.",
+		 function );
+
+		return( -1 );
+	}
+	result = nbd_connection_read_data(
+	          connection,
+	          option_data,
+	          4,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read client flags.",
+			 function );
+		}
+		return( result );
+	}
+	byte_stream_copy_to_uint32_big_endian(
+	 option_data,
+	 client_flags );
+
+	if( ( client_flags & ~( NBD_FLAG_C_FIXED_NEWSTYLE | NBD_FLAG_C_NO_ZEROES ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported client flags: 0x%08" PRIx32 ".",
+		 function,
+		 client_flags );
+
+		return( -1 );
+	}
+	if( ( client_flags & NBD_FLAG_C_NO_ZEROES ) != 0 )
+	{
+		connection->no_zeroes = 1;
+	}
+	while( nbd_server->abort == 0 )
+	{
+		result = nbd_connection_read_data(
+		          connection,
+		          option_data,
+		          16,
+		          error );
+
+		if( result != 1 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read option header.",
+				 function );
+			}
+			return( result );
+		}
+		if( memory_compare(
+		     option_data,
+		     &( nbd_connection_handshake_magic[ 8 ] ),
+		     8 ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+			 "%s: invalid option magic.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_big_endian(
+		 &( option_data[ 8 ] ),
+		 option );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( option_data[ 12 ] ),
+		 option_data_size );
+
+		if( option_data_size > NBD_CONNECTION_MAXIMUM_OPTION_DATA_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid option data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( option_data_size > 0 )
+		{
+			result = nbd_connection_read_data(
+			          connection,
+			          option_data,
+			          (size_t) option_data_size,
+			          error );
+
+			if( result != 1 )
+			{
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read option data.",
+					 function );
+				}
+				return( result );
+			}
+		}
+		result = 1;
+
+		switch( option )
+		{
+			case NBD_OPT_EXPORT_NAME:
+				export_name_offset = 0;
+				export_name_length = option_data_size;
+				break;
+
+			case NBD_OPT_INFO:
+			case NBD_OPT_GO:
+				if( option_data_size < 6 )
+				{
+					result = 0;
+					break;
+				}
+				byte_stream_copy_to_uint32_big_endian(
+				 option_data,
+				 export_name_length );
+
+				if( export_name_length > ( option_data_size - 6 ) )
+				{
+					result = 0;
+					break;
+				}
+				export_name_offset = 4;
+
+				byte_stream_copy_to_uint16_big_endian(
+				 &( option_data[ 4 + export_name_length ] ),
+				 number_of_information );
+
+				if( ( (uint32_t) number_of_information * 2 ) != ( option_data_size - 6 - export_name_length ) )
+				{
+					result = 0;
+					break;
+				}
+				block_size_was_requested = 0;
+
+				for( information_index = 0;
+				     information_index < number_of_information;
+				     information_index++ )
+				{
+					byte_stream_copy_to_uint16_big_endian(
+					 &( option_data[ 6 + export_name_length + ( information_index * 2 ) ] ),
+					 information_type );
+
+					if( information_type == NBD_INFO_BLOCK_SIZE )
+					{
+						block_size_was_requested = 1;
+					}
+				}
+				break;
+
+			case NBD_OPT_LIST:
+			case NBD_OPT_STRUCTURED_REPLY:
+				if( option_data_size != 0 )
+				{
+					result = 0;
+				}
+				break;
+
+			default:
+				break;
+		}
+		if( result == 0 )
+		{
+			if( nbd_connection_write_option_reply(
+			     connection,
+			     option,
+			     NBD_REP_ERR_INVALID,
+			     NULL,
+			     0,
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			continue;
+		}
+		if( ( option == NBD_OPT_EXPORT_NAME )
+		 || ( option == NBD_OPT_INFO )
+		 || ( option == NBD_OPT_GO ) )
+		{
+			/* The empty name selects the default export
+			 */
+			if( ( export_name_length != 0 )
+			 && ( ( export_name_length != nbd_server->export_name_length )
+			  || ( memory_compare(
+			        &( option_data[ export_name_offset ] ),
+			        nbd_server->export_name,
+			        nbd_server->export_name_length ) != 0 ) ) )
+			{
+				if( option == NBD_OPT_EXPORT_NAME )
+				{
+					/* There is no way to report an error for this option
+					 */
+					return( 0 );
+				}
+				if( nbd_connection_write_option_reply(
+				     connection,
+				     option,
+				     NBD_REP_ERR_UNKNOWN,
+				     NULL,
+				     0,
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+				continue;
+			}
+		}
+		switch( option )
+		{
+			case NBD_OPT_EXPORT_NAME:
+				byte_stream_copy_from_uint64_big_endian(
+				 reply_data,
+				 nbd_server->volume_size );
+
+				byte_stream_copy_from_uint16_big_endian(
+				 &( reply_data[ 8 ] ),
+				 transmission_flags );
+
+				reply_data_size = 10;
+
+				if( connection->no_zeroes == 0 )
+				{
+					if( memory_set(
+					     &( reply_data[ 10 ] ),
+					     0,
+					     124 ) == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+						 "%s: unable to clear reply data.",
+						 function );
+
+						return( -1 );
+					}
+					reply_data_size += 124;
+				}
+				if( nbd_connection_write_data(
+				     connection,
+				     reply_data,
+				     reply_data_size,
+				     0,
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+				return( 1 );
+
+			case NBD_OPT_ABORT:
+				/* The client can close the connection before reading the reply
+				 */
+				nbd_connection_write_option_reply(
+				 connection,
+				 option,
+				 NBD_REP_ACK,
+				 NULL,
+				 0,
+				 NULL );
+
+				return( 0 );
+
+			case NBD_OPT_LIST:
+				byte_stream_copy_from_uint32_big_endian(
+				 option_data,
+				 (uint32_t) nbd_server->export_name_length );
+
+				if( memory_copy(
+				     &( option_data[ 4 ] ),
+				     nbd_server->export_name,
+				     nbd_server->export_name_length ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy export name.",
+					 function );
+
+					return( -1 );
+				}
+				if( nbd_connection_write_option_reply(
+				     connection,
+				     option,
+				     NBD_REP_SERVER,
+				     option_data,
+				     4 + nbd_server->export_name_length,
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+				if( nbd_connection_write_option_reply(
+				     connection,
+				     option,
+				     NBD_REP_ACK,
+				     NULL,
+				     0,
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+				break;
+
+			case NBD_OPT_INFO:
+			case NBD_OPT_GO:
+				byte_stream_copy_from_uint16_big_endian(
+				 reply_data,
+				 NBD_INFO_EXPORT );
+
+				byte_stream_copy_from_uint64_big_endian(
+				 &( reply_data[ 2 ] ),
+				 nbd_server->volume_size );
+
+				byte_stream_copy_from_uint16_big_endian(
+				 &( reply_data[ 10 ] ),
+				 transmission_flags );
+
+				if( nbd_connection_write_option_reply(
+				     connection,
+				     option,
+				     NBD_REP_INFO,
+				     reply_data,
+				     12,
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+				if( block_size_was_requested != 0 )
+				{
+					byte_stream_copy_from_uint16_big_endian(
+					 reply_data,
+					 NBD_INFO_BLOCK_SIZE );
+
+					byte_stream_copy_from_uint32_big_endian(
+					 &( reply_data[ 2 ] ),
+					 1 );
+
+					byte_stream_copy_from_uint32_big_endian(
+					 &( reply_data[ 6 ] ),
+					 NBD_SERVER_PREFERRED_REQUEST_SIZE );
+
+					byte_stream_copy_from_uint32_big_endian(
+					 &( reply_data[ 10 ] ),
+					 NBD_SERVER_MAXIMUM_REQUEST_SIZE );
+
+					if( nbd_connection_write_option_reply(
+					     connection,
+					     option,
+					     NBD_REP_INFO,
+					     reply_data,
+					     14,
+					     error ) != 1 )
+					{
+						goto on_write_error;
+					}
+				}
+				if( nbd_connection_write_option_reply(
+				     connection,
+				     option,
+				     NBD_REP_ACK,
+				     NULL,
+				     0,
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+				if( option == NBD_OPT_GO )
+				{
+					return( 1 );
+				}
+				break;
+
+			case NBD_OPT_STRUCTURED_REPLY:
+				connection->use_structured_replies = 1;
+
+				if( nbd_connection_write_option_reply(
+				     connection,
+				     option,
+				     NBD_REP_ACK,
+				     NULL,
+				     0,
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+				break;
+
+			/* TLS is not supported since the server only listens locally
+			 */
+			case NBD_OPT_STARTTLS:
+			default:
+				if( nbd_connection_write_option_reply(
+				     connection,
+				     option,
+				     NBD_REP_ERR_UNSUP,
+				     NULL,
+				     0,
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+				break;
+		}
+	}
+	return( 0 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write reply to option: %" PRIu32 ".",
+	 function,
+	 option );
+
+	return( -1 );
+}
+
+/* Writes a simple reply without data to the connection
+ * Returns 1 if successful or -1 on error
+ */
+int nbd_connection_write_simple_reply(
+     nbd_connection_t *connection,
+     uint64_t cookie,
+     uint32_t error_value,
+     libcerror_error_t **error )
+{
+	uint8_t reply_header[ 16 ];
+
+	static char *function = "nbd_connection_write_simple_reply";
+	int result            = 1;
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_big_endian(
+	 reply_header,
+	 NBD_SIMPLE_REPLY_MAGIC );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( reply_header[ 4 ] ),
+	 error_value );
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( reply_header[ 8 ] ),
+	 cookie );
+
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     connection->write_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab write mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( nbd_connection_write_data(
+	     connection,
+	     reply_header,
+	     16,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write reply.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     connection->write_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release write mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Writes the reply to a read request to the connection
+ * A structured reply is written when negotiated, in which case the data is
+ * sent as a single offset data chunk
+ * Returns 1 if successful or -1 on error
+ */
+int nbd_connection_write_read_reply(
+     nbd_connection_t *connection,
+     uint64_t cookie,
+     uint64_t offset,
+     uint32_t error_value,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t reply_header[ 28 ];
+
+	static char *function    = "nbd_connection_write_read_reply";
+	size_t reply_header_size = 0;
+	int result               = 1;
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( error_value == 0 )
+	 && ( data == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) ( UINT32_MAX - 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( connection->use_structured_replies == 0 )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 reply_header,
+		 NBD_SIMPLE_REPLY_MAGIC );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( reply_header[ 4 ] ),
+		 error_value );
+
+		byte_stream_copy_from_uint64_big_endian(
+		 &( reply_header[ 8 ] ),
+		 cookie );
+
+		reply_header_size = 16;
+	}
+	else
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 reply_header,
+		 NBD_STRUCTURED_REPLY_MAGIC );
+
+		byte_stream_copy_from_uint16_big_endian(
+		 &( reply_header[ 4 ] ),
+		 NBD_REPLY_FLAG_DONE );
+
+		byte_stream_copy_from_uint64_big_endian(
+		 &( reply_header[ 8 ] ),
+		 cookie );
+
+		if( error_value == 0 )
+		{
+			byte_stream_copy_from_uint16_big_endian(
+			 &( reply_header[ 6 ] ),
+			 NBD_REPLY_TYPE_OFFSET_DATA );
+
+			byte_stream_copy_from_uint32_big_endian(
+			 &( reply_header[ 16 ] ),
+			 (uint32_t) ( 8 + data_size ) );
+
+			byte_stream_copy_from_uint64_big_endian(
+			 &( reply_header[ 20 ] ),
+			 offset );
+		}
+		else
+		{
+			/* The error chunk contains the error value and an empty message
+			 */
+			byte_stream_copy_from_uint16_big_endian(
+			 &( reply_header[ 6 ] ),
+			 NBD_REPLY_TYPE_ERROR );
+
+			byte_stream_copy_from_uint32_big_endian(
+			 &( reply_header[ 16 ] ),
+			 6 );
+
+			byte_stream_copy_from_uint32_big_endian(
+			 &( reply_header[ 20 ] ),
+			 error_value );
+
+			byte_stream_copy_from_uint16_big_endian(
+			 &( reply_header[ 24 ] ),
+			 0 );
+		}
+		reply_header_size = ( error_value == 0 ) ? 28 : 26;
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     connection->write_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab write mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( nbd_connection_write_data(
+	     connection,
+	     reply_header,
+	     reply_header_size,
+	     (uint8_t) ( error_value == 0 ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write reply header.",
+		 function );
+
+		result = -1;
+	}
+	else if( error_value == 0 )
+	{
+		if( nbd_connection_write_data(
+		     connection,
+		     data,
+		     data_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write reply data.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     connection->write_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release write mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Handles a read request
+ * Returns 1 if successful or -1 on error
+ */
+int nbd_connection_handle_read_request(
+     nbd_connection_t *connection,
+     nbd_request_t *request,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *read_error = NULL;
+	uint8_t *data                 = NULL;
+	static char *function         = "nbd_connection_handle_read_request";
+	ssize_t read_count            = 0;
+	uint32_t error_value          = 0;
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( connection->nbd_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid connection - missing NBD server.",
+		 function );
+
+		return( -1 );
+	}
+	if( request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid request.",
+		 function );
+
+		return( -1 );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * request->length );
+
+	if( data == NULL )
+	{
+		error_value = NBD_ENOMEM;
+	}
+	else
+	{
+		read_count = mount_file_system_read_buffer_at_offset(
+		              connection->nbd_server->file_system,
+		              connection->nbd_server->bde_volume,
+		              data,
+		              (size_t) request->length,
+		              (off64_t) request->offset,
+		              &read_error );
+
+		if( read_count != (ssize_t) request->length )
+		{
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to read data at offset: %" PRIu64 " (0x%08" PRIx64 ") of size: %" PRIu32 ".\n",
+				 function,
+				 request->offset,
+				 request->offset,
+				 request->length );
+
+				if( read_error != NULL )
+				{
+					libcnotify_print_error_backtrace(
+					 read_error );
+				}
+			}
+			libcerror_error_free(
+			 &read_error );
+
+			error_value = NBD_EIO;
+		}
+	}
+	if( nbd_connection_write_read_reply(
+	     connection,
+	     request->cookie,
+	     request->offset,
+	     error_value,
+	     data,
+	     (size_t) request->length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write reply.",
+		 function );
+
+		goto on_error;
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Thread pool callback that handles a read request
+ * Returns 1 if successful or -1 on error
+ */
+int nbd_connection_request_callback(
+     nbd_request_t *request,
+     void *arguments BDETOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error     = NULL;
+	nbd_connection_t *connection = NULL;
+	static char *function        = "nbd_connection_request_callback";
+	int result                   = 1;
+
+	BDETOOLS_UNREFERENCED_PARAMETER( arguments )
+
+	if( request == NULL )
+	{
+		return( -1 );
+	}
+	connection = request->connection;
+
+	if( nbd_connection_handle_read_request(
+	     connection,
+	     request,
+	     &error ) != 1 )
+	{
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to handle read request.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+		libcerror_error_free(
+		 &error );
+
+		/* The client is no longer able to match replies to requests
+		 * so the connection is shut down, which stops the requests loop
+		 */
+		shutdown(
+		 connection->socket_descriptor,
+		 SHUT_RDWR );
+
+		result = -1;
+	}
+	memory_free(
+	 request );
+
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     connection->requests_mutex,
+	     NULL ) == 1 )
+	{
+		connection->number_of_requests -= 1;
+
+		libcthreads_condition_broadcast(
+		 connection->requests_condition,
+		 NULL );
+
+		libcthreads_mutex_release(
+		 connection->requests_mutex,
+		 NULL );
+	}
+#endif
+	return( result );
+}
+
+/* Handles the requests of a connection in the transmission phase
+ * Read requests are handed to the requests thread pool if available
+ * Returns 1 if successful or -1 on error
+ */
+int nbd_connection_handle_requests(
+     nbd_connection_t *connection,
+     libcerror_error_t **error )
+{
+	uint8_t request_header[ 28 ];
+	uint8_t discard_data[ 4096 ];
+
+#if defined( HAVE_POLL_H )
+	struct pollfd poll_descriptor;
+#endif
+
+	nbd_request_t *request     = NULL;
+	nbd_server_t *nbd_server   = NULL;
+	static char *function      = "nbd_connection_handle_requests";
+	size_t discard_size        = 0;
+	uint64_t cookie            = 0;
+	uint64_t offset            = 0;
+	uint32_t error_value       = 0;
+	uint32_t length            = 0;
+	uint32_t request_magic     = 0;
+	uint16_t command           = 0;
+	int result                 = 1;
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( connection->nbd_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid connection - missing NBD server.",
+		 function );
+
+		return( -1 );
+	}
+	nbd_server = connection->nbd_server;
+
+	while( nbd_server->abort == 0 )
+	{
+#if defined( HAVE_POLL_H )
+		/* Poll with a timeout so that an abort is noticed on idle connections
+		 */
+		poll_descriptor.fd      = connection->socket_descriptor;
+		poll_descriptor.events  = POLLIN;
+		poll_descriptor.revents = 0;
+
+		result = poll(
+		          &poll_descriptor,
+		          1,
+		          1000 );
+
+		if( result == 0 )
+		{
+			continue;
+		}
+		else if( result < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 errno,
+			 "%s: unable to poll socket.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+#endif /* defined( HAVE_POLL_H ) */
+
+		result = nbd_connection_read_data(
+		          connection,
+		          request_header,
+		          28,
+		          error );
+
+		if( result != 1 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read request header.",
+				 function );
+			}
+			else
+			{
+				result = 1;
+			}
+			break;
+		}
+		byte_stream_copy_to_uint32_big_endian(
+		 request_header,
+		 request_magic );
+
+		byte_stream_copy_to_uint16_big_endian(
+		 &( request_header[ 6 ] ),
+		 command );
+
+		byte_stream_copy_to_uint64_big_endian(
+		 &( request_header[ 8 ] ),
+		 cookie );
+
+		byte_stream_copy_to_uint64_big_endian(
+		 &( request_header[ 16 ] ),
+		 offset );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( request_header[ 24 ] ),
+		 length );
+
+		if( request_magic != NBD_REQUEST_MAGIC )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+			 "%s: invalid request magic.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		if( command == NBD_CMD_DISC )
+		{
+			break;
+		}
+		error_value = 0;
+
+		switch( command )
+		{
+			case NBD_CMD_READ:
+				if( ( length == 0 )
+				 || ( length > NBD_SERVER_MAXIMUM_REQUEST_SIZE )
+				 || ( offset > nbd_server->volume_size )
+				 || ( (uint64_t) length > ( nbd_server->volume_size - offset ) ) )
+				{
+					error_value = NBD_EINVAL;
+				}
+				break;
+
+			case NBD_CMD_WRITE:
+				/* The data of the write request needs to be consumed
+				 */
+				while( length > 0 )
+				{
+					discard_size = sizeof( discard_data );
+
+					if( discard_size > (size_t) length )
+					{
+						discard_size = (size_t) length;
+					}
+					result = nbd_connection_read_data(
+					          connection,
+					          discard_data,
+					          discard_size,
+					          error );
+
+					if( result != 1 )
+					{
+						break;
+					}
+					length -= (uint32_t) discard_size;
+				}
+				if( result != 1 )
+				{
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read write request data.",
+						 function );
+					}
+					break;
+				}
+				error_value = NBD_EPERM;
+
+				break;
+
+			case NBD_CMD_TRIM:
+			case NBD_CMD_WRITE_ZEROES:
+				error_value = NBD_EPERM;
+
+				break;
+
+			/* Nothing is written so there is nothing to flush
+			 */
+			case NBD_CMD_FLUSH:
+				break;
+
+			default:
+				error_value = NBD_EINVAL;
+
+				break;
+		}
+		if( result != 1 )
+		{
+			break;
+		}
+		if( ( command != NBD_CMD_READ )
+		 || ( error_value != 0 ) )
+		{
+			if( command == NBD_CMD_READ )
+			{
+				result = nbd_connection_write_read_reply(
+				          connection,
+				          cookie,
+				          offset,
+				          error_value,
+				          NULL,
+				          0,
+				          error );
+			}
+			else
+			{
+				result = nbd_connection_write_simple_reply(
+				          connection,
+				          cookie,
+				          error_value,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write reply.",
+				 function );
+
+				break;
+			}
+			continue;
+		}
+		request = memory_allocate_structure(
+		           nbd_request_t );
+
+		if( request == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create request.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		request->connection = connection;
+		request->cookie     = cookie;
+		request->offset     = offset;
+		request->length     = length;
+
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+		if( nbd_server->requests_thread_pool != NULL )
+		{
+			if( libcthreads_mutex_grab(
+			     connection->requests_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab requests mutex.",
+				 function );
+
+				memory_free(
+				 request );
+
+				result = -1;
+
+				break;
+			}
+			connection->number_of_requests += 1;
+
+			if( libcthreads_mutex_release(
+			     connection->requests_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release requests mutex.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+			/* The request is freed by the requests thread pool callback
+			 */
+			if( libcthreads_thread_pool_push(
+			     nbd_server->requests_thread_pool,
+			     (intptr_t *) request,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push request onto requests thread pool.",
+				 function );
+
+				nbd_connection_request_callback(
+				 request,
+				 NULL );
+
+				result = -1;
+
+				break;
+			}
+			request = NULL;
+
+			continue;
+		}
+#endif /* defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT ) */
+
+		result = nbd_connection_handle_read_request(
+		          connection,
+		          request,
+		          error );
+
+		memory_free(
+		 request );
+
+		request = NULL;
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to handle read request.",
+			 function );
+
+			break;
+		}
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	/* Wait for the in-flight requests before the connection is freed
+	 */
+	if( libcthreads_mutex_grab(
+	     connection->requests_mutex,
+	     NULL ) == 1 )
+	{
+		while( connection->number_of_requests > 0 )
+		{
+			if( libcthreads_condition_wait(
+			     connection->requests_condition,
+			     connection->requests_mutex,
+			     NULL ) != 1 )
+			{
+				break;
+			}
+		}
+		libcthreads_mutex_release(
+		 connection->requests_mutex,
+		 NULL );
+	}
+#endif /* defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT ) */
+
+	return( result );
+}
+
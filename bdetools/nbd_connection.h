@@ -0,0 +1,238 @@
+/*
+ * Network Block Device (NBD) connection
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _NBD_CONNECTION_H )
+#define _NBD_CONNECTION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "bdetools_libcerror.h"
+#include "bdetools_libcthreads.h"
+#include "nbd_server.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The handshake flags
+ */
+#define NBD_FLAG_FIXED_NEWSTYLE			0x0001
+#define NBD_FLAG_NO_ZEROES			0x0002
+
+/* The client flags
+ */
+#define NBD_FLAG_C_FIXED_NEWSTYLE		0x00000001UL
+#define NBD_FLAG_C_NO_ZEROES			0x00000002UL
+
+/* The transmission flags
+ */
+#define NBD_FLAG_HAS_FLAGS			0x0001
+#define NBD_FLAG_READ_ONLY			0x0002
+#define NBD_FLAG_SEND_FLUSH			0x0004
+#define NBD_FLAG_CAN_MULTI_CONN			0x0100
+
+/* The options
+ */
+#define NBD_OPT_EXPORT_NAME			1
+#define NBD_OPT_ABORT				2
+#define NBD_OPT_LIST				3
+#define NBD_OPT_STARTTLS			5
+#define NBD_OPT_INFO				6
+#define NBD_OPT_GO				7
+#define NBD_OPT_STRUCTURED_REPLY		8
+
+/* The option reply types
+ */
+#define NBD_REP_ACK				1
+#define NBD_REP_SERVER				2
+#define NBD_REP_INFO				3
+#define NBD_REP_ERR_UNSUP			0x80000001UL
+#define NBD_REP_ERR_INVALID			0x80000003UL
+#define NBD_REP_ERR_UNKNOWN			0x80000006UL
+
+/* The information types
+ */
+#define NBD_INFO_EXPORT				0
+#define NBD_INFO_BLOCK_SIZE			3
+
+/* The request and reply magic
+ */
+#define NBD_REQUEST_MAGIC			0x25609513UL
+#define NBD_SIMPLE_REPLY_MAGIC			0x67446698UL
+#define NBD_STRUCTURED_REPLY_MAGIC		0x668e33efUL
+
+/* The commands
+ */
+#define NBD_CMD_READ				0
+#define NBD_CMD_WRITE				1
+#define NBD_CMD_DISC				2
+#define NBD_CMD_FLUSH				3
+#define NBD_CMD_TRIM				4
+#define NBD_CMD_WRITE_ZEROES			6
+
+/* The structured reply flags and types
+ */
+#define NBD_REPLY_FLAG_DONE			0x0001
+#define NBD_REPLY_TYPE_NONE			0
+#define NBD_REPLY_TYPE_OFFSET_DATA		1
+#define NBD_REPLY_TYPE_ERROR			0x8001
+
+/* The error values
+ */
+#define NBD_EPERM				1
+#define NBD_EIO					5
+#define NBD_ENOMEM				12
+#define NBD_EINVAL				22
+
+/* The maximum size of the data of an option
+ */
+#define NBD_CONNECTION_MAXIMUM_OPTION_DATA_SIZE	( NBD_SERVER_MAXIMUM_EXPORT_NAME_SIZE + 64 )
+
+typedef struct nbd_connection nbd_connection_t;
+
+struct nbd_connection
+{
+	/* The server
+	 */
+	nbd_server_t *nbd_server;
+
+	/* The socket descriptor
+	 */
+	int socket_descriptor;
+
+	/* Value to indicate the client does not expect zero padding
+	 */
+	uint8_t no_zeroes;
+
+	/* Value to indicate structured replies are used
+	 */
+	uint8_t use_structured_replies;
+
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	/* The write mutex, which serializes replies
+	 */
+	libcthreads_mutex_t *write_mutex;
+
+	/* The requests mutex
+	 */
+	libcthreads_mutex_t *requests_mutex;
+
+	/* The requests condition
+	 */
+	libcthreads_condition_t *requests_condition;
+
+	/* The number of in-flight requests
+	 */
+	int number_of_requests;
+#endif
+};
+
+typedef struct nbd_request nbd_request_t;
+
+struct nbd_request
+{
+	/* The connection
+	 */
+	nbd_connection_t *connection;
+
+	/* The cookie
+	 */
+	uint64_t cookie;
+
+	/* The offset
+	 */
+	uint64_t offset;
+
+	/* The length
+	 */
+	uint32_t length;
+};
+
+int nbd_connection_initialize(
+     nbd_connection_t **connection,
+     nbd_server_t *nbd_server,
+     int socket_descriptor,
+     libcerror_error_t **error );
+
+int nbd_connection_free(
+     nbd_connection_t **connection,
+     libcerror_error_t **error );
+
+int nbd_connection_read_data(
+     nbd_connection_t *connection,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int nbd_connection_write_data(
+     nbd_connection_t *connection,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t has_more_data,
+     libcerror_error_t **error );
+
+int nbd_connection_write_option_reply(
+     nbd_connection_t *connection,
+     uint32_t option,
+     uint32_t reply_type,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int nbd_connection_negotiate(
+     nbd_connection_t *connection,
+     libcerror_error_t **error );
+
+int nbd_connection_write_simple_reply(
+     nbd_connection_t *connection,
+     uint64_t cookie,
+     uint32_t error_value,
+     libcerror_error_t **error );
+
+int nbd_connection_write_read_reply(
+     nbd_connection_t *connection,
+     uint64_t cookie,
+     uint64_t offset,
+     uint32_t error_value,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int nbd_connection_handle_read_request(
+     nbd_connection_t *connection,
+     nbd_request_t *request,
+     libcerror_error_t **error );
+
+int nbd_connection_handle_requests(
+     nbd_connection_t *connection,
+     libcerror_error_t **error );
+
+int nbd_connection_request_callback(
+     nbd_request_t *request,
+     void *arguments );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _NBD_CONNECTION_H ) */
+
@@ -0,0 +1,981 @@
+/*
+ * Network Block Device (NBD) server
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_POLL_H )
+#include <poll.h>
+#endif
+
+#if defined( HAVE_SYS_SOCKET_H )
+#include <sys/socket.h>
+#endif
+
+#if defined( HAVE_SYS_UN_H )
+#include <sys/un.h>
+#endif
+
+#if defined( HAVE_NETINET_IN_H )
+#include <netinet/in.h>
+#endif
+
+#if defined( HAVE_ARPA_INET_H )
+#include <arpa/inet.h>
+#endif
+
+#if defined( HAVE_NETINET_TCP_H )
+#include <netinet/tcp.h>
+#endif
+
+#include "bdetools_libbde.h"
+#include "bdetools_libcerror.h"
+#include "bdetools_libcnotify.h"
+#include "bdetools_libcthreads.h"
+#include "bdetools_unused.h"
+#include "mount_file_system.h"
+#include "nbd_connection.h"
+#include "nbd_server.h"
+
+/* Creates a NBD server
+ * Make sure the value nbd_server is referencing, is set to NULL
+ * The volume of the file system is exported under the export name
+ * Returns 1 if successful or -1 on error
+ */
+int nbd_server_initialize(
+     nbd_server_t **nbd_server,
+     mount_file_system_t *file_system,
+     const char *export_name,
+     libcerror_error_t **error )
+{
+	static char *function = "nbd_server_initialize";
+
+	if( nbd_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid NBD server.",
+		 function );
+
+		return( -1 );
+	}
+	if( *nbd_server != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid NBD server value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export name.",
+		 function );
+
+		return( -1 );
+	}
+	*nbd_server = memory_allocate_structure(
+	               nbd_server_t );
+
+	if( *nbd_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create NBD server.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *nbd_server,
+	     0,
+	     sizeof( nbd_server_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear NBD server.",
+		 function );
+
+		memory_free(
+		 *nbd_server );
+
+		*nbd_server = NULL;
+
+		return( -1 );
+	}
+	( *nbd_server )->socket_descriptor  = -1;
+	( *nbd_server )->file_system        = file_system;
+	( *nbd_server )->export_name        = export_name;
+	( *nbd_server )->export_name_length = narrow_string_length(
+	                                       export_name );
+
+	if( ( *nbd_server )->export_name_length > NBD_SERVER_MAXIMUM_EXPORT_NAME_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export name length value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( mount_file_system_get_volume_by_index(
+	     file_system,
+	     0,
+	     &( ( *nbd_server )->bde_volume ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume: 0.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbde_volume_get_size(
+	     ( *nbd_server )->bde_volume,
+	     &( ( *nbd_server )->volume_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume size.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *nbd_server != NULL )
+	{
+		memory_free(
+		 *nbd_server );
+
+		*nbd_server = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a NBD server
+ * Returns 1 if successful or -1 on error
+ */
+int nbd_server_free(
+     nbd_server_t **nbd_server,
+     libcerror_error_t **error )
+{
+	static char *function = "nbd_server_free";
+	int result            = 1;
+
+	if( nbd_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid NBD server.",
+		 function );
+
+		return( -1 );
+	}
+	if( *nbd_server != NULL )
+	{
+		if( ( *nbd_server )->socket_descriptor >= 0 )
+		{
+			if( nbd_server_close(
+			     *nbd_server,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close NBD server.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The file_system and bde_volume references are freed elsewhere
+		 */
+		memory_free(
+		 *nbd_server );
+
+		*nbd_server = NULL;
+	}
+	return( result );
+}
+
+/* Signals the NBD server to abort
+ * Returns 1 if successful or -1 on error
+ */
+int nbd_server_signal_abort(
+     nbd_server_t *nbd_server,
+     libcerror_error_t **error )
+{
+	static char *function = "nbd_server_signal_abort";
+
+	if( nbd_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid NBD server.",
+		 function );
+
+		return( -1 );
+	}
+	nbd_server->abort = 1;
+
+	return( 1 );
+}
+
+/* Opens a listening Unix domain socket
+ * Returns 1 if successful or -1 on error
+ */
+int nbd_server_open_unix_socket(
+     nbd_server_t *nbd_server,
+     const char *path,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_SYS_UN_H )
+	struct sockaddr_un socket_address;
+#endif
+
+	static char *function = "nbd_server_open_unix_socket";
+	size_t path_length    = 0;
+
+	if( nbd_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid NBD server.",
+		 function );
+
+		return( -1 );
+	}
+	if( nbd_server->socket_descriptor >= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid NBD server - socket already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = narrow_string_length(
+	               path );
+
+#if defined( HAVE_SYS_UN_H )
+	if( ( path_length == 0 )
+	 || ( path_length >= sizeof( socket_address.sun_path ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &socket_address,
+	     0,
+	     sizeof( struct sockaddr_un ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear socket address.",
+		 function );
+
+		return( -1 );
+	}
+	socket_address.sun_family = AF_UNIX;
+
+	if( memory_copy(
+	     socket_address.sun_path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		return( -1 );
+	}
+	nbd_server->socket_descriptor = socket(
+	                                 AF_UNIX,
+	                                 SOCK_STREAM,
+	                                 0 );
+
+	if( nbd_server->socket_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to create socket.",
+		 function );
+
+		return( -1 );
+	}
+	if( bind(
+	     nbd_server->socket_descriptor,
+	     (struct sockaddr *) &socket_address,
+	     sizeof( struct sockaddr_un ) ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to bind socket to: %s.",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	/* The socket file is removed when the server is closed
+	 */
+	nbd_server->socket_path = path;
+
+	if( listen(
+	     nbd_server->socket_descriptor,
+	     NBD_SERVER_MAXIMUM_NUMBER_OF_CONNECTIONS ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to listen on socket.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	nbd_server_close(
+	 nbd_server,
+	 NULL );
+
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: Unix domain sockets not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_SYS_UN_H ) */
+}
+
+/* Opens a listening TCP socket on the loopback address
+ * Returns 1 if successful or -1 on error
+ */
+int nbd_server_open_tcp_socket(
+     nbd_server_t *nbd_server,
+     uint16_t port,
+     libcerror_error_t **error )
+{
+	struct sockaddr_in socket_address;
+
+	static char *function = "nbd_server_open_tcp_socket";
+	int option_value      = 1;
+
+	if( nbd_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid NBD server.",
+		 function );
+
+		return( -1 );
+	}
+	if( nbd_server->socket_descriptor >= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid NBD server - socket already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &socket_address,
+	     0,
+	     sizeof( struct sockaddr_in ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear socket address.",
+		 function );
+
+		return( -1 );
+	}
+	/* The decrypted volume is only served to the local host
+	 */
+	socket_address.sin_family      = AF_INET;
+	socket_address.sin_port        = htons( port );
+	socket_address.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+
+	nbd_server->socket_descriptor = socket(
+	                                 AF_INET,
+	                                 SOCK_STREAM,
+	                                 0 );
+
+	if( nbd_server->socket_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to create socket.",
+		 function );
+
+		return( -1 );
+	}
+	if( setsockopt(
+	     nbd_server->socket_descriptor,
+	     SOL_SOCKET,
+	     SO_REUSEADDR,
+	     &option_value,
+	     sizeof( int ) ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to set socket option: SO_REUSEADDR.",
+		 function );
+
+		goto on_error;
+	}
+	if( bind(
+	     nbd_server->socket_descriptor,
+	     (struct sockaddr *) &socket_address,
+	     sizeof( struct sockaddr_in ) ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to bind socket to port: %" PRIu16 ".",
+		 function,
+		 port );
+
+		goto on_error;
+	}
+	if( listen(
+	     nbd_server->socket_descriptor,
+	     NBD_SERVER_MAXIMUM_NUMBER_OF_CONNECTIONS ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to listen on socket.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	nbd_server_close(
+	 nbd_server,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Closes the listening socket
+ * Returns the 0 if successful or -1 on error
+ */
+int nbd_server_close(
+     nbd_server_t *nbd_server,
+     libcerror_error_t **error )
+{
+	static char *function = "nbd_server_close";
+	int result            = 0;
+
+	if( nbd_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid NBD server.",
+		 function );
+
+		return( -1 );
+	}
+	if( nbd_server->socket_descriptor >= 0 )
+	{
+		if( close(
+		     nbd_server->socket_descriptor ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to close socket.",
+			 function );
+
+			result = -1;
+		}
+		nbd_server->socket_descriptor = -1;
+	}
+	if( nbd_server->socket_path != NULL )
+	{
+		if( unlink(
+		     nbd_server->socket_path ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+			 errno,
+			 "%s: unable to remove socket: %s.",
+			 function,
+			 nbd_server->socket_path );
+
+			result = -1;
+		}
+		nbd_server->socket_path = NULL;
+	}
+	return( result );
+}
+
+/* Handles a connection
+ * Returns 1 if successful or -1 on error
+ */
+int nbd_server_connection_callback(
+     nbd_connection_t *connection,
+     void *arguments BDETOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "nbd_server_connection_callback";
+	int result               = 0;
+
+	BDETOOLS_UNREFERENCED_PARAMETER( arguments )
+
+	result = nbd_connection_negotiate(
+	          connection,
+	          &error );
+
+	if( result == 1 )
+	{
+		result = nbd_connection_handle_requests(
+		          connection,
+		          &error );
+	}
+	if( result == -1 )
+	{
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to handle connection.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+		libcerror_error_free(
+		 &error );
+	}
+	if( nbd_connection_free(
+	     &connection,
+	     &error ) != 1 )
+	{
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to free connection.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+		libcerror_error_free(
+		 &error );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Accepts and handles connections until abort is signalled
+ * Connections are handled concurrently by a connections thread pool and their
+ * read requests by a requests thread pool of number of workers threads
+ * Returns 1 if successful or -1 on error
+ */
+int nbd_server_run(
+     nbd_server_t *nbd_server,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_POLL_H )
+	struct pollfd poll_descriptor;
+#endif
+
+	nbd_connection_t *connection = NULL;
+	static char *function        = "nbd_server_run";
+	int socket_descriptor        = -1;
+
+#if defined( TCP_NODELAY ) || defined( SO_NOSIGPIPE )
+	int option_value             = 1;
+#endif
+#if defined( HAVE_POLL_H )
+	int result                   = 0;
+#endif
+
+	if( nbd_server == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid NBD server.",
+		 function );
+
+		return( -1 );
+	}
+	if( nbd_server->socket_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid NBD server - socket not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_workers <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of workers value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_thread_pool_create(
+	     &( nbd_server->connections_thread_pool ),
+	     NULL,
+	     NBD_SERVER_MAXIMUM_NUMBER_OF_CONNECTIONS,
+	     NBD_SERVER_MAXIMUM_NUMBER_OF_CONNECTIONS,
+	     (int (*)(intptr_t *, void *)) &nbd_server_connection_callback,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create connections thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_create(
+	     &( nbd_server->requests_thread_pool ),
+	     NULL,
+	     number_of_workers,
+	     number_of_workers * NBD_SERVER_MAXIMUM_NUMBER_OF_REQUESTS,
+	     (int (*)(intptr_t *, void *)) &nbd_connection_request_callback,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create requests thread pool.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT ) */
+
+	while( nbd_server->abort == 0 )
+	{
+#if defined( HAVE_POLL_H )
+		/* Poll with a timeout so that an abort is noticed
+		 */
+		poll_descriptor.fd      = nbd_server->socket_descriptor;
+		poll_descriptor.events  = POLLIN;
+		poll_descriptor.revents = 0;
+
+		result = poll(
+		          &poll_descriptor,
+		          1,
+		          1000 );
+
+		if( result == 0 )
+		{
+			continue;
+		}
+		else if( result < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 errno,
+			 "%s: unable to poll socket.",
+			 function );
+
+			goto on_error;
+		}
+#endif /* defined( HAVE_POLL_H ) */
+
+		socket_descriptor = accept(
+		                     nbd_server->socket_descriptor,
+		                     NULL,
+		                     NULL );
+
+		if( socket_descriptor == -1 )
+		{
+			if( ( errno == EINTR )
+			 || ( errno == ECONNABORTED ) )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 errno,
+			 "%s: unable to accept connection.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( TCP_NODELAY )
+		/* Replies are written with a small header followed by the data
+		 * this fails for Unix domain sockets, which is ignored
+		 */
+		setsockopt(
+		 socket_descriptor,
+		 IPPROTO_TCP,
+		 TCP_NODELAY,
+		 &option_value,
+		 sizeof( int ) );
+#endif
+#if defined( SO_NOSIGPIPE )
+		/* Where MSG_NOSIGNAL is not available a closed connection should
+		 * not raise SIGPIPE
+		 */
+		setsockopt(
+		 socket_descriptor,
+		 SOL_SOCKET,
+		 SO_NOSIGPIPE,
+		 &option_value,
+		 sizeof( int ) );
+#endif
+		if( nbd_connection_initialize(
+		     &connection,
+		     nbd_server,
+		     socket_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create connection.",
+			 function );
+
+			close(
+			 socket_descriptor );
+
+			goto on_error;
+		}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+		/* The connection is freed by the connections thread pool callback
+		 */
+		if( libcthreads_thread_pool_push(
+		     nbd_server->connections_thread_pool,
+		     (intptr_t *) connection,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push connection onto connections thread pool.",
+			 function );
+
+			goto on_error;
+		}
+#else
+		nbd_server_connection_callback(
+		 connection,
+		 NULL );
+#endif
+		connection = NULL;
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	/* The connections need to be finished before the requests thread pool is joined
+	 */
+	if( libcthreads_thread_pool_join(
+	     &( nbd_server->connections_thread_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join connections thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_join(
+	     &( nbd_server->requests_thread_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join requests thread pool.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+
+on_error:
+	if( connection != NULL )
+	{
+		nbd_connection_free(
+		 &connection,
+		 NULL );
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	/* Make sure the connections stop before the thread pools are joined
+	 */
+	nbd_server->abort = 1;
+
+	if( nbd_server->connections_thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &( nbd_server->connections_thread_pool ),
+		 NULL );
+	}
+	if( nbd_server->requests_thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &( nbd_server->requests_thread_pool ),
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
@@ -0,0 +1,152 @@
+/*
+ * Network Block Device (NBD) server
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _NBD_SERVER_H )
+#define _NBD_SERVER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "bdetools_libbde.h"
+#include "bdetools_libcerror.h"
+#include "bdetools_libcthreads.h"
+#include "mount_file_system.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default TCP port
+ */
+#define NBD_SERVER_DEFAULT_PORT				10809
+
+/* The maximum number of concurrent connections
+ */
+#define NBD_SERVER_MAXIMUM_NUMBER_OF_CONNECTIONS	16
+
+/* The maximum number of in-flight requests per worker
+ */
+#define NBD_SERVER_MAXIMUM_NUMBER_OF_REQUESTS		16
+
+/* The maximum size of the data of a single read request
+ */
+#define NBD_SERVER_MAXIMUM_REQUEST_SIZE			( 32 * 1024 * 1024 )
+
+/* The preferred size of the data of a read request
+ */
+#define NBD_SERVER_PREFERRED_REQUEST_SIZE		( 1024 * 1024 )
+
+/* The maximum size of an export name
+ */
+#define NBD_SERVER_MAXIMUM_EXPORT_NAME_SIZE		4096
+
+struct nbd_connection;
+
+typedef struct nbd_server nbd_server_t;
+
+struct nbd_server
+{
+	/* The file system
+	 */
+	mount_file_system_t *file_system;
+
+	/* The BDE volume
+	 */
+	libbde_volume_t *bde_volume;
+
+	/* The volume size
+	 */
+	size64_t volume_size;
+
+	/* The export name
+	 */
+	const char *export_name;
+
+	/* The export name length
+	 */
+	size_t export_name_length;
+
+	/* The listening socket descriptor
+	 */
+	int socket_descriptor;
+
+	/* The path of the Unix domain socket
+	 */
+	const char *socket_path;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	/* The connections thread pool
+	 */
+	libcthreads_thread_pool_t *connections_thread_pool;
+
+	/* The requests thread pool
+	 */
+	libcthreads_thread_pool_t *requests_thread_pool;
+#endif
+};
+
+int nbd_server_initialize(
+     nbd_server_t **nbd_server,
+     mount_file_system_t *file_system,
+     const char *export_name,
+     libcerror_error_t **error );
+
+int nbd_server_free(
+     nbd_server_t **nbd_server,
+     libcerror_error_t **error );
+
+int nbd_server_signal_abort(
+     nbd_server_t *nbd_server,
+     libcerror_error_t **error );
+
+int nbd_server_open_unix_socket(
+     nbd_server_t *nbd_server,
+     const char *path,
+     libcerror_error_t **error );
+
+int nbd_server_open_tcp_socket(
+     nbd_server_t *nbd_server,
+     uint16_t port,
+     libcerror_error_t **error );
+
+int nbd_server_close(
+     nbd_server_t *nbd_server,
+     libcerror_error_t **error );
+
+int nbd_server_connection_callback(
+     struct nbd_connection *connection,
+     void *arguments );
+
+int nbd_server_run(
+     nbd_server_t *nbd_server,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _NBD_SERVER_H ) */
+
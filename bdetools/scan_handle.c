@@ -0,0 +1,2428 @@
+/*
+ * Scan handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "bdetools_libcdata.h"
+#include "bdetools_libcerror.h"
+#include "bdetools_libcfile.h"
+#include "bdetools_libcnotify.h"
+#include "bdetools_libcthreads.h"
+#include "bdetools_unused.h"
+#include "scan_handle.h"
+
+const uint8_t scan_handle_boot_entry_point_vista[ 3 ] = {
+	0xeb, 0x52, 0x90 };
+
+const uint8_t scan_handle_boot_entry_point_windows7[ 3 ] = {
+	0xeb, 0x58, 0x90 };
+
+const uint8_t scan_handle_bde_identifier[ 16 ] = {
+	0x3b, 0xd6, 0x67, 0x49, 0x29, 0x2e, 0xd8, 0x4a, 0x83, 0x99, 0xf6, 0xa3, 0x39, 0xe3, 0xd0, 0x01 };
+
+const uint8_t scan_handle_bde_identifier_used_disk_space_only[ 16 ] = {
+	0x3b, 0x4d, 0xa8, 0x92, 0x80, 0xdd, 0x0e, 0x4d, 0x9e, 0x4e, 0xb1, 0xe3, 0x28, 0x4e, 0xae, 0xd8 };
+
+const char *scan_handle_bde_signature = "-FVE-FS-";
+
+/* Copies a string of a decimal value to a 64-bit value
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_system_string_copy_from_64_bit_in_decimal(
+     const system_character_t *string,
+     size_t string_size,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function              = "scan_handle_system_string_copy_from_64_bit_in_decimal";
+	system_character_t character_value = 0;
+	size_t string_index                = 0;
+	uint8_t maximum_string_index       = 20;
+	int8_t sign                        = 1;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	*value_64bit = 0;
+
+	if( string[ string_index ] == (system_character_t) '-' )
+	{
+		string_index++;
+		maximum_string_index++;
+
+		sign = -1;
+	}
+	else if( string[ string_index ] == (system_character_t) '+' )
+	{
+		string_index++;
+		maximum_string_index++;
+	}
+	while( string_index < string_size )
+	{
+		if( string[ string_index ] == 0 )
+		{
+			break;
+		}
+		if( string_index > (size_t) maximum_string_index )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_LARGE,
+			 "%s: string too large.",
+			 function );
+
+			return( -1 );
+		}
+		*value_64bit *= 10;
+
+		if( ( string[ string_index ] >= (system_character_t) '0' )
+		 && ( string[ string_index ] <= (system_character_t) '9' ) )
+		{
+			character_value = (system_character_t) ( string[ string_index ] - (system_character_t) '0' );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character value: %" PRIc_SYSTEM " at index: %d.",
+			 function,
+			 string[ string_index ],
+			 string_index );
+
+			return( -1 );
+		}
+		*value_64bit += character_value;
+
+		string_index++;
+	}
+	if( sign == -1 )
+	{
+		*value_64bit *= (uint64_t) -1;
+	}
+	return( 1 );
+}
+
+/* Creates a scan handle
+ * Make sure the value scan_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_initialize(
+     scan_handle_t **scan_handle,
+     uint8_t print_status,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_initialize";
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*scan_handle = memory_allocate_structure(
+	                scan_handle_t );
+
+	if( *scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scan_handle,
+	     0,
+	     sizeof( scan_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan handle.",
+		 function );
+
+		memory_free(
+		 *scan_handle );
+
+		*scan_handle = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( ( *scan_handle )->results_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize results array.",
+		 function );
+
+		goto on_error;
+	}
+	( *scan_handle )->chunk_size        = SCAN_HANDLE_DEFAULT_CHUNK_SIZE;
+	( *scan_handle )->number_of_workers = 1;
+	( *scan_handle )->print_status      = print_status;
+	( *scan_handle )->notify_stream     = stdout;
+
+	return( 1 );
+
+on_error:
+	if( *scan_handle != NULL )
+	{
+		memory_free(
+		 *scan_handle );
+
+		*scan_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a scan handle
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_free(
+     scan_handle_t **scan_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_free";
+	int result            = 1;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_handle != NULL )
+	{
+		if( ( *scan_handle )->chunks != NULL )
+		{
+			if( scan_handle_close(
+			     *scan_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close scan handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcdata_array_free(
+		     &( ( *scan_handle )->results_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &scan_handle_free_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free results array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *scan_handle );
+
+		*scan_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the scan handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_signal_abort(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_signal_abort";
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	scan_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Sets the number of workers
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_set_number_of_workers(
+     scan_handle_t *scan_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_set_number_of_workers";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_handle->chunks != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan handle - chunks value already set.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( scan_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > SCAN_HANDLE_MAXIMUM_NUMBER_OF_WORKERS ) )
+#else
+	if( value_64bit != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of workers.",
+		 function );
+
+		return( -1 );
+	}
+	scan_handle->number_of_workers = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Opens the image
+ * Every chunk opens its own file so that the workers can read concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_open(
+     scan_handle_t *scan_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	scan_chunk_t *scan_chunk = NULL;
+	static char *function    = "scan_handle_open";
+	int chunk_index          = 0;
+	int result               = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_handle->chunks != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan handle - chunks value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	scan_handle->number_of_chunks = scan_handle->number_of_workers * SCAN_HANDLE_NUMBER_OF_CHUNKS_PER_WORKER;
+
+	scan_handle->chunks = (scan_chunk_t *) memory_allocate(
+	                                        sizeof( scan_chunk_t ) * scan_handle->number_of_chunks );
+
+	if( scan_handle->chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     scan_handle->chunks,
+	     0,
+	     sizeof( scan_chunk_t ) * scan_handle->number_of_chunks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunks.",
+		 function );
+
+		memory_free(
+		 scan_handle->chunks );
+
+		scan_handle->chunks = NULL;
+
+		goto on_error;
+	}
+	for( chunk_index = 0;
+	     chunk_index < scan_handle->number_of_chunks;
+	     chunk_index++ )
+	{
+		scan_chunk = &( scan_handle->chunks[ chunk_index ] );
+
+		scan_chunk->scan_handle = scan_handle;
+
+		if( libcfile_file_initialize(
+		     &( scan_chunk->file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize chunk: %d file.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcfile_file_open_wide(
+		          scan_chunk->file,
+		          filename,
+		          LIBCFILE_OPEN_READ,
+		          error );
+#else
+		result = libcfile_file_open(
+		          scan_chunk->file,
+		          filename,
+		          LIBCFILE_OPEN_READ,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file: %" PRIs_SYSTEM ".",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		scan_chunk->data = (uint8_t *) memory_allocate(
+		                                sizeof( uint8_t ) * scan_handle->chunk_size );
+
+		if( scan_chunk->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunk: %d data.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( libcdata_array_initialize(
+		     &( scan_chunk->results_array ),
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize chunk: %d results array.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	if( libcfile_file_get_size(
+	     scan_handle->chunks[ 0 ].file,
+	     &( scan_handle->image_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve image size.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( scan_handle->chunks != NULL )
+	{
+		scan_handle_close(
+		 scan_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the image
+ * Returns the 0 if successful or -1 on error
+ */
+int scan_handle_close(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error )
+{
+	scan_chunk_t *scan_chunk = NULL;
+	static char *function    = "scan_handle_close";
+	int chunk_index          = 0;
+	int result               = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_handle->chunks == NULL )
+	{
+		return( 0 );
+	}
+	for( chunk_index = 0;
+	     chunk_index < scan_handle->number_of_chunks;
+	     chunk_index++ )
+	{
+		scan_chunk = &( scan_handle->chunks[ chunk_index ] );
+
+		if( scan_chunk->results_array != NULL )
+		{
+			if( libcdata_array_free(
+			     &( scan_chunk->results_array ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &scan_handle_free_result,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk: %d results array.",
+				 function,
+				 chunk_index );
+
+				result = -1;
+			}
+		}
+		if( scan_chunk->data != NULL )
+		{
+			memory_free(
+			 scan_chunk->data );
+		}
+		if( scan_chunk->file != NULL )
+		{
+			if( libcfile_file_free(
+			     &( scan_chunk->file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk: %d file.",
+				 function,
+				 chunk_index );
+
+				result = -1;
+			}
+		}
+	}
+	memory_free(
+	 scan_handle->chunks );
+
+	scan_handle->chunks           = NULL;
+	scan_handle->number_of_chunks = 0;
+
+	return( result );
+}
+
+/* Frees a scan result
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_free_result(
+     scan_result_t **scan_result,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_free_result";
+
+	if( scan_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan result.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_result != NULL )
+	{
+		memory_free(
+		 *scan_result );
+
+		*scan_result = NULL;
+	}
+	return( 1 );
+}
+
+/* Checks if the data contains a valid BitLocker volume header
+ * Returns 1 if valid, 0 if not
+ */
+int scan_handle_check_volume_header(
+     const uint8_t *data,
+     size_t data_size,
+     scan_result_t *scan_result )
+{
+	uint64_t total_number_of_sectors = 0;
+	uint64_t value_64bit             = 0;
+	uint32_t cluster_block_size      = 0;
+	uint16_t bytes_per_sector        = 0;
+	size_t metadata_offsets_offset   = 0;
+	int metadata_offset_index        = 0;
+	int version                      = 0;
+
+	if( ( data == NULL )
+	 || ( data_size < SCAN_HANDLE_SECTOR_SIZE )
+	 || ( scan_result == NULL ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     data,
+	     scan_handle_boot_entry_point_vista,
+	     3 ) == 0 )
+	{
+		version = SCAN_VOLUME_VERSION_WINDOWS_VISTA;
+	}
+	else if( memory_compare(
+	          data,
+	          scan_handle_boot_entry_point_windows7,
+	          3 ) != 0 )
+	{
+		return( 0 );
+	}
+	/* The Windows 7 identifier is stored at offset 160 and the To Go identifier at offset 424
+	 */
+	else if( ( memory_compare(
+	            &( data[ 160 ] ),
+	            scan_handle_bde_identifier,
+	            16 ) == 0 )
+	      || ( memory_compare(
+	            &( data[ 160 ] ),
+	            scan_handle_bde_identifier_used_disk_space_only,
+	            16 ) == 0 ) )
+	{
+		version                 = SCAN_VOLUME_VERSION_WINDOWS_7;
+		metadata_offsets_offset = 176;
+	}
+	else if( memory_compare(
+	          &( data[ 424 ] ),
+	          scan_handle_bde_identifier,
+	          16 ) == 0 )
+	{
+		version                 = SCAN_VOLUME_VERSION_TO_GO;
+		metadata_offsets_offset = 440;
+	}
+	else
+	{
+		return( 0 );
+	}
+	if( ( version != SCAN_VOLUME_VERSION_TO_GO )
+	 && ( memory_compare(
+	       &( data[ 3 ] ),
+	       scan_handle_bde_signature,
+	       8 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 11 ] ),
+	 bytes_per_sector );
+
+	if( ( bytes_per_sector != 512 )
+	 && ( bytes_per_sector != 1024 )
+	 && ( bytes_per_sector != 2048 )
+	 && ( bytes_per_sector != 4096 ) )
+	{
+		return( 0 );
+	}
+	if( memory_set(
+	     scan_result,
+	     0,
+	     sizeof( scan_result_t ) ) == NULL )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 19 ] ),
+	 total_number_of_sectors );
+
+	if( total_number_of_sectors == 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 32 ] ),
+		 total_number_of_sectors );
+	}
+	if( version == SCAN_VOLUME_VERSION_WINDOWS_VISTA )
+	{
+		if( total_number_of_sectors == 0 )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ 40 ] ),
+			 total_number_of_sectors );
+		}
+		if( data[ 13 ] == 0 )
+		{
+			return( 0 );
+		}
+		cluster_block_size = (uint32_t) data[ 13 ] * bytes_per_sector;
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ 56 ] ),
+		 value_64bit );
+
+		if( ( value_64bit == 0 )
+		 || ( value_64bit > ( (uint64_t) INT64_MAX / cluster_block_size ) ) )
+		{
+			return( 0 );
+		}
+		scan_result->metadata_offsets[ 0 ] = value_64bit * cluster_block_size;
+	}
+	else
+	{
+		for( metadata_offset_index = 0;
+		     metadata_offset_index < 3;
+		     metadata_offset_index++ )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ metadata_offsets_offset + ( metadata_offset_index * 8 ) ] ),
+			 value_64bit );
+
+			if( ( value_64bit == 0 )
+			 || ( value_64bit > (uint64_t) INT64_MAX ) )
+			{
+				return( 0 );
+			}
+			scan_result->metadata_offsets[ metadata_offset_index ] = value_64bit;
+		}
+	}
+	if( total_number_of_sectors > ( (uint64_t) INT64_MAX / bytes_per_sector ) )
+	{
+		return( 0 );
+	}
+	scan_result->type          = SCAN_RESULT_TYPE_VOLUME_HEADER;
+	scan_result->version       = version;
+	scan_result->volume_size   = total_number_of_sectors * bytes_per_sector;
+	scan_result->volume_offset = -1;
+
+	return( 1 );
+}
+
+/* Checks if the data contains a valid FVE metadata block header
+ * Returns 1 if valid, 0 if not
+ */
+int scan_handle_check_metadata_block_header(
+     const uint8_t *data,
+     size_t data_size,
+     scan_result_t *scan_result )
+{
+	uint64_t value_64bit      = 0;
+	uint16_t format_version   = 0;
+	int metadata_offset_index = 0;
+
+	if( ( data == NULL )
+	 || ( data_size < 64 )
+	 || ( scan_result == NULL ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     data,
+	     scan_handle_bde_signature,
+	     8 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 10 ] ),
+	 format_version );
+
+	if( ( format_version != 1 )
+	 && ( format_version != 2 ) )
+	{
+		return( 0 );
+	}
+	if( memory_set(
+	     scan_result,
+	     0,
+	     sizeof( scan_result_t ) ) == NULL )
+	{
+		return( 0 );
+	}
+	/* The metadata offsets are stored at offset 32 in both format versions
+	 */
+	for( metadata_offset_index = 0;
+	     metadata_offset_index < 3;
+	     metadata_offset_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ 32 + ( metadata_offset_index * 8 ) ] ),
+		 value_64bit );
+
+		if( ( value_64bit == 0 )
+		 || ( value_64bit > (uint64_t) INT64_MAX ) )
+		{
+			return( 0 );
+		}
+		scan_result->metadata_offsets[ metadata_offset_index ] = value_64bit;
+	}
+	if( format_version == 2 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ 16 ] ),
+		 scan_result->encrypted_volume_size );
+	}
+	scan_result->type          = SCAN_RESULT_TYPE_METADATA_BLOCK;
+	scan_result->version       = (int) format_version;
+	scan_result->volume_offset = -1;
+
+	return( 1 );
+}
+
+/* Scans data for BitLocker volume headers and FVE metadata block headers
+ * Only the start of every sector is checked, since both are sector aligned
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_scan_data(
+     const uint8_t *data,
+     size_t data_size,
+     off64_t data_offset,
+     libcdata_array_t *results_array,
+     libcerror_error_t **error )
+{
+	scan_result_t candidate_result;
+
+	scan_result_t *scan_result = NULL;
+	const uint8_t *sector_data = NULL;
+	static char *function      = "scan_handle_scan_data";
+	size_t sector_offset       = 0;
+	int entry_index            = 0;
+	int result                 = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( sector_offset = 0;
+	     ( sector_offset + SCAN_HANDLE_SECTOR_SIZE ) <= data_size;
+	     sector_offset += SCAN_HANDLE_SECTOR_SIZE )
+	{
+		sector_data = &( data[ sector_offset ] );
+
+		/* Most sectors are rejected on their first byte, a metadata block
+		 * starts with the signature and a volume header with a jump instruction
+		 */
+		if( sector_data[ 0 ] == (uint8_t) '-' )
+		{
+			result = scan_handle_check_metadata_block_header(
+			          sector_data,
+			          SCAN_HANDLE_SECTOR_SIZE,
+			          &candidate_result );
+		}
+		else if( sector_data[ 0 ] == 0xeb )
+		{
+			result = scan_handle_check_volume_header(
+			          sector_data,
+			          SCAN_HANDLE_SECTOR_SIZE,
+			          &candidate_result );
+		}
+		else
+		{
+			continue;
+		}
+		if( result == 0 )
+		{
+			continue;
+		}
+		candidate_result.offset = data_offset + (off64_t) sector_offset;
+
+		scan_result = memory_allocate_structure(
+		               scan_result_t );
+
+		if( scan_result == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create scan result.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     scan_result,
+		     &candidate_result,
+		     sizeof( scan_result_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy scan result.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_array_append_entry(
+		     results_array,
+		     &entry_index,
+		     (intptr_t *) scan_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append scan result to array.",
+			 function );
+
+			goto on_error;
+		}
+		scan_result = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( scan_result != NULL )
+	{
+		memory_free(
+		 scan_result );
+	}
+	return( -1 );
+}
+
+/* Reads and scans a chunk
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_scan_chunk(
+     scan_handle_t *scan_handle,
+     scan_chunk_t *scan_chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_scan_chunk";
+	ssize_t read_count    = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_file_seek_offset(
+	     scan_chunk->file,
+	     scan_chunk->offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek chunk offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 scan_chunk->offset,
+		 scan_chunk->offset );
+
+		return( -1 );
+	}
+	read_count = libcfile_file_read_buffer(
+	              scan_chunk->file,
+	              scan_chunk->data,
+	              scan_chunk->data_size,
+	              error );
+
+	if( read_count != (ssize_t) scan_chunk->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 scan_chunk->offset,
+		 scan_chunk->offset );
+
+		return( -1 );
+	}
+	if( scan_handle_scan_data(
+	     scan_chunk->data,
+	     scan_chunk->data_size,
+	     scan_chunk->offset,
+	     scan_chunk->results_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 scan_chunk->offset,
+		 scan_chunk->offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Scans a chunk on a worker thread
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_chunk_callback(
+     scan_chunk_t *scan_chunk,
+     void *arguments BDETOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error   = NULL;
+	scan_handle_t *scan_handle = NULL;
+	static char *function      = "scan_handle_chunk_callback";
+	int result                 = 1;
+	int state                  = SCAN_CHUNK_STATE_SCANNED;
+
+	BDETOOLS_UNREFERENCED_PARAMETER( arguments )
+
+	if( scan_chunk == NULL )
+	{
+		return( -1 );
+	}
+	scan_handle = scan_chunk->scan_handle;
+
+	if( scan_handle->abort != 0 )
+	{
+		state = SCAN_CHUNK_STATE_FAILED;
+	}
+	else if( scan_handle_scan_chunk(
+	          scan_handle,
+	          scan_chunk,
+	          &error ) != 1 )
+	{
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to scan chunk.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+		libcerror_error_free(
+		 &error );
+
+		state  = SCAN_CHUNK_STATE_FAILED;
+		result = -1;
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     scan_handle->chunks_mutex,
+	     NULL ) == 1 )
+	{
+		scan_chunk->state = state;
+
+		libcthreads_condition_broadcast(
+		 scan_handle->chunks_condition,
+		 NULL );
+
+		libcthreads_mutex_release(
+		 scan_handle->chunks_mutex,
+		 NULL );
+	}
+#else
+	scan_chunk->state = state;
+#endif
+	return( result );
+}
+
+/* Prints the scan status
+ */
+void scan_handle_print_status(
+      scan_handle_t *scan_handle,
+      off64_t scan_offset,
+      int *last_percentage )
+{
+	int percentage = 100;
+
+	if( ( scan_handle == NULL )
+	 || ( scan_handle->print_status == 0 )
+	 || ( scan_handle->notify_stream == NULL )
+	 || ( last_percentage == NULL ) )
+	{
+		return;
+	}
+	if( scan_handle->image_size > 0 )
+	{
+		percentage = (int) ( ( (uint64_t) scan_offset * 100 ) / scan_handle->image_size );
+	}
+	if( percentage == *last_percentage )
+	{
+		return;
+	}
+	*last_percentage = percentage;
+
+	fprintf(
+	 scan_handle->notify_stream,
+	 "Status: at %d%%, scanned: %" PRIu64 " of %" PRIu64 " bytes.\n",
+	 percentage,
+	 (uint64_t) scan_offset,
+	 scan_handle->image_size );
+}
+
+/* Moves the results of a scanned chunk to the results of the scan handle
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_move_chunk_results(
+     scan_handle_t *scan_handle,
+     scan_chunk_t *scan_chunk,
+     libcerror_error_t **error )
+{
+	scan_result_t *scan_result = NULL;
+	static char *function      = "scan_handle_move_chunk_results";
+	int entry_index            = 0;
+	int number_of_results      = 0;
+	int result_index           = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     scan_chunk->results_array,
+	     &number_of_results,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunk results.",
+		 function );
+
+		return( -1 );
+	}
+	for( result_index = 0;
+	     result_index < number_of_results;
+	     result_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     scan_chunk->results_array,
+		     result_index,
+		     (intptr_t **) &scan_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk result: %d.",
+			 function,
+			 result_index );
+
+			return( -1 );
+		}
+		if( libcdata_array_set_entry_by_index(
+		     scan_chunk->results_array,
+		     result_index,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to clear chunk result: %d.",
+			 function,
+			 result_index );
+
+			return( -1 );
+		}
+		if( libcdata_array_append_entry(
+		     scan_handle->results_array,
+		     &entry_index,
+		     (intptr_t *) scan_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append result: %d.",
+			 function,
+			 result_index );
+
+			memory_free(
+			 scan_result );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_empty(
+	     scan_chunk->results_array,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty chunk results array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees the workers thread pool, the chunks mutex and condition
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_free_workers(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_free_workers";
+	int result            = 1;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( scan_handle->workers_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( scan_handle->workers_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join workers thread pool.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( scan_handle->chunks_condition != NULL )
+	{
+		if( libcthreads_condition_free(
+		     &( scan_handle->chunks_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunks condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( scan_handle->chunks_mutex != NULL )
+	{
+		if( libcthreads_mutex_free(
+		     &( scan_handle->chunks_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunks mutex.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	return( result );
+}
+
+/* Scans the image
+ * The chunks are read and scanned by the workers and their results are collected in order,
+ * which keeps the results sorted by offset
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int scan_handle_scan(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error )
+{
+	scan_chunk_t *scan_chunk         = NULL;
+	static char *function            = "scan_handle_scan";
+	size64_t remaining_size          = 0;
+	uint64_t number_of_queued_chunks = 0;
+	uint64_t number_of_done_chunks   = 0;
+	off64_t read_offset              = 0;
+	off64_t scan_offset              = 0;
+	int chunk_index                  = 0;
+	int last_percentage              = -1;
+	int result                       = 1;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_handle->chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan handle - missing chunks.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	if( scan_handle->workers_thread_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan handle - workers thread pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_handle->number_of_workers > 1 )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( scan_handle->chunks_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize chunks mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_condition_initialize(
+		     &( scan_handle->chunks_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize chunks condition.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_thread_pool_create(
+		     &( scan_handle->workers_thread_pool ),
+		     NULL,
+		     scan_handle->number_of_workers,
+		     scan_handle->number_of_chunks,
+		     (int (*)(intptr_t *, void *)) &scan_handle_chunk_callback,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create workers thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT ) */
+
+	while( (size64_t) scan_offset < scan_handle->image_size )
+	{
+		if( scan_handle->abort != 0 )
+		{
+			result = 0;
+
+			break;
+		}
+		/* Keep the workers busy by queuing chunks until all chunks are in flight
+		 */
+		while( ( (size64_t) read_offset < scan_handle->image_size )
+		    && ( ( number_of_queued_chunks - number_of_done_chunks ) < (uint64_t) scan_handle->number_of_chunks ) )
+		{
+			chunk_index = (int) ( number_of_queued_chunks % scan_handle->number_of_chunks );
+			scan_chunk  = &( scan_handle->chunks[ chunk_index ] );
+
+			remaining_size = scan_handle->image_size - (size64_t) read_offset;
+
+			scan_chunk->offset    = read_offset;
+			scan_chunk->data_size = scan_handle->chunk_size;
+			scan_chunk->state     = SCAN_CHUNK_STATE_QUEUED;
+
+			if( remaining_size < (size64_t) scan_chunk->data_size )
+			{
+				scan_chunk->data_size = (size_t) remaining_size;
+			}
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+			if( scan_handle->workers_thread_pool != NULL )
+			{
+				if( libcthreads_thread_pool_push(
+				     scan_handle->workers_thread_pool,
+				     (intptr_t *) scan_chunk,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push chunk onto workers thread pool.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			else
+#endif
+			{
+				if( scan_handle_scan_chunk(
+				     scan_handle,
+				     scan_chunk,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to scan chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 read_offset,
+					 read_offset );
+
+					goto on_error;
+				}
+				scan_chunk->state = SCAN_CHUNK_STATE_SCANNED;
+			}
+			read_offset += scan_chunk->data_size;
+
+			number_of_queued_chunks++;
+		}
+		/* Collect the results of the chunks in order
+		 */
+		chunk_index = (int) ( number_of_done_chunks % scan_handle->number_of_chunks );
+		scan_chunk  = &( scan_handle->chunks[ chunk_index ] );
+
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+		if( scan_handle->workers_thread_pool != NULL )
+		{
+			if( libcthreads_mutex_grab(
+			     scan_handle->chunks_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab chunks mutex.",
+				 function );
+
+				goto on_error;
+			}
+			while( scan_chunk->state == SCAN_CHUNK_STATE_QUEUED )
+			{
+				if( libcthreads_condition_wait(
+				     scan_handle->chunks_condition,
+				     scan_handle->chunks_mutex,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to wait for chunk.",
+					 function );
+
+					libcthreads_mutex_release(
+					 scan_handle->chunks_mutex,
+					 NULL );
+
+					goto on_error;
+				}
+			}
+			if( libcthreads_mutex_release(
+			     scan_handle->chunks_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release chunks mutex.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif /* defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT ) */
+
+		if( scan_chunk->state != SCAN_CHUNK_STATE_SCANNED )
+		{
+			if( scan_handle->abort != 0 )
+			{
+				result = 0;
+
+				break;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 scan_chunk->offset,
+			 scan_chunk->offset );
+
+			goto on_error;
+		}
+		if( scan_handle_move_chunk_results(
+		     scan_handle,
+		     scan_chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to move chunk results.",
+			 function );
+
+			goto on_error;
+		}
+		scan_chunk->state = SCAN_CHUNK_STATE_FREE;
+
+		scan_offset += scan_chunk->data_size;
+
+		number_of_done_chunks++;
+
+		scan_handle_print_status(
+		 scan_handle,
+		 scan_offset,
+		 &last_percentage );
+	}
+	if( scan_handle_free_workers(
+	     scan_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( result == 1 )
+	{
+		if( scan_handle_resolve_results(
+		     scan_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to resolve results.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	scan_handle->abort = 1;
+
+	scan_handle_free_workers(
+	 scan_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the result of a specific type at a specific offset
+ * The results are sorted by offset, hence a binary search is used
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int scan_handle_get_result_by_offset(
+     scan_handle_t *scan_handle,
+     off64_t offset,
+     int type,
+     scan_result_t **scan_result,
+     libcerror_error_t **error )
+{
+	scan_result_t *safe_scan_result = NULL;
+	static char *function           = "scan_handle_get_result_by_offset";
+	int lower_index                 = 0;
+	int middle_index                = 0;
+	int number_of_results           = 0;
+	int upper_index                 = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan result.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     scan_handle->results_array,
+	     &number_of_results,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of results.",
+		 function );
+
+		return( -1 );
+	}
+	upper_index = number_of_results;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     scan_handle->results_array,
+		     middle_index,
+		     (intptr_t **) &safe_scan_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve result: %d.",
+			 function,
+			 middle_index );
+
+			return( -1 );
+		}
+		if( safe_scan_result == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing result: %d.",
+			 function,
+			 middle_index );
+
+			return( -1 );
+		}
+		if( offset < safe_scan_result->offset )
+		{
+			upper_index = middle_index;
+		}
+		else if( offset > safe_scan_result->offset )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			/* A sector contains at most one result
+			 */
+			if( safe_scan_result->type != type )
+			{
+				break;
+			}
+			*scan_result = safe_scan_result;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Determines the volume offset and copy number of the metadata blocks
+ * A metadata block belongs to the volume at its offset minus one of its metadata offsets,
+ * which is confirmed by a volume header or another metadata block with the same offsets
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_resolve_results(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error )
+{
+	scan_result_t *other_result     = NULL;
+	scan_result_t *scan_result      = NULL;
+	static char *function           = "scan_handle_resolve_results";
+	off64_t candidate_offset        = 0;
+	int metadata_offset_index       = 0;
+	int number_of_results           = 0;
+	int other_metadata_offset_index = 0;
+	int result                      = 0;
+	int result_index                = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     scan_handle->results_array,
+	     &number_of_results,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of results.",
+		 function );
+
+		return( -1 );
+	}
+	for( result_index = 0;
+	     result_index < number_of_results;
+	     result_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     scan_handle->results_array,
+		     result_index,
+		     (intptr_t **) &scan_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve result: %d.",
+			 function,
+			 result_index );
+
+			return( -1 );
+		}
+		if( ( scan_result == NULL )
+		 || ( scan_result->type != SCAN_RESULT_TYPE_METADATA_BLOCK ) )
+		{
+			continue;
+		}
+		/* First look for a volume header that references the metadata
+		 */
+		for( metadata_offset_index = 0;
+		     metadata_offset_index < 3;
+		     metadata_offset_index++ )
+		{
+			if( scan_result->metadata_offsets[ metadata_offset_index ] > (uint64_t) scan_result->offset )
+			{
+				continue;
+			}
+			candidate_offset = scan_result->offset - (off64_t) scan_result->metadata_offsets[ metadata_offset_index ];
+
+			result = scan_handle_get_result_by_offset(
+			          scan_handle,
+			          candidate_offset,
+			          SCAN_RESULT_TYPE_VOLUME_HEADER,
+			          &other_result,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume header at offset: %" PRIi64 ".",
+				 function,
+				 candidate_offset );
+
+				return( -1 );
+			}
+			else if( ( result != 0 )
+			      && ( other_result->metadata_offsets[ 0 ] == scan_result->metadata_offsets[ 0 ] ) )
+			{
+				scan_result->volume_offset = candidate_offset;
+				scan_result->copy_number   = metadata_offset_index + 1;
+
+				break;
+			}
+		}
+		if( scan_result->volume_offset != -1 )
+		{
+			continue;
+		}
+		/* Otherwise look for another copy of the metadata, for example
+		 * when the volume header was overwritten
+		 */
+		for( metadata_offset_index = 0;
+		     metadata_offset_index < 3;
+		     metadata_offset_index++ )
+		{
+			if( scan_result->metadata_offsets[ metadata_offset_index ] > (uint64_t) scan_result->offset )
+			{
+				continue;
+			}
+			candidate_offset = scan_result->offset - (off64_t) scan_result->metadata_offsets[ metadata_offset_index ];
+
+			for( other_metadata_offset_index = 0;
+			     other_metadata_offset_index < 3;
+			     other_metadata_offset_index++ )
+			{
+				if( other_metadata_offset_index == metadata_offset_index )
+				{
+					continue;
+				}
+				result = scan_handle_get_result_by_offset(
+				          scan_handle,
+				          candidate_offset + (off64_t) scan_result->metadata_offsets[ other_metadata_offset_index ],
+				          SCAN_RESULT_TYPE_METADATA_BLOCK,
+				          &other_result,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve metadata block.",
+					 function );
+
+					return( -1 );
+				}
+				else if( ( result != 0 )
+				      && ( memory_compare(
+				            other_result->metadata_offsets,
+				            scan_result->metadata_offsets,
+				            sizeof( uint64_t ) * 3 ) == 0 ) )
+				{
+					scan_result->volume_offset = candidate_offset;
+					scan_result->copy_number   = metadata_offset_index + 1;
+
+					break;
+				}
+			}
+			if( scan_result->volume_offset != -1 )
+			{
+				break;
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Prints the volume version
+ */
+void scan_handle_volume_version_fprint(
+      int version,
+      FILE *stream )
+{
+	switch( version )
+	{
+		case SCAN_VOLUME_VERSION_WINDOWS_VISTA:
+			fprintf(
+			 stream,
+			 "Windows Vista" );
+			break;
+
+		case SCAN_VOLUME_VERSION_WINDOWS_7:
+			fprintf(
+			 stream,
+			 "Windows 7" );
+			break;
+
+		case SCAN_VOLUME_VERSION_TO_GO:
+			fprintf(
+			 stream,
+			 "BitLocker To Go" );
+			break;
+
+		default:
+			fprintf(
+			 stream,
+			 "Unknown" );
+			break;
+	}
+}
+
+/* Prints the scan results
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_results_fprint(
+     scan_handle_t *scan_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	scan_result_t *other_result   = NULL;
+	scan_result_t *scan_result    = NULL;
+	static char *function         = "scan_handle_results_fprint";
+	int metadata_offset_index     = 0;
+	int number_of_metadata_blocks = 0;
+	int number_of_results         = 0;
+	int number_of_volume_headers  = 0;
+	int other_result_index        = 0;
+	int result                    = 0;
+	int result_index              = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     scan_handle->results_array,
+	     &number_of_results,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of results.",
+		 function );
+
+		return( -1 );
+	}
+	for( result_index = 0;
+	     result_index < number_of_results;
+	     result_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     scan_handle->results_array,
+		     result_index,
+		     (intptr_t **) &scan_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve result: %d.",
+			 function,
+			 result_index );
+
+			return( -1 );
+		}
+		if( scan_result->type == SCAN_RESULT_TYPE_VOLUME_HEADER )
+		{
+			number_of_volume_headers++;
+		}
+		else
+		{
+			number_of_metadata_blocks++;
+		}
+	}
+	fprintf(
+	 stream,
+	 "BitLocker Drive Encryption scan results:\n" );
+
+	fprintf(
+	 stream,
+	 "\tImage size\t\t\t: %" PRIu64 " bytes\n",
+	 scan_handle->image_size );
+
+	fprintf(
+	 stream,
+	 "\tNumber of volume headers\t: %d\n",
+	 number_of_volume_headers );
+
+	fprintf(
+	 stream,
+	 "\tNumber of metadata blocks\t: %d\n",
+	 number_of_metadata_blocks );
+
+	fprintf(
+	 stream,
+	 "\n" );
+
+	for( result_index = 0;
+	     result_index < number_of_results;
+	     result_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     scan_handle->results_array,
+		     result_index,
+		     (intptr_t **) &scan_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve result: %d.",
+			 function,
+			 result_index );
+
+			return( -1 );
+		}
+		if( scan_result->type == SCAN_RESULT_TYPE_VOLUME_HEADER )
+		{
+			fprintf(
+			 stream,
+			 "Volume header:\n" );
+
+			fprintf(
+			 stream,
+			 "\tOffset\t\t\t\t: %" PRIi64 " (0x%08" PRIx64 ")\n",
+			 scan_result->offset,
+			 scan_result->offset );
+
+			fprintf(
+			 stream,
+			 "\tVersion\t\t\t\t: " );
+
+			scan_handle_volume_version_fprint(
+			 scan_result->version,
+			 stream );
+
+			fprintf(
+			 stream,
+			 "\n" );
+
+			fprintf(
+			 stream,
+			 "\tVolume size\t\t\t: %" PRIu64 " bytes\n",
+			 scan_result->volume_size );
+
+			fprintf(
+			 stream,
+			 "\tMetadata offsets\t\t:" );
+
+			for( metadata_offset_index = 0;
+			     metadata_offset_index < 3;
+			     metadata_offset_index++ )
+			{
+				if( scan_result->metadata_offsets[ metadata_offset_index ] != 0 )
+				{
+					fprintf(
+					 stream,
+					 " 0x%08" PRIx64 "",
+					 scan_result->metadata_offsets[ metadata_offset_index ] );
+				}
+			}
+			fprintf(
+			 stream,
+			 "\n" );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "Metadata block:\n" );
+
+			fprintf(
+			 stream,
+			 "\tOffset\t\t\t\t: %" PRIi64 " (0x%08" PRIx64 ")\n",
+			 scan_result->offset,
+			 scan_result->offset );
+
+			fprintf(
+			 stream,
+			 "\tFormat version\t\t\t: %d\n",
+			 scan_result->version );
+
+			if( scan_result->version == 2 )
+			{
+				fprintf(
+				 stream,
+				 "\tEncrypted volume size\t\t: %" PRIu64 " bytes\n",
+				 scan_result->encrypted_volume_size );
+			}
+			fprintf(
+			 stream,
+			 "\tMetadata offsets\t\t: 0x%08" PRIx64 " 0x%08" PRIx64 " 0x%08" PRIx64 "\n",
+			 scan_result->metadata_offsets[ 0 ],
+			 scan_result->metadata_offsets[ 1 ],
+			 scan_result->metadata_offsets[ 2 ] );
+
+			if( scan_result->volume_offset == -1 )
+			{
+				fprintf(
+				 stream,
+				 "\tVolume offset\t\t\t: unknown\n" );
+			}
+			else
+			{
+				fprintf(
+				 stream,
+				 "\tVolume offset\t\t\t: %" PRIi64 " (0x%08" PRIx64 ")\n",
+				 scan_result->volume_offset,
+				 scan_result->volume_offset );
+
+				fprintf(
+				 stream,
+				 "\tMetadata copy\t\t\t: %d\n",
+				 scan_result->copy_number );
+			}
+		}
+		fprintf(
+		 stream,
+		 "\n" );
+	}
+	fprintf(
+	 stream,
+	 "Volumes:\n" );
+
+	for( result_index = 0;
+	     result_index < number_of_results;
+	     result_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     scan_handle->results_array,
+		     result_index,
+		     (intptr_t **) &scan_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve result: %d.",
+			 function,
+			 result_index );
+
+			return( -1 );
+		}
+		if( scan_result->type == SCAN_RESULT_TYPE_VOLUME_HEADER )
+		{
+			fprintf(
+			 stream,
+			 "\t%" PRIi64 " (0x%08" PRIx64 ")\n",
+			 scan_result->offset,
+			 scan_result->offset );
+
+			continue;
+		}
+		if( scan_result->volume_offset == -1 )
+		{
+			continue;
+		}
+		/* Volumes without a volume header are listed once
+		 */
+		result = scan_handle_get_result_by_offset(
+		          scan_handle,
+		          scan_result->volume_offset,
+		          SCAN_RESULT_TYPE_VOLUME_HEADER,
+		          &other_result,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume header at offset: %" PRIi64 ".",
+			 function,
+			 scan_result->volume_offset );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			continue;
+		}
+		for( other_result_index = 0;
+		     other_result_index < result_index;
+		     other_result_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     scan_handle->results_array,
+			     other_result_index,
+			     (intptr_t **) &other_result,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve result: %d.",
+				 function,
+				 other_result_index );
+
+				return( -1 );
+			}
+			if( ( other_result->type == SCAN_RESULT_TYPE_METADATA_BLOCK )
+			 && ( other_result->volume_offset == scan_result->volume_offset ) )
+			{
+				break;
+			}
+		}
+		if( other_result_index >= result_index )
+		{
+			fprintf(
+			 stream,
+			 "\t%" PRIi64 " (0x%08" PRIx64 ") without volume header\n",
+			 scan_result->volume_offset,
+			 scan_result->volume_offset );
+		}
+	}
+	fprintf(
+	 stream,
+	 "\n" );
+
+	return( 1 );
+}
+
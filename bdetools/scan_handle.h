@@ -0,0 +1,307 @@
+/*
+ * Scan handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SCAN_HANDLE_H )
+#define _SCAN_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "bdetools_libcdata.h"
+#include "bdetools_libcerror.h"
+#include "bdetools_libcfile.h"
+#include "bdetools_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the sectors that are checked for signatures
+ */
+#define SCAN_HANDLE_SECTOR_SIZE				512
+
+/* The default chunk size
+ */
+#define SCAN_HANDLE_DEFAULT_CHUNK_SIZE			( 16 * 1024 * 1024 )
+
+/* The number of chunks in flight per worker
+ */
+#define SCAN_HANDLE_NUMBER_OF_CHUNKS_PER_WORKER		2
+
+/* The maximum number of workers
+ */
+#define SCAN_HANDLE_MAXIMUM_NUMBER_OF_WORKERS		32
+
+enum SCAN_CHUNK_STATES
+{
+	SCAN_CHUNK_STATE_FREE		= 0,
+	SCAN_CHUNK_STATE_QUEUED		= 1,
+	SCAN_CHUNK_STATE_SCANNED	= 2,
+	SCAN_CHUNK_STATE_FAILED		= 3
+};
+
+enum SCAN_RESULT_TYPES
+{
+	SCAN_RESULT_TYPE_VOLUME_HEADER	= 1,
+	SCAN_RESULT_TYPE_METADATA_BLOCK	= 2
+};
+
+enum SCAN_VOLUME_VERSIONS
+{
+	SCAN_VOLUME_VERSION_WINDOWS_VISTA	= 1,
+	SCAN_VOLUME_VERSION_WINDOWS_7		= 2,
+	SCAN_VOLUME_VERSION_TO_GO		= 3
+};
+
+typedef struct scan_chunk scan_chunk_t;
+typedef struct scan_handle scan_handle_t;
+typedef struct scan_result scan_result_t;
+
+struct scan_result
+{
+	/* The offset of the signature in the image
+	 */
+	off64_t offset;
+
+	/* The type
+	 */
+	int type;
+
+	/* The version
+	 * Contains the volume version for a volume header
+	 * or the format version for a metadata block
+	 */
+	int version;
+
+	/* The FVE metadata offsets relative to the start of the volume
+	 */
+	uint64_t metadata_offsets[ 3 ];
+
+	/* The volume size, which is only set for a volume header
+	 */
+	size64_t volume_size;
+
+	/* The encrypted volume size, which is only set for a version 2 metadata block
+	 */
+	size64_t encrypted_volume_size;
+
+	/* The offset of the volume the metadata block belongs to or -1 if not known
+	 */
+	off64_t volume_offset;
+
+	/* The metadata copy number (1, 2 or 3) or 0 if not known
+	 */
+	int copy_number;
+};
+
+struct scan_chunk
+{
+	/* The scan handle
+	 */
+	scan_handle_t *scan_handle;
+
+	/* The file, every chunk has its own file so that
+	 * workers do not share a file offset
+	 */
+	libcfile_file_t *file;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The offset of the data in the image
+	 */
+	off64_t offset;
+
+	/* The size of the data
+	 */
+	size_t data_size;
+
+	/* The results found in the chunk
+	 */
+	libcdata_array_t *results_array;
+
+	/* The state
+	 */
+	int state;
+};
+
+struct scan_handle
+{
+	/* The image size
+	 */
+	size64_t image_size;
+
+	/* The chunk size
+	 */
+	size_t chunk_size;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* The chunks
+	 */
+	scan_chunk_t *chunks;
+
+	/* The number of chunks
+	 */
+	int number_of_chunks;
+
+	/* The results, sorted by offset
+	 */
+	libcdata_array_t *results_array;
+
+	/* Value to indicate if the status should be printed
+	 */
+	uint8_t print_status;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	/* The workers thread pool
+	 */
+	libcthreads_thread_pool_t *workers_thread_pool;
+
+	/* The chunks mutex
+	 */
+	libcthreads_mutex_t *chunks_mutex;
+
+	/* The chunks condition
+	 */
+	libcthreads_condition_t *chunks_condition;
+#endif
+};
+
+int scan_handle_system_string_copy_from_64_bit_in_decimal(
+     const system_character_t *string,
+     size_t string_size,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+int scan_handle_initialize(
+     scan_handle_t **scan_handle,
+     uint8_t print_status,
+     libcerror_error_t **error );
+
+int scan_handle_free(
+     scan_handle_t **scan_handle,
+     libcerror_error_t **error );
+
+int scan_handle_signal_abort(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error );
+
+int scan_handle_set_number_of_workers(
+     scan_handle_t *scan_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int scan_handle_open(
+     scan_handle_t *scan_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int scan_handle_close(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error );
+
+int scan_handle_free_result(
+     scan_result_t **scan_result,
+     libcerror_error_t **error );
+
+int scan_handle_check_volume_header(
+     const uint8_t *data,
+     size_t data_size,
+     scan_result_t *scan_result );
+
+int scan_handle_check_metadata_block_header(
+     const uint8_t *data,
+     size_t data_size,
+     scan_result_t *scan_result );
+
+int scan_handle_scan_data(
+     const uint8_t *data,
+     size_t data_size,
+     off64_t data_offset,
+     libcdata_array_t *results_array,
+     libcerror_error_t **error );
+
+int scan_handle_scan_chunk(
+     scan_handle_t *scan_handle,
+     scan_chunk_t *scan_chunk,
+     libcerror_error_t **error );
+
+int scan_handle_chunk_callback(
+     scan_chunk_t *scan_chunk,
+     void *arguments );
+
+int scan_handle_move_chunk_results(
+     scan_handle_t *scan_handle,
+     scan_chunk_t *scan_chunk,
+     libcerror_error_t **error );
+
+void scan_handle_print_status(
+      scan_handle_t *scan_handle,
+      off64_t scan_offset,
+      int *last_percentage );
+
+int scan_handle_free_workers(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error );
+
+int scan_handle_scan(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error );
+
+int scan_handle_get_result_by_offset(
+     scan_handle_t *scan_handle,
+     off64_t offset,
+     int type,
+     scan_result_t **scan_result,
+     libcerror_error_t **error );
+
+int scan_handle_resolve_results(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error );
+
+void scan_handle_volume_version_fprint(
+      int version,
+      FILE *stream );
+
+int scan_handle_results_fprint(
+     scan_handle_t *scan_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SCAN_HANDLE_H ) */
+
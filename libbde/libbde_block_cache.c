@@ -0,0 +1,787 @@
+/*
+ * Block cache functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libbde_block_cache.h"
+#include "libbde_definitions.h"
+#include "libbde_io_handle.h"
+#include "libbde_libbfio.h"
+#include "libbde_libcerror.h"
+#include "libbde_libcthreads.h"
+#include "libbde_libfcache.h"
+#include "libbde_positional_file.h"
+#include "libbde_sector_data.h"
+#include "libbde_types.h"
+
+/* Creates a block cache
+ * Make sure the value block_cache is referencing, is set to NULL
+ * The maximum size is the amount of memory in bytes the cached blocks can use
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_block_cache_initialize(
+     libbde_block_cache_t **block_cache,
+     size64_t maximum_size,
+     libcerror_error_t **error )
+{
+	libbde_internal_block_cache_t *internal_block_cache = NULL;
+	static char *function                               = "libbde_block_cache_initialize";
+	size64_t maximum_number_of_blocks                   = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_number_of_blocks = maximum_size / LIBBDE_BLOCK_CACHE_BLOCK_SIZE;
+
+	if( ( maximum_number_of_blocks == 0 )
+	 || ( maximum_number_of_blocks > (size64_t) INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_cache = memory_allocate_structure(
+	                        libbde_internal_block_cache_t );
+
+	if( internal_block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_block_cache,
+	     0,
+	     sizeof( libbde_internal_block_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block cache.",
+		 function );
+
+		memory_free(
+		 internal_block_cache );
+
+		return( -1 );
+	}
+	if( libfcache_date_time_get_timestamp(
+	     &( internal_block_cache->cache_timestamp ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache timestamp.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     &( internal_block_cache->cache ),
+	     (int) maximum_number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create blocks cache.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_block_cache->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_block_cache->maximum_number_of_blocks = (int) maximum_number_of_blocks;
+	internal_block_cache->block_size               = LIBBDE_BLOCK_CACHE_BLOCK_SIZE;
+
+	*block_cache = (libbde_block_cache_t *) internal_block_cache;
+
+	return( 1 );
+
+on_error:
+	if( internal_block_cache != NULL )
+	{
+		if( internal_block_cache->cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( internal_block_cache->cache ),
+			 NULL );
+		}
+		memory_free(
+		 internal_block_cache );
+	}
+	return( -1 );
+}
+
+/* Frees a block cache
+ * The block cache should not be freed while it is in use by a volume
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_block_cache_free(
+     libbde_block_cache_t **block_cache,
+     libcerror_error_t **error )
+{
+	libbde_internal_block_cache_t *internal_block_cache = NULL;
+	static char *function                               = "libbde_block_cache_free";
+	int result                                          = 1;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+		internal_block_cache = (libbde_internal_block_cache_t *) *block_cache;
+		*block_cache         = NULL;
+
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_block_cache->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libfcache_cache_free(
+		     &( internal_block_cache->cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free blocks cache.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_block_cache );
+	}
+	return( result );
+}
+
+/* Binds the block cache to an image
+ * The block cache is bound to the image of the first volume it is set for,
+ * volumes on other images cannot use the block cache since their blocks
+ * would be mistaken for blocks of that image
+ * Returns 1 if successful, 0 if the block cache is bound to another image or -1 on error
+ */
+int libbde_block_cache_bind_image(
+     libbde_block_cache_t *block_cache,
+     uint64_t image_identifier,
+     libcerror_error_t **error )
+{
+	libbde_internal_block_cache_t *internal_block_cache = NULL;
+	static char *function                               = "libbde_block_cache_bind_image";
+	int result                                          = 1;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_cache = (libbde_internal_block_cache_t *) block_cache;
+
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_block_cache->is_bound == 0 )
+	{
+		internal_block_cache->image_identifier = image_identifier;
+		internal_block_cache->is_bound         = 1;
+	}
+	else if( internal_block_cache->image_identifier != image_identifier )
+	{
+		result = 0;
+	}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads a block from the file IO handle
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libbde_block_cache_read_block(
+     libbde_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *block_data,
+     size_t block_data_size,
+     off64_t block_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_block_cache_read_block";
+	ssize_t read_count    = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->positional_file != NULL )
+	{
+		read_count = libbde_positional_file_read_buffer_at_offset(
+		              io_handle->positional_file,
+		              block_data,
+		              block_data_size,
+		              block_offset,
+		              error );
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              block_data,
+		              block_data_size,
+		              block_offset,
+		              error );
+	}
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 block_offset,
+		 block_offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Reads data at a specific offset of the file IO handle using the block cache
+ * Blocks that are not cached are read from the file IO handle and stored in the cache
+ * The blocks are identified by their offset in the file IO handle and the block cache offset
+ * of the IO handle, which allows volumes on the same image to share the block cache
+ * The statistics are only updated if set
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libbde_block_cache_read_buffer_at_offset(
+     libbde_block_cache_t *block_cache,
+     libbde_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     libbde_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	libbde_internal_block_cache_t *internal_block_cache = NULL;
+	libbde_sector_data_t *block                         = NULL;
+	libbde_sector_data_t *cached_block                  = NULL;
+	libfcache_cache_value_t *cache_value                = NULL;
+	static char *function                               = "libbde_block_cache_read_buffer_at_offset";
+	size_t block_data_offset                            = 0;
+	size_t buffer_offset                                = 0;
+	size_t read_size                                    = 0;
+	ssize_t read_count                                  = 0;
+	off64_t block_offset                                = 0;
+	off64_t cache_offset                                = 0;
+	off64_t cached_offset                               = 0;
+	int64_t cached_timestamp                            = 0;
+	int cache_entry_index                               = 0;
+	int cached_file_index                               = 0;
+	int result                                          = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_cache = (libbde_internal_block_cache_t *) block_cache;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( io_handle->block_cache_offset < 0 )
+	 || ( offset > (off64_t) ( INT64_MAX - io_handle->block_cache_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		block_data_offset = (size_t) ( ( offset + (off64_t) buffer_offset ) % internal_block_cache->block_size );
+		block_offset      = offset + (off64_t) ( buffer_offset - block_data_offset );
+		cache_offset      = block_offset + io_handle->block_cache_offset;
+		cache_entry_index = (int) ( ( cache_offset / internal_block_cache->block_size ) % internal_block_cache->maximum_number_of_blocks );
+
+		read_size = internal_block_cache->block_size - block_data_offset;
+
+		if( read_size > ( buffer_size - buffer_offset ) )
+		{
+			read_size = buffer_size - buffer_offset;
+		}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_block_cache->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		cache_value = NULL;
+		result      = libfcache_cache_get_value_by_index(
+		               internal_block_cache->cache,
+		               cache_entry_index,
+		               &cache_value,
+		               error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value: %d.",
+			 function,
+			 cache_entry_index );
+		}
+		else if( cache_value != NULL )
+		{
+			result = libfcache_cache_value_get_identifier(
+			          cache_value,
+			          &cached_file_index,
+			          &cached_offset,
+			          &cached_timestamp,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve cache value identifier.",
+				 function );
+
+				result = -1;
+			}
+			else if( ( cached_file_index != 0 )
+			      || ( cached_offset != cache_offset )
+			      || ( cached_timestamp != internal_block_cache->cache_timestamp ) )
+			{
+				result = 0;
+			}
+			else
+			{
+				cached_block = NULL;
+				result       = libfcache_cache_value_get_value(
+				                cache_value,
+				                (intptr_t **) &cached_block,
+				                error );
+
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve block from cache value.",
+					 function );
+
+					result = -1;
+				}
+				else if( cached_block == NULL )
+				{
+					result = 0;
+				}
+				else if( memory_copy(
+				          &( buffer[ buffer_offset ] ),
+				          &( cached_block->data[ block_data_offset ] ),
+				          read_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy block data.",
+					 function );
+
+					result = -1;
+				}
+			}
+		}
+		else
+		{
+			result = 0;
+		}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_block_cache->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( result == -1 )
+		{
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( statistics != NULL )
+			{
+				libbde_statistics_add_value(
+				 &( statistics->number_of_block_cache_hits ),
+				 1 );
+			}
+
+			buffer_offset += read_size;
+
+			continue;
+		}
+		if( statistics != NULL )
+		{
+			libbde_statistics_add_value(
+			 &( statistics->number_of_block_cache_misses ),
+			 1 );
+		}
+
+		/* The block is read outside the lock so that volumes sharing the block cache
+		 * do not have to wait for each other's reads
+		 */
+		if( block == NULL )
+		{
+			if( libbde_sector_data_initialize(
+			     &block,
+			     internal_block_cache->block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create block.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		read_count = libbde_block_cache_read_block(
+		              io_handle,
+		              file_io_handle,
+		              block->data,
+		              block->data_size,
+		              block_offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 block_offset,
+			 block_offset );
+
+			goto on_error;
+		}
+		if( statistics != NULL )
+		{
+			libbde_statistics_add_value(
+			 &( statistics->number_of_bytes_read ),
+			 (uint64_t) read_count );
+		}
+
+		/* The end of the file IO handle was reached
+		 */
+		if( (size_t) read_count <= block_data_offset )
+		{
+			break;
+		}
+		if( read_size > ( (size_t) read_count - block_data_offset ) )
+		{
+			read_size = (size_t) read_count - block_data_offset;
+		}
+		if( memory_copy(
+		     &( buffer[ buffer_offset ] ),
+		     &( block->data[ block_data_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy block data.",
+			 function );
+
+			goto on_error;
+		}
+		buffer_offset += read_size;
+
+		/* Only complete blocks are stored in the cache
+		 */
+		if( (size_t) read_count != block->data_size )
+		{
+			break;
+		}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_block_cache->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		result = libfcache_cache_set_value_by_index(
+		          internal_block_cache->cache,
+		          cache_entry_index,
+		          0,
+		          cache_offset,
+		          internal_block_cache->cache_timestamp,
+		          (intptr_t *) block,
+		          (int (*)(intptr_t **, libcerror_error_t **)) &libbde_sector_data_free,
+		          LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set block in cache.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			block = NULL;
+		}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_block_cache->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( result == -1 )
+		{
+			goto on_error;
+		}
+	}
+	if( block != NULL )
+	{
+		if( libbde_sector_data_free(
+		     &block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free block.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( (ssize_t) buffer_offset );
+
+on_error:
+	if( block != NULL )
+	{
+		libbde_sector_data_free(
+		 &block,
+		 NULL );
+	}
+	return( -1 );
+}
+
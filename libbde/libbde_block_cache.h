@@ -0,0 +1,118 @@
+/*
+ * Block cache functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBDE_INTERNAL_BLOCK_CACHE_H )
+#define _LIBBDE_INTERNAL_BLOCK_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbde_extern.h"
+#include "libbde_io_handle.h"
+#include "libbde_libbfio.h"
+#include "libbde_libcerror.h"
+#include "libbde_libcthreads.h"
+#include "libbde_libfcache.h"
+#include "libbde_statistics.h"
+#include "libbde_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libbde_internal_block_cache libbde_internal_block_cache_t;
+
+struct libbde_internal_block_cache
+{
+	/* The cache timestamp
+	 */
+	int64_t cache_timestamp;
+
+	/* The blocks cache
+	 * Contains the data of the blocks as read from the file IO handle
+	 */
+	libfcache_cache_t *cache;
+
+	/* The maximum number of blocks
+	 */
+	int maximum_number_of_blocks;
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The identifier of the image the block cache is bound to
+	 * The cached blocks are identified by their offset in that image
+	 */
+	uint64_t image_identifier;
+
+	/* Value to indicate the block cache is bound to an image
+	 */
+	uint8_t is_bound;
+
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 * The block cache can be shared by multiple volumes
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+LIBBDE_EXTERN \
+int libbde_block_cache_initialize(
+     libbde_block_cache_t **block_cache,
+     size64_t maximum_size,
+     libcerror_error_t **error );
+
+LIBBDE_EXTERN \
+int libbde_block_cache_free(
+     libbde_block_cache_t **block_cache,
+     libcerror_error_t **error );
+
+int libbde_block_cache_bind_image(
+     libbde_block_cache_t *block_cache,
+     uint64_t image_identifier,
+     libcerror_error_t **error );
+
+ssize_t libbde_block_cache_read_block(
+     libbde_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *block_data,
+     size_t block_data_size,
+     off64_t block_offset,
+     libcerror_error_t **error );
+
+ssize_t libbde_block_cache_read_buffer_at_offset(
+     libbde_block_cache_t *block_cache,
+     libbde_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     libbde_statistics_t *statistics,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBDE_INTERNAL_BLOCK_CACHE_H ) */
+
@@ -554,63 +554,59 @@ int libbde_diffuser_a_encrypt(
 
 		return( -1 );
 	}
-/* TODO reverse loop
-	number_of_iterations = number_of_values * 5;
-
-	value_32bit_index1 = 0;
-	value_32bit_index2 = number_of_values - 2;
-	value_32bit_index3 = number_of_values - 5;
-*/
-
+	/* Diffuser-A encryption reverses the Diffuser-A decryption by undoing
+	 * its updates in reverse order, which requires the values of index - 2
+	 * and index - 5 to be the ones used by the update of the decryption
+	 */
 	for( number_of_iterations = 5;
 	     number_of_iterations > 0;
 	     number_of_iterations-- )
 	{
-		value_32bit_index1 = 0;
+		value_32bit_index1 = number_of_values;
 		value_32bit_index2 = number_of_values - 2;
 		value_32bit_index3 = number_of_values - 5;
 
-		while( value_32bit_index1 < ( number_of_values - 1 ) )
+		while( value_32bit_index1 > 0 )
 		{
-			values_32bit[ value_32bit_index1 ] -= values_32bit[ value_32bit_index2 ]
-			                                    ^ byte_stream_bit_rotate_left_32bit(
-			                                       values_32bit[ value_32bit_index3 ],
-			                                       9 );
-
-			value_32bit_index1++;
-			value_32bit_index2++;
-			value_32bit_index3++;
+			value_32bit_index1--;
+			value_32bit_index2--;
+			value_32bit_index3--;
 
-			if( value_32bit_index3 >= number_of_values )
-			{
-				value_32bit_index3 -= number_of_values;
-			}
 			values_32bit[ value_32bit_index1 ] -= values_32bit[ value_32bit_index2 ]
 			                                    ^ values_32bit[ value_32bit_index3 ];
 
-			value_32bit_index1++;
-			value_32bit_index2++;
-			value_32bit_index3++;
+			value_32bit_index1--;
+			value_32bit_index2--;
+			value_32bit_index3--;
 
-			if( value_32bit_index2 >= number_of_values )
-			{
-				value_32bit_index2 -= number_of_values;
-			}
 			values_32bit[ value_32bit_index1 ] -= values_32bit[ value_32bit_index2 ]
 			                                    ^ byte_stream_bit_rotate_left_32bit(
 			                                       values_32bit[ value_32bit_index3 ],
 			                                       13 );
 
-			value_32bit_index1++;
-			value_32bit_index2++;
-			value_32bit_index3++;
+			if( value_32bit_index2 == 0 )
+			{
+				value_32bit_index2 = number_of_values;
+			}
+			value_32bit_index1--;
+			value_32bit_index2--;
+			value_32bit_index3--;
 
 			values_32bit[ value_32bit_index1 ] -= values_32bit[ value_32bit_index2 ]
 			                                    ^ values_32bit[ value_32bit_index3 ];
 
-			value_32bit_index1++;
-			value_32bit_index2++;
-			value_32bit_index3++;
+			if( value_32bit_index3 == 0 )
+			{
+				value_32bit_index3 = number_of_values;
+			}
+			value_32bit_index1--;
+			value_32bit_index2--;
+			value_32bit_index3--;
+
+			values_32bit[ value_32bit_index1 ] -= values_32bit[ value_32bit_index2 ]
+			                                    ^ byte_stream_bit_rotate_left_32bit(
+			                                       values_32bit[ value_32bit_index3 ],
+			                                       9 );
 		}
 	}
 	return( 1 );
@@ -663,63 +659,59 @@ int libbde_diffuser_b_encrypt(
 
 		return( -1 );
 	}
-/* TODO reverse loop
-	number_of_iterations = number_of_values * 3;
-
-	value_32bit_index1 = 0;
-	value_32bit_index2 = 2;
-	value_32bit_index3 = 5;
-*/
-
+	/* Diffuser-B encryption reverses the Diffuser-B decryption by undoing
+	 * its updates in reverse order, which requires the values of index + 2
+	 * and index + 5 to be the ones used by the update of the decryption
+	 */
 	for( number_of_iterations = 3;
 	     number_of_iterations > 0;
 	     number_of_iterations-- )
 	{
-		value_32bit_index1 = 0;
+		value_32bit_index1 = number_of_values;
 		value_32bit_index2 = 2;
 		value_32bit_index3 = 5;
 
-		while( value_32bit_index1 < ( number_of_values - 1 ) )
+		while( value_32bit_index1 > 0 )
 		{
-			values_32bit[ value_32bit_index1 ] -= values_32bit[ value_32bit_index2 ]
-			                                    ^ values_32bit[ value_32bit_index3 ];
-
-			value_32bit_index1++;
-			value_32bit_index2++;
-			value_32bit_index3++;
+			value_32bit_index1--;
+			value_32bit_index2--;
+			value_32bit_index3--;
 
 			values_32bit[ value_32bit_index1 ] -= values_32bit[ value_32bit_index2 ]
 			                                    ^ byte_stream_bit_rotate_left_32bit(
 			                                       values_32bit[ value_32bit_index3 ],
-			                                       10 );
-
-			value_32bit_index1++;
-			value_32bit_index2++;
-			value_32bit_index3++;
+			                                       25 );
 
-			if( value_32bit_index2 >= number_of_values )
+			if( value_32bit_index3 == 0 )
 			{
-				value_32bit_index2 -= number_of_values;
+				value_32bit_index3 = number_of_values;
 			}
+			value_32bit_index1--;
+			value_32bit_index2--;
+			value_32bit_index3--;
+
 			values_32bit[ value_32bit_index1 ] -= values_32bit[ value_32bit_index2 ]
 			                                    ^ values_32bit[ value_32bit_index3 ];
 
-			value_32bit_index1++;
-			value_32bit_index2++;
-			value_32bit_index3++;
-
-			if( value_32bit_index3 >= number_of_values )
+			if( value_32bit_index2 == 0 )
 			{
-				value_32bit_index3 -= number_of_values;
+				value_32bit_index2 = number_of_values;
 			}
+			value_32bit_index1--;
+			value_32bit_index2--;
+			value_32bit_index3--;
+
 			values_32bit[ value_32bit_index1 ] -= values_32bit[ value_32bit_index2 ]
 			                                    ^ byte_stream_bit_rotate_left_32bit(
 			                                       values_32bit[ value_32bit_index3 ],
-			                                       25 );
+			                                       10 );
 
-			value_32bit_index1++;
-			value_32bit_index2++;
-			value_32bit_index3++;
+			value_32bit_index1--;
+			value_32bit_index2--;
+			value_32bit_index3--;
+
+			values_32bit[ value_32bit_index1 ] -= values_32bit[ value_32bit_index2 ]
+			                                    ^ values_32bit[ value_32bit_index3 ];
 		}
 	}
 	return( 1 );
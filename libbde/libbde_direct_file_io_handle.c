@@ -0,0 +1,1480 @@
+/*
+ * Direct IO file IO handle functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if defined( __linux__ ) && !defined( _GNU_SOURCE )
+/* Required for O_DIRECT
+ */
+#define _GNU_SOURCE
+#endif
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libbde_direct_file_io_handle.h"
+#include "libbde_libbfio.h"
+#include "libbde_libcerror.h"
+#include "libbde_libcnotify.h"
+#include "libbde_unused.h"
+
+/* Creates a direct IO file handle
+ * The direct file IO handle is managed by the handle, direct_file_io_handle
+ * is only set as a reference
+ * Make sure the value handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_direct_file_initialize(
+     libbfio_handle_t **handle,
+     libbde_direct_file_io_handle_t **direct_file_io_handle,
+     libcerror_error_t **error )
+{
+	libbde_direct_file_io_handle_t *safe_direct_file_io_handle = NULL;
+	static char *function                                      = "libbde_direct_file_initialize";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbde_direct_file_io_handle_initialize(
+	     &safe_direct_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create direct file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     handle,
+	     (intptr_t *) safe_direct_file_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libbde_direct_file_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libbde_direct_file_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libbde_direct_file_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libbde_direct_file_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libbde_direct_file_io_handle_read,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libbde_direct_file_io_handle_write,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libbde_direct_file_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libbde_direct_file_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libbde_direct_file_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libbde_direct_file_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	*direct_file_io_handle = safe_direct_file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( safe_direct_file_io_handle != NULL )
+	{
+		libbde_direct_file_io_handle_free(
+		 &safe_direct_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens a direct IO file handle
+ * Returns 1 if successful, 0 if the file cannot be opened or -1 on error
+ */
+int libbde_direct_file_open(
+     libbfio_handle_t **handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	libbde_direct_file_io_handle_t *direct_file_io_handle = NULL;
+	libbfio_handle_t *safe_handle                         = NULL;
+	libcerror_error_t *open_error                         = NULL;
+	static char *function                                 = "libbde_direct_file_open";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbde_direct_file_initialize(
+	     &safe_handle,
+	     &direct_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create direct IO file handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbde_direct_file_io_handle_set_name(
+	     direct_file_io_handle,
+	     name,
+	     name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name in direct IO file handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* Failing to open the file is not an error, the caller is expected
+	 * to fall back to reading the file as usual
+	 */
+	if( libbfio_handle_open(
+	     safe_handle,
+	     LIBBFIO_OPEN_READ,
+	     &open_error ) != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to open file for direct IO: %s.\n",
+			 function,
+			 name );
+
+			libcnotify_print_error_backtrace(
+			 open_error );
+		}
+#endif
+		libcerror_error_free(
+		 &open_error );
+
+		libbfio_handle_free(
+		 &safe_handle,
+		 NULL );
+
+		return( 0 );
+	}
+	*handle = safe_handle;
+
+	return( 1 );
+
+on_error:
+	if( safe_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &safe_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a direct file IO handle
+ * Make sure the value direct_file_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_direct_file_io_handle_initialize(
+     libbde_direct_file_io_handle_t **direct_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_direct_file_io_handle_initialize";
+	int block_index       = 0;
+
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *direct_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid direct file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*direct_file_io_handle = memory_allocate_structure(
+	                          libbde_direct_file_io_handle_t );
+
+	if( *direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create direct file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *direct_file_io_handle,
+	     0,
+	     sizeof( libbde_direct_file_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear direct file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *direct_file_io_handle )->file_descriptor = -1;
+	( *direct_file_io_handle )->block_size      = LIBBDE_DIRECT_FILE_IO_HANDLE_BLOCK_SIZE;
+
+	for( block_index = 0;
+	     block_index < LIBBDE_DIRECT_FILE_IO_HANDLE_NUMBER_OF_BLOCKS;
+	     block_index++ )
+	{
+		( *direct_file_io_handle )->block_offsets[ block_index ] = -1;
+	}
+	return( 1 );
+
+on_error:
+	if( *direct_file_io_handle != NULL )
+	{
+		memory_free(
+		 *direct_file_io_handle );
+
+		*direct_file_io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a direct file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_direct_file_io_handle_free(
+     libbde_direct_file_io_handle_t **direct_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_direct_file_io_handle_free";
+	int result            = 1;
+
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *direct_file_io_handle != NULL )
+	{
+		if( ( *direct_file_io_handle )->file_descriptor != -1 )
+		{
+			if( libbde_direct_file_io_handle_close(
+			     *direct_file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close direct file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *direct_file_io_handle )->block_pool != NULL )
+		{
+			memory_free(
+			 ( *direct_file_io_handle )->block_pool );
+		}
+		if( ( *direct_file_io_handle )->name != NULL )
+		{
+			memory_free(
+			 ( *direct_file_io_handle )->name );
+		}
+		memory_free(
+		 *direct_file_io_handle );
+
+		*direct_file_io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the direct file IO handle
+ * The clone is not opened, the name is copied
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_direct_file_io_handle_clone(
+     libbde_direct_file_io_handle_t **destination_direct_file_io_handle,
+     libbde_direct_file_io_handle_t *source_direct_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_direct_file_io_handle_clone";
+
+	if( destination_direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_direct_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: destination direct file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_direct_file_io_handle == NULL )
+	{
+		*destination_direct_file_io_handle = NULL;
+
+		return( 1 );
+	}
+	if( libbde_direct_file_io_handle_initialize(
+	     destination_direct_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination direct file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_direct_file_io_handle->name != NULL )
+	{
+		if( libbde_direct_file_io_handle_set_name(
+		     *destination_direct_file_io_handle,
+		     source_direct_file_io_handle->name,
+		     source_direct_file_io_handle->name_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set name in destination direct file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Clones are used by the read workers of which there can be many,
+	 * hence they use a smaller block pool
+	 */
+	( *destination_direct_file_io_handle )->block_size = LIBBDE_DIRECT_FILE_IO_HANDLE_CLONE_BLOCK_SIZE;
+
+	return( 1 );
+
+on_error:
+	if( *destination_direct_file_io_handle != NULL )
+	{
+		libbde_direct_file_io_handle_free(
+		 destination_direct_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the name
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_direct_file_io_handle_set_name(
+     libbde_direct_file_io_handle_t *direct_file_io_handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_direct_file_io_handle_set_name";
+
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file_io_handle->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid direct file IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_length == 0 )
+	 || ( name_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file_io_handle->name != NULL )
+	{
+		memory_free(
+		 direct_file_io_handle->name );
+
+		direct_file_io_handle->name      = NULL;
+		direct_file_io_handle->name_size = 0;
+	}
+	direct_file_io_handle->name = narrow_string_allocate(
+	                               name_length + 1 );
+
+	if( direct_file_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     direct_file_io_handle->name,
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		goto on_error;
+	}
+	direct_file_io_handle->name[ name_length ] = 0;
+	direct_file_io_handle->name_size           = name_length + 1;
+
+	return( 1 );
+
+on_error:
+	if( direct_file_io_handle->name != NULL )
+	{
+		memory_free(
+		 direct_file_io_handle->name );
+
+		direct_file_io_handle->name = NULL;
+	}
+	direct_file_io_handle->name_size = 0;
+
+	return( -1 );
+}
+
+/* Opens the direct file IO handle
+ * The file is opened to bypass the page cache if supported by the system
+ * and the file system, otherwise the file is opened as usual
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_direct_file_io_handle_open(
+     libbde_direct_file_io_handle_t *direct_file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBBDE_DIRECT_FILE_SUPPORT )
+	uint8_t *block_pool   = NULL;
+	off64_t file_size     = 0;
+	size_t block_padding  = 0;
+	int block_index       = 0;
+	int file_descriptor   = -1;
+	uint8_t use_direct_io = 0;
+#endif
+	static char *function = "libbde_direct_file_io_handle_open";
+
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file_io_handle->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid direct file IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	 || ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBDE_DIRECT_FILE_SUPPORT )
+#if defined( O_DIRECT )
+	file_descriptor = open(
+	                   direct_file_io_handle->name,
+	                   O_RDONLY | O_DIRECT );
+
+	if( file_descriptor != -1 )
+	{
+		use_direct_io = 1;
+	}
+	/* Not every file system supports direct IO, e.g. tmpfs
+	 */
+	else if( errno != EINVAL )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 direct_file_io_handle->name );
+
+		goto on_error;
+	}
+#endif /* defined( O_DIRECT ) */
+
+	if( file_descriptor == -1 )
+	{
+		file_descriptor = open(
+		                   direct_file_io_handle->name,
+		                   O_RDONLY );
+
+		if( file_descriptor == -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 errno,
+			 "%s: unable to open file: %s.",
+			 function,
+			 direct_file_io_handle->name );
+
+			goto on_error;
+		}
+	}
+#if defined( F_NOCACHE )
+	if( use_direct_io == 0 )
+	{
+		if( fcntl(
+		     file_descriptor,
+		     F_NOCACHE,
+		     1 ) != -1 )
+		{
+			use_direct_io = 1;
+		}
+	}
+#endif
+	/* The size is determined by seeking so that devices are supported as well
+	 */
+	file_size = (off64_t) lseek(
+	                       file_descriptor,
+	                       0,
+	                       SEEK_END );
+
+	if( file_size < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 errno,
+		 "%s: unable to determine size of file: %s.",
+		 function,
+		 direct_file_io_handle->name );
+
+		goto on_error;
+	}
+	/* Direct IO requires the buffers to be aligned hence additional space is allocated
+	 * to align the block data within
+	 */
+	block_pool = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * ( ( direct_file_io_handle->block_size * LIBBDE_DIRECT_FILE_IO_HANDLE_NUMBER_OF_BLOCKS ) + LIBBDE_DIRECT_FILE_IO_HANDLE_ALIGNMENT ) );
+
+	if( block_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block pool.",
+		 function );
+
+		goto on_error;
+	}
+	block_padding = (size_t) ( (intptr_t) block_pool % LIBBDE_DIRECT_FILE_IO_HANDLE_ALIGNMENT );
+
+	if( block_padding != 0 )
+	{
+		block_padding = LIBBDE_DIRECT_FILE_IO_HANDLE_ALIGNMENT - block_padding;
+	}
+	for( block_index = 0;
+	     block_index < LIBBDE_DIRECT_FILE_IO_HANDLE_NUMBER_OF_BLOCKS;
+	     block_index++ )
+	{
+		direct_file_io_handle->block_offsets[ block_index ]    = -1;
+		direct_file_io_handle->block_data_sizes[ block_index ] = 0;
+	}
+	direct_file_io_handle->file_descriptor  = file_descriptor;
+	direct_file_io_handle->use_direct_io    = use_direct_io;
+	direct_file_io_handle->size             = (size64_t) file_size;
+	direct_file_io_handle->access_flags     = access_flags;
+	direct_file_io_handle->current_offset   = 0;
+	direct_file_io_handle->block_pool       = block_pool;
+	direct_file_io_handle->block_data       = &( block_pool[ block_padding ] );
+	direct_file_io_handle->next_block_index = 0;
+
+	return( 1 );
+
+on_error:
+	if( block_pool != NULL )
+	{
+		memory_free(
+		 block_pool );
+	}
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: direct IO files not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBBDE_DIRECT_FILE_SUPPORT ) */
+}
+
+/* Closes the direct file IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int libbde_direct_file_io_handle_close(
+     libbde_direct_file_io_handle_t *direct_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_direct_file_io_handle_close";
+	int block_index       = 0;
+	int result            = 0;
+
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file_io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBDE_DIRECT_FILE_SUPPORT )
+	if( close(
+	     direct_file_io_handle->file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file: %s.",
+		 function,
+		 direct_file_io_handle->name );
+
+		result = -1;
+	}
+#endif
+	if( direct_file_io_handle->block_pool != NULL )
+	{
+		memory_free(
+		 direct_file_io_handle->block_pool );
+
+		direct_file_io_handle->block_pool = NULL;
+	}
+	for( block_index = 0;
+	     block_index < LIBBDE_DIRECT_FILE_IO_HANDLE_NUMBER_OF_BLOCKS;
+	     block_index++ )
+	{
+		direct_file_io_handle->block_offsets[ block_index ]    = -1;
+		direct_file_io_handle->block_data_sizes[ block_index ] = 0;
+	}
+	direct_file_io_handle->file_descriptor  = -1;
+	direct_file_io_handle->use_direct_io    = 0;
+	direct_file_io_handle->size             = 0;
+	direct_file_io_handle->access_flags     = 0;
+	direct_file_io_handle->current_offset   = 0;
+	direct_file_io_handle->block_data       = NULL;
+	direct_file_io_handle->next_block_index = 0;
+
+	return( result );
+}
+
+/* Reads a block aligned buffer at a specific offset from the file
+ * If direct IO is rejected for the read, e.g. due to the alignment of the buffer,
+ * the read is retried without direct IO. If the file is read without direct IO
+ * the system is advised that the data read is no longer needed in the page cache.
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbde_direct_file_io_handle_read_block(
+         libbde_direct_file_io_handle_t *direct_file_io_handle,
+         off64_t offset,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libbde_direct_file_io_handle_read_block";
+	size_t data_offset    = 0;
+	ssize_t read_count    = 0;
+
+#if defined( HAVE_LIBBDE_DIRECT_FILE_SUPPORT ) && defined( O_DIRECT ) && defined( F_GETFL ) && defined( F_SETFL )
+	int file_status_flags = 0;
+#endif
+
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file_io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBDE_DIRECT_FILE_SUPPORT )
+	if( lseek(
+	     direct_file_io_handle->file_descriptor,
+	     (off_t) offset,
+	     SEEK_SET ) == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 errno,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		read_count = read(
+		              direct_file_io_handle->file_descriptor,
+		              &( data[ data_offset ] ),
+		              data_size - data_offset );
+
+		if( read_count == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+#if defined( O_DIRECT ) && defined( F_GETFL ) && defined( F_SETFL )
+			if( ( errno == EINVAL )
+			 && ( direct_file_io_handle->use_direct_io != 0 ) )
+			{
+				file_status_flags = fcntl(
+				                     direct_file_io_handle->file_descriptor,
+				                     F_GETFL );
+
+				if( ( file_status_flags != -1 )
+				 && ( fcntl(
+				       direct_file_io_handle->file_descriptor,
+				       F_SETFL,
+				       file_status_flags & ~O_DIRECT ) != -1 ) )
+				{
+					direct_file_io_handle->use_direct_io = 0;
+
+					continue;
+				}
+			}
+#endif /* defined( O_DIRECT ) && defined( F_GETFL ) && defined( F_SETFL ) */
+
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		if( read_count == 0 )
+		{
+			break;
+		}
+		data_offset += (size_t) read_count;
+	}
+#if defined( HAVE_POSIX_FADVISE ) && defined( POSIX_FADV_DONTNEED )
+	if( ( direct_file_io_handle->use_direct_io == 0 )
+	 && ( data_offset > 0 ) )
+	{
+		/* The advice is only a hint, hence failure is ignored
+		 */
+		posix_fadvise(
+		 direct_file_io_handle->file_descriptor,
+		 (off_t) offset,
+		 (off_t) data_offset,
+		 POSIX_FADV_DONTNEED );
+	}
+#endif
+	return( (ssize_t) data_offset );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: direct IO files not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBBDE_DIRECT_FILE_SUPPORT ) */
+}
+
+/* Reads a buffer from the direct file IO handle
+ * Data is read from the file in aligned blocks that are kept in a small block pool,
+ * so that small reads, such as those of individual sectors, do not each require
+ * a read from the file. Block aligned reads of at least the block size into
+ * an aligned buffer are read directly into the buffer.
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbde_direct_file_io_handle_read(
+         libbde_direct_file_io_handle_t *direct_file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	uint8_t *block_data      = NULL;
+	static char *function    = "libbde_direct_file_io_handle_read";
+	size_t block_data_offset = 0;
+	size_t buffer_offset     = 0;
+	size_t read_size         = 0;
+	ssize_t read_count       = 0;
+	off64_t block_offset     = 0;
+	int block_index          = 0;
+
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file_io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < size )
+	{
+		if( (size64_t) direct_file_io_handle->current_offset >= direct_file_io_handle->size )
+		{
+			break;
+		}
+		block_offset      = ( direct_file_io_handle->current_offset / (off64_t) direct_file_io_handle->block_size ) * (off64_t) direct_file_io_handle->block_size;
+		block_data_offset = (size_t) ( direct_file_io_handle->current_offset - block_offset );
+
+		if( ( block_data_offset == 0 )
+		 && ( ( size - buffer_offset ) >= direct_file_io_handle->block_size )
+		 && ( ( (intptr_t) &( buffer[ buffer_offset ] ) % LIBBDE_DIRECT_FILE_IO_HANDLE_ALIGNMENT ) == 0 ) )
+		{
+			read_size = ( ( size - buffer_offset ) / direct_file_io_handle->block_size ) * direct_file_io_handle->block_size;
+
+			read_count = libbde_direct_file_io_handle_read_block(
+			              direct_file_io_handle,
+			              direct_file_io_handle->current_offset,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              error );
+
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read from file.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_offset                         += (size_t) read_count;
+			direct_file_io_handle->current_offset += (off64_t) read_count;
+
+			if( (size_t) read_count < read_size )
+			{
+				break;
+			}
+			continue;
+		}
+		for( block_index = 0;
+		     block_index < LIBBDE_DIRECT_FILE_IO_HANDLE_NUMBER_OF_BLOCKS;
+		     block_index++ )
+		{
+			if( direct_file_io_handle->block_offsets[ block_index ] == block_offset )
+			{
+				break;
+			}
+		}
+		if( block_index >= LIBBDE_DIRECT_FILE_IO_HANDLE_NUMBER_OF_BLOCKS )
+		{
+			block_index = direct_file_io_handle->next_block_index;
+			block_data  = &( direct_file_io_handle->block_data[ block_index * direct_file_io_handle->block_size ] );
+
+			direct_file_io_handle->next_block_index = ( block_index + 1 ) % LIBBDE_DIRECT_FILE_IO_HANDLE_NUMBER_OF_BLOCKS;
+
+			direct_file_io_handle->block_offsets[ block_index ] = -1;
+
+			read_count = libbde_direct_file_io_handle_read_block(
+			              direct_file_io_handle,
+			              block_offset,
+			              block_data,
+			              direct_file_io_handle->block_size,
+			              error );
+
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read block at offset: %" PRIi64 " (0x%08" PRIx64 ") from file.",
+				 function,
+				 block_offset,
+				 block_offset );
+
+				return( -1 );
+			}
+			direct_file_io_handle->block_offsets[ block_index ]    = block_offset;
+			direct_file_io_handle->block_data_sizes[ block_index ] = (size_t) read_count;
+		}
+		if( block_data_offset >= direct_file_io_handle->block_data_sizes[ block_index ] )
+		{
+			break;
+		}
+		read_size = direct_file_io_handle->block_data_sizes[ block_index ] - block_data_offset;
+
+		if( read_size > ( size - buffer_offset ) )
+		{
+			read_size = size - buffer_offset;
+		}
+		block_data = &( direct_file_io_handle->block_data[ block_index * direct_file_io_handle->block_size ] );
+
+		if( memory_copy(
+		     &( buffer[ buffer_offset ] ),
+		     &( block_data[ block_data_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy block data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		buffer_offset                         += read_size;
+		direct_file_io_handle->current_offset += (off64_t) read_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Writes a buffer to the direct file IO handle
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libbde_direct_file_io_handle_write(
+         libbde_direct_file_io_handle_t *direct_file_io_handle,
+         const uint8_t *buffer LIBBDE_ATTRIBUTE_UNUSED,
+         size_t size LIBBDE_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	static char *function = "libbde_direct_file_io_handle_write";
+
+	LIBBDE_UNREFERENCED_PARAMETER( buffer )
+	LIBBDE_UNREFERENCED_PARAMETER( size )
+
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: write access not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Seeks a certain offset within the direct file IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libbde_direct_file_io_handle_seek_offset(
+         libbde_direct_file_io_handle_t *direct_file_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libbde_direct_file_io_handle_seek_offset";
+
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file_io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += direct_file_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) direct_file_io_handle->size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	direct_file_io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if a file exists
+ * Returns 1 if file exists, 0 if not or -1 on error
+ */
+int libbde_direct_file_io_handle_exists(
+     libbde_direct_file_io_handle_t *direct_file_io_handle,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBBDE_DIRECT_FILE_SUPPORT )
+	struct stat file_statistics;
+#endif
+	static char *function = "libbde_direct_file_io_handle_exists";
+
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBDE_DIRECT_FILE_SUPPORT )
+	if( stat(
+	     direct_file_io_handle->name,
+	     &file_statistics ) != 0 )
+	{
+		if( errno == ENOENT )
+		{
+			return( 0 );
+		}
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: direct IO files not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBBDE_DIRECT_FILE_SUPPORT ) */
+}
+
+/* Determines if the direct file IO handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libbde_direct_file_io_handle_is_open(
+     libbde_direct_file_io_handle_t *direct_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_direct_file_io_handle_is_open";
+
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file_io_handle->file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the file size
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_direct_file_io_handle_get_size(
+     libbde_direct_file_io_handle_t *direct_file_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_direct_file_io_handle_get_size";
+
+	if( direct_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_file_io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = direct_file_io_handle->size;
+
+	return( 1 );
+}
+
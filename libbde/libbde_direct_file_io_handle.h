@@ -0,0 +1,194 @@
+/*
+ * Direct IO file IO handle functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBDE_DIRECT_FILE_IO_HANDLE_H )
+#define _LIBBDE_DIRECT_FILE_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbde_libbfio.h"
+#include "libbde_libcerror.h"
+
+#if !defined( WINAPI ) && defined( HAVE_FCNTL_H ) && defined( HAVE_UNISTD_H )
+#define HAVE_LIBBDE_DIRECT_FILE_SUPPORT
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the blocks read from the file
+ */
+#define LIBBDE_DIRECT_FILE_IO_HANDLE_BLOCK_SIZE		( 4 * 1024 * 1024 )
+
+/* The size of the blocks read from the file by a clone
+ */
+#define LIBBDE_DIRECT_FILE_IO_HANDLE_CLONE_BLOCK_SIZE	( 256 * 1024 )
+
+/* The number of blocks in the block pool
+ */
+#define LIBBDE_DIRECT_FILE_IO_HANDLE_NUMBER_OF_BLOCKS	2
+
+/* The alignment of the blocks in memory and on the file
+ */
+#define LIBBDE_DIRECT_FILE_IO_HANDLE_ALIGNMENT		4096
+
+typedef struct libbde_direct_file_io_handle libbde_direct_file_io_handle_t;
+
+struct libbde_direct_file_io_handle
+{
+	/* The name
+	 */
+	char *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* The file descriptor
+	 */
+	int file_descriptor;
+
+	/* Value to indicate the file is read bypassing the page cache
+	 */
+	uint8_t use_direct_io;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The block pool allocation
+	 */
+	uint8_t *block_pool;
+
+	/* The block data, aligned within the block pool
+	 */
+	uint8_t *block_data;
+
+	/* The offsets of the blocks, -1 if not set
+	 */
+	off64_t block_offsets[ LIBBDE_DIRECT_FILE_IO_HANDLE_NUMBER_OF_BLOCKS ];
+
+	/* The sizes of the data of the blocks
+	 */
+	size_t block_data_sizes[ LIBBDE_DIRECT_FILE_IO_HANDLE_NUMBER_OF_BLOCKS ];
+
+	/* The index of the next block to replace
+	 */
+	int next_block_index;
+};
+
+int libbde_direct_file_initialize(
+     libbfio_handle_t **handle,
+     libbde_direct_file_io_handle_t **direct_file_io_handle,
+     libcerror_error_t **error );
+
+int libbde_direct_file_open(
+     libbfio_handle_t **handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int libbde_direct_file_io_handle_initialize(
+     libbde_direct_file_io_handle_t **direct_file_io_handle,
+     libcerror_error_t **error );
+
+int libbde_direct_file_io_handle_free(
+     libbde_direct_file_io_handle_t **direct_file_io_handle,
+     libcerror_error_t **error );
+
+int libbde_direct_file_io_handle_clone(
+     libbde_direct_file_io_handle_t **destination_direct_file_io_handle,
+     libbde_direct_file_io_handle_t *source_direct_file_io_handle,
+     libcerror_error_t **error );
+
+int libbde_direct_file_io_handle_set_name(
+     libbde_direct_file_io_handle_t *direct_file_io_handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int libbde_direct_file_io_handle_open(
+     libbde_direct_file_io_handle_t *direct_file_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libbde_direct_file_io_handle_close(
+     libbde_direct_file_io_handle_t *direct_file_io_handle,
+     libcerror_error_t **error );
+
+ssize_t libbde_direct_file_io_handle_read_block(
+         libbde_direct_file_io_handle_t *direct_file_io_handle,
+         off64_t offset,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error );
+
+ssize_t libbde_direct_file_io_handle_read(
+         libbde_direct_file_io_handle_t *direct_file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libbde_direct_file_io_handle_write(
+         libbde_direct_file_io_handle_t *direct_file_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libbde_direct_file_io_handle_seek_offset(
+         libbde_direct_file_io_handle_t *direct_file_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libbde_direct_file_io_handle_exists(
+     libbde_direct_file_io_handle_t *direct_file_io_handle,
+     libcerror_error_t **error );
+
+int libbde_direct_file_io_handle_is_open(
+     libbde_direct_file_io_handle_t *direct_file_io_handle,
+     libcerror_error_t **error );
+
+int libbde_direct_file_io_handle_get_size(
+     libbde_direct_file_io_handle_t *direct_file_io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBDE_DIRECT_FILE_IO_HANDLE_H ) */
+
@@ -30,6 +30,7 @@
 #include "libbde_libcaes.h"
 #include "libbde_libcerror.h"
 #include "libbde_libcnotify.h"
+#include "libbde_unused.h"
 
 /* Creates an encryption context
  * Make sure the value encryption context is referencing, is set to NULL
@@ -623,29 +624,56 @@ int libbde_encryption_context_set_keys(
 			return( -1 );
 		}
 	}
+	/* Bind the method specific crypt functions so that de- and encrypting
+	 * a sector does not need to re-evaluate the method
+	 */
+	if( ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_128_CBC )
+	 || ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_256_CBC ) )
+	{
+		context->decrypt_function       = &libbde_encryption_context_decrypt_aes_cbc;
+		context->encrypt_function       = &libbde_encryption_context_encrypt_aes_cbc;
+		context->crypt_sectors_function = &libbde_encryption_context_crypt_sectors_aes_cbc;
+	}
+	else if( ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_128_CBC_DIFFUSER )
+	      || ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_256_CBC_DIFFUSER ) )
+	{
+		context->decrypt_function       = &libbde_encryption_context_decrypt_aes_cbc_diffuser;
+		context->encrypt_function       = &libbde_encryption_context_encrypt_aes_cbc_diffuser;
+		context->crypt_sectors_function = &libbde_encryption_context_crypt_sectors_aes_cbc_diffuser;
+	}
+	else if( ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_128_XTS )
+	      || ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_256_XTS ) )
+	{
+		context->decrypt_function       = &libbde_encryption_context_decrypt_aes_xts;
+		context->encrypt_function       = &libbde_encryption_context_encrypt_aes_xts;
+		context->crypt_sectors_function = &libbde_encryption_context_crypt_sectors_aes_xts;
+	}
 	return( 1 );
 }
 
-/* De- or encrypts a block of data
+/* Determines the AES-CBC initialization vectors of consecutive blocks
+ * The block keys of the blocks start at block_key and increase by block_key_increment
+ * If sector_keys_data is not NULL the 32-byte Diffuser sector keys are determined as well
  * Returns 1 if successful or -1 on error
  */
-int libbde_encryption_context_crypt(
+int libbde_encryption_context_get_block_keys_data(
      libbde_encryption_context_t *context,
-     int mode,
-     const uint8_t *input_data,
-     size_t input_data_size,
-     uint8_t *output_data,
-     size_t output_data_size,
      uint64_t block_key,
+     uint64_t block_key_increment,
+     int number_of_block_keys,
+     uint8_t *initialization_vectors,
+     size_t initialization_vectors_size,
+     uint8_t *sector_keys_data,
+     size_t sector_keys_data_size,
      libcerror_error_t **error )
 {
-	uint8_t block_key_data[ 16 ];
-	uint8_t initialization_vector[ 16 ];
-	uint8_t sector_key_data[ 32 ];
+	uint8_t block_keys_data[ 32 * LIBBDE_MAXIMUM_NUMBER_OF_BATCH_SECTORS ];
 
-	static char *function        = "libbde_encryption_context_crypt";
-	size_t data_index            = 0;
-	size_t sector_key_data_index = 0;
+	static char *function       = "libbde_encryption_context_get_block_keys_data";
+	size_t block_keys_data_size = 0;
+	size_t data_offset          = 0;
+	uint64_t first_block_key    = 0;
+	int block_key_index         = 0;
 
 	if( context == NULL )
 	{
@@ -658,329 +686,367 @@ int libbde_encryption_context_crypt(
 
 		return( -1 );
 	}
-	if( ( mode != LIBBDE_ENCRYPTION_CRYPT_MODE_DECRYPT )
-	 && ( mode != LIBBDE_ENCRYPTION_CRYPT_MODE_ENCRYPT ) )
+	if( ( number_of_block_keys <= 0 )
+	 || ( number_of_block_keys > LIBBDE_MAXIMUM_NUMBER_OF_BATCH_SECTORS ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported mode.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of block keys value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( memory_set(
-	     initialization_vector,
-	     0,
-	     16 ) == NULL )
+	if( initialization_vectors == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear initialization vector.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid initialization vectors.",
 		 function );
 
 		return( -1 );
 	}
-	if( memory_set(
-	     block_key_data,
-	     0,
-	     16 ) == NULL )
+	block_keys_data_size = (size_t) number_of_block_keys * 16;
+
+	if( initialization_vectors_size < block_keys_data_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear block key data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid initialization vectors size value too small.",
 		 function );
 
 		return( -1 );
 	}
-	if( memory_set(
-	     sector_key_data,
-	     0,
-	     32 ) == NULL )
+	if( ( sector_keys_data != NULL )
+	 && ( sector_keys_data_size < ( 2 * block_keys_data_size ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear sector key data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid sector keys data size value too small.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_128_CBC )
-	 || ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_128_CBC_DIFFUSER )
-	 || ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_256_CBC )
-	 || ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_256_CBC_DIFFUSER ) )
+	first_block_key = block_key;
+
+	/* The upper 8 bytes of the block key data are always 0 except for
+	 * the last byte of the second sector key block
+	 */
+	for( block_key_index = 0;
+	     block_key_index < number_of_block_keys;
+	     block_key_index++ )
 	{
 		byte_stream_copy_from_uint64_little_endian(
-		 block_key_data,
+		 &( block_keys_data[ data_offset ] ),
 		 block_key );
 
-		/* The block key for the initialization vector is encrypted
-		 * with the FVEK
+		byte_stream_copy_from_uint64_little_endian(
+		 &( block_keys_data[ data_offset + 8 ] ),
+		 (uint64_t) 0 );
+
+		data_offset += 16;
+		block_key   += block_key_increment;
+	}
+	/* The block keys for the initialization vectors are encrypted
+	 * with the FVEK, since ECB encrypts every 16-byte block separately
+	 * all block keys are encrypted at once
+	 */
+	if( libcaes_crypt_ecb(
+	     context->fvek_encryption_context,
+	     LIBCAES_CRYPT_MODE_ENCRYPT,
+	     block_keys_data,
+	     block_keys_data_size,
+	     initialization_vectors,
+	     block_keys_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to encrypt initialization vectors.",
+		 function );
+
+		goto on_error;
+	}
+	if( sector_keys_data != NULL )
+	{
+		/* The sector key data of a block consists of the block key data
+		 * and the block key data with the last byte set to 0x80 (128),
+		 * both encrypted with the TWEAK key
 		 */
+		block_key   = first_block_key;
+		data_offset = 0;
+
+		for( block_key_index = 0;
+		     block_key_index < number_of_block_keys;
+		     block_key_index++ )
+		{
+			byte_stream_copy_from_uint64_little_endian(
+			 &( block_keys_data[ data_offset ] ),
+			 block_key );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 &( block_keys_data[ data_offset + 8 ] ),
+			 (uint64_t) 0 );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 &( block_keys_data[ data_offset + 16 ] ),
+			 block_key );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 &( block_keys_data[ data_offset + 24 ] ),
+			 (uint64_t) 0 );
+
+			block_keys_data[ data_offset + 31 ] = 0x80;
+
+			data_offset += 32;
+			block_key   += block_key_increment;
+		}
 		if( libcaes_crypt_ecb(
-		     context->fvek_encryption_context,
+		     context->tweak_encryption_context,
 		     LIBCAES_CRYPT_MODE_ENCRYPT,
-		     block_key_data,
-		     16,
-		     initialization_vector,
-		     16,
+		     block_keys_data,
+		     data_offset,
+		     sector_keys_data,
+		     data_offset,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
 			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-			 "%s: unable to encrypt initialization vector.",
+			 "%s: unable to encrypt sector keys data.",
 			 function );
 
 			goto on_error;
 		}
-		if( ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_128_CBC_DIFFUSER )
-		 || ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_256_CBC_DIFFUSER ) )
-		{
-			/* The block key for the sector key data is encrypted
-			 * with the TWEAK key
-			 */
-			if( libcaes_crypt_ecb(
-			     context->tweak_encryption_context,
-			     LIBCAES_CRYPT_MODE_ENCRYPT,
-			     block_key_data,
-			     16,
-			     sector_key_data,
-			     16,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to encrypt sector key data.",
-				 function );
-
-				goto on_error;
-			}
-			/* Set the last byte to contain 0x80 (128)
-			 */
-			block_key_data[ 15 ] = 0x80;
-
-			if( libcaes_crypt_ecb(
-			     context->tweak_encryption_context,
-			     LIBCAES_CRYPT_MODE_ENCRYPT,
-			     block_key_data,
-			     16,
-			     &( sector_key_data[ 16 ] ),
-			     16,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to encrypt sector key data.",
-				 function );
-
-				goto on_error;
-			}
-		}
-	}
-	else if( ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_128_XTS )
-	      || ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_256_XTS ) )
-	{
-		byte_stream_copy_from_uint64_little_endian(
-		 initialization_vector,
-		 block_key );
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: initialization vector:\n",
+		 "%s: initialization vectors:\n",
 		 function );
 		libcnotify_print_data(
-		 initialization_vector,
-		 16,
+		 initialization_vectors,
+		 block_keys_data_size,
 		 0 );
 	}
 #endif
-	if( mode == LIBBDE_ENCRYPTION_CRYPT_MODE_ENCRYPT )
-	{
-/* TODO safe guard input data ? */
-		if( ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_128_CBC_DIFFUSER )
-		 || ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_256_CBC_DIFFUSER ) )
-		{
-			sector_key_data_index = 0;
+	return( 1 );
 
-			for( data_index = 0;
-			     data_index < input_data_size;
-			     data_index++ )
-			{
-				output_data[ data_index ] ^= sector_key_data[ sector_key_data_index ];
+on_error:
+	memory_set(
+	 block_keys_data,
+	 0,
+	 32 * LIBBDE_MAXIMUM_NUMBER_OF_BATCH_SECTORS );
 
-				sector_key_data_index++;
+	return( -1 );
+}
 
-				if( sector_key_data_index >= 32 )
-				{
-					sector_key_data_index -= 32;
-				}
-			}
-			if( libbde_diffuser_encrypt(
-			     output_data,
-			     output_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_ENCRYPT_FAILED,
-				 "%s: unable to encrypt data using Diffuser.",
-				 function );
+/* Decrypts a block of data using AES-CBC
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_encryption_context_decrypt_aes_cbc(
+     libbde_encryption_context_t *context,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     uint64_t block_key,
+     libcerror_error_t **error )
+{
+	uint8_t initialization_vector[ 16 ];
 
-				goto on_error;
-			}
-		}
-		if( ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_128_CBC )
-		 || ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_128_CBC_DIFFUSER )
-		 || ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_256_CBC )
-		 || ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_256_CBC_DIFFUSER ) )
-		{
-			if( libcaes_crypt_cbc(
-			     context->fvek_encryption_context,
-			     LIBCAES_CRYPT_MODE_ENCRYPT,
-			     initialization_vector,
-			     16,
-			     input_data,
-			     input_data_size,
-			     output_data,
-			     output_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to AES-CBC encrypt output data.",
-				 function );
+	static char *function = "libbde_encryption_context_decrypt_aes_cbc";
 
-				goto on_error;
-			}
-		}
-		else if( ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_128_XTS )
-		      || ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_256_XTS ) )
-		{
-			if( libcaes_crypt_xts(
-			     context->fvek_encryption_tweaked_context,
-			     LIBCAES_CRYPT_MODE_ENCRYPT,
-			     initialization_vector,
-			     16,
-			     input_data,
-			     input_data_size,
-			     output_data,
-			     output_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to AES-XTS decrypt output data.",
-				 function );
+	if( libbde_encryption_context_get_block_keys_data(
+	     context,
+	     block_key,
+	     0,
+	     1,
+	     initialization_vector,
+	     16,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine block key data.",
+		 function );
 
-				goto on_error;
-			}
-		}
+		return( -1 );
 	}
-	else
+	if( libcaes_crypt_cbc(
+	     context->fvek_decryption_context,
+	     LIBCAES_CRYPT_MODE_DECRYPT,
+	     initialization_vector,
+	     16,
+	     input_data,
+	     input_data_size,
+	     output_data,
+	     output_data_size,
+	     error ) != 1 )
 	{
-		if( ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_128_CBC )
-		 || ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_128_CBC_DIFFUSER )
-		 || ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_256_CBC )
-		 || ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_256_CBC_DIFFUSER ) )
-		{
-			if( libcaes_crypt_cbc(
-			     context->fvek_decryption_context,
-			     LIBCAES_CRYPT_MODE_DECRYPT,
-			     initialization_vector,
-			     16,
-			     input_data,
-			     input_data_size,
-			     output_data,
-			     output_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to AES-CBC decrypt output data.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to AES-CBC decrypt output data.",
+		 function );
 
-				goto on_error;
-			}
-		}
-		else if( ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_128_XTS )
-		      || ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_256_XTS ) )
-		{
-			if( libcaes_crypt_xts(
-			     context->fvek_decryption_tweaked_context,
-			     LIBCAES_CRYPT_MODE_DECRYPT,
-			     initialization_vector,
-			     16,
-			     input_data,
-			     input_data_size,
-			     output_data,
-			     output_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to AES-XTS decrypt output data.",
-				 function );
+		return( -1 );
+	}
+	return( 1 );
+}
 
-				goto on_error;
-			}
-		}
-		if( ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_128_CBC_DIFFUSER )
-		 || ( context->method == LIBBDE_ENCRYPTION_METHOD_AES_256_CBC_DIFFUSER ) )
-		{
-			if( libbde_diffuser_decrypt(
-			     output_data,
-			     output_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
-				 "%s: unable to decrypt data using Diffuser.",
-				 function );
+/* Encrypts a block of data using AES-CBC
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_encryption_context_encrypt_aes_cbc(
+     libbde_encryption_context_t *context,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     uint64_t block_key,
+     libcerror_error_t **error )
+{
+	uint8_t initialization_vector[ 16 ];
 
-				goto on_error;
-			}
-			sector_key_data_index = 0;
+	static char *function = "libbde_encryption_context_encrypt_aes_cbc";
 
-			for( data_index = 0;
-			     data_index < input_data_size;
-			     data_index++ )
-			{
-				output_data[ data_index ] ^= sector_key_data[ sector_key_data_index ];
+	if( libbde_encryption_context_get_block_keys_data(
+	     context,
+	     block_key,
+	     0,
+	     1,
+	     initialization_vector,
+	     16,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine block key data.",
+		 function );
 
-				sector_key_data_index++;
+		return( -1 );
+	}
+	if( libcaes_crypt_cbc(
+	     context->fvek_encryption_context,
+	     LIBCAES_CRYPT_MODE_ENCRYPT,
+	     initialization_vector,
+	     16,
+	     input_data,
+	     input_data_size,
+	     output_data,
+	     output_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to AES-CBC encrypt output data.",
+		 function );
 
-				if( sector_key_data_index >= 32 )
-				{
-					sector_key_data_index -= 32;
-				}
-			}
-		}
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decrypts a block of data using AES-CBC and the Diffuser
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_encryption_context_decrypt_aes_cbc_diffuser(
+     libbde_encryption_context_t *context,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     uint64_t block_key,
+     libcerror_error_t **error )
+{
+	uint8_t initialization_vector[ 16 ];
+	uint8_t sector_key_data[ 32 ];
+
+	static char *function = "libbde_encryption_context_decrypt_aes_cbc_diffuser";
+	size_t data_index     = 0;
+
+	if( libbde_encryption_context_get_block_keys_data(
+	     context,
+	     block_key,
+	     0,
+	     1,
+	     initialization_vector,
+	     16,
+	     sector_key_data,
+	     32,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine block key data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcaes_crypt_cbc(
+	     context->fvek_decryption_context,
+	     LIBCAES_CRYPT_MODE_DECRYPT,
+	     initialization_vector,
+	     16,
+	     input_data,
+	     input_data_size,
+	     output_data,
+	     output_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to AES-CBC decrypt output data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbde_diffuser_decrypt(
+	     output_data,
+	     output_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+		 "%s: unable to decrypt data using Diffuser.",
+		 function );
+
+		goto on_error;
+	}
+	for( data_index = 0;
+	     data_index < input_data_size;
+	     data_index++ )
+	{
+		output_data[ data_index ] ^= sector_key_data[ data_index & 0x1f ];
 	}
 	return( 1 );
 
@@ -990,16 +1056,792 @@ on_error:
 	 0,
 	 32 );
 
+	return( -1 );
+}
+
+/* Encrypts a block of data using the Diffuser and AES-CBC
+ * The sector key and Diffuser are applied to a copy of the input data
+ * which is then AES-CBC encrypted in-place
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_encryption_context_encrypt_aes_cbc_diffuser(
+     libbde_encryption_context_t *context,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     uint64_t block_key,
+     libcerror_error_t **error )
+{
+	uint8_t initialization_vector[ 16 ];
+	uint8_t sector_key_data[ 32 ];
+
+	static char *function = "libbde_encryption_context_encrypt_aes_cbc_diffuser";
+	size_t data_index     = 0;
+
+	if( output_data_size < input_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid output data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbde_encryption_context_get_block_keys_data(
+	     context,
+	     block_key,
+	     0,
+	     1,
+	     initialization_vector,
+	     16,
+	     sector_key_data,
+	     32,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine block key data.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_data != input_data )
+	{
+		if( memory_copy(
+		     output_data,
+		     input_data,
+		     input_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy input data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( data_index = 0;
+	     data_index < input_data_size;
+	     data_index++ )
+	{
+		output_data[ data_index ] ^= sector_key_data[ data_index & 0x1f ];
+	}
+	if( libbde_diffuser_encrypt(
+	     output_data,
+	     input_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_ENCRYPT_FAILED,
+		 "%s: unable to encrypt data using Diffuser.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcaes_crypt_cbc(
+	     context->fvek_encryption_context,
+	     LIBCAES_CRYPT_MODE_ENCRYPT,
+	     initialization_vector,
+	     16,
+	     output_data,
+	     input_data_size,
+	     output_data,
+	     output_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to AES-CBC encrypt output data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
 	memory_set(
-	 block_key_data,
+	 sector_key_data,
 	 0,
-	 16 );
+	 32 );
 
-	memory_set(
+	return( -1 );
+}
+
+/* Decrypts a block of data using AES-XTS
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_encryption_context_decrypt_aes_xts(
+     libbde_encryption_context_t *context,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     uint64_t block_key,
+     libcerror_error_t **error )
+{
+	uint8_t initialization_vector[ 16 ];
+
+	static char *function = "libbde_encryption_context_decrypt_aes_xts";
+
+	byte_stream_copy_from_uint64_little_endian(
 	 initialization_vector,
+	 block_key );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( initialization_vector[ 8 ] ),
+	 (uint64_t) 0 );
+
+	if( libcaes_crypt_xts(
+	     context->fvek_decryption_tweaked_context,
+	     LIBCAES_CRYPT_MODE_DECRYPT,
+	     initialization_vector,
+	     16,
+	     input_data,
+	     input_data_size,
+	     output_data,
+	     output_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to AES-XTS decrypt output data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Encrypts a block of data using AES-XTS
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_encryption_context_encrypt_aes_xts(
+     libbde_encryption_context_t *context,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     uint64_t block_key,
+     libcerror_error_t **error )
+{
+	uint8_t initialization_vector[ 16 ];
+
+	static char *function = "libbde_encryption_context_encrypt_aes_xts";
+
+	byte_stream_copy_from_uint64_little_endian(
+	 initialization_vector,
+	 block_key );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( initialization_vector[ 8 ] ),
+	 (uint64_t) 0 );
+
+	if( libcaes_crypt_xts(
+	     context->fvek_encryption_tweaked_context,
+	     LIBCAES_CRYPT_MODE_ENCRYPT,
+	     initialization_vector,
+	     16,
+	     input_data,
+	     input_data_size,
+	     output_data,
+	     output_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to AES-XTS encrypt output data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* De- or encrypts consecutive sectors of data using AES-CBC
+ * The initialization vectors of a batch of sectors are determined at once
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_encryption_context_crypt_sectors_aes_cbc(
+     libbde_encryption_context_t *context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size LIBBDE_ATTRIBUTE_UNUSED,
+     uint64_t data_offset,
+     size_t bytes_per_sector,
+     libcerror_error_t **error )
+{
+	uint8_t initialization_vectors[ 16 * LIBBDE_MAXIMUM_NUMBER_OF_BATCH_SECTORS ];
+
+	libcaes_context_t *aes_context = NULL;
+	static char *function          = "libbde_encryption_context_crypt_sectors_aes_cbc";
+	size_t data_index              = 0;
+	size_t number_of_sectors       = 0;
+	int aes_mode                   = 0;
+	int number_of_batch_sectors    = 0;
+	int sector_index               = 0;
+
+	LIBBDE_UNREFERENCED_PARAMETER( output_data_size )
+
+	if( mode == LIBBDE_ENCRYPTION_CRYPT_MODE_DECRYPT )
+	{
+		aes_context = context->fvek_decryption_context;
+		aes_mode    = LIBCAES_CRYPT_MODE_DECRYPT;
+	}
+	else
+	{
+		aes_context = context->fvek_encryption_context;
+		aes_mode    = LIBCAES_CRYPT_MODE_ENCRYPT;
+	}
+	while( data_index < input_data_size )
+	{
+		number_of_sectors = ( input_data_size - data_index ) / bytes_per_sector;
+
+		if( number_of_sectors > (size_t) LIBBDE_MAXIMUM_NUMBER_OF_BATCH_SECTORS )
+		{
+			number_of_sectors = (size_t) LIBBDE_MAXIMUM_NUMBER_OF_BATCH_SECTORS;
+		}
+		number_of_batch_sectors = (int) number_of_sectors;
+
+		if( libbde_encryption_context_get_block_keys_data(
+		     context,
+		     data_offset + (uint64_t) data_index,
+		     (uint64_t) bytes_per_sector,
+		     number_of_batch_sectors,
+		     initialization_vectors,
+		     16 * LIBBDE_MAXIMUM_NUMBER_OF_BATCH_SECTORS,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine block keys data.",
+			 function );
+
+			return( -1 );
+		}
+		for( sector_index = 0;
+		     sector_index < number_of_batch_sectors;
+		     sector_index++ )
+		{
+			if( libcaes_crypt_cbc(
+			     aes_context,
+			     aes_mode,
+			     &( initialization_vectors[ sector_index * 16 ] ),
+			     16,
+			     &( input_data[ data_index ] ),
+			     bytes_per_sector,
+			     &( output_data[ data_index ] ),
+			     bytes_per_sector,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+				 "%s: unable to AES-CBC crypt sector data at offset: %" PRIzu ".",
+				 function,
+				 data_index );
+
+				return( -1 );
+			}
+			data_index += bytes_per_sector;
+		}
+	}
+	return( 1 );
+}
+
+/* De- or encrypts consecutive sectors of data using AES-CBC and the Diffuser
+ * The initialization vectors and sector keys of a batch of sectors are determined at once
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_encryption_context_crypt_sectors_aes_cbc_diffuser(
+     libbde_encryption_context_t *context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size LIBBDE_ATTRIBUTE_UNUSED,
+     uint64_t data_offset,
+     size_t bytes_per_sector,
+     libcerror_error_t **error )
+{
+	uint8_t initialization_vectors[ 16 * LIBBDE_MAXIMUM_NUMBER_OF_BATCH_SECTORS ];
+	uint8_t sector_keys_data[ 32 * LIBBDE_MAXIMUM_NUMBER_OF_BATCH_SECTORS ];
+
+	static char *function       = "libbde_encryption_context_crypt_sectors_aes_cbc_diffuser";
+	uint8_t *sector_key_data    = NULL;
+	size_t data_index           = 0;
+	size_t number_of_sectors    = 0;
+	size_t sector_data_index    = 0;
+	int number_of_batch_sectors = 0;
+	int sector_index            = 0;
+
+	LIBBDE_UNREFERENCED_PARAMETER( output_data_size )
+
+	while( data_index < input_data_size )
+	{
+		number_of_sectors = ( input_data_size - data_index ) / bytes_per_sector;
+
+		if( number_of_sectors > (size_t) LIBBDE_MAXIMUM_NUMBER_OF_BATCH_SECTORS )
+		{
+			number_of_sectors = (size_t) LIBBDE_MAXIMUM_NUMBER_OF_BATCH_SECTORS;
+		}
+		number_of_batch_sectors = (int) number_of_sectors;
+
+		if( libbde_encryption_context_get_block_keys_data(
+		     context,
+		     data_offset + (uint64_t) data_index,
+		     (uint64_t) bytes_per_sector,
+		     number_of_batch_sectors,
+		     initialization_vectors,
+		     16 * LIBBDE_MAXIMUM_NUMBER_OF_BATCH_SECTORS,
+		     sector_keys_data,
+		     32 * LIBBDE_MAXIMUM_NUMBER_OF_BATCH_SECTORS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine block keys data.",
+			 function );
+
+			goto on_error;
+		}
+		for( sector_index = 0;
+		     sector_index < number_of_batch_sectors;
+		     sector_index++ )
+		{
+			sector_key_data = &( sector_keys_data[ sector_index * 32 ] );
+
+			if( mode == LIBBDE_ENCRYPTION_CRYPT_MODE_DECRYPT )
+			{
+				if( libcaes_crypt_cbc(
+				     context->fvek_decryption_context,
+				     LIBCAES_CRYPT_MODE_DECRYPT,
+				     &( initialization_vectors[ sector_index * 16 ] ),
+				     16,
+				     &( input_data[ data_index ] ),
+				     bytes_per_sector,
+				     &( output_data[ data_index ] ),
+				     bytes_per_sector,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+					 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+					 "%s: unable to AES-CBC decrypt sector data at offset: %" PRIzu ".",
+					 function,
+					 data_index );
+
+					goto on_error;
+				}
+				if( libbde_diffuser_decrypt(
+				     &( output_data[ data_index ] ),
+				     bytes_per_sector,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+					 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+					 "%s: unable to decrypt sector data at offset: %" PRIzu " using Diffuser.",
+					 function,
+					 data_index );
+
+					goto on_error;
+				}
+				for( sector_data_index = 0;
+				     sector_data_index < bytes_per_sector;
+				     sector_data_index++ )
+				{
+					output_data[ data_index + sector_data_index ] ^= sector_key_data[ sector_data_index & 0x1f ];
+				}
+			}
+			else
+			{
+				if( &( output_data[ data_index ] ) != &( input_data[ data_index ] ) )
+				{
+					if( memory_copy(
+					     &( output_data[ data_index ] ),
+					     &( input_data[ data_index ] ),
+					     bytes_per_sector ) == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+						 "%s: unable to copy sector data at offset: %" PRIzu ".",
+						 function,
+						 data_index );
+
+						goto on_error;
+					}
+				}
+				for( sector_data_index = 0;
+				     sector_data_index < bytes_per_sector;
+				     sector_data_index++ )
+				{
+					output_data[ data_index + sector_data_index ] ^= sector_key_data[ sector_data_index & 0x1f ];
+				}
+				if( libbde_diffuser_encrypt(
+				     &( output_data[ data_index ] ),
+				     bytes_per_sector,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+					 LIBCERROR_ENCRYPTION_ERROR_ENCRYPT_FAILED,
+					 "%s: unable to encrypt sector data at offset: %" PRIzu " using Diffuser.",
+					 function,
+					 data_index );
+
+					goto on_error;
+				}
+				if( libcaes_crypt_cbc(
+				     context->fvek_encryption_context,
+				     LIBCAES_CRYPT_MODE_ENCRYPT,
+				     &( initialization_vectors[ sector_index * 16 ] ),
+				     16,
+				     &( output_data[ data_index ] ),
+				     bytes_per_sector,
+				     &( output_data[ data_index ] ),
+				     bytes_per_sector,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+					 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+					 "%s: unable to AES-CBC encrypt sector data at offset: %" PRIzu ".",
+					 function,
+					 data_index );
+
+					goto on_error;
+				}
+			}
+			data_index += bytes_per_sector;
+		}
+	}
+	memory_set(
+	 sector_keys_data,
 	 0,
-	 16 );
+	 32 * LIBBDE_MAXIMUM_NUMBER_OF_BATCH_SECTORS );
+
+	return( 1 );
+
+on_error:
+	memory_set(
+	 sector_keys_data,
+	 0,
+	 32 * LIBBDE_MAXIMUM_NUMBER_OF_BATCH_SECTORS );
 
 	return( -1 );
 }
 
+/* De- or encrypts consecutive sectors of data using AES-XTS
+ * The initialization vector of a sector is its sector number
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_encryption_context_crypt_sectors_aes_xts(
+     libbde_encryption_context_t *context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size LIBBDE_ATTRIBUTE_UNUSED,
+     uint64_t data_offset,
+     size_t bytes_per_sector,
+     libcerror_error_t **error )
+{
+	uint8_t initialization_vector[ 16 ];
+
+	libcaes_tweaked_context_t *aes_tweaked_context = NULL;
+	static char *function                          = "libbde_encryption_context_crypt_sectors_aes_xts";
+	size_t data_index                              = 0;
+	uint64_t sector_number                         = 0;
+	int aes_mode                                   = 0;
+
+	LIBBDE_UNREFERENCED_PARAMETER( output_data_size )
+
+	if( mode == LIBBDE_ENCRYPTION_CRYPT_MODE_DECRYPT )
+	{
+		aes_tweaked_context = context->fvek_decryption_tweaked_context;
+		aes_mode            = LIBCAES_CRYPT_MODE_DECRYPT;
+	}
+	else
+	{
+		aes_tweaked_context = context->fvek_encryption_tweaked_context;
+		aes_mode            = LIBCAES_CRYPT_MODE_ENCRYPT;
+	}
+	sector_number = data_offset / bytes_per_sector;
+
+	/* The upper 8 bytes of the initialization vector are always 0
+	 */
+	byte_stream_copy_from_uint64_little_endian(
+	 &( initialization_vector[ 8 ] ),
+	 (uint64_t) 0 );
+
+	for( data_index = 0;
+	     data_index < input_data_size;
+	     data_index += bytes_per_sector )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 initialization_vector,
+		 sector_number );
+
+		if( libcaes_crypt_xts(
+		     aes_tweaked_context,
+		     aes_mode,
+		     initialization_vector,
+		     16,
+		     &( input_data[ data_index ] ),
+		     bytes_per_sector,
+		     &( output_data[ data_index ] ),
+		     bytes_per_sector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to AES-XTS crypt sector data at offset: %" PRIzu ".",
+			 function,
+			 data_index );
+
+			return( -1 );
+		}
+		sector_number++;
+	}
+	return( 1 );
+}
+
+/* De- or encrypts a block of data
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_encryption_context_crypt(
+     libbde_encryption_context_t *context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     uint64_t block_key,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_encryption_context_crypt";
+	int result            = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mode != LIBBDE_ENCRYPTION_CRYPT_MODE_DECRYPT )
+	 && ( mode != LIBBDE_ENCRYPTION_CRYPT_MODE_ENCRYPT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( context->decrypt_function == NULL )
+	 || ( context->encrypt_function == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid context - missing crypt functions.",
+		 function );
+
+		return( -1 );
+	}
+	if( mode == LIBBDE_ENCRYPTION_CRYPT_MODE_DECRYPT )
+	{
+		result = context->decrypt_function(
+		          context,
+		          input_data,
+		          input_data_size,
+		          output_data,
+		          output_data_size,
+		          block_key,
+		          error );
+	}
+	else
+	{
+		result = context->encrypt_function(
+		          context,
+		          input_data,
+		          input_data_size,
+		          output_data,
+		          output_data_size,
+		          block_key,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to crypt data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* De- or encrypts consecutive sectors of data
+ * The block key of every sector is derived from the data offset, which is the offset
+ * of the first sector, by the method specific function bound when the keys were set
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_encryption_context_crypt_sectors(
+     libbde_encryption_context_t *context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     uint64_t data_offset,
+     size_t bytes_per_sector,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_encryption_context_crypt_sectors";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mode != LIBBDE_ENCRYPTION_CRYPT_MODE_DECRYPT )
+	 && ( mode != LIBBDE_ENCRYPTION_CRYPT_MODE_ENCRYPT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->crypt_sectors_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid context - missing crypt sectors function.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data_size < input_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid output data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bytes_per_sector == 0 )
+	 || ( bytes_per_sector > (size_t) SSIZE_MAX )
+	 || ( ( input_data_size % bytes_per_sector ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->crypt_sectors_function(
+	     context,
+	     mode,
+	     input_data,
+	     input_data_size,
+	     output_data,
+	     output_data_size,
+	     data_offset,
+	     bytes_per_sector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to crypt sectors data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
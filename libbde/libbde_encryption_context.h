@@ -63,6 +63,41 @@ struct libbde_encryption_context
 	/* The FVEK (AES) encryption tweaked context
 	 */
 	libcaes_tweaked_context_t *fvek_encryption_tweaked_context;
+
+	/* The method specific decrypt function, set when the keys are set
+	 */
+	int (*decrypt_function)(
+	       libbde_encryption_context_t *context,
+	       const uint8_t *input_data,
+	       size_t input_data_size,
+	       uint8_t *output_data,
+	       size_t output_data_size,
+	       uint64_t block_key,
+	       libcerror_error_t **error );
+
+	/* The method specific encrypt function, set when the keys are set
+	 */
+	int (*encrypt_function)(
+	       libbde_encryption_context_t *context,
+	       const uint8_t *input_data,
+	       size_t input_data_size,
+	       uint8_t *output_data,
+	       size_t output_data_size,
+	       uint64_t block_key,
+	       libcerror_error_t **error );
+
+	/* The method specific function to de- or encrypt consecutive sectors, set when the keys are set
+	 */
+	int (*crypt_sectors_function)(
+	       libbde_encryption_context_t *context,
+	       int mode,
+	       const uint8_t *input_data,
+	       size_t input_data_size,
+	       uint8_t *output_data,
+	       size_t output_data_size,
+	       uint64_t data_offset,
+	       size_t bytes_per_sector,
+	       libcerror_error_t **error );
 };
 
 int libbde_encryption_context_initialize(
@@ -82,6 +117,104 @@ int libbde_encryption_context_set_keys(
      size_t tweak_key_size,
      libcerror_error_t **error );
 
+int libbde_encryption_context_get_block_keys_data(
+     libbde_encryption_context_t *context,
+     uint64_t block_key,
+     uint64_t block_key_increment,
+     int number_of_block_keys,
+     uint8_t *initialization_vectors,
+     size_t initialization_vectors_size,
+     uint8_t *sector_keys_data,
+     size_t sector_keys_data_size,
+     libcerror_error_t **error );
+
+int libbde_encryption_context_decrypt_aes_cbc(
+     libbde_encryption_context_t *context,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     uint64_t block_key,
+     libcerror_error_t **error );
+
+int libbde_encryption_context_encrypt_aes_cbc(
+     libbde_encryption_context_t *context,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     uint64_t block_key,
+     libcerror_error_t **error );
+
+int libbde_encryption_context_decrypt_aes_cbc_diffuser(
+     libbde_encryption_context_t *context,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     uint64_t block_key,
+     libcerror_error_t **error );
+
+int libbde_encryption_context_encrypt_aes_cbc_diffuser(
+     libbde_encryption_context_t *context,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     uint64_t block_key,
+     libcerror_error_t **error );
+
+int libbde_encryption_context_decrypt_aes_xts(
+     libbde_encryption_context_t *context,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     uint64_t block_key,
+     libcerror_error_t **error );
+
+int libbde_encryption_context_encrypt_aes_xts(
+     libbde_encryption_context_t *context,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     uint64_t block_key,
+     libcerror_error_t **error );
+
+int libbde_encryption_context_crypt_sectors_aes_cbc(
+     libbde_encryption_context_t *context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     uint64_t data_offset,
+     size_t bytes_per_sector,
+     libcerror_error_t **error );
+
+int libbde_encryption_context_crypt_sectors_aes_cbc_diffuser(
+     libbde_encryption_context_t *context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     uint64_t data_offset,
+     size_t bytes_per_sector,
+     libcerror_error_t **error );
+
+int libbde_encryption_context_crypt_sectors_aes_xts(
+     libbde_encryption_context_t *context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     uint64_t data_offset,
+     size_t bytes_per_sector,
+     libcerror_error_t **error );
+
 int libbde_encryption_context_crypt(
      libbde_encryption_context_t *context,
      int mode,
@@ -92,6 +225,17 @@ int libbde_encryption_context_crypt(
      uint64_t block_key,
      libcerror_error_t **error );
 
+int libbde_encryption_context_crypt_sectors(
+     libbde_encryption_context_t *context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     uint64_t data_offset,
+     size_t bytes_per_sector,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,71 @@
+/*
+ * Extent functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBDE_EXTENT_H )
+#define _LIBBDE_EXTENT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbde_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libbde_extent libbde_extent_t;
+
+struct libbde_extent
+{
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The flags
+	 */
+	uint32_t flags;
+};
+
+int libbde_extent_initialize(
+     libbde_extent_t **extent,
+     libcerror_error_t **error );
+
+int libbde_extent_free(
+     libbde_extent_t **extent,
+     libcerror_error_t **error );
+
+int libbde_extent_get_values(
+     libbde_extent_t *extent,
+     off64_t *offset,
+     size64_t *size,
+     uint32_t *flags,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBDE_EXTENT_H ) */
+
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libbde_block_cache.h"
 #include "libbde_definitions.h"
 #include "libbde_encryption_context.h"
 #include "libbde_io_handle.h"
@@ -32,6 +33,7 @@
 #include "libbde_libcnotify.h"
 #include "libbde_ntfs_volume_header.h"
 #include "libbde_sector_data.h"
+#include "libbde_statistics.h"
 #include "libbde_unused.h"
 
 #include "bde_volume.h"
@@ -175,8 +177,27 @@ int libbde_io_handle_clear(
 
 		return( -1 );
 	}
-	io_handle->bytes_per_sector = 512;
+	io_handle->bytes_per_sector         = 512;
+	io_handle->cluster_block_size       = 0;
+	io_handle->mft_cluster_block_number = 0;
+	io_handle->mapped_file_io_handle    = NULL;
+	io_handle->positional_file          = NULL;
+	io_handle->block_cache              = NULL;
+	io_handle->block_cache_offset       = 0;
+
+	if( libbde_statistics_clear(
+	     &( io_handle->statistics ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
 
+		return( -1 );
+	}
 	return( 1 );
 }
 
@@ -192,7 +213,9 @@ int libbde_io_handle_read_unencrypted_volume_header(
 {
 	libbde_ntfs_volume_header_t *ntfs_volume_header = NULL;
 	libbde_sector_data_t *sector_data               = NULL;
+	libcerror_error_t *ntfs_error                   = NULL;
 	static char *function                           = "libbde_io_handle_read_unencrypted_volume_header";
+	int result                                      = 0;
 
 	if( io_handle == NULL )
 	{
@@ -247,7 +270,15 @@ int libbde_io_handle_read_unencrypted_volume_header(
 
 		goto on_error;
 	}
-	if( io_handle->volume_size == 0 )
+	/* The NTFS volume header is required to determine the volume size if the metadata
+	 * does not provide it, otherwise it is only read to determine the cluster block size
+	 * and MFT location of a NTFS formatted volume
+	 */
+	if( ( io_handle->volume_size == 0 )
+	 || ( memory_compare(
+	       ( (bde_ntfs_volume_header_t *) sector_data->data )->file_system_signature,
+	       "NTFS    ",
+	       8 ) == 0 ) )
 	{
 		if( libbde_ntfs_volume_header_initialize(
 		     &ntfs_volume_header,
@@ -262,23 +293,57 @@ int libbde_io_handle_read_unencrypted_volume_header(
 
 			goto on_error;
 		}
-		if( libbde_ntfs_volume_header_read_data(
-		     ntfs_volume_header,
-		     sector_data->data,
-		     sector_data->data_size,
-		     error ) != 1 )
+		if( io_handle->volume_size == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read NTFS volume header.",
-			 function );
-
-			goto on_error;
+			if( libbde_ntfs_volume_header_read_data(
+			     ntfs_volume_header,
+			     sector_data->data,
+			     sector_data->data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read NTFS volume header.",
+				 function );
+
+				goto on_error;
+			}
+			io_handle->volume_size = ntfs_volume_header->volume_size;
+
+			result = 1;
+		}
+		else
+		{
+			result = libbde_ntfs_volume_header_read_data(
+			          ntfs_volume_header,
+			          sector_data->data,
+			          sector_data->data_size,
+			          &ntfs_error );
+
+			if( result != 1 )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: unable to read NTFS volume header.\n",
+					 function );
+
+					libcnotify_print_error_backtrace(
+					 ntfs_error );
+				}
+#endif
+				libcerror_error_free(
+				 &ntfs_error );
+			}
+		}
+		if( result == 1 )
+		{
+			io_handle->cluster_block_size       = ntfs_volume_header->cluster_block_size;
+			io_handle->mft_cluster_block_number = ntfs_volume_header->mft_cluster_block_number;
 		}
-		io_handle->volume_size = ntfs_volume_header->volume_size;
-
 		if( libbde_ntfs_volume_header_free(
 		     &ntfs_volume_header,
 		     error ) != 1 )
@@ -324,3 +389,136 @@ on_error:
 	return( -1 );
 }
 
+/* Reads data at a specific offset of the file IO handle
+ * The data is read from the memory mapped file, the block cache or the positional file
+ * when available, otherwise from the file IO handle
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libbde_io_handle_read_buffer_at_offset(
+         libbde_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	const uint8_t *mapped_data = NULL;
+	static char *function      = "libbde_io_handle_read_buffer_at_offset";
+	ssize_t read_count         = 0;
+	int result                 = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->mapped_file_io_handle != NULL )
+	{
+		result = libbde_mapped_file_io_handle_get_data_at_offset(
+		          io_handle->mapped_file_io_handle,
+		          offset,
+		          buffer_size,
+		          &mapped_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve mapped data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+	}
+	if( mapped_data != NULL )
+	{
+		if( memory_copy(
+		     buffer,
+		     mapped_data,
+		     buffer_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy mapped data.",
+			 function );
+
+			return( -1 );
+		}
+		read_count = (ssize_t) buffer_size;
+	}
+	/* The block cache accounts for the bytes it reads from the file IO handle
+	 */
+	else if( io_handle->block_cache != NULL )
+	{
+		return( libbde_block_cache_read_buffer_at_offset(
+		         io_handle->block_cache,
+		         io_handle,
+		         file_io_handle,
+		         buffer,
+		         buffer_size,
+		         offset,
+		         &( io_handle->statistics ),
+		         error ) );
+	}
+	else if( io_handle->positional_file != NULL )
+	{
+		read_count = libbde_positional_file_read_buffer_at_offset(
+		              io_handle->positional_file,
+		              buffer,
+		              buffer_size,
+		              offset,
+		              error );
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              buffer,
+		              buffer_size,
+		              offset,
+		              error );
+	}
+	if( read_count > 0 )
+	{
+		libbde_statistics_add_value(
+		 &( io_handle->statistics.number_of_bytes_read ),
+		 (uint64_t) read_count );
+	}
+	return( read_count );
+}
+
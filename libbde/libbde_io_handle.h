@@ -28,6 +28,10 @@
 #include "libbde_encryption_context.h"
 #include "libbde_libbfio.h"
 #include "libbde_libcerror.h"
+#include "libbde_mapped_file_io_handle.h"
+#include "libbde_positional_file.h"
+#include "libbde_statistics.h"
+#include "libbde_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -82,6 +86,16 @@ struct libbde_io_handle
 	 */
 	uint64_t mft_mirror_cluster_block_number;
 
+	/* The cluster block size
+	 * Determined from the NTFS volume header, 0 if not available
+	 */
+	uint32_t cluster_block_size;
+
+	/* The MFT cluster block number
+	 * Determined from the NTFS volume header
+	 */
+	uint64_t mft_cluster_block_number;
+
 	/* The volume header offset
 	 * Used by Windows 7 (version 2)
 	 */
@@ -92,6 +106,45 @@ struct libbde_io_handle
 	 */
 	size64_t volume_header_size;
 
+	/* The mapped file IO handle
+	 * Used to decrypt the sector data directly from the mapped data
+	 */
+	libbde_mapped_file_io_handle_t *mapped_file_io_handle;
+
+	/* The positional file
+	 * Used to read the sector data without using the file IO handle,
+	 * the positional file is shared with the read workers
+	 */
+	libbde_positional_file_t *positional_file;
+
+	/* The block cache
+	 * Contains the data as read from the file IO handle, the block cache
+	 * is not owned by the IO handle and can be shared by multiple volumes
+	 */
+	libbde_block_cache_t *block_cache;
+
+	/* The offset of the file IO handle data in the image the block cache is shared for
+	 */
+	off64_t block_cache_offset;
+
+	/* The statistics
+	 */
+	libbde_statistics_t statistics;
+
+	/* The trace function
+	 */
+	void (*trace_function)(
+	       intptr_t *user_data,
+	       int event_type,
+	       off64_t offset,
+	       size64_t size,
+	       uint64_t start_timestamp,
+	       uint64_t end_timestamp );
+
+	/* The trace function user data
+	 */
+	intptr_t *trace_user_data;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -116,6 +169,14 @@ int libbde_io_handle_read_unencrypted_volume_header(
      libbde_encryption_context_t *encryption_context,
      libcerror_error_t **error );
 
+ssize_t libbde_io_handle_read_buffer_at_offset(
+         libbde_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
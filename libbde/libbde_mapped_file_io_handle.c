@@ -0,0 +1,1349 @@
+/*
+ * Memory mapped file IO handle functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libbde_libbfio.h"
+#include "libbde_libcerror.h"
+#include "libbde_libcnotify.h"
+#include "libbde_mapped_file_io_handle.h"
+#include "libbde_unused.h"
+
+/* Creates a memory mapped file handle
+ * The mapped file IO handle is managed by the handle, mapped_file_io_handle
+ * is only set as a reference
+ * Make sure the value handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_mapped_file_initialize(
+     libbfio_handle_t **handle,
+     libbde_mapped_file_io_handle_t **mapped_file_io_handle,
+     libcerror_error_t **error )
+{
+	libbde_mapped_file_io_handle_t *safe_mapped_file_io_handle = NULL;
+	static char *function                                      = "libbde_mapped_file_initialize";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbde_mapped_file_io_handle_initialize(
+	     &safe_mapped_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mapped file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     handle,
+	     (intptr_t *) safe_mapped_file_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libbde_mapped_file_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libbde_mapped_file_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libbde_mapped_file_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libbde_mapped_file_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libbde_mapped_file_io_handle_read,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libbde_mapped_file_io_handle_write,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libbde_mapped_file_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libbde_mapped_file_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libbde_mapped_file_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libbde_mapped_file_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	*mapped_file_io_handle = safe_mapped_file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( safe_mapped_file_io_handle != NULL )
+	{
+		libbde_mapped_file_io_handle_free(
+		 &safe_mapped_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens a memory mapped file handle
+ * The mapped file IO handle is managed by the handle, mapped_file_io_handle
+ * is only set as a reference
+ * Returns 1 if successful, 0 if the file cannot be memory mapped or -1 on error
+ */
+int libbde_mapped_file_open(
+     libbfio_handle_t **handle,
+     libbde_mapped_file_io_handle_t **mapped_file_io_handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *safe_handle                              = NULL;
+	libbde_mapped_file_io_handle_t *safe_mapped_file_io_handle = NULL;
+	libcerror_error_t *open_error                              = NULL;
+	static char *function                                      = "libbde_mapped_file_open";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbde_mapped_file_initialize(
+	     &safe_handle,
+	     &safe_mapped_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mapped file handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbde_mapped_file_io_handle_set_name(
+	     safe_mapped_file_io_handle,
+	     name,
+	     name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name in mapped file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* Failing to map the file, e.g. because it is a device, is not an error
+	 * the caller is expected to fall back to reading the file
+	 */
+	if( libbfio_handle_open(
+	     safe_handle,
+	     LIBBFIO_OPEN_READ,
+	     &open_error ) != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to memory map file: %s.\n",
+			 function,
+			 name );
+
+			libcnotify_print_error_backtrace(
+			 open_error );
+		}
+#endif
+		libcerror_error_free(
+		 &open_error );
+
+		libbfio_handle_free(
+		 &safe_handle,
+		 NULL );
+
+		return( 0 );
+	}
+	*handle                = safe_handle;
+	*mapped_file_io_handle = safe_mapped_file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( safe_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &safe_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a mapped file IO handle
+ * Make sure the value mapped_file_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_mapped_file_io_handle_initialize(
+     libbde_mapped_file_io_handle_t **mapped_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_mapped_file_io_handle_initialize";
+
+	if( mapped_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mapped_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mapped file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*mapped_file_io_handle = memory_allocate_structure(
+	                          libbde_mapped_file_io_handle_t );
+
+	if( *mapped_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create mapped file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *mapped_file_io_handle,
+	     0,
+	     sizeof( libbde_mapped_file_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear mapped file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *mapped_file_io_handle != NULL )
+	{
+		memory_free(
+		 *mapped_file_io_handle );
+
+		*mapped_file_io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a mapped file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_mapped_file_io_handle_free(
+     libbde_mapped_file_io_handle_t **mapped_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_mapped_file_io_handle_free";
+	int result            = 1;
+
+	if( mapped_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mapped_file_io_handle != NULL )
+	{
+		if( ( *mapped_file_io_handle )->mapped_data != NULL )
+		{
+			if( libbde_mapped_file_io_handle_close(
+			     *mapped_file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close mapped file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *mapped_file_io_handle )->name != NULL )
+		{
+			memory_free(
+			 ( *mapped_file_io_handle )->name );
+		}
+		memory_free(
+		 *mapped_file_io_handle );
+
+		*mapped_file_io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the mapped file IO handle
+ * The clone is not opened, the name is copied
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_mapped_file_io_handle_clone(
+     libbde_mapped_file_io_handle_t **destination_mapped_file_io_handle,
+     libbde_mapped_file_io_handle_t *source_mapped_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_mapped_file_io_handle_clone";
+
+	if( destination_mapped_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination mapped file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_mapped_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: destination mapped file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_mapped_file_io_handle == NULL )
+	{
+		*destination_mapped_file_io_handle = NULL;
+
+		return( 1 );
+	}
+	if( libbde_mapped_file_io_handle_initialize(
+	     destination_mapped_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination mapped file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_mapped_file_io_handle->name != NULL )
+	{
+		if( libbde_mapped_file_io_handle_set_name(
+		     *destination_mapped_file_io_handle,
+		     source_mapped_file_io_handle->name,
+		     source_mapped_file_io_handle->name_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set name in destination mapped file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_mapped_file_io_handle != NULL )
+	{
+		libbde_mapped_file_io_handle_free(
+		 destination_mapped_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the name
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_mapped_file_io_handle_set_name(
+     libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_mapped_file_io_handle_set_name";
+
+	if( mapped_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file_io_handle->mapped_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mapped file IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_length == 0 )
+	 || ( name_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file_io_handle->name != NULL )
+	{
+		memory_free(
+		 mapped_file_io_handle->name );
+
+		mapped_file_io_handle->name      = NULL;
+		mapped_file_io_handle->name_size = 0;
+	}
+	mapped_file_io_handle->name = narrow_string_allocate(
+	                               name_length + 1 );
+
+	if( mapped_file_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     mapped_file_io_handle->name,
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		goto on_error;
+	}
+	mapped_file_io_handle->name[ name_length ] = 0;
+	mapped_file_io_handle->name_size           = name_length + 1;
+
+	return( 1 );
+
+on_error:
+	if( mapped_file_io_handle->name != NULL )
+	{
+		memory_free(
+		 mapped_file_io_handle->name );
+
+		mapped_file_io_handle->name = NULL;
+	}
+	mapped_file_io_handle->name_size = 0;
+
+	return( -1 );
+}
+
+/* Opens the mapped file IO handle
+ * The file must be a non-empty regular file and is mapped read-only in its entirety
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_mapped_file_io_handle_open(
+     libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBBDE_MAPPED_FILE_SUPPORT )
+	struct stat file_statistics;
+
+	void *mapped_data       = NULL;
+	long page_size          = 0;
+	int file_descriptor     = -1;
+#endif
+	static char *function   = "libbde_mapped_file_io_handle_open";
+
+	if( mapped_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid mapped file IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file_io_handle->mapped_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mapped file IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	 || ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBDE_MAPPED_FILE_SUPPORT )
+	file_descriptor = open(
+	                   mapped_file_io_handle->name,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 mapped_file_io_handle->name );
+
+		goto on_error;
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		goto on_error;
+	}
+	/* Devices and other special files cannot be mapped reliably
+	 */
+	if( !S_ISREG( file_statistics.st_mode ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file type - not a regular file.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_statistics.st_size <= 0 )
+	 || ( (uint64_t) file_statistics.st_size > (uint64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	page_size = sysconf(
+	             _SC_PAGESIZE );
+
+	if( page_size <= 0 )
+	{
+		page_size = 4096;
+	}
+	mapped_data = mmap(
+	               NULL,
+	               (size_t) file_statistics.st_size,
+	               PROT_READ,
+	               MAP_SHARED,
+	               file_descriptor,
+	               0 );
+
+	if( mapped_data == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to map file: %s.",
+		 function,
+		 mapped_file_io_handle->name );
+
+		goto on_error;
+	}
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	if( close(
+	     file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file: %s.",
+		 function,
+		 mapped_file_io_handle->name );
+
+		file_descriptor = -1;
+
+		goto on_error;
+	}
+	mapped_file_io_handle->mapped_data                    = (uint8_t *) mapped_data;
+	mapped_file_io_handle->mapped_data_size               = (size64_t) file_statistics.st_size;
+	mapped_file_io_handle->page_size                      = (size_t) page_size;
+	mapped_file_io_handle->access_flags                   = access_flags;
+	mapped_file_io_handle->current_offset                 = 0;
+	mapped_file_io_handle->last_read_end_offset           = -1;
+	mapped_file_io_handle->number_of_contiguous_reads     = 0;
+	mapped_file_io_handle->number_of_non_contiguous_reads = 0;
+	mapped_file_io_handle->advice                         = LIBBDE_MAPPED_FILE_IO_HANDLE_ADVICE_NORMAL;
+	mapped_file_io_handle->read_ahead_end_offset          = 0;
+
+	return( 1 );
+
+on_error:
+	if( mapped_data != NULL )
+	{
+		munmap(
+		 mapped_data,
+		 (size_t) file_statistics.st_size );
+	}
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: memory mapped files not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBBDE_MAPPED_FILE_SUPPORT ) */
+}
+
+/* Closes the mapped file IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int libbde_mapped_file_io_handle_close(
+     libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_mapped_file_io_handle_close";
+
+	if( mapped_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file_io_handle->mapped_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid mapped file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBDE_MAPPED_FILE_SUPPORT )
+	if( munmap(
+	     mapped_file_io_handle->mapped_data,
+	     (size_t) mapped_file_io_handle->mapped_data_size ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to unmap file.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	mapped_file_io_handle->mapped_data      = NULL;
+	mapped_file_io_handle->mapped_data_size = 0;
+	mapped_file_io_handle->access_flags     = 0;
+	mapped_file_io_handle->current_offset   = 0;
+
+	return( 0 );
+}
+
+/* Updates the access advice of the mapping based on the read pattern
+ * After a number of contiguous reads the mapping is advised to be read sequentially
+ * and the data ahead of the read is advised to be needed, after a number of
+ * non-contiguous reads the mapping is advised to be read randomly
+ */
+void libbde_mapped_file_io_handle_advise_read(
+      libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+      off64_t offset,
+      size_t size )
+{
+	off64_t read_end_offset     = 0;
+	off64_t read_ahead_offset   = 0;
+	size64_t read_ahead_size    = 0;
+	int advice                  = 0;
+
+	if( mapped_file_io_handle == NULL )
+	{
+		return;
+	}
+	if( mapped_file_io_handle->mapped_data == NULL )
+	{
+		return;
+	}
+	read_end_offset = offset + (off64_t) size;
+
+	if( offset == mapped_file_io_handle->last_read_end_offset )
+	{
+		mapped_file_io_handle->number_of_contiguous_reads    += 1;
+		mapped_file_io_handle->number_of_non_contiguous_reads = 0;
+	}
+	else
+	{
+		mapped_file_io_handle->number_of_contiguous_reads      = 0;
+		mapped_file_io_handle->number_of_non_contiguous_reads += 1;
+		mapped_file_io_handle->read_ahead_end_offset           = 0;
+	}
+	mapped_file_io_handle->last_read_end_offset = read_end_offset;
+
+	advice = mapped_file_io_handle->advice;
+
+	if( mapped_file_io_handle->number_of_contiguous_reads >= LIBBDE_MAPPED_FILE_IO_HANDLE_ADVICE_THRESHOLD )
+	{
+		advice = LIBBDE_MAPPED_FILE_IO_HANDLE_ADVICE_SEQUENTIAL;
+	}
+	else if( mapped_file_io_handle->number_of_non_contiguous_reads >= LIBBDE_MAPPED_FILE_IO_HANDLE_ADVICE_THRESHOLD )
+	{
+		advice = LIBBDE_MAPPED_FILE_IO_HANDLE_ADVICE_RANDOM;
+	}
+	if( advice != mapped_file_io_handle->advice )
+	{
+#if defined( HAVE_LIBBDE_MAPPED_FILE_SUPPORT ) && defined( HAVE_MADVISE )
+		/* The advice is only a hint, hence failure is ignored
+		 */
+		madvise(
+		 mapped_file_io_handle->mapped_data,
+		 (size_t) mapped_file_io_handle->mapped_data_size,
+		 ( advice == LIBBDE_MAPPED_FILE_IO_HANDLE_ADVICE_SEQUENTIAL ) ? MADV_SEQUENTIAL : MADV_RANDOM );
+#endif
+		mapped_file_io_handle->advice = advice;
+	}
+	if( mapped_file_io_handle->advice != LIBBDE_MAPPED_FILE_IO_HANDLE_ADVICE_SEQUENTIAL )
+	{
+		return;
+	}
+	/* Keep at least half of the read-ahead window ahead of the reads
+	 */
+	if( ( read_end_offset + ( LIBBDE_MAPPED_FILE_IO_HANDLE_READ_AHEAD_SIZE / 2 ) ) <= mapped_file_io_handle->read_ahead_end_offset )
+	{
+		return;
+	}
+	read_ahead_offset = read_end_offset;
+
+	if( read_ahead_offset < mapped_file_io_handle->read_ahead_end_offset )
+	{
+		read_ahead_offset = mapped_file_io_handle->read_ahead_end_offset;
+	}
+	read_ahead_offset -= read_ahead_offset % (off64_t) mapped_file_io_handle->page_size;
+
+	if( (size64_t) read_ahead_offset >= mapped_file_io_handle->mapped_data_size )
+	{
+		return;
+	}
+	read_ahead_size = mapped_file_io_handle->mapped_data_size - (size64_t) read_ahead_offset;
+
+	if( read_ahead_size > (size64_t) LIBBDE_MAPPED_FILE_IO_HANDLE_READ_AHEAD_SIZE )
+	{
+		read_ahead_size = (size64_t) LIBBDE_MAPPED_FILE_IO_HANDLE_READ_AHEAD_SIZE;
+	}
+#if defined( HAVE_LIBBDE_MAPPED_FILE_SUPPORT ) && defined( HAVE_MADVISE )
+	madvise(
+	 &( mapped_file_io_handle->mapped_data[ read_ahead_offset ] ),
+	 (size_t) read_ahead_size,
+	 MADV_WILLNEED );
+#endif
+	mapped_file_io_handle->read_ahead_end_offset = read_ahead_offset + (off64_t) read_ahead_size;
+}
+
+/* Retrieves a pointer to the mapped data at a specific offset
+ * This allows the data to be used without copying it
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libbde_mapped_file_io_handle_get_data_at_offset(
+     libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_mapped_file_io_handle_get_data_at_offset";
+
+	if( mapped_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file_io_handle->mapped_data == NULL )
+	{
+		return( 0 );
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset >= mapped_file_io_handle->mapped_data_size )
+	 || ( (size64_t) size > ( mapped_file_io_handle->mapped_data_size - (size64_t) offset ) ) )
+	{
+		return( 0 );
+	}
+	libbde_mapped_file_io_handle_advise_read(
+	 mapped_file_io_handle,
+	 offset,
+	 size );
+
+	*data = &( mapped_file_io_handle->mapped_data[ offset ] );
+
+	return( 1 );
+}
+
+/* Reads a buffer from the mapped file IO handle
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbde_mapped_file_io_handle_read(
+         libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libbde_mapped_file_io_handle_read";
+	size64_t read_size    = 0;
+
+	if( mapped_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file_io_handle->mapped_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid mapped file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) mapped_file_io_handle->current_offset >= mapped_file_io_handle->mapped_data_size )
+	{
+		return( 0 );
+	}
+	read_size = mapped_file_io_handle->mapped_data_size - (size64_t) mapped_file_io_handle->current_offset;
+
+	if( read_size > (size64_t) size )
+	{
+		read_size = (size64_t) size;
+	}
+	libbde_mapped_file_io_handle_advise_read(
+	 mapped_file_io_handle,
+	 mapped_file_io_handle->current_offset,
+	 (size_t) read_size );
+
+	if( memory_copy(
+	     buffer,
+	     &( mapped_file_io_handle->mapped_data[ mapped_file_io_handle->current_offset ] ),
+	     (size_t) read_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy mapped data.",
+		 function );
+
+		return( -1 );
+	}
+	mapped_file_io_handle->current_offset += (off64_t) read_size;
+
+	return( (ssize_t) read_size );
+}
+
+/* Writes a buffer to the mapped file IO handle
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libbde_mapped_file_io_handle_write(
+         libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+         const uint8_t *buffer LIBBDE_ATTRIBUTE_UNUSED,
+         size_t size LIBBDE_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	static char *function = "libbde_mapped_file_io_handle_write";
+
+	LIBBDE_UNREFERENCED_PARAMETER( buffer )
+	LIBBDE_UNREFERENCED_PARAMETER( size )
+
+	if( mapped_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: write access not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Seeks a certain offset within the mapped file IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libbde_mapped_file_io_handle_seek_offset(
+         libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libbde_mapped_file_io_handle_seek_offset";
+
+	if( mapped_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file_io_handle->mapped_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid mapped file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += mapped_file_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) mapped_file_io_handle->mapped_data_size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	mapped_file_io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if a file exists
+ * Returns 1 if file exists, 0 if not or -1 on error
+ */
+int libbde_mapped_file_io_handle_exists(
+     libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBBDE_MAPPED_FILE_SUPPORT )
+	struct stat file_statistics;
+#endif
+	static char *function = "libbde_mapped_file_io_handle_exists";
+
+	if( mapped_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid mapped file IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBDE_MAPPED_FILE_SUPPORT )
+	if( stat(
+	     mapped_file_io_handle->name,
+	     &file_statistics ) != 0 )
+	{
+		if( errno == ENOENT )
+		{
+			return( 0 );
+		}
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: memory mapped files not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBBDE_MAPPED_FILE_SUPPORT ) */
+}
+
+/* Determines if the mapped file IO handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libbde_mapped_file_io_handle_is_open(
+     libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_mapped_file_io_handle_is_open";
+
+	if( mapped_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file_io_handle->mapped_data == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the mapped file size
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_mapped_file_io_handle_get_size(
+     libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_mapped_file_io_handle_get_size";
+
+	if( mapped_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file_io_handle->mapped_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid mapped file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = mapped_file_io_handle->mapped_data_size;
+
+	return( 1 );
+}
+
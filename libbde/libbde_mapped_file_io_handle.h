@@ -0,0 +1,195 @@
+/*
+ * Memory mapped file IO handle functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBDE_MAPPED_FILE_IO_HANDLE_H )
+#define _LIBBDE_MAPPED_FILE_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbde_libbfio.h"
+#include "libbde_libcerror.h"
+
+#if !defined( WINAPI ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+#define HAVE_LIBBDE_MAPPED_FILE_SUPPORT
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of contiguous or non-contiguous reads after which the access advice is changed
+ */
+#define LIBBDE_MAPPED_FILE_IO_HANDLE_ADVICE_THRESHOLD		4
+
+/* The size of the read-ahead window that is advised for sequential access
+ */
+#define LIBBDE_MAPPED_FILE_IO_HANDLE_READ_AHEAD_SIZE		( 4 * 1024 * 1024 )
+
+enum LIBBDE_MAPPED_FILE_IO_HANDLE_ADVICES
+{
+	LIBBDE_MAPPED_FILE_IO_HANDLE_ADVICE_NORMAL		= 0,
+	LIBBDE_MAPPED_FILE_IO_HANDLE_ADVICE_SEQUENTIAL		= 1,
+	LIBBDE_MAPPED_FILE_IO_HANDLE_ADVICE_RANDOM		= 2
+};
+
+typedef struct libbde_mapped_file_io_handle libbde_mapped_file_io_handle_t;
+
+struct libbde_mapped_file_io_handle
+{
+	/* The name
+	 */
+	char *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* The mapped data
+	 */
+	uint8_t *mapped_data;
+
+	/* The mapped data size
+	 */
+	size64_t mapped_data_size;
+
+	/* The page size
+	 */
+	size_t page_size;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The end offset of the last read
+	 */
+	off64_t last_read_end_offset;
+
+	/* The number of contiguous reads
+	 */
+	int number_of_contiguous_reads;
+
+	/* The number of non-contiguous reads
+	 */
+	int number_of_non_contiguous_reads;
+
+	/* The current access advice
+	 */
+	int advice;
+
+	/* The end offset of the data advised to be read ahead
+	 */
+	off64_t read_ahead_end_offset;
+};
+
+int libbde_mapped_file_initialize(
+     libbfio_handle_t **handle,
+     libbde_mapped_file_io_handle_t **mapped_file_io_handle,
+     libcerror_error_t **error );
+
+int libbde_mapped_file_open(
+     libbfio_handle_t **handle,
+     libbde_mapped_file_io_handle_t **mapped_file_io_handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int libbde_mapped_file_io_handle_initialize(
+     libbde_mapped_file_io_handle_t **mapped_file_io_handle,
+     libcerror_error_t **error );
+
+int libbde_mapped_file_io_handle_free(
+     libbde_mapped_file_io_handle_t **mapped_file_io_handle,
+     libcerror_error_t **error );
+
+int libbde_mapped_file_io_handle_clone(
+     libbde_mapped_file_io_handle_t **destination_mapped_file_io_handle,
+     libbde_mapped_file_io_handle_t *source_mapped_file_io_handle,
+     libcerror_error_t **error );
+
+int libbde_mapped_file_io_handle_set_name(
+     libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int libbde_mapped_file_io_handle_open(
+     libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libbde_mapped_file_io_handle_close(
+     libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+     libcerror_error_t **error );
+
+void libbde_mapped_file_io_handle_advise_read(
+      libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+      off64_t offset,
+      size_t size );
+
+int libbde_mapped_file_io_handle_get_data_at_offset(
+     libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
+ssize_t libbde_mapped_file_io_handle_read(
+         libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libbde_mapped_file_io_handle_write(
+         libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libbde_mapped_file_io_handle_seek_offset(
+         libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libbde_mapped_file_io_handle_exists(
+     libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+     libcerror_error_t **error );
+
+int libbde_mapped_file_io_handle_is_open(
+     libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+     libcerror_error_t **error );
+
+int libbde_mapped_file_io_handle_get_size(
+     libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBDE_MAPPED_FILE_IO_HANDLE_H ) */
+
@@ -335,7 +335,18 @@ int libbde_metadata_read_block(
 	}
 	metadata->version               = block_header->version;
 	metadata->encrypted_volume_size = block_header->encrypted_volume_size;
-	metadata->volume_header_offset  = block_header->volume_header_offset;
+
+	/* The MFT mirror cluster block number and volume header offset share storage
+	 * in the block header, hence only use the one that is valid for the version
+	 */
+	if( block_header->version == 1 )
+	{
+		metadata->mft_mirror_cluster_block_number = block_header->mft_mirror_cluster_block_number;
+	}
+	else
+	{
+		metadata->volume_header_offset = block_header->volume_header_offset;
+	}
 
 	volume_header_size = block_header->number_of_volume_header_sectors * io_handle->bytes_per_sector;
 
@@ -356,7 +356,10 @@ int libbde_metadata_block_header_read_data(
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	 metadata_block_header->volume_header_offset = (off64_t) safe_volume_header_offset;
+	if( metadata_block_header->version == 2 )
+	{
+		metadata_block_header->volume_header_offset = (off64_t) safe_volume_header_offset;
+	}
 
 	if( ( metadata_block_header->version != 1 )
 	 && ( metadata_block_header->version != 2 ) )
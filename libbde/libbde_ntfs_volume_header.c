@@ -221,6 +221,10 @@ int libbde_ntfs_volume_header_read_data(
 	 ( (bde_ntfs_volume_header_t *) data )->total_number_of_sectors,
 	 ntfs_volume_header->volume_size );
 
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (bde_ntfs_volume_header_t *) data )->mft_cluster_block_number,
+	 ntfs_volume_header->mft_cluster_block_number );
+
 	byte_stream_copy_to_uint32_little_endian(
 	 ( (bde_ntfs_volume_header_t *) data )->mft_entry_size,
 	 mft_entry_size );
@@ -329,13 +333,10 @@ int libbde_ntfs_volume_header_read_data(
 		 function,
 		 ntfs_volume_header->volume_size );
 
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (bde_ntfs_volume_header_t *) data )->mft_cluster_block_number,
-		 value_64bit );
 		libcnotify_printf(
 		 "%s: MFT cluster block number\t\t: %" PRIu64 "\n",
 		 function,
-		 value_64bit );
+		 ntfs_volume_header->mft_cluster_block_number );
 
 		byte_stream_copy_to_uint64_little_endian(
 		 ( (bde_ntfs_volume_header_t *) data )->mirror_mft_cluster_block_number,
@@ -586,6 +587,8 @@ int libbde_ntfs_volume_header_read_data(
 
 		return( -1 );
 	}
+	ntfs_volume_header->cluster_block_size = cluster_block_size;
+
 	ntfs_volume_header->volume_size *= ntfs_volume_header->bytes_per_sector;
 	ntfs_volume_header->volume_size += ntfs_volume_header->bytes_per_sector;
 
@@ -39,6 +39,14 @@ struct libbde_ntfs_volume_header
 	 */
 	uint16_t bytes_per_sector;
 
+	/* The cluster block size
+	 */
+	uint32_t cluster_block_size;
+
+	/* The MFT cluster block number
+	 */
+	uint64_t mft_cluster_block_number;
+
 	/* The volume size
 	 */
 	size64_t volume_size;
@@ -0,0 +1,438 @@
+/*
+ * Positional file functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libbde_libcerror.h"
+#include "libbde_positional_file.h"
+
+/* Creates a positional file
+ * Make sure the value positional_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_positional_file_initialize(
+     libbde_positional_file_t **positional_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_positional_file_initialize";
+
+	if( positional_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid positional file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *positional_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid positional file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*positional_file = memory_allocate_structure(
+	                    libbde_positional_file_t );
+
+	if( *positional_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create positional file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *positional_file,
+	     0,
+	     sizeof( libbde_positional_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear positional file.",
+		 function );
+
+		goto on_error;
+	}
+	( *positional_file )->file_descriptor = -1;
+
+	return( 1 );
+
+on_error:
+	if( *positional_file != NULL )
+	{
+		memory_free(
+		 *positional_file );
+
+		*positional_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a positional file
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_positional_file_free(
+     libbde_positional_file_t **positional_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_positional_file_free";
+	int result            = 1;
+
+	if( positional_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid positional file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *positional_file != NULL )
+	{
+		if( ( *positional_file )->file_descriptor != -1 )
+		{
+			if( libbde_positional_file_close(
+			     *positional_file,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close positional file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *positional_file );
+
+		*positional_file = NULL;
+	}
+	return( result );
+}
+
+/* Opens a positional file for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_positional_file_open(
+     libbde_positional_file_t *positional_file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBBDE_POSITIONAL_FILE_SUPPORT )
+	off64_t file_size     = 0;
+	int file_descriptor   = -1;
+#endif
+	static char *function = "libbde_positional_file_open";
+
+	if( positional_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid positional file.",
+		 function );
+
+		return( -1 );
+	}
+	if( positional_file->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid positional file - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBDE_POSITIONAL_FILE_SUPPORT )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	/* The size is determined by seeking so that devices are supported as well
+	 */
+	file_size = (off64_t) lseek(
+	                       file_descriptor,
+	                       0,
+	                       SEEK_END );
+
+	if( file_size < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 errno,
+		 "%s: unable to determine size of file: %s.",
+		 function,
+		 filename );
+
+		close(
+		 file_descriptor );
+
+		return( -1 );
+	}
+	positional_file->file_descriptor = file_descriptor;
+	positional_file->size            = (size64_t) file_size;
+
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: positional files not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBBDE_POSITIONAL_FILE_SUPPORT ) */
+}
+
+/* Closes a positional file
+ * Returns 0 if successful or -1 on error
+ */
+int libbde_positional_file_close(
+     libbde_positional_file_t *positional_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_positional_file_close";
+	int result            = 0;
+
+	if( positional_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid positional file.",
+		 function );
+
+		return( -1 );
+	}
+	if( positional_file->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid positional file - not open.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBDE_POSITIONAL_FILE_SUPPORT )
+	if( close(
+	     positional_file->file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	positional_file->file_descriptor = -1;
+	positional_file->size            = 0;
+
+	return( result );
+}
+
+/* Reads a buffer at a specific offset from the positional file
+ * The read does not use or change the offset of the file descriptor,
+ * hence it can be called from multiple threads without locking
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbde_positional_file_read_buffer_at_offset(
+         libbde_positional_file_t *positional_file,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+#if defined( HAVE_LIBBDE_POSITIONAL_FILE_SUPPORT )
+	size_t buffer_offset  = 0;
+	ssize_t read_count    = 0;
+#endif
+	static char *function = "libbde_positional_file_read_buffer_at_offset";
+
+	if( positional_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid positional file.",
+		 function );
+
+		return( -1 );
+	}
+	if( positional_file->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid positional file - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBDE_POSITIONAL_FILE_SUPPORT )
+	while( buffer_offset < buffer_size )
+	{
+		read_count = pread(
+		              positional_file->file_descriptor,
+		              &( buffer[ buffer_offset ] ),
+		              buffer_size - buffer_offset,
+		              (off_t) ( offset + (off64_t) buffer_offset ) );
+
+		if( read_count == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		if( read_count == 0 )
+		{
+			break;
+		}
+		buffer_offset += (size_t) read_count;
+	}
+	return( (ssize_t) buffer_offset );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: positional files not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBBDE_POSITIONAL_FILE_SUPPORT ) */
+}
+
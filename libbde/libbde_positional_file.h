@@ -0,0 +1,82 @@
+/*
+ * Positional file functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBDE_POSITIONAL_FILE_H )
+#define _LIBBDE_POSITIONAL_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbde_libcerror.h"
+
+#if !defined( WINAPI ) && defined( HAVE_FCNTL_H ) && defined( HAVE_UNISTD_H ) && defined( HAVE_PREAD )
+#define HAVE_LIBBDE_POSITIONAL_FILE_SUPPORT
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libbde_positional_file libbde_positional_file_t;
+
+struct libbde_positional_file
+{
+	/* The file descriptor
+	 * The file descriptor is shared between threads, the reads do not
+	 * change the offset of the file descriptor
+	 */
+	int file_descriptor;
+
+	/* The size
+	 */
+	size64_t size;
+};
+
+int libbde_positional_file_initialize(
+     libbde_positional_file_t **positional_file,
+     libcerror_error_t **error );
+
+int libbde_positional_file_free(
+     libbde_positional_file_t **positional_file,
+     libcerror_error_t **error );
+
+int libbde_positional_file_open(
+     libbde_positional_file_t *positional_file,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libbde_positional_file_close(
+     libbde_positional_file_t *positional_file,
+     libcerror_error_t **error );
+
+ssize_t libbde_positional_file_read_buffer_at_offset(
+         libbde_positional_file_t *positional_file,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBDE_POSITIONAL_FILE_H ) */
+
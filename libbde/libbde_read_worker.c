@@ -0,0 +1,720 @@
+/*
+ * Read worker functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libbde_encryption_context.h"
+#include "libbde_io_handle.h"
+#include "libbde_libbfio.h"
+#include "libbde_libcerror.h"
+#include "libbde_read_worker.h"
+#include "libbde_sector_data.h"
+#include "libbde_statistics.h"
+#include "libbde_unused.h"
+
+/* Creates a read worker
+ * Make sure the value read_worker is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_read_worker_initialize(
+     libbde_read_worker_t **read_worker,
+     libbde_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint16_t encryption_method,
+     const uint8_t *key,
+     size_t key_size,
+     const uint8_t *tweak_key,
+     size_t tweak_key_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_read_worker_initialize";
+	int result            = 0;
+
+	if( read_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_worker != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read worker value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*read_worker = memory_allocate_structure(
+	                libbde_read_worker_t );
+
+	if( *read_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read worker.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_worker,
+	     0,
+	     sizeof( libbde_read_worker_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read worker.",
+		 function );
+
+		memory_free(
+		 *read_worker );
+
+		*read_worker = NULL;
+
+		return( -1 );
+	}
+	/* The IO handle of the volume is shared, since reading does not change
+	 * its state other than the statistics, which are updated atomically.
+	 * The mapped data, the positional file and the block cache of the IO handle
+	 * can be read concurrently. The file IO handle is cloned since reading
+	 * changes its current offset
+	 */
+	( *read_worker )->io_handle = io_handle;
+
+	if( libbfio_handle_clone(
+	     &( ( *read_worker )->file_io_handle ),
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libbfio_handle_is_open(
+	          ( *read_worker )->file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libbfio_handle_open(
+		     ( *read_worker )->file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libbde_encryption_context_initialize(
+	     &( ( *read_worker )->encryption_context ),
+	     encryption_method,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create encryption context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbde_encryption_context_set_keys(
+	     ( *read_worker )->encryption_context,
+	     key,
+	     key_size,
+	     tweak_key,
+	     tweak_key_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set keys in encryption context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbde_sector_data_initialize(
+	     &( ( *read_worker )->sector_data ),
+	     (size_t) io_handle->bytes_per_sector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sector data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *read_worker != NULL )
+	{
+		if( ( *read_worker )->encryption_context != NULL )
+		{
+			libbde_encryption_context_free(
+			 &( ( *read_worker )->encryption_context ),
+			 NULL );
+		}
+		if( ( *read_worker )->file_io_handle != NULL )
+		{
+			libbfio_handle_free(
+			 &( ( *read_worker )->file_io_handle ),
+			 NULL );
+		}
+		memory_free(
+		 *read_worker );
+
+		*read_worker = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read worker
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_read_worker_free(
+     libbde_read_worker_t **read_worker,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_read_worker_free";
+	int result            = 1;
+
+	if( read_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_worker != NULL )
+	{
+		if( ( *read_worker )->sector_data != NULL )
+		{
+			if( libbde_sector_data_free(
+			     &( ( *read_worker )->sector_data ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sector data.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *read_worker )->encryption_context != NULL )
+		{
+			if( libbde_encryption_context_free(
+			     &( ( *read_worker )->encryption_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free encryption context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *read_worker )->file_io_handle != NULL )
+		{
+			if( libbfio_handle_close(
+			     ( *read_worker )->file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle.",
+				 function );
+
+				result = -1;
+			}
+			if( libbfio_handle_free(
+			     &( ( *read_worker )->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *read_worker )->error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *read_worker )->error ) );
+		}
+		memory_free(
+		 *read_worker );
+
+		*read_worker = NULL;
+	}
+	return( result );
+}
+
+/* Sets the buffers to be read by the read worker
+ * The worker reads the buffers with index first_buffer_index + ( N * buffer_index_increment )
+ * The buffers, buffer sizes, offsets and read counts are not managed by the read worker
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_read_worker_set_buffers(
+     libbde_read_worker_t *read_worker,
+     uint8_t **buffers,
+     size_t *buffer_sizes,
+     off64_t *offsets,
+     ssize_t *read_counts,
+     int number_of_buffers,
+     int first_buffer_index,
+     int buffer_index_increment,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_read_worker_set_buffers";
+
+	if( read_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_buffers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of buffers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_buffer_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first buffer index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_index_increment <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid buffer index increment value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	read_worker->buffers                = buffers;
+	read_worker->buffer_sizes           = buffer_sizes;
+	read_worker->offsets                = offsets;
+	read_worker->read_counts            = read_counts;
+	read_worker->number_of_buffers      = number_of_buffers;
+	read_worker->first_buffer_index     = first_buffer_index;
+	read_worker->buffer_index_increment = buffer_index_increment;
+
+	return( 1 );
+}
+
+/* Reads unencrypted data at a specific offset into a buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libbde_read_worker_read_buffer_at_offset(
+         libbde_read_worker_t *read_worker,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libbde_sector_data_t buffer_sector_data;
+
+	libbde_sector_data_t *sector_data = NULL;
+	static char *function             = "libbde_read_worker_read_buffer_at_offset";
+	size_t buffer_offset              = 0;
+	size_t read_size                  = 0;
+	size_t remaining_buffer_size      = 0;
+	size_t sector_data_offset         = 0;
+	off64_t sector_file_offset        = 0;
+
+	if( read_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	libbde_statistics_add_value(
+	 &( read_worker->io_handle->statistics.number_of_read_calls ),
+	 1 );
+
+	if( (size64_t) offset >= read_worker->io_handle->volume_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( read_worker->io_handle->volume_size - offset ) )
+	{
+		buffer_size = (size_t) ( read_worker->io_handle->volume_size - offset );
+	}
+	remaining_buffer_size = buffer_size;
+
+	sector_file_offset = ( offset / read_worker->io_handle->bytes_per_sector ) * read_worker->io_handle->bytes_per_sector;
+	sector_data_offset = (size_t) ( offset - sector_file_offset );
+
+	while( remaining_buffer_size > 0 )
+	{
+		read_size = read_worker->io_handle->bytes_per_sector - sector_data_offset;
+
+		if( read_size > remaining_buffer_size )
+		{
+			read_size = remaining_buffer_size;
+		}
+		/* Whole sectors are decrypted directly into the buffer
+		 */
+		if( read_size == (size_t) read_worker->io_handle->bytes_per_sector )
+		{
+			buffer_sector_data.data      = &( buffer[ buffer_offset ] );
+			buffer_sector_data.data_size = read_size;
+
+			sector_data = &buffer_sector_data;
+		}
+		else
+		{
+			sector_data = read_worker->sector_data;
+		}
+		if( libbde_sector_data_read_file_io_handle(
+		     sector_data,
+		     read_worker->io_handle,
+		     read_worker->file_io_handle,
+		     sector_file_offset,
+		     read_worker->encryption_context,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 sector_file_offset,
+			 sector_file_offset );
+
+			return( -1 );
+		}
+		if( sector_data != &buffer_sector_data )
+		{
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( ( sector_data->data )[ sector_data_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy sector data to buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		buffer_offset         += read_size;
+		remaining_buffer_size -= read_size;
+		sector_data_offset     = 0;
+		sector_file_offset    += read_worker->io_handle->bytes_per_sector;
+
+		if( read_worker->io_handle->abort != 0 )
+		{
+			break;
+		}
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Reads the buffers assigned to the read worker
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_read_worker_read_buffers(
+     libbde_read_worker_t *read_worker,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_read_worker_read_buffers";
+	ssize_t read_count    = 0;
+	int buffer_index      = 0;
+
+	if( read_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_worker->buffers == NULL )
+	 || ( read_worker->buffer_sizes == NULL )
+	 || ( read_worker->offsets == NULL )
+	 || ( read_worker->read_counts == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid read worker - missing buffers.",
+		 function );
+
+		return( -1 );
+	}
+	for( buffer_index = read_worker->first_buffer_index;
+	     buffer_index < read_worker->number_of_buffers;
+	     buffer_index += read_worker->buffer_index_increment )
+	{
+		if( read_worker->io_handle->abort != 0 )
+		{
+			break;
+		}
+		read_count = libbde_read_worker_read_buffer_at_offset(
+		              read_worker,
+		              read_worker->buffers[ buffer_index ],
+		              read_worker->buffer_sizes[ buffer_index ],
+		              read_worker->offsets[ buffer_index ],
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 buffer_index,
+			 read_worker->offsets[ buffer_index ],
+			 read_worker->offsets[ buffer_index ] );
+
+			return( -1 );
+		}
+		read_worker->read_counts[ buffer_index ] = read_count;
+	}
+	return( 1 );
+}
+
+/* Callback function to read the buffers in a worker thread
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_read_worker_callback(
+     libbde_read_worker_t *read_worker,
+     void *arguments LIBBDE_ATTRIBUTE_UNUSED )
+{
+	LIBBDE_UNREFERENCED_PARAMETER( arguments )
+
+	if( read_worker == NULL )
+	{
+		return( -1 );
+	}
+	read_worker->result = libbde_read_worker_read_buffers(
+	                       read_worker,
+	                       &( read_worker->error ) );
+
+	return( read_worker->result );
+}
+
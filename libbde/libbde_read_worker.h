@@ -0,0 +1,148 @@
+/*
+ * Read worker functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBDE_READ_WORKER_H )
+#define _LIBBDE_READ_WORKER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbde_encryption_context.h"
+#include "libbde_io_handle.h"
+#include "libbde_libbfio.h"
+#include "libbde_libcerror.h"
+#include "libbde_sector_data.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of read workers
+ */
+#define LIBBDE_READ_WORKER_MAXIMUM_NUMBER_OF_WORKERS	16
+
+typedef struct libbde_read_worker libbde_read_worker_t;
+
+struct libbde_read_worker
+{
+	/* The IO handle
+	 * The IO handle of the volume, which is shared with the other read workers
+	 */
+	libbde_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 * A clone of the file IO handle of the volume
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The encryption context
+	 */
+	libbde_encryption_context_t *encryption_context;
+
+	/* The sector data
+	 * Used for reads that do not cover an entire sector
+	 */
+	libbde_sector_data_t *sector_data;
+
+	/* The buffers
+	 */
+	uint8_t **buffers;
+
+	/* The buffer sizes
+	 */
+	size_t *buffer_sizes;
+
+	/* The offsets
+	 */
+	off64_t *offsets;
+
+	/* The read counts
+	 */
+	ssize_t *read_counts;
+
+	/* The number of buffers
+	 */
+	int number_of_buffers;
+
+	/* The index of the first buffer read by the worker
+	 */
+	int first_buffer_index;
+
+	/* The buffer index increment, which is the number of workers
+	 */
+	int buffer_index_increment;
+
+	/* The result
+	 */
+	int result;
+
+	/* The error
+	 */
+	libcerror_error_t *error;
+};
+
+int libbde_read_worker_initialize(
+     libbde_read_worker_t **read_worker,
+     libbde_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint16_t encryption_method,
+     const uint8_t *key,
+     size_t key_size,
+     const uint8_t *tweak_key,
+     size_t tweak_key_size,
+     libcerror_error_t **error );
+
+int libbde_read_worker_free(
+     libbde_read_worker_t **read_worker,
+     libcerror_error_t **error );
+
+int libbde_read_worker_set_buffers(
+     libbde_read_worker_t *read_worker,
+     uint8_t **buffers,
+     size_t *buffer_sizes,
+     off64_t *offsets,
+     ssize_t *read_counts,
+     int number_of_buffers,
+     int first_buffer_index,
+     int buffer_index_increment,
+     libcerror_error_t **error );
+
+ssize_t libbde_read_worker_read_buffer_at_offset(
+         libbde_read_worker_t *read_worker,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libbde_read_worker_read_buffers(
+     libbde_read_worker_t *read_worker,
+     libcerror_error_t **error );
+
+int libbde_read_worker_callback(
+     libbde_read_worker_t *read_worker,
+     void *arguments );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBDE_READ_WORKER_H ) */
+
@@ -31,6 +31,7 @@
 #include "libbde_libcerror.h"
 #include "libbde_libcnotify.h"
 #include "libbde_sector_data.h"
+#include "libbde_statistics.h"
 
 /* Creates sector data
  * Make sure the value sector_data is referencing, is set to NULL
@@ -199,11 +200,15 @@ int libbde_sector_data_read_file_io_handle(
      uint8_t zero_metadata,
      libcerror_error_t **error )
 {
-	uint8_t *encrypted_data = NULL;
-	uint8_t *read_buffer    = 0;
-	static char *function   = "libbde_sector_data_read_file_io_handle";
-	ssize_t read_count      = 0;
-	uint64_t block_key      = 0;
+	const uint8_t *encrypted_sector_data = NULL;
+	const uint8_t *mapped_data           = NULL;
+	uint8_t *encrypted_data              = NULL;
+	uint8_t *read_buffer                 = 0;
+	static char *function                = "libbde_sector_data_read_file_io_handle";
+	ssize_t read_count                   = 0;
+	uint64_t end_time                    = 0;
+	uint64_t start_time                  = 0;
+	int result                           = 0;
 
 	if( sector_data == NULL )
 	{
@@ -372,28 +377,89 @@ int libbde_sector_data_read_file_io_handle(
 	}
 	else
 	{
-		encrypted_data = (uint8_t *) memory_allocate(
-		                              sizeof( uint8_t ) * sector_data->data_size );
+		/* If the file is memory mapped the encrypted data is decrypted
+		 * directly from the mapped data
+		 */
+		if( io_handle->mapped_file_io_handle != NULL )
+		{
+			result = libbde_mapped_file_io_handle_get_data_at_offset(
+			          io_handle->mapped_file_io_handle,
+			          sector_data_offset,
+			          sector_data->data_size,
+			          &mapped_data,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve mapped data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 sector_data_offset,
+				 sector_data_offset );
 
-		if( encrypted_data == NULL )
+				goto on_error;
+			}
+			encrypted_sector_data = mapped_data;
+		}
+		if( mapped_data == NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create encrypted data.",
-			 function );
+			encrypted_data = (uint8_t *) memory_allocate(
+			                              sizeof( uint8_t ) * sector_data->data_size );
 
-			goto on_error;
+			if( encrypted_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create encrypted data.",
+				 function );
+
+				goto on_error;
+			}
+			read_buffer           = encrypted_data;
+			encrypted_sector_data = encrypted_data;
 		}
-		read_buffer = encrypted_data;
 	}
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              read_buffer,
-	              sector_data->data_size,
-	              sector_data_offset,
-	              error );
+	start_time = libbde_statistics_get_timestamp();
+
+	if( mapped_data != NULL )
+	{
+		read_count = (ssize_t) sector_data->data_size;
+
+		libbde_statistics_add_value(
+		 &( io_handle->statistics.number_of_bytes_read ),
+		 (uint64_t) read_count );
+	}
+	else
+	{
+		read_count = libbde_io_handle_read_buffer_at_offset(
+		              io_handle,
+		              file_io_handle,
+		              read_buffer,
+		              sector_data->data_size,
+		              sector_data_offset,
+		              error );
+	}
+	end_time = libbde_statistics_get_timestamp();
+
+	libbde_statistics_add_value(
+	 &( io_handle->statistics.read_time ),
+	 end_time - start_time );
+
+	if( io_handle->trace_function != NULL )
+	{
+		io_handle->trace_function(
+		 io_handle->trace_user_data,
+		 LIBBDE_TRACE_EVENT_TYPE_READ,
+		 sector_data_offset,
+		 (size64_t) sector_data->data_size,
+		 start_time,
+		 end_time );
+	}
 
 	if( read_count != (ssize_t) sector_data->data_size )
 	{
@@ -411,13 +477,13 @@ int libbde_sector_data_read_file_io_handle(
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
-		if( read_buffer == encrypted_data )
+		if( encrypted_sector_data != NULL )
 		{
 			libcnotify_printf(
 			 "%s: encrypted sector data:\n",
 			 function );
 			libcnotify_print_data(
-			 encrypted_data,
+			 encrypted_sector_data,
 			 sector_data->data_size,
 			 0 );
 		}
@@ -453,23 +519,19 @@ int libbde_sector_data_read_file_io_handle(
 		 &( sector_data->data[ 56 ] ),
 		 io_handle->mft_mirror_cluster_block_number );
 	}
-	if( read_buffer == encrypted_data )
+	if( encrypted_sector_data != NULL )
 	{
-		block_key = (uint64_t) sector_data_offset;
+		start_time = libbde_statistics_get_timestamp();
 
-		if( ( encryption_context->method == LIBBDE_ENCRYPTION_METHOD_AES_128_XTS )
-		 || ( encryption_context->method == LIBBDE_ENCRYPTION_METHOD_AES_256_XTS ) )
-		{
-			block_key /= io_handle->bytes_per_sector;
-		}
-		if( libbde_encryption_context_crypt(
+		if( libbde_encryption_context_crypt_sectors(
 		     encryption_context,
 		     LIBBDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
-		     encrypted_data,
+		     encrypted_sector_data,
 		     sector_data->data_size,
 		     sector_data->data,
 		     sector_data->data_size,
-		     block_key,
+		     (uint64_t) sector_data_offset,
+		     (size_t) io_handle->bytes_per_sector,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -481,6 +543,25 @@ int libbde_sector_data_read_file_io_handle(
 
 			goto on_error;
 		}
+		end_time = libbde_statistics_get_timestamp();
+
+		libbde_statistics_add_decrypted(
+		 &( io_handle->statistics ),
+		 encryption_context->method,
+		 (uint64_t) sector_data->data_size,
+		 end_time - start_time );
+
+		if( io_handle->trace_function != NULL )
+		{
+			io_handle->trace_function(
+			 io_handle->trace_user_data,
+			 LIBBDE_TRACE_EVENT_TYPE_DECRYPT,
+			 sector_data_offset,
+			 (size64_t) sector_data->data_size,
+			 start_time,
+			 end_time );
+		}
+
 		memory_free(
 		 encrypted_data );
 
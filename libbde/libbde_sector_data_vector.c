@@ -31,6 +31,7 @@
 #include "libbde_libfcache.h"
 #include "libbde_sector_data.h"
 #include "libbde_sector_data_vector.h"
+#include "libbde_statistics.h"
 
 /* Creates a sector data vector
  * Make sure the value sector data vector is referencing, is set to NULL
@@ -133,6 +134,20 @@ int libbde_sector_data_vector_initialize(
 
 		goto on_error;
 	}
+	if( libfcache_cache_initialize(
+	     &( ( *sector_data_vector )->probation_cache ),
+	     LIBBDE_MAXIMUM_CACHE_ENTRIES_SECTOR_DATA_PROBATION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create probationary sectors cache.",
+		 function );
+
+		goto on_error;
+	}
 	( *sector_data_vector )->bytes_per_sector = bytes_per_sector;
 	( *sector_data_vector )->data_offset      = data_offset;
 	( *sector_data_vector )->data_size        = data_size;
@@ -142,6 +157,12 @@ int libbde_sector_data_vector_initialize(
 on_error:
 	if( *sector_data_vector != NULL )
 	{
+		if( ( *sector_data_vector )->cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( ( *sector_data_vector )->cache ),
+			 NULL );
+		}
 		memory_free(
 		 *sector_data_vector );
 
@@ -159,6 +180,7 @@ int libbde_sector_data_vector_free(
 {
 	static char *function = "libbde_sector_data_vector_free";
 	int result            = 1;
+	int warm_range_index  = 0;
 
 	if( sector_data_vector == NULL )
 	{
@@ -186,6 +208,54 @@ int libbde_sector_data_vector_free(
 
 			result = -1;
 		}
+		if( libfcache_cache_free(
+		     &( ( *sector_data_vector )->probation_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free probationary cache.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *sector_data_vector )->uncached_sector_data != NULL )
+		{
+			if( libbde_sector_data_free(
+			     &( ( *sector_data_vector )->uncached_sector_data ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free uncached sector data.",
+				 function );
+
+				result = -1;
+			}
+		}
+		for( warm_range_index = 0;
+		     warm_range_index < ( *sector_data_vector )->number_of_warm_ranges;
+		     warm_range_index++ )
+		{
+			if( libbde_sector_data_free(
+			     &( ( *sector_data_vector )->warm_ranges[ warm_range_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free warm range: %d.",
+				 function,
+				 warm_range_index );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *sector_data_vector );
 
@@ -194,7 +264,165 @@ int libbde_sector_data_vector_free(
 	return( result );
 }
 
+/* Appends a warm range
+ * The warm range contains decrypted sector data, starting at a sector aligned offset,
+ * that is used instead of reading and decrypting the sectors
+ * The sector data vector takes over management of the warm range if successful
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_sector_data_vector_append_warm_range(
+     libbde_sector_data_vector_t *sector_data_vector,
+     off64_t offset,
+     libbde_sector_data_t *warm_range,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_sector_data_vector_append_warm_range";
+
+	if( sector_data_vector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data vector.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data_vector->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector data vector - bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data_vector->number_of_warm_ranges >= LIBBDE_MAXIMUM_NUMBER_OF_WARM_RANGES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector data vector - number of warm ranges value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( ( offset % sector_data_vector->bytes_per_sector ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( warm_range == NULL )
+	 || ( warm_range->data == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid warm range.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( warm_range->data_size == 0 )
+	 || ( ( warm_range->data_size % sector_data_vector->bytes_per_sector ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid warm range - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	sector_data_vector->warm_ranges[ sector_data_vector->number_of_warm_ranges ]        = warm_range;
+	sector_data_vector->warm_range_offsets[ sector_data_vector->number_of_warm_ranges ] = offset;
+
+	sector_data_vector->number_of_warm_ranges += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the decrypted data of the sector at a specific offset from the warm ranges
+ * Returns 1 if successful, 0 if the sector is not in a warm range or -1 on error
+ */
+int libbde_sector_data_vector_get_warm_data_at_offset(
+     libbde_sector_data_vector_t *sector_data_vector,
+     off64_t offset,
+     uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_sector_data_vector_get_warm_data_at_offset";
+	off64_t range_offset  = 0;
+	int warm_range_index  = 0;
+
+	if( sector_data_vector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data vector.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	for( warm_range_index = 0;
+	     warm_range_index < sector_data_vector->number_of_warm_ranges;
+	     warm_range_index++ )
+	{
+		range_offset = offset - sector_data_vector->warm_range_offsets[ warm_range_index ];
+
+		if( ( range_offset >= 0 )
+		 && ( (size64_t) range_offset < (size64_t) sector_data_vector->warm_ranges[ warm_range_index ]->data_size ) )
+		{
+			*data = &( ( sector_data_vector->warm_ranges[ warm_range_index ]->data )[ range_offset ] );
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
 /* Reads sector data at a specific offset
+ *
+ * The cache is scan resistant, sectors that are read for the first time are
+ * admitted into a small probationary cache and only sectors that are read
+ * again after they were admitted, are stored in the main cache. A sector that
+ * is read again while it is in the probationary cache is promoted into the main
+ * cache. This prevents a sequential scan from evicting frequently used sectors,
+ * such as file system metadata, from the main cache.
+ *
+ * Sectors in the warm ranges are not stored in the caches, their sector data
+ * refers to the data of the warm range and remains valid until the next call.
+ *
+ * If read_flags contains LIBBDE_READ_FLAG_STREAMING sectors that are not cached
+ * are read into a reusable buffer and not stored in the cache. The sector data
+ * remains valid until the next call.
+ *
  * Returns 1 if successful or -1 on error
  */
 int libbde_sector_data_vector_get_sector_data_at_offset(
@@ -203,13 +431,17 @@ int libbde_sector_data_vector_get_sector_data_at_offset(
      libbfio_handle_t *file_io_handle,
      libbde_encryption_context_t *encryption_context,
      off64_t offset,
+     uint8_t read_flags,
      libbde_sector_data_t **sector_data,
      libcerror_error_t **error )
 {
 	libbde_sector_data_t *safe_sector_data = NULL;
+	libfcache_cache_t *cache               = NULL;
 	libfcache_cache_value_t *cache_value   = NULL;
 	static char *function                  = "libbde_sector_data_vector_get_sector_data_at_offset";
+	uint8_t *warm_data                     = NULL;
 	off64_t sector_data_offset             = 0;
+	int history_entry_index                = 0;
 	int result                             = 0;
 
 	if( sector_data_vector == NULL )
@@ -234,14 +466,72 @@ int libbde_sector_data_vector_get_sector_data_at_offset(
 
 		return( -1 );
 	}
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data_vector->number_of_warm_ranges > 0 )
+	{
+		result = libbde_sector_data_vector_get_warm_data_at_offset(
+		          sector_data_vector,
+		          offset,
+		          &warm_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve warm data.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			libbde_statistics_add_value(
+			 &( io_handle->statistics.number_of_cache_hits ),
+			 1 );
+
+			sector_data_vector->warm_sector_data.data      = warm_data;
+			sector_data_vector->warm_sector_data.data_size = (size_t) sector_data_vector->bytes_per_sector;
+
+			*sector_data = &( sector_data_vector->warm_sector_data );
+
+			return( 1 );
+		}
+	}
+	cache = sector_data_vector->cache;
+
 	result = libfcache_cache_get_value_by_identifier(
-	          sector_data_vector->cache,
+	          cache,
 	          0,
 	          offset,
 	          sector_data_vector->cache_timestamp,
 	          &cache_value,
 	          error );
 
+	if( result == 0 )
+	{
+		cache = sector_data_vector->probation_cache;
+
+		result = libfcache_cache_get_value_by_identifier(
+		          cache,
+		          0,
+		          offset,
+		          sector_data_vector->cache_timestamp,
+		          &cache_value,
+		          error );
+	}
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -261,15 +551,19 @@ int libbde_sector_data_vector_get_sector_data_at_offset(
 			libcnotify_printf(
 			 "%s: cache: 0x%08" PRIjx " hit for offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
 			 function,
-			 (intptr_t) sector_data_vector->cache,
+			 (intptr_t) cache,
 			 offset,
 			 offset );
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
+		libbde_statistics_add_value(
+		 &( io_handle->statistics.number_of_cache_hits ),
+		 1 );
+
 		if( libfcache_cache_value_get_value(
 		     cache_value,
-		     (intptr_t **) sector_data,
+		     (intptr_t **) &safe_sector_data,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -279,41 +573,73 @@ int libbde_sector_data_vector_get_sector_data_at_offset(
 			 "%s: unable to retrieve sector data from cache.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-	}
-	else
-	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		/* A streaming read does not indicate reuse of the sector
+		 */
+		if( ( cache == sector_data_vector->probation_cache )
+		 && ( ( read_flags & LIBBDE_READ_FLAG_STREAMING ) == 0 ) )
 		{
-			libcnotify_printf(
-			 "%s: cache: 0x%08" PRIjx " miss for offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-			 function,
-			 (intptr_t) sector_data_vector->cache,
-			 offset,
-			 offset );
+			if( libbde_sector_data_vector_promote_sector_data(
+			     sector_data_vector,
+			     offset,
+			     safe_sector_data,
+			     &safe_sector_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to promote sector data.",
+				 function );
+
+				return( -1 );
+			}
 		}
+		*sector_data = safe_sector_data;
+
+		return( 1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: cache: 0x%08" PRIjx " miss for offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 (intptr_t) sector_data_vector->cache,
+		 offset,
+		 offset );
+	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-		if( libbde_sector_data_initialize(
-		     &safe_sector_data,
-		     (size_t) sector_data_vector->bytes_per_sector,
-		     error ) != 1 )
+	libbde_statistics_add_value(
+	 &( io_handle->statistics.number_of_cache_misses ),
+	 1 );
+
+	sector_data_offset = sector_data_vector->data_offset + offset;
+
+	if( ( read_flags & LIBBDE_READ_FLAG_STREAMING ) != 0 )
+	{
+		if( sector_data_vector->uncached_sector_data == NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create sector data.",
-			 function );
+			if( libbde_sector_data_initialize(
+			     &( sector_data_vector->uncached_sector_data ),
+			     (size_t) sector_data_vector->bytes_per_sector,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create uncached sector data.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
-		sector_data_offset = sector_data_vector->data_offset + offset;
-
 		if( libbde_sector_data_read_file_io_handle(
-		     safe_sector_data,
+		     sector_data_vector->uncached_sector_data,
 		     io_handle,
 		     file_io_handle,
 		     sector_data_offset,
@@ -332,28 +658,97 @@ int libbde_sector_data_vector_get_sector_data_at_offset(
 
 			goto on_error;
 		}
-		if( libfcache_cache_set_value_by_identifier(
-		     sector_data_vector->cache,
-		     0,
-		     offset,
-		     sector_data_vector->cache_timestamp,
-		     (intptr_t *) safe_sector_data,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libbde_sector_data_free,
-		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
-		     error ) != 1 )
+		*sector_data = sector_data_vector->uncached_sector_data;
+
+		return( 1 );
+	}
+	if( libbde_sector_data_initialize(
+	     &safe_sector_data,
+	     (size_t) sector_data_vector->bytes_per_sector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sector data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbde_sector_data_read_file_io_handle(
+	     safe_sector_data,
+	     io_handle,
+	     file_io_handle,
+	     sector_data_offset,
+	     encryption_context,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 sector_data_offset,
+		 sector_data_offset );
+
+		goto on_error;
+	}
+	/* Sectors that were admitted recently are stored in the main cache
+	 * other sectors are admitted into the probationary cache
+	 */
+	cache = sector_data_vector->probation_cache;
+
+	for( history_entry_index = 0;
+	     history_entry_index < sector_data_vector->number_of_history_entries;
+	     history_entry_index++ )
+	{
+		if( sector_data_vector->history[ history_entry_index ] == offset )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set sector data in cache.",
-			 function );
+			cache = sector_data_vector->cache;
 
-			goto on_error;
+			break;
 		}
-		*sector_data     = safe_sector_data;
-		safe_sector_data = NULL;
 	}
+	if( cache == sector_data_vector->probation_cache )
+	{
+		sector_data_vector->history[ sector_data_vector->history_index ] = offset;
+
+		sector_data_vector->history_index += 1;
+
+		if( sector_data_vector->history_index >= LIBBDE_MAXIMUM_CACHE_ENTRIES_SECTOR_DATA_HISTORY )
+		{
+			sector_data_vector->history_index = 0;
+		}
+		if( sector_data_vector->number_of_history_entries < LIBBDE_MAXIMUM_CACHE_ENTRIES_SECTOR_DATA_HISTORY )
+		{
+			sector_data_vector->number_of_history_entries += 1;
+		}
+	}
+	if( libfcache_cache_set_value_by_identifier(
+	     cache,
+	     0,
+	     offset,
+	     sector_data_vector->cache_timestamp,
+	     (intptr_t *) safe_sector_data,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libbde_sector_data_free,
+	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set sector data in cache.",
+		 function );
+
+		goto on_error;
+	}
+	*sector_data     = safe_sector_data;
+	safe_sector_data = NULL;
+
 	return( 1 );
 
 on_error:
@@ -366,3 +761,342 @@ on_error:
 	return( -1 );
 }
 
+/* Promotes sector data that was read again while in the probationary cache
+ * into the main cache
+ *
+ * The probationary cache owns the cached sector data and libfcache cannot
+ * release a value without freeing it, hence a copy of the sector data is
+ * stored in the main cache. The main cache is searched first, so the copy
+ * that remains in the probationary cache is no longer used and is evicted
+ * by subsequent admissions.
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_sector_data_vector_promote_sector_data(
+     libbde_sector_data_vector_t *sector_data_vector,
+     off64_t offset,
+     libbde_sector_data_t *sector_data,
+     libbde_sector_data_t **promoted_sector_data,
+     libcerror_error_t **error )
+{
+	libbde_sector_data_t *safe_sector_data = NULL;
+	static char *function                  = "libbde_sector_data_vector_promote_sector_data";
+
+	if( sector_data_vector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data vector.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data.",
+		 function );
+
+		return( -1 );
+	}
+	if( promoted_sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid promoted sector data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbde_sector_data_initialize(
+	     &safe_sector_data,
+	     sector_data->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sector data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     safe_sector_data->data,
+	     sector_data->data,
+	     sector_data->data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy sector data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_set_value_by_identifier(
+	     sector_data_vector->cache,
+	     0,
+	     offset,
+	     sector_data_vector->cache_timestamp,
+	     (intptr_t *) safe_sector_data,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libbde_sector_data_free,
+	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set sector data in cache.",
+		 function );
+
+		goto on_error;
+	}
+	*promoted_sector_data = safe_sector_data;
+
+	return( 1 );
+
+on_error:
+	if( safe_sector_data != NULL )
+	{
+		libbde_sector_data_free(
+		 &safe_sector_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads sector data at a specific offset directly into a buffer
+ * The buffer size must be equal to the number of bytes per sector
+ * A cached sector is copied from the warm ranges or the cache, otherwise the sector is decrypted
+ * into the buffer without being added to the cache
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_sector_data_vector_read_sector_data_at_offset_into_buffer(
+     libbde_sector_data_vector_t *sector_data_vector,
+     libbde_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libbde_encryption_context_t *encryption_context,
+     off64_t offset,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	libbde_sector_data_t buffer_sector_data;
+
+	libbde_sector_data_t *sector_data    = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libbde_sector_data_vector_read_sector_data_at_offset_into_buffer";
+	uint8_t *warm_data                   = NULL;
+	off64_t sector_data_offset           = 0;
+	int result                           = 0;
+
+	if( sector_data_vector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data vector.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size != (size_t) sector_data_vector->bytes_per_sector )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data_vector->number_of_warm_ranges > 0 )
+	{
+		result = libbde_sector_data_vector_get_warm_data_at_offset(
+		          sector_data_vector,
+		          offset,
+		          &warm_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve warm data.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			libbde_statistics_add_value(
+			 &( io_handle->statistics.number_of_cache_hits ),
+			 1 );
+
+			if( memory_copy(
+			     buffer,
+			     warm_data,
+			     buffer_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy warm data to buffer.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+	}
+	result = libfcache_cache_get_value_by_identifier(
+	          sector_data_vector->cache,
+	          0,
+	          offset,
+	          sector_data_vector->cache_timestamp,
+	          &cache_value,
+	          error );
+
+	if( result == 0 )
+	{
+		result = libfcache_cache_get_value_by_identifier(
+		          sector_data_vector->probation_cache,
+		          0,
+		          offset,
+		          sector_data_vector->cache_timestamp,
+		          &cache_value,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from cache.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		libbde_statistics_add_value(
+		 &( io_handle->statistics.number_of_cache_hits ),
+		 1 );
+
+		if( libfcache_cache_value_get_value(
+		     cache_value,
+		     (intptr_t **) &sector_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sector data from cache.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( sector_data == NULL )
+		 || ( sector_data->data == NULL )
+		 || ( sector_data->data_size != buffer_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid sector data.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     buffer,
+		     sector_data->data,
+		     buffer_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sector data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	libbde_statistics_add_value(
+	 &( io_handle->statistics.number_of_cache_misses ),
+	 1 );
+
+	sector_data_offset = sector_data_vector->data_offset + offset;
+
+	/* The buffer is wrapped in sector data so that the sector is decrypted
+	 * directly into it, the wrapper does not take ownership of the buffer
+	 */
+	buffer_sector_data.data      = buffer;
+	buffer_sector_data.data_size = buffer_size;
+
+	if( libbde_sector_data_read_file_io_handle(
+	     &buffer_sector_data,
+	     io_handle,
+	     file_io_handle,
+	     sector_data_offset,
+	     encryption_context,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 sector_data_offset,
+		 sector_data_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libbde_definitions.h"
 #include "libbde_encryption_context.h"
 #include "libbde_io_handle.h"
 #include "libbde_libcerror.h"
@@ -45,9 +46,52 @@ struct libbde_sector_data_vector
 	int64_t cache_timestamp;
 
 	/* The sector data cache
+	 * Contains sectors that were read again after their first admission
 	 */
 	libfcache_cache_t *cache;
 
+	/* The probationary sector data cache
+	 * Contains sectors that were read for the first time
+	 */
+	libfcache_cache_t *probation_cache;
+
+	/* The admission history
+	 * Contains the offsets of the sectors most recently admitted
+	 * into the probationary cache
+	 */
+	off64_t history[ LIBBDE_MAXIMUM_CACHE_ENTRIES_SECTOR_DATA_HISTORY ];
+
+	/* The admission history index
+	 */
+	int history_index;
+
+	/* The number of admission history entries
+	 */
+	int number_of_history_entries;
+
+	/* The uncached sector data
+	 * Used for sectors that are not stored in the cache
+	 */
+	libbde_sector_data_t *uncached_sector_data;
+
+	/* The warm ranges
+	 * Contains the decrypted data prefetched by the warmup
+	 */
+	libbde_sector_data_t *warm_ranges[ LIBBDE_MAXIMUM_NUMBER_OF_WARM_RANGES ];
+
+	/* The warm range offsets
+	 */
+	off64_t warm_range_offsets[ LIBBDE_MAXIMUM_NUMBER_OF_WARM_RANGES ];
+
+	/* The number of warm ranges
+	 */
+	int number_of_warm_ranges;
+
+	/* The warm sector data
+	 * Refers to a sector in the warm ranges and does not own its data
+	 */
+	libbde_sector_data_t warm_sector_data;
+
 	/* The number of bytes per sector
 	 */
 	uint16_t bytes_per_sector;
@@ -72,15 +116,45 @@ int libbde_sector_data_vector_free(
      libbde_sector_data_vector_t **sector_data_vector,
      libcerror_error_t **error );
 
+int libbde_sector_data_vector_append_warm_range(
+     libbde_sector_data_vector_t *sector_data_vector,
+     off64_t offset,
+     libbde_sector_data_t *warm_range,
+     libcerror_error_t **error );
+
+int libbde_sector_data_vector_get_warm_data_at_offset(
+     libbde_sector_data_vector_t *sector_data_vector,
+     off64_t offset,
+     uint8_t **data,
+     libcerror_error_t **error );
+
 int libbde_sector_data_vector_get_sector_data_at_offset(
      libbde_sector_data_vector_t *sector_data_vector,
      libbde_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libbde_encryption_context_t *encryption_context,
      off64_t offset,
+     uint8_t read_flags,
      libbde_sector_data_t **sector_data,
      libcerror_error_t **error );
 
+int libbde_sector_data_vector_promote_sector_data(
+     libbde_sector_data_vector_t *sector_data_vector,
+     off64_t offset,
+     libbde_sector_data_t *sector_data,
+     libbde_sector_data_t **promoted_sector_data,
+     libcerror_error_t **error );
+
+int libbde_sector_data_vector_read_sector_data_at_offset_into_buffer(
+     libbde_sector_data_vector_t *sector_data_vector,
+     libbde_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libbde_encryption_context_t *encryption_context,
+     off64_t offset,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,302 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_TIME_H )
+#include <time.h>
+#endif
+
+#include "libbde_definitions.h"
+#include "libbde_libcerror.h"
+#include "libbde_libcthreads.h"
+#include "libbde_statistics.h"
+
+/* Clears the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_statistics_clear(
+     libbde_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_statistics_clear";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     statistics,
+	     0,
+	     sizeof( libbde_statistics_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the statistics values
+ * Every value is read atomically, values that are updated concurrently with
+ * this call are not necessarily consistent with each other
+ * The values are stored in the order of LIBBDE_STATISTICS_VALUES, if
+ * number_of_values is smaller than LIBBDE_NUMBER_OF_STATISTICS_VALUES only
+ * the first number_of_values values are retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_statistics_get_values(
+     libbde_statistics_t *statistics,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	uint64_t *statistics_values[ LIBBDE_NUMBER_OF_STATISTICS_VALUES ];
+
+	static char *function = "libbde_statistics_get_values";
+	int value_index       = 0;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > LIBBDE_NUMBER_OF_STATISTICS_VALUES )
+	{
+		number_of_values = LIBBDE_NUMBER_OF_STATISTICS_VALUES;
+	}
+	statistics_values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_READ_CALLS ]                       = &( statistics->number_of_read_calls );
+	statistics_values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_CACHE_HITS ]                       = &( statistics->number_of_cache_hits );
+	statistics_values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_CACHE_MISSES ]                     = &( statistics->number_of_cache_misses );
+	statistics_values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_BYTES_READ ]                       = &( statistics->number_of_bytes_read );
+	statistics_values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_BYTES_DECRYPTED ]                  = &( statistics->number_of_bytes_decrypted );
+	statistics_values[ LIBBDE_STATISTICS_VALUE_READ_TIME ]                                  = &( statistics->read_time );
+	statistics_values[ LIBBDE_STATISTICS_VALUE_DECRYPTION_TIME ]                            = &( statistics->decryption_time );
+	statistics_values[ LIBBDE_STATISTICS_VALUE_UNLOCK_TIME ]                                = &( statistics->unlock_time );
+	statistics_values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_BLOCK_CACHE_HITS ]                 = &( statistics->number_of_block_cache_hits );
+	statistics_values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_BLOCK_CACHE_MISSES ]               = &( statistics->number_of_block_cache_misses );
+	statistics_values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_BYTES_DECRYPTED_AES_CBC ]          = &( statistics->number_of_bytes_decrypted_aes_cbc );
+	statistics_values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_BYTES_DECRYPTED_AES_CBC_DIFFUSER ] = &( statistics->number_of_bytes_decrypted_aes_cbc_diffuser );
+	statistics_values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_BYTES_DECRYPTED_AES_XTS ]          = &( statistics->number_of_bytes_decrypted_aes_xts );
+	statistics_values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_WARMUP_BYTES ]                     = &( statistics->number_of_warmup_bytes );
+
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		values[ value_index ] = libbde_statistics_get_value(
+		                         statistics_values[ value_index ] );
+	}
+	return( 1 );
+}
+
+/* Adds a count to a statistics value
+ * The value is updated atomically if multi-thread support is enabled, so that
+ * concurrent reads of the volume, such as those of the warmup and the read
+ * workers, do not lose updates and the value is never read partially updated
+ */
+void libbde_statistics_add_value(
+      uint64_t *value,
+      uint64_t count )
+{
+	if( value == NULL )
+	{
+		return;
+	}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT ) && defined( WINAPI )
+	InterlockedExchangeAdd64(
+	 (LONG64 volatile *) value,
+	 (LONG64) count );
+
+#elif defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT ) && ( defined( __GNUC__ ) || defined( __clang__ ) )
+	__atomic_fetch_add(
+	 value,
+	 count,
+	 __ATOMIC_RELAXED );
+
+#else
+	*value += count;
+
+#endif
+}
+
+/* Retrieves a statistics value
+ * The value is read atomically if multi-thread support is enabled
+ * Returns the value or 0 if not available
+ */
+uint64_t libbde_statistics_get_value(
+          uint64_t *value )
+{
+	if( value == NULL )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT ) && defined( WINAPI )
+	return( (uint64_t) InterlockedCompareExchange64(
+	                    (LONG64 volatile *) value,
+	                    0,
+	                    0 ) );
+
+#elif defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT ) && ( defined( __GNUC__ ) || defined( __clang__ ) )
+	return( __atomic_load_n(
+	         value,
+	         __ATOMIC_RELAXED ) );
+
+#else
+	return( *value );
+
+#endif
+}
+
+/* Adds decrypted data to the statistics
+ * The number of bytes is added to the total and to the value of the encryption method
+ */
+void libbde_statistics_add_decrypted(
+      libbde_statistics_t *statistics,
+      uint16_t encryption_method,
+      uint64_t number_of_bytes,
+      uint64_t decryption_time )
+{
+	uint64_t *method_value = NULL;
+
+	if( statistics == NULL )
+	{
+		return;
+	}
+	switch( encryption_method )
+	{
+		case LIBBDE_ENCRYPTION_METHOD_AES_128_CBC:
+		case LIBBDE_ENCRYPTION_METHOD_AES_256_CBC:
+			method_value = &( statistics->number_of_bytes_decrypted_aes_cbc );
+			break;
+
+		case LIBBDE_ENCRYPTION_METHOD_AES_128_CBC_DIFFUSER:
+		case LIBBDE_ENCRYPTION_METHOD_AES_256_CBC_DIFFUSER:
+			method_value = &( statistics->number_of_bytes_decrypted_aes_cbc_diffuser );
+			break;
+
+		case LIBBDE_ENCRYPTION_METHOD_AES_128_XTS:
+		case LIBBDE_ENCRYPTION_METHOD_AES_256_XTS:
+			method_value = &( statistics->number_of_bytes_decrypted_aes_xts );
+			break;
+
+		default:
+			break;
+	}
+	libbde_statistics_add_value(
+	 &( statistics->decryption_time ),
+	 decryption_time );
+
+	libbde_statistics_add_value(
+	 &( statistics->number_of_bytes_decrypted ),
+	 number_of_bytes );
+
+	libbde_statistics_add_value(
+	 method_value,
+	 number_of_bytes );
+}
+
+/* Retrieves a monotonic timestamp used to measure elapsed time
+ * Returns the timestamp in nanoseconds or 0 if not available
+ */
+uint64_t libbde_statistics_get_timestamp(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	if( QueryPerformanceFrequency(
+	     &frequency ) == 0 )
+	{
+		return( 0 );
+	}
+	if( QueryPerformanceCounter(
+	     &counter ) == 0 )
+	{
+		return( 0 );
+	}
+	if( frequency.QuadPart <= 0 )
+	{
+		return( 0 );
+	}
+	return( (uint64_t) ( ( counter.QuadPart / frequency.QuadPart ) * 1000000000 )
+	      + (uint64_t) ( ( ( counter.QuadPart % frequency.QuadPart ) * 1000000000 ) / frequency.QuadPart ) );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_specification;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_specification ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_specification.tv_sec * 1000000000 ) + (uint64_t) time_specification.tv_nsec );
+
+#else
+	return( 0 );
+
+#endif
+}
+
@@ -0,0 +1,126 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBDE_STATISTICS_H )
+#define _LIBBDE_STATISTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbde_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libbde_statistics libbde_statistics_t;
+
+struct libbde_statistics
+{
+	/* The number of read calls
+	 */
+	uint64_t number_of_read_calls;
+
+	/* The number of sector data cache hits
+	 */
+	uint64_t number_of_cache_hits;
+
+	/* The number of sector data cache misses
+	 */
+	uint64_t number_of_cache_misses;
+
+	/* The number of bytes read from the file IO handle
+	 */
+	uint64_t number_of_bytes_read;
+
+	/* The number of bytes decrypted
+	 */
+	uint64_t number_of_bytes_decrypted;
+
+	/* The time spent reading from the file IO handle in nanoseconds
+	 */
+	uint64_t read_time;
+
+	/* The time spent decrypting in nanoseconds
+	 */
+	uint64_t decryption_time;
+
+	/* The time spent unlocking the volume in nanoseconds
+	 */
+	uint64_t unlock_time;
+
+	/* The number of block cache hits
+	 */
+	uint64_t number_of_block_cache_hits;
+
+	/* The number of block cache misses
+	 */
+	uint64_t number_of_block_cache_misses;
+
+	/* The number of bytes decrypted with AES-CBC
+	 */
+	uint64_t number_of_bytes_decrypted_aes_cbc;
+
+	/* The number of bytes decrypted with AES-CBC and the Elephant diffuser
+	 */
+	uint64_t number_of_bytes_decrypted_aes_cbc_diffuser;
+
+	/* The number of bytes decrypted with AES-XTS
+	 */
+	uint64_t number_of_bytes_decrypted_aes_xts;
+
+	/* The number of bytes prefetched by the warmup
+	 */
+	uint64_t number_of_warmup_bytes;
+};
+
+int libbde_statistics_clear(
+     libbde_statistics_t *statistics,
+     libcerror_error_t **error );
+
+int libbde_statistics_get_values(
+     libbde_statistics_t *statistics,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error );
+
+void libbde_statistics_add_value(
+      uint64_t *value,
+      uint64_t count );
+
+uint64_t libbde_statistics_get_value(
+          uint64_t *value );
+
+void libbde_statistics_add_decrypted(
+      libbde_statistics_t *statistics,
+      uint16_t encryption_method,
+      uint64_t number_of_bytes,
+      uint64_t decryption_time );
+
+uint64_t libbde_statistics_get_timestamp(
+          void );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBDE_STATISTICS_H ) */
+
@@ -34,10 +34,12 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libbde_block_cache {}	libbde_block_cache_t;
 typedef struct libbde_key_protector {}	libbde_key_protector_t;
 typedef struct libbde_volume {}		libbde_volume_t;
 
 #else
+typedef intptr_t libbde_block_cache_t;
 typedef intptr_t libbde_key_protector_t;
 typedef intptr_t libbde_volume_t;
 
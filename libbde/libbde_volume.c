@@ -25,21 +25,29 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libbde_block_cache.h"
 #include "libbde_debug.h"
 #include "libbde_definitions.h"
 #include "libbde_encryption_context.h"
+#include "libbde_extent.h"
 #include "libbde_io_handle.h"
 #include "libbde_libbfio.h"
+#include "libbde_libcdata.h"
 #include "libbde_libcerror.h"
 #include "libbde_libcnotify.h"
 #include "libbde_libcthreads.h"
+#include "libbde_direct_file_io_handle.h"
+#include "libbde_mapped_file_io_handle.h"
 #include "libbde_metadata.h"
 #include "libbde_metadata_header.h"
 #include "libbde_key_protector.h"
 #include "libbde_password.h"
+#include "libbde_positional_file.h"
+#include "libbde_read_worker.h"
 #include "libbde_recovery.h"
 #include "libbde_sector_data.h"
 #include "libbde_sector_data_vector.h"
+#include "libbde_statistics.h"
 #include "libbde_volume.h"
 #include "libbde_volume_header.h"
 
@@ -135,6 +143,20 @@ int libbde_volume_initialize(
 
 		goto on_error;
 	}
+	if( libcdata_array_initialize(
+	     &( internal_volume->extents_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extents array.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_initialize(
 	     &( internal_volume->read_write_lock ),
@@ -159,6 +181,13 @@ int libbde_volume_initialize(
 on_error:
 	if( internal_volume != NULL )
 	{
+		if( internal_volume->extents_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_volume->extents_array ),
+			 NULL,
+			 NULL );
+		}
 		if( internal_volume->password_keep != NULL )
 		{
 			libbde_password_keep_free(
@@ -262,6 +291,20 @@ int libbde_volume_free(
 
 			result = -1;
 		}
+		if( libcdata_array_free(
+		     &( internal_volume->extents_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libbde_extent_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free extents array.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 internal_volume );
 	}
@@ -316,10 +359,14 @@ int libbde_volume_open(
      int access_flags,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle          = NULL;
-	libbde_internal_volume_t *internal_volume = NULL;
-	static char *function                     = "libbde_volume_open";
-	size_t filename_length                    = 0;
+	libbfio_handle_t *file_io_handle                      = NULL;
+	libbde_internal_volume_t *internal_volume             = NULL;
+	libbde_mapped_file_io_handle_t *mapped_file_io_handle = NULL;
+	libbde_positional_file_t *positional_file             = NULL;
+	libcerror_error_t *open_error                         = NULL;
+	static char *function                                 = "libbde_volume_open";
+	size_t filename_length                                = 0;
+	int result                                            = 0;
 
 	if( volume == NULL )
 	{
@@ -382,53 +429,152 @@ int libbde_volume_open(
 
 		goto on_error;
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	if( ( access_flags & LIBBDE_ACCESS_FLAG_DIRECT_IO ) != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
-		 function );
+		result = libbde_direct_file_open(
+		          &file_io_handle,
+		          filename,
+		          filename_length,
+		          error );
 
-		goto on_error;
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open direct IO file: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
+	else if( ( access_flags & LIBBDE_ACCESS_FLAG_MEMORY_MAP ) != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set track offsets read in file IO handle.",
-		 function );
+		result = libbde_mapped_file_open(
+		          &file_io_handle,
+		          &mapped_file_io_handle,
+		          filename,
+		          filename_length,
+		          error );
 
-		goto on_error;
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open memory mapped file: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
 	}
+	/* Fall back to reading the file if it was not opened for direct IO
+	 * or memory mapped
+	 */
+	if( file_io_handle == NULL )
+	{
+		if( libbfio_file_initialize(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libbfio_handle_set_track_offsets_read(
+		     file_io_handle,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set track offsets read in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
 #endif
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     filename_length,
-	     error ) != 1 )
+		if( libbfio_file_set_name(
+		     file_io_handle,
+		     filename,
+		     filename_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The sector data is read using positional reads if supported, so that
+	 * the read workers can share the file without locking. Direct IO reads
+	 * are only done by the direct file IO handle since they require alignment
+	 */
+	if( ( access_flags & LIBBDE_ACCESS_FLAG_DIRECT_IO ) == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set filename in file IO handle.",
-		 function );
+		if( libbde_positional_file_initialize(
+		     &positional_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create positional file.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		/* Failing to open the positional file is not an error
+		 * the sector data is then read using the file IO handle
+		 */
+		if( libbde_positional_file_open(
+		     positional_file,
+		     filename,
+		     &open_error ) != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to open positional file: %s.\n",
+				 function,
+				 filename );
+
+				libcnotify_print_error_backtrace(
+				 open_error );
+			}
+#endif
+			libcerror_error_free(
+			 &open_error );
+
+			libbde_positional_file_free(
+			 &positional_file,
+			 NULL );
+		}
 	}
-	if( libbde_volume_open_file_io_handle(
-	     volume,
+	if( libbde_internal_volume_open_file_io_handle(
+	     internal_volume,
 	     file_io_handle,
+	     mapped_file_io_handle,
+	     positional_file,
+	     1,
 	     access_flags,
 	     error ) != 1 )
 	{
@@ -442,41 +588,15 @@ int libbde_volume_open(
 
 		goto on_error;
 	}
-#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
-		 function );
-
-		return( -1 );
-	}
-#endif
-	internal_volume->file_io_handle_created_in_library = 1;
-
-#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
-		 function );
-
-		return( -1 );
-	}
-#endif
 	return( 1 );
 
 on_error:
+	if( positional_file != NULL )
+	{
+		libbde_positional_file_free(
+		 &positional_file,
+		 NULL );
+	}
 	if( file_io_handle != NULL )
 	{
 		libbfio_handle_free(
@@ -678,12 +798,7 @@ int libbde_volume_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error )
 {
-	libbde_internal_volume_t *internal_volume = NULL;
-	static char *function                     = "libbde_volume_open_file_io_handle";
-	uint8_t file_io_handle_opened_in_library  = 0;
-	int bfio_access_flags                     = 0;
-	int file_io_handle_is_open                = 0;
-	int result                                = 1;
+	static char *function = "libbde_volume_open_file_io_handle";
 
 	if( volume == NULL )
 	{
@@ -696,8 +811,60 @@ int libbde_volume_open_file_io_handle(
 
 		return( -1 );
 	}
-	internal_volume = (libbde_internal_volume_t *) volume;
+	if( libbde_internal_volume_open_file_io_handle(
+	     (libbde_internal_volume_t *) volume,
+	     file_io_handle,
+	     NULL,
+	     NULL,
+	     0,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens a volume using a Basic File IO (bfio) handle
+ * The memory mapped file IO handle and positional file, if set, are attached
+ * to the IO handle before the volume is read, so that every read of the volume,
+ * including those of the warmup, uses them. The positional file is owned by
+ * the volume if the open is successful.
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_internal_volume_open_file_io_handle(
+     libbde_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+     libbde_positional_file_t *positional_file,
+     uint8_t file_io_handle_created_in_library,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function                    = "libbde_internal_volume_open_file_io_handle";
+	uint8_t file_io_handle_opened_in_library = 0;
+	int bfio_access_flags                    = 0;
+	int file_io_handle_is_open               = 0;
+	int result                               = 1;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
 
+		return( -1 );
+	}
 	if( internal_volume->file_io_handle != NULL )
 	{
 		libcerror_error_set(
@@ -795,6 +962,9 @@ int libbde_volume_open_file_io_handle(
 		return( -1 );
 	}
 #endif
+	internal_volume->io_handle->mapped_file_io_handle = mapped_file_io_handle;
+	internal_volume->io_handle->positional_file       = positional_file;
+
 	if( libbde_internal_volume_open_read(
 	     internal_volume,
 	     file_io_handle,
@@ -811,8 +981,44 @@ int libbde_volume_open_file_io_handle(
 	}
 	else
 	{
-		internal_volume->file_io_handle                   = file_io_handle;
-		internal_volume->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+		internal_volume->file_io_handle                    = file_io_handle;
+		internal_volume->file_io_handle_created_in_library = file_io_handle_created_in_library;
+		internal_volume->positional_file                   = positional_file;
+
+		/* A file IO handle created in the library is also opened in the library
+		 * even if it was opened before it was passed to this function
+		 */
+		if( file_io_handle_created_in_library != 0 )
+		{
+			internal_volume->file_io_handle_opened_in_library = 1;
+		}
+		else
+		{
+			internal_volume->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+		}
+		if( libbde_internal_volume_start_warmup(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to start warmup.",
+			 function );
+
+			internal_volume->file_io_handle                    = NULL;
+			internal_volume->file_io_handle_created_in_library = 0;
+			internal_volume->file_io_handle_opened_in_library  = 0;
+			internal_volume->positional_file                   = NULL;
+
+			result = -1;
+		}
+	}
+	if( result == -1 )
+	{
+		internal_volume->io_handle->mapped_file_io_handle = NULL;
+		internal_volume->io_handle->positional_file       = NULL;
 	}
 #if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -880,6 +1086,19 @@ int libbde_volume_close(
 
 		return( -1 );
 	}
+	if( libbde_internal_volume_stop_warmup(
+	     internal_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to stop warmup.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
@@ -948,11 +1167,27 @@ int libbde_volume_close(
 		}
 		internal_volume->file_io_handle_created_in_library = 0;
 	}
-	internal_volume->file_io_handle = NULL;
-	internal_volume->current_offset = 0;
-	internal_volume->is_locked      = 1;
-
-	if( libbde_io_handle_clear(
+	if( internal_volume->positional_file != NULL )
+	{
+		if( libbde_positional_file_free(
+		     &( internal_volume->positional_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free positional file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_volume->file_io_handle = NULL;
+	internal_volume->current_offset = 0;
+	internal_volume->is_locked      = 1;
+
+	if( libbde_io_handle_clear(
 	     internal_volume->io_handle,
 	     error ) != 1 )
 	{
@@ -968,7 +1203,7 @@ int libbde_volume_close(
 	if( memory_set(
 	     internal_volume->full_volume_encryption_key,
 	     0,
-	     32 ) == NULL )
+	     sizeof( internal_volume->full_volume_encryption_key ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -982,7 +1217,7 @@ int libbde_volume_close(
 	if( memory_set(
 	     internal_volume->tweak_key,
 	     0,
-	     32 ) == NULL )
+	     sizeof( internal_volume->tweak_key ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -993,7 +1228,9 @@ int libbde_volume_close(
 
 		result = -1;
 	}
-	internal_volume->keys_are_set = 0;
+	internal_volume->full_volume_encryption_key_size = 0;
+	internal_volume->tweak_key_size                  = 0;
+	internal_volume->keys_are_set                    = 0;
 
 	if( libbde_sector_data_vector_free(
 	     &( internal_volume->sector_data_vector ),
@@ -1008,6 +1245,20 @@ int libbde_volume_close(
 
 		result = -1;
 	}
+	if( libcdata_array_empty(
+	     internal_volume->extents_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libbde_extent_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty extents array.",
+		 function );
+
+		result = -1;
+	}
 	if( internal_volume->encryption_context != NULL )
 	{
 		if( libbde_encryption_context_free(
@@ -1338,7 +1589,7 @@ int libbde_internal_volume_open_read(
 	     internal_volume->secondary_metadata,
 	     internal_volume->io_handle,
 	     file_io_handle,
-	     internal_volume->volume_header->second_metadata_offset,
+	     internal_volume->io_handle->second_metadata_offset,
 	     startup_key_identifier,
 	     startup_key_identifier_size,
 	     error ) != 1 )
@@ -1376,7 +1627,7 @@ int libbde_internal_volume_open_read(
 	     internal_volume->tertiary_metadata,
 	     internal_volume->io_handle,
 	     file_io_handle,
-	     internal_volume->volume_header->third_metadata_offset,
+	     internal_volume->io_handle->third_metadata_offset,
 	     startup_key_identifier,
 	     startup_key_identifier_size,
 	     error ) != 1 )
@@ -1707,7 +1958,7 @@ int libbde_internal_volume_open_read_keys_from_metadata(
 			if( memory_set(
 			     internal_volume->full_volume_encryption_key,
 			     0,
-			     64 ) == NULL )
+			     sizeof( internal_volume->full_volume_encryption_key ) ) == NULL )
 			{
 				libcerror_error_set(
 				 error,
@@ -1721,7 +1972,7 @@ int libbde_internal_volume_open_read_keys_from_metadata(
 			if( memory_set(
 			     internal_volume->tweak_key,
 			     0,
-			     32 ) == NULL )
+			     sizeof( internal_volume->tweak_key ) ) == NULL )
 			{
 				libcerror_error_set(
 				 error,
@@ -1884,6 +2135,7 @@ int libbde_internal_volume_unlock(
 	static char *function        = "libbde_internal_volume_unlock";
 	size64_t file_size           = 0;
 	off64_t volume_header_offset = 0;
+	uint64_t start_time          = 0;
 	int result                   = 0;
 
 	if( internal_volume == NULL )
@@ -1908,6 +2160,8 @@ int libbde_internal_volume_unlock(
 
 		return( -1 );
 	}
+	start_time = libbde_statistics_get_timestamp();
+
 	result = libbde_internal_volume_open_read_keys(
 	          internal_volume,
 	          error );
@@ -1986,23 +2240,40 @@ int libbde_internal_volume_unlock(
 		{
 			internal_volume->io_handle->volume_size += internal_volume->io_handle->bytes_per_sector;
 		}
+		if( libbde_internal_volume_read_extents(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read extents.",
+			 function );
+
+			return( -1 );
+		}
+		internal_volume->io_handle->statistics.unlock_time = libbde_statistics_get_timestamp() - start_time;
+
 		internal_volume->is_locked = 0;
 	}
 	return( result );
 }
 
-/* Unlocks the volume
- * Returns 1 if the volume is unlocked, 0 if not or -1 on error
+/* Retrieves the extent flags of a specific offset
+ * This mirrors the way libbde_sector_data_read_file_io_handle maps the offset
+ * Returns 1 if successful or -1 on error
  */
-int libbde_volume_unlock(
-     libbde_volume_t *volume,
+int libbde_internal_volume_get_extent_flags_at_offset(
+     libbde_internal_volume_t *internal_volume,
+     off64_t offset,
+     uint32_t *extent_flags,
      libcerror_error_t **error )
 {
-	libbde_internal_volume_t *internal_volume = NULL;
-	static char *function                     = "libbde_volume_unlock";
-	int result                                = 1;
+	libbde_io_handle_t *io_handle = NULL;
+	static char *function         = "libbde_internal_volume_get_extent_flags_at_offset";
 
-	if( volume == NULL )
+	if( internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2013,78 +2284,135 @@ int libbde_volume_unlock(
 
 		return( -1 );
 	}
-	internal_volume = (libbde_internal_volume_t *) volume;
-
-#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( internal_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( internal_volume->is_locked != 0 )
-	{
-		result = libbde_internal_volume_unlock(
-		          internal_volume,
-		          internal_volume->file_io_handle,
-		          error );
+	io_handle = internal_volume->io_handle;
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to unlock volume.",
-			 function );
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
 
-			result = -1;
-		}
+		return( -1 );
 	}
-#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( extent_flags == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent flags.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( result );
+	/* The BitLocker metadata areas are represented as zero byte blocks
+	 */
+	if( ( ( offset >= io_handle->first_metadata_offset )
+	  &&  ( offset < ( io_handle->first_metadata_offset + (off64_t) io_handle->metadata_size ) ) )
+	 || ( ( offset >= io_handle->second_metadata_offset )
+	  &&  ( offset < ( io_handle->second_metadata_offset + (off64_t) io_handle->metadata_size ) ) )
+	 || ( ( offset >= io_handle->third_metadata_offset )
+	  &&  ( offset < ( io_handle->third_metadata_offset + (off64_t) io_handle->metadata_size ) ) ) )
+	{
+		*extent_flags = LIBBDE_EXTENT_FLAG_IS_SPARSE;
+
+		return( 1 );
+	}
+	if( ( io_handle->version == LIBBDE_VERSION_WINDOWS_7 )
+	 || ( io_handle->version == LIBBDE_VERSION_TO_GO ) )
+	{
+		if( ( offset >= io_handle->volume_header_offset )
+		 && ( offset < ( io_handle->volume_header_offset + (off64_t) io_handle->volume_header_size ) ) )
+		{
+			*extent_flags = LIBBDE_EXTENT_FLAG_IS_SPARSE;
+
+			return( 1 );
+		}
+		/* Normally the first 8192 bytes are stored in another location on the volume
+		 */
+		if( (size64_t) offset < io_handle->volume_header_size )
+		{
+			if( ( io_handle->volume_header_offset < 0 )
+			 || ( offset > (off64_t) ( INT64_MAX - io_handle->volume_header_offset ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid offset value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			offset += io_handle->volume_header_offset;
+		}
+	}
+	/* In Windows Vista the first 16 sectors are unencrypted
+	 */
+	if( ( io_handle->version == LIBBDE_VERSION_WINDOWS_VISTA )
+	 && ( (size64_t) offset < 8192 ) )
+	{
+		*extent_flags = 0;
+	}
+	else if( ( internal_volume->encryption_context != NULL )
+	      && ( internal_volume->encryption_context->method == LIBBDE_ENCRYPTION_METHOD_NONE ) )
+	{
+		*extent_flags = 0;
+	}
+	/* Check if the offset is outside the encrypted part of the volume
+	 */
+	else if( ( io_handle->encrypted_volume_size != 0 )
+	      && ( offset >= (off64_t) io_handle->encrypted_volume_size ) )
+	{
+		*extent_flags = 0;
+	}
+	else
+	{
+		*extent_flags = LIBBDE_EXTENT_FLAG_IS_ENCRYPTED;
+	}
+	return( 1 );
 }
 
-/* Reads unencrypted data from the last current into a buffer using a Basic File IO (bfio) handle
- * This function is not multi-thread safe acquire write lock before call
- * Returns the number of bytes read or -1 on error
+/* Reads the extents
+ * The volume is split at the boundaries of the metadata areas, the volume header,
+ * the unencrypted start of a Windows Vista volume and the encrypted volume size,
+ * after which adjacent ranges with the same extent flags are merged
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libbde_internal_volume_read_buffer_from_file_io_handle(
-         libbde_internal_volume_t *internal_volume,
-         libbfio_handle_t *file_io_handle,
-         void *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libbde_internal_volume_read_extents(
+     libbde_internal_volume_t *internal_volume,
+     libcerror_error_t **error )
 {
-	libbde_sector_data_t *sector_data = NULL;
-	static char *function             = "libbde_internal_volume_read_buffer_from_file_io_handle";
-	size_t buffer_offset              = 0;
-	size_t read_size                  = 0;
-	size_t remaining_buffer_size      = 0;
-	size_t sector_data_offset         = 0;
-	off64_t sector_file_offset        = 0;
+	off64_t boundary_offsets[ 16 ];
+	off64_t candidate_offsets[ 16 ];
+
+	libbde_extent_t *extent            = NULL;
+	libbde_extent_t *last_extent       = NULL;
+	libbde_io_handle_t *io_handle      = NULL;
+	static char *function              = "libbde_internal_volume_read_extents";
+	off64_t extent_end_offset          = 0;
+	off64_t extent_offset              = 0;
+	uint32_t extent_flags              = 0;
+	int boundary_index                 = 0;
+	int candidate_index                = 0;
+	int entry_index                    = 0;
+	int number_of_boundary_offsets     = 0;
+	int number_of_candidate_offsets    = 0;
+	int shift_index                    = 0;
 
 	if( internal_volume == NULL )
 	{
@@ -2097,17 +2425,6 @@ ssize_t libbde_internal_volume_read_buffer_from_file_io_handle(
 
 		return( -1 );
 	}
-	if( internal_volume->is_locked != 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - volume is locked.",
-		 function );
-
-		return( -1 );
-	}
 	if( internal_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -2119,151 +2436,2535 @@ ssize_t libbde_internal_volume_read_buffer_from_file_io_handle(
 
 		return( -1 );
 	}
-	if( internal_volume->sector_data_vector == NULL )
+	io_handle = internal_volume->io_handle;
+
+	if( io_handle->volume_size > (size64_t) INT64_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing sector data vector.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume - volume size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_volume->current_offset < 0 )
+	if( libcdata_array_empty(
+	     internal_volume->extents_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libbde_extent_free,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid volume - current offset value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty extents array.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( buffer == NULL )
+	if( io_handle->volume_size == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
-		 function );
-
-		return( -1 );
+		return( 1 );
 	}
-	if( buffer_size > (size_t) SSIZE_MAX )
+	candidate_offsets[ number_of_candidate_offsets++ ] = io_handle->first_metadata_offset;
+	candidate_offsets[ number_of_candidate_offsets++ ] = io_handle->first_metadata_offset + (off64_t) io_handle->metadata_size;
+	candidate_offsets[ number_of_candidate_offsets++ ] = io_handle->second_metadata_offset;
+	candidate_offsets[ number_of_candidate_offsets++ ] = io_handle->second_metadata_offset + (off64_t) io_handle->metadata_size;
+	candidate_offsets[ number_of_candidate_offsets++ ] = io_handle->third_metadata_offset;
+	candidate_offsets[ number_of_candidate_offsets++ ] = io_handle->third_metadata_offset + (off64_t) io_handle->metadata_size;
+
+	if( ( io_handle->version == LIBBDE_VERSION_WINDOWS_7 )
+	 || ( io_handle->version == LIBBDE_VERSION_TO_GO ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid buffer size value exceeds maximum.",
-		 function );
+		candidate_offsets[ number_of_candidate_offsets++ ] = io_handle->volume_header_offset;
+		candidate_offsets[ number_of_candidate_offsets++ ] = io_handle->volume_header_offset + (off64_t) io_handle->volume_header_size;
+		candidate_offsets[ number_of_candidate_offsets++ ] = (off64_t) io_handle->volume_header_size;
 
-		return( -1 );
+		/* The start of the volume is read from the volume header offset,
+		 * which can cross the encrypted volume size
+		 */
+		candidate_offsets[ number_of_candidate_offsets++ ] = (off64_t) io_handle->encrypted_volume_size - io_handle->volume_header_offset;
 	}
-	internal_volume->io_handle->abort = 0;
-
-	if( (size64_t) internal_volume->current_offset >= internal_volume->io_handle->volume_size )
+	else if( io_handle->version == LIBBDE_VERSION_WINDOWS_VISTA )
 	{
-		return( 0 );
+		candidate_offsets[ number_of_candidate_offsets++ ] = 8192;
 	}
-	if( (size64_t) buffer_size > ( internal_volume->io_handle->volume_size - internal_volume->current_offset ) )
+	if( io_handle->encrypted_volume_size != 0 )
 	{
-		buffer_size = (size_t) ( internal_volume->io_handle->volume_size - internal_volume->current_offset );
+		candidate_offsets[ number_of_candidate_offsets++ ] = (off64_t) io_handle->encrypted_volume_size;
 	}
-	remaining_buffer_size = buffer_size;
+	/* Sort the boundary offsets and ignore duplicates and offsets outside the volume
+	 */
+	boundary_offsets[ number_of_boundary_offsets++ ] = 0;
 
-	sector_file_offset = ( internal_volume->current_offset / internal_volume->io_handle->bytes_per_sector ) * internal_volume->io_handle->bytes_per_sector;
-	sector_data_offset = (size_t) ( internal_volume->current_offset - sector_file_offset );
+	for( candidate_index = 0;
+	     candidate_index < number_of_candidate_offsets;
+	     candidate_index++ )
+	{
+		extent_offset = candidate_offsets[ candidate_index ];
 
-	while( remaining_buffer_size > 0 )
+		if( ( extent_offset <= 0 )
+		 || ( extent_offset >= (off64_t) io_handle->volume_size ) )
+		{
+			continue;
+		}
+		for( boundary_index = 0;
+		     boundary_index < number_of_boundary_offsets;
+		     boundary_index++ )
+		{
+			if( extent_offset <= boundary_offsets[ boundary_index ] )
+			{
+				break;
+			}
+		}
+		if( ( boundary_index < number_of_boundary_offsets )
+		 && ( extent_offset == boundary_offsets[ boundary_index ] ) )
+		{
+			continue;
+		}
+		for( shift_index = number_of_boundary_offsets;
+		     shift_index > boundary_index;
+		     shift_index-- )
+		{
+			boundary_offsets[ shift_index ] = boundary_offsets[ shift_index - 1 ];
+		}
+		boundary_offsets[ boundary_index ] = extent_offset;
+
+		number_of_boundary_offsets++;
+	}
+	for( boundary_index = 0;
+	     boundary_index < number_of_boundary_offsets;
+	     boundary_index++ )
 	{
-		read_size = internal_volume->io_handle->bytes_per_sector - sector_data_offset;
+		extent_offset = boundary_offsets[ boundary_index ];
 
-		if( read_size > remaining_buffer_size )
+		if( ( boundary_index + 1 ) < number_of_boundary_offsets )
 		{
-			read_size = remaining_buffer_size;
+			extent_end_offset = boundary_offsets[ boundary_index + 1 ];
 		}
-		if( read_size == 0 )
+		else
 		{
-			break;
+			extent_end_offset = (off64_t) io_handle->volume_size;
 		}
-		if( libbde_sector_data_vector_get_sector_data_at_offset(
-		     internal_volume->sector_data_vector,
-		     internal_volume->io_handle,
-		     file_io_handle,
-		     internal_volume->encryption_context,
-		     sector_file_offset,
-		     &sector_data,
+		if( libbde_internal_volume_get_extent_flags_at_offset(
+		     internal_volume,
+		     extent_offset,
+		     &extent_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 "%s: unable to retrieve extent flags at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 			 function,
-			 sector_file_offset,
-			 sector_file_offset );
+			 extent_offset,
+			 extent_offset );
 
-			return( -1 );
+			goto on_error;
+		}
+		if( ( last_extent != NULL )
+		 && ( last_extent->flags == extent_flags ) )
+		{
+			last_extent->size += (size64_t) ( extent_end_offset - extent_offset );
+
+			continue;
 		}
-		if( sector_data == NULL )
+		if( libbde_extent_initialize(
+		     &extent,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 sector_file_offset,
-			 sector_file_offset );
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create extent.",
+			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( memory_copy(
-		     &( ( (uint8_t *) buffer )[ buffer_offset ] ),
-		     &( ( sector_data->data )[ sector_data_offset ] ),
-		     read_size ) == NULL )
+		extent->offset = extent_offset;
+		extent->size   = (size64_t) ( extent_end_offset - extent_offset );
+		extent->flags  = extent_flags;
+
+		if( libcdata_array_append_entry(
+		     internal_volume->extents_array,
+		     &entry_index,
+		     (intptr_t *) extent,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy sector data to buffer.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append extent to array.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		buffer_offset         += read_size;
-		remaining_buffer_size -= read_size;
-		sector_data_offset     = 0;
-		sector_file_offset    += read_size;
+		last_extent = extent;
+		extent      = NULL;
+	}
+	return( 1 );
 
-		if( internal_volume->io_handle->abort != 0 )
-		{
-			break;
-		}
+on_error:
+	if( extent != NULL )
+	{
+		libbde_extent_free(
+		 &extent,
+		 NULL );
 	}
-	internal_volume->current_offset += (off64_t) buffer_offset;
+	libcdata_array_empty(
+	 internal_volume->extents_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libbde_extent_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the extent that contains a specific offset
+ * This function is not multi-thread safe acquire read lock before call
+ * Returns 1 if successful, 0 if the offset is beyond the volume or -1 on error
+ */
+int libbde_internal_volume_get_extent_at_offset(
+     libbde_internal_volume_t *internal_volume,
+     off64_t offset,
+     libbde_extent_t **extent,
+     libcerror_error_t **error )
+{
+	libbde_extent_t *safe_extent = NULL;
+	static char *function        = "libbde_internal_volume_get_extent_at_offset";
+	int extent_index             = 0;
+	int maximum_extent_index     = 0;
+	int minimum_extent_index     = 0;
+	int number_of_extents        = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_volume->extents_array,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	/* The extents are sorted by offset and do not overlap
+	 */
+	maximum_extent_index = number_of_extents - 1;
+
+	while( minimum_extent_index <= maximum_extent_index )
+	{
+		extent_index = minimum_extent_index + ( ( maximum_extent_index - minimum_extent_index ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     internal_volume->extents_array,
+		     extent_index,
+		     (intptr_t **) &safe_extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( safe_extent == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( offset < safe_extent->offset )
+		{
+			maximum_extent_index = extent_index - 1;
+		}
+		else if( (size64_t) ( offset - safe_extent->offset ) >= safe_extent->size )
+		{
+			minimum_extent_index = extent_index + 1;
+		}
+		else
+		{
+			*extent = safe_extent;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Unlocks the volume
+ * Returns 1 if the volume is unlocked, 0 if not or -1 on error
+ */
+int libbde_volume_unlock(
+     libbde_volume_t *volume,
+     libcerror_error_t **error )
+{
+	libbde_internal_volume_t *internal_volume = NULL;
+	static char *function                     = "libbde_volume_unlock";
+	int result                                = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libbde_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->is_locked != 0 )
+	{
+		result = libbde_internal_volume_unlock(
+		          internal_volume,
+		          internal_volume->file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to unlock volume.",
+			 function );
+
+			result = -1;
+		}
+		else if( result != 0 )
+		{
+			if( libbde_internal_volume_start_warmup(
+			     internal_volume,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to start warmup.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Prefetches the boot area and the start of the MFT of an unlocked volume
+ * The data is read and decrypted like other reads of the volume and kept
+ * in the warm ranges of the sector data vector until the volume is closed
+ * The data is read in parts and the read/write lock is only held while reading a part,
+ * so that the warmup does not block other reads of the volume for long
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_internal_volume_warmup(
+     libbde_internal_volume_t *internal_volume,
+     libcerror_error_t **error )
+{
+	off64_t range_offsets[ LIBBDE_MAXIMUM_NUMBER_OF_WARM_RANGES ];
+	size64_t range_sizes[ LIBBDE_MAXIMUM_NUMBER_OF_WARM_RANGES ];
+
+	libbde_sector_data_t *warm_range = NULL;
+	static char *function            = "libbde_internal_volume_warmup";
+	size64_t volume_size             = 0;
+	size_t data_offset               = 0;
+	size_t read_size                 = 0;
+	ssize_t read_count               = 0;
+	off64_t current_offset           = 0;
+	off64_t mft_offset               = 0;
+	uint16_t bytes_per_sector        = 0;
+	int number_of_ranges             = 0;
+	int range_index                  = 0;
+	int result                       = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	volume_size      = internal_volume->io_handle->volume_size;
+	bytes_per_sector = internal_volume->io_handle->bytes_per_sector;
+
+	if( bytes_per_sector != 0 )
+	{
+		range_offsets[ number_of_ranges ] = 0;
+		range_sizes[ number_of_ranges ]   = LIBBDE_WARMUP_BOOT_AREA_SIZE;
+
+		if( range_sizes[ number_of_ranges ] > volume_size )
+		{
+			range_sizes[ number_of_ranges ] = volume_size;
+		}
+		number_of_ranges++;
+
+		/* The MFT location is only known if the volume contains a NTFS file system
+		 */
+		if( ( internal_volume->io_handle->cluster_block_size != 0 )
+		 && ( internal_volume->io_handle->mft_cluster_block_number != 0 )
+		 && ( internal_volume->io_handle->mft_cluster_block_number < ( volume_size / internal_volume->io_handle->cluster_block_size ) ) )
+		{
+			mft_offset = (off64_t) ( internal_volume->io_handle->mft_cluster_block_number * internal_volume->io_handle->cluster_block_size );
+
+			range_offsets[ number_of_ranges ] = mft_offset;
+			range_sizes[ number_of_ranges ]   = internal_volume->warmup_size;
+
+			if( range_sizes[ number_of_ranges ] > ( volume_size - (size64_t) mft_offset ) )
+			{
+				range_sizes[ number_of_ranges ] = volume_size - (size64_t) mft_offset;
+			}
+			number_of_ranges++;
+		}
+	}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: prefetching boot area and MFT at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIu64 "\n",
+		 function,
+		 mft_offset,
+		 mft_offset,
+		 internal_volume->warmup_size );
+	}
+#endif
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		/* The warm ranges consist of whole sectors
+		 */
+		range_sizes[ range_index ] -= range_sizes[ range_index ] % bytes_per_sector;
+
+		if( range_sizes[ range_index ] == 0 )
+		{
+			continue;
+		}
+		if( libbde_sector_data_initialize(
+		     &warm_range,
+		     (size_t) range_sizes[ range_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create warm range: %d.",
+			 function,
+			 range_index );
+
+			goto on_error;
+		}
+		data_offset = 0;
+
+		while( data_offset < warm_range->data_size )
+		{
+			read_size = LIBBDE_WARMUP_READ_SIZE;
+
+			if( read_size > ( warm_range->data_size - data_offset ) )
+			{
+				read_size = warm_range->data_size - data_offset;
+			}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+			if( libcthreads_read_write_lock_grab_for_write(
+			     internal_volume->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab read/write lock for writing.",
+				 function );
+
+				goto on_error;
+			}
+#endif
+			/* Stop the warmup when the volume is being closed
+			 */
+			if( ( internal_volume->abort_warmup != 0 )
+			 || ( internal_volume->is_locked != 0 )
+			 || ( internal_volume->file_io_handle == NULL )
+			 || ( internal_volume->sector_data_vector == NULL ) )
+			{
+				read_count = 0;
+			}
+			else
+			{
+				/* The warmup reads at its own offset without changing the current offset of the volume
+				 */
+				current_offset = internal_volume->current_offset;
+
+				internal_volume->current_offset = range_offsets[ range_index ] + (off64_t) data_offset;
+
+				read_count = libbde_internal_volume_read_buffer_from_file_io_handle(
+				              internal_volume,
+				              internal_volume->file_io_handle,
+				              &( ( warm_range->data )[ data_offset ] ),
+				              read_size,
+				              LIBBDE_READ_FLAG_STREAMING,
+				              error );
+
+				internal_volume->current_offset = current_offset;
+			}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+			if( libcthreads_read_write_lock_release_for_write(
+			     internal_volume->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release read/write lock for writing.",
+				 function );
+
+				goto on_error;
+			}
+#endif
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 range_offsets[ range_index ] + (off64_t) data_offset,
+				 range_offsets[ range_index ] + (off64_t) data_offset );
+
+				goto on_error;
+			}
+			else if( (size_t) read_count != read_size )
+			{
+				break;
+			}
+			data_offset += read_size;
+		}
+		/* The warm range is only used if it was read entirely
+		 */
+		if( data_offset == warm_range->data_size )
+		{
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+			if( libcthreads_read_write_lock_grab_for_write(
+			     internal_volume->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab read/write lock for writing.",
+				 function );
+
+				goto on_error;
+			}
+#endif
+			if( ( internal_volume->abort_warmup != 0 )
+			 || ( internal_volume->is_locked != 0 )
+			 || ( internal_volume->sector_data_vector == NULL ) )
+			{
+				result = 0;
+			}
+			else
+			{
+				result = libbde_sector_data_vector_append_warm_range(
+				          internal_volume->sector_data_vector,
+				          range_offsets[ range_index ],
+				          warm_range,
+				          error );
+
+				if( result == 1 )
+				{
+					libbde_statistics_add_value(
+					 &( internal_volume->io_handle->statistics.number_of_warmup_bytes ),
+					 (uint64_t) warm_range->data_size );
+
+					warm_range = NULL;
+				}
+			}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+			if( libcthreads_read_write_lock_release_for_write(
+			     internal_volume->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release read/write lock for writing.",
+				 function );
+
+				goto on_error;
+			}
+#endif
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append warm range: %d.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+		}
+		/* The warmup was stopped
+		 */
+		if( warm_range != NULL )
+		{
+			if( libbde_sector_data_free(
+			     &warm_range,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free warm range: %d.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+			break;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( warm_range != NULL )
+	{
+		libbde_sector_data_free(
+		 &warm_range,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Callback function for the warmup thread
+ * The warmup only prefetches data, errors are therefore not returned to the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_internal_volume_warmup_callback(
+     libbde_internal_volume_t *internal_volume )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	result = libbde_internal_volume_warmup(
+	          internal_volume,
+	          &error );
+
+	if( result != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Starts the warmup of an unlocked volume
+ * The warmup is only started if a warmup size is set
+ * If multi-thread support is enabled the warmup runs in a background thread
+ * otherwise the warmup is done before this function returns
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_internal_volume_start_warmup(
+     libbde_internal_volume_t *internal_volume,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	libcerror_error_t *warmup_error = NULL;
+#endif
+
+	static char *function           = "libbde_internal_volume_start_warmup";
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_volume->warmup_size == 0 )
+	 || ( internal_volume->is_locked != 0 ) )
+	{
+		return( 1 );
+	}
+	internal_volume->abort_warmup = 0;
+
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( internal_volume->warmup_thread != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - warmup thread value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The warmup thread waits for the read/write lock held by the caller
+	 * The warmup only prefetches data, the volume is used without warmup
+	 * if the warmup thread cannot be created
+	 */
+	if( libcthreads_thread_create(
+	     &( internal_volume->warmup_thread ),
+	     NULL,
+	     (int (*)(void *)) &libbde_internal_volume_warmup_callback,
+	     (void *) internal_volume,
+	     &warmup_error ) != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to create warmup thread.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 warmup_error );
+		}
+#endif
+		libcerror_error_free(
+		 &warmup_error );
+
+		internal_volume->warmup_thread = NULL;
+	}
+#else
+	libbde_internal_volume_warmup_callback(
+	 internal_volume );
+#endif
+	return( 1 );
+}
+
+/* Stops the warmup
+ * Waits for the warmup thread to finish if multi-thread support is enabled
+ * This function must be called without holding the read/write lock
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_internal_volume_stop_warmup(
+     libbde_internal_volume_t *internal_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "libbde_internal_volume_stop_warmup";
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( internal_volume->warmup_thread != NULL )
+	{
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_volume->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+		internal_volume->abort_warmup = 1;
+
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_volume->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcthreads_thread_join(
+		     &( internal_volume->warmup_thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join warmup thread.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Reads unencrypted data beyond the encrypted volume size directly into a buffer using a Basic File IO (bfio) handle
+ * The data of a partially encrypted volume, e.g. one that is being converted, beyond the encrypted volume size
+ * is stored unencrypted and is therefore read as-is, without using the sector data cache
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the number of bytes read, 0 if the data at the offset cannot be read directly or -1 on error
+ */
+ssize_t libbde_internal_volume_read_unencrypted_buffer_from_file_io_handle(
+         libbde_internal_volume_t *internal_volume,
+         libbfio_handle_t *file_io_handle,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libbde_extent_t *extent       = NULL;
+	libbde_io_handle_t *io_handle = NULL;
+	static char *function         = "libbde_internal_volume_read_unencrypted_buffer_from_file_io_handle";
+	size_t read_size              = 0;
+	ssize_t read_count            = 0;
+	uint64_t end_time             = 0;
+	uint64_t start_time           = 0;
+	int result                    = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle = internal_volume->io_handle;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->encrypted_volume_size == 0 )
+	 || ( offset < (off64_t) io_handle->encrypted_volume_size ) )
+	{
+		return( 0 );
+	}
+	/* The start of the volume is read from another location on the volume
+	 */
+	if( ( ( io_handle->version == LIBBDE_VERSION_WINDOWS_7 )
+	  ||  ( io_handle->version == LIBBDE_VERSION_TO_GO ) )
+	 && ( (size64_t) offset < io_handle->volume_header_size ) )
+	{
+		return( 0 );
+	}
+	result = libbde_internal_volume_get_extent_at_offset(
+	          internal_volume,
+	          offset,
+	          &extent,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	/* The metadata areas within the unencrypted part are read as 0-byte values
+	 */
+	if( ( result == 0 )
+	 || ( extent->flags != 0 ) )
+	{
+		return( 0 );
+	}
+	read_size = buffer_size;
+
+	if( (size64_t) read_size > ( extent->size - (size64_t) ( offset - extent->offset ) ) )
+	{
+		read_size = (size_t) ( extent->size - (size64_t) ( offset - extent->offset ) );
+	}
+	start_time = libbde_statistics_get_timestamp();
+
+	read_count = libbde_io_handle_read_buffer_at_offset(
+	              io_handle,
+	              file_io_handle,
+	              buffer,
+	              read_size,
+	              offset,
+	              error );
+
+	end_time = libbde_statistics_get_timestamp();
+
+	libbde_statistics_add_value(
+	 &( io_handle->statistics.read_time ),
+	 end_time - start_time );
+
+	if( io_handle->trace_function != NULL )
+	{
+		io_handle->trace_function(
+		 io_handle->trace_user_data,
+		 LIBBDE_TRACE_EVENT_TYPE_READ,
+		 offset,
+		 (size64_t) read_size,
+		 start_time,
+		 end_time );
+	}
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read unencrypted data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Reads unencrypted data from the last current into a buffer using a Basic File IO (bfio) handle
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libbde_internal_volume_read_buffer_from_file_io_handle(
+         libbde_internal_volume_t *internal_volume,
+         libbfio_handle_t *file_io_handle,
+         void *buffer,
+         size_t buffer_size,
+         uint8_t read_flags,
+         libcerror_error_t **error )
+{
+	libbde_sector_data_t *sector_data = NULL;
+	static char *function             = "libbde_internal_volume_read_buffer_from_file_io_handle";
+	size_t buffer_offset              = 0;
+	size_t read_size                  = 0;
+	size_t remaining_buffer_size      = 0;
+	size_t sector_data_offset         = 0;
+	ssize_t read_count                = 0;
+	off64_t sector_file_offset        = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->is_locked != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - volume is locked.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->sector_data_vector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing sector data vector.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume - current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume->io_handle->abort = 0;
+
+	libbde_statistics_add_value(
+	 &( internal_volume->io_handle->statistics.number_of_read_calls ),
+	 1 );
+
+	if( (size64_t) internal_volume->current_offset >= internal_volume->io_handle->volume_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( internal_volume->io_handle->volume_size - internal_volume->current_offset ) )
+	{
+		buffer_size = (size_t) ( internal_volume->io_handle->volume_size - internal_volume->current_offset );
+	}
+	remaining_buffer_size = buffer_size;
+
+	sector_file_offset = ( internal_volume->current_offset / internal_volume->io_handle->bytes_per_sector ) * internal_volume->io_handle->bytes_per_sector;
+	sector_data_offset = (size_t) ( internal_volume->current_offset - sector_file_offset );
+
+	while( remaining_buffer_size > 0 )
+	{
+		read_count = libbde_internal_volume_read_unencrypted_buffer_from_file_io_handle(
+		              internal_volume,
+		              file_io_handle,
+		              sector_file_offset + (off64_t) sector_data_offset,
+		              &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+		              remaining_buffer_size,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read unencrypted data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 sector_file_offset,
+			 sector_file_offset );
+
+			return( -1 );
+		}
+		else if( read_count > 0 )
+		{
+			buffer_offset         += (size_t) read_count;
+			remaining_buffer_size -= (size_t) read_count;
+			sector_file_offset    += (off64_t) ( sector_data_offset + read_count );
+			sector_data_offset     = (size_t) ( sector_file_offset % internal_volume->io_handle->bytes_per_sector );
+			sector_file_offset    -= (off64_t) sector_data_offset;
+
+			if( internal_volume->io_handle->abort != 0 )
+			{
+				break;
+			}
+			continue;
+		}
+		read_size = internal_volume->io_handle->bytes_per_sector - sector_data_offset;
+
+		if( read_size > remaining_buffer_size )
+		{
+			read_size = remaining_buffer_size;
+		}
+		if( read_size == 0 )
+		{
+			break;
+		}
+		/* When streaming whole sectors decrypt directly into the buffer
+		 * this saves a copy of the sector data per sector
+		 */
+		if( ( ( read_flags & LIBBDE_READ_FLAG_STREAMING ) != 0 )
+		 && ( read_size == (size_t) internal_volume->io_handle->bytes_per_sector ) )
+		{
+			if( libbde_sector_data_vector_read_sector_data_at_offset_into_buffer(
+			     internal_volume->sector_data_vector,
+			     internal_volume->io_handle,
+			     file_io_handle,
+			     internal_volume->encryption_context,
+			     sector_file_offset,
+			     &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 sector_file_offset,
+				 sector_file_offset );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( libbde_sector_data_vector_get_sector_data_at_offset(
+			     internal_volume->sector_data_vector,
+			     internal_volume->io_handle,
+			     file_io_handle,
+			     internal_volume->encryption_context,
+			     sector_file_offset,
+			     read_flags,
+			     &sector_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 sector_file_offset,
+				 sector_file_offset );
+
+				return( -1 );
+			}
+			if( sector_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 sector_file_offset,
+				 sector_file_offset );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+			     &( ( sector_data->data )[ sector_data_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy sector data to buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		buffer_offset         += read_size;
+		remaining_buffer_size -= read_size;
+		sector_data_offset     = 0;
+		sector_file_offset    += read_size;
+
+		if( internal_volume->io_handle->abort != 0 )
+		{
+			break;
+		}
+	}
+	internal_volume->current_offset += (off64_t) buffer_offset;
 
 	return( (ssize_t) buffer_offset );
 }
 
-/* Reads unencrypted data at the current offset into a buffer
- * Returns the number of bytes read or -1 on error
+/* Reads unencrypted data at the current offset into a buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libbde_volume_read_buffer(
+         libbde_volume_t *volume,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libbde_internal_volume_t *internal_volume = NULL;
+	static char *function                     = "libbde_volume_read_buffer";
+	ssize_t read_count                        = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libbde_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_count = libbde_internal_volume_read_buffer_from_file_io_handle(
+		      internal_volume,
+		      internal_volume->file_io_handle,
+		      buffer,
+		      buffer_size,
+		      0,
+		      error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		read_count = -1;
+	}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads unencrypted data at a specific offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libbde_volume_read_buffer_at_offset(
+         libbde_volume_t *volume,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libbde_volume_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	read_count = libbde_volume_read_buffer_at_offset_with_flags(
+	              volume,
+	              buffer,
+	              buffer_size,
+	              offset,
+	              0,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Reads unencrypted data at a specific offset using read flags
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libbde_volume_read_buffer_at_offset_with_flags(
+         libbde_volume_t *volume,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         uint8_t read_flags,
+         libcerror_error_t **error )
+{
+	libbde_internal_volume_t *internal_volume = NULL;
+	static char *function                     = "libbde_volume_read_buffer_at_offset_with_flags";
+	ssize_t read_count                        = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_flags & ~( LIBBDE_READ_FLAG_STREAMING ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported read flags: 0x%02" PRIx8 ".",
+		 function,
+		 read_flags );
+
+		return( -1 );
+	}
+	internal_volume = (libbde_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libbde_internal_volume_seek_offset(
+	     internal_volume,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbde_internal_volume_read_buffer_from_file_io_handle(
+		      internal_volume,
+		      internal_volume->file_io_handle,
+		      buffer,
+		      buffer_size,
+		      read_flags,
+		      error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+
+on_error:
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Reads unencrypted data at specific offsets into multiple buffers
+ * The read count of every buffer is stored in read_counts
+ * If number_of_threads is more than 1 the buffers are read by worker threads
+ * that each use their own file IO handle and encryption context
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_volume_read_buffers_at_offsets(
+     libbde_volume_t *volume,
+     uint8_t **buffers,
+     size_t *buffer_sizes,
+     off64_t *offsets,
+     ssize_t *read_counts,
+     int number_of_buffers,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libbde_internal_volume_t *internal_volume = NULL;
+	static char *function                     = "libbde_volume_read_buffers_at_offsets";
+	ssize_t read_count                        = 0;
+	off64_t current_offset                    = 0;
+	int buffer_index                          = 0;
+
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	libbde_read_worker_t **read_workers            = NULL;
+	libcthreads_thread_pool_t *workers_thread_pool = NULL;
+	int lock_is_grabbed_for_read                   = 0;
+	int lock_is_grabbed_for_write                  = 0;
+	int worker_index                               = 0;
+#endif
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libbde_internal_volume_t *) volume;
+
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_buffers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of buffers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of threads value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		if( buffers[ buffer_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid buffer: %d.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		if( buffer_sizes[ buffer_index ] > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid buffer: %d size value exceeds maximum.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		if( offsets[ buffer_index ] < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+			 "%s: invalid buffer: %d offset value less than zero.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		read_counts[ buffer_index ] = 0;
+	}
+	if( number_of_threads > number_of_buffers )
+	{
+		number_of_threads = number_of_buffers;
+	}
+	if( number_of_threads > LIBBDE_READ_WORKER_MAXIMUM_NUMBER_OF_WORKERS )
+	{
+		number_of_threads = LIBBDE_READ_WORKER_MAXIMUM_NUMBER_OF_WORKERS;
+	}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		/* The read workers do not change the state of the volume, hence the read
+		 * lock suffices to copy the keys and to read while the volume remains open
+		 */
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_volume->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
+
+			return( -1 );
+		}
+		lock_is_grabbed_for_read = 1;
+
+		if( internal_volume->is_locked != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid volume - volume is locked.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_volume->encryption_context == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid volume - missing encryption context.",
+			 function );
+
+			goto on_error;
+		}
+		internal_volume->io_handle->abort = 0;
+
+		read_workers = (libbde_read_worker_t **) memory_allocate(
+		                sizeof( libbde_read_worker_t * ) * number_of_threads );
+
+		if( read_workers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create read workers.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     read_workers,
+		     0,
+		     sizeof( libbde_read_worker_t * ) * number_of_threads ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear read workers.",
+			 function );
+
+			goto on_error;
+		}
+		/* Every worker reads every number_of_threads-th buffer
+		 */
+		for( worker_index = 0;
+		     worker_index < number_of_threads;
+		     worker_index++ )
+		{
+			if( libbde_read_worker_initialize(
+			     &( read_workers[ worker_index ] ),
+			     internal_volume->io_handle,
+			     internal_volume->file_io_handle,
+			     internal_volume->encryption_context->method,
+			     internal_volume->full_volume_encryption_key,
+			     sizeof( internal_volume->full_volume_encryption_key ),
+			     internal_volume->tweak_key,
+			     sizeof( internal_volume->tweak_key ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create read worker: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+			if( libbde_read_worker_set_buffers(
+			     read_workers[ worker_index ],
+			     buffers,
+			     buffer_sizes,
+			     offsets,
+			     read_counts,
+			     number_of_buffers,
+			     worker_index,
+			     number_of_threads,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set buffers of read worker: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_thread_pool_create(
+		     &workers_thread_pool,
+		     NULL,
+		     number_of_threads,
+		     number_of_threads,
+		     (int (*)(intptr_t *, void *)) &libbde_read_worker_callback,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create workers thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( worker_index = 0;
+		     worker_index < number_of_threads;
+		     worker_index++ )
+		{
+			if( libcthreads_thread_pool_push(
+			     workers_thread_pool,
+			     (intptr_t *) read_workers[ worker_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push read worker: %d onto workers thread pool.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_thread_pool_join(
+		     &workers_thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join workers thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		/* The workers update the statistics of the volume themselves
+		 */
+		for( worker_index = 0;
+		     worker_index < number_of_threads;
+		     worker_index++ )
+		{
+			if( read_workers[ worker_index ]->result != 1 )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( ( libcnotify_verbose != 0 )
+				 && ( read_workers[ worker_index ]->error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 read_workers[ worker_index ]->error );
+				}
+#endif
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: read worker: %d unable to read buffers.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+		for( worker_index = 0;
+		     worker_index < number_of_threads;
+		     worker_index++ )
+		{
+			if( libbde_read_worker_free(
+			     &( read_workers[ worker_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free read worker: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 read_workers );
+
+		read_workers = NULL;
+
+		lock_is_grabbed_for_read = 0;
+
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_volume->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	lock_is_grabbed_for_write = 1;
+
+#endif /* defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT ) */
+
+	/* The buffers are read at their own offsets without changing the current offset of the volume
+	 */
+	current_offset = internal_volume->current_offset;
+
+	if( internal_volume->is_locked != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - volume is locked.",
+		 function );
+
+		goto on_error;
+	}
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		if( libbde_internal_volume_seek_offset(
+		     internal_volume,
+		     offsets[ buffer_index ],
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset of buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+		read_count = libbde_internal_volume_read_buffer_from_file_io_handle(
+			      internal_volume,
+			      internal_volume->file_io_handle,
+			      buffers[ buffer_index ],
+			      buffer_sizes[ buffer_index ],
+			      0,
+			      error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+		read_counts[ buffer_index ] = read_count;
+
+		if( internal_volume->io_handle->abort != 0 )
+		{
+			break;
+		}
+	}
+	internal_volume->current_offset = current_offset;
+
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( workers_thread_pool != NULL )
+	{
+		internal_volume->io_handle->abort = 1;
+
+		libcthreads_thread_pool_join(
+		 &workers_thread_pool,
+		 NULL );
+	}
+	if( read_workers != NULL )
+	{
+		for( worker_index = 0;
+		     worker_index < number_of_threads;
+		     worker_index++ )
+		{
+			if( read_workers[ worker_index ] != NULL )
+			{
+				libbde_read_worker_free(
+				 &( read_workers[ worker_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 read_workers );
+	}
+	if( lock_is_grabbed_for_read != 0 )
+	{
+		libcthreads_read_write_lock_release_for_read(
+		 internal_volume->read_write_lock,
+		 NULL );
+	}
+	else if( lock_is_grabbed_for_write != 0 )
+	{
+		if( number_of_threads <= 1 )
+		{
+			internal_volume->current_offset = current_offset;
+		}
+		libcthreads_read_write_lock_release_for_write(
+		 internal_volume->read_write_lock,
+		 NULL );
+	}
+#else
+	internal_volume->current_offset = current_offset;
+#endif
+	return( -1 );
+}
+
+/* Seeks a certain offset within the unencrypted data
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libbde_internal_volume_seek_offset(
+         libbde_internal_volume_t *internal_volume,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libbde_internal_volume_seek_offset";
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->is_locked != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - volume is locked.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += internal_volume->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) internal_volume->io_handle->volume_size;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: seeking volume data offset: %" PRIi64 ".\n",
+		 function,
+		 offset );
+	}
+#endif
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume->current_offset = offset;
+
+	return( offset );
+}
+
+/* Seeks a certain offset within the unencrypted data
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libbde_volume_seek_offset(
+         libbde_volume_t *volume,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libbde_internal_volume_t *internal_volume = NULL;
+	static char *function                     = "libbde_volume_seek_offset";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libbde_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	offset = libbde_internal_volume_seek_offset(
+	          internal_volume,
+	          offset,
+	          whence,
+	          error );
+
+	if( offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		offset = -1;
+	}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( offset );
+}
+
+/* Retrieves the current offset within the unencrypted data
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libbde_volume_read_buffer(
-         libbde_volume_t *volume,
-         void *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libbde_volume_get_offset(
+     libbde_volume_t *volume,
+     off64_t *offset,
+     libcerror_error_t **error )
 {
 	libbde_internal_volume_t *internal_volume = NULL;
-	static char *function                     = "libbde_volume_read_buffer";
-	ssize_t read_count                        = 0;
+	static char *function                     = "libbde_volume_get_offset";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libbde_internal_volume_t *) volume;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*offset = internal_volume->current_offset;
+
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the size
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_volume_get_size(
+     libbde_volume_t *volume,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libbde_internal_volume_t *internal_volume = NULL;
+	static char *function                     = "libbde_volume_get_size";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libbde_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->is_locked != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - volume is locked.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*size = internal_volume->io_handle->volume_size;
+
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the encryption method
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_volume_get_encryption_method(
+     libbde_volume_t *volume,
+     uint16_t *encryption_method,
+     libcerror_error_t **error )
+{
+	libbde_internal_volume_t *internal_volume = NULL;
+	static char *function                     = "libbde_volume_get_encryption_method";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libbde_internal_volume_t *) volume;
+
+	if( encryption_method == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encryption method.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*encryption_method = internal_volume->encryption_method;
+
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the statistics
+ * The values are stored in the order of LIBBDE_STATISTICS_VALUES, at most
+ * number_of_values values are retrieved
+ * The values are updated and read atomically, but values retrieved while the volume
+ * is being read, e.g. by another thread, are not necessarily consistent with each other
+ * Returns 1 if successful or -1 on error
+ */
+int libbde_volume_get_statistics(
+     libbde_volume_t *volume,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	libbde_internal_volume_t *internal_volume = NULL;
+	static char *function                     = "libbde_volume_get_statistics";
+	int result                                = 1;
 
 	if( volume == NULL )
 	{
@@ -2278,8 +4979,19 @@ ssize_t libbde_volume_read_buffer(
 	}
 	internal_volume = (libbde_internal_volume_t *) volume;
 
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2287,32 +4999,29 @@ ssize_t libbde_volume_read_buffer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	read_count = libbde_internal_volume_read_buffer_from_file_io_handle(
-		      internal_volume,
-		      internal_volume->file_io_handle,
-		      buffer,
-		      buffer_size,
-		      error );
-
-	if( read_count == -1 )
+	if( libbde_statistics_get_values(
+	     &( internal_volume->io_handle->statistics ),
+	     values,
+	     number_of_values,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics values.",
 		 function );
 
-		read_count = -1;
+		result = -1;
 	}
 #if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2320,28 +5029,32 @@ ssize_t libbde_volume_read_buffer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( read_count );
+	return( result );
 }
 
-/* Reads unencrypted data at a specific offset
- * Returns the number of bytes read or -1 on error
+/* Sets the trace function
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libbde_volume_read_buffer_at_offset(
-         libbde_volume_t *volume,
-         void *buffer,
-         size_t buffer_size,
-         off64_t offset,
-         libcerror_error_t **error )
+int libbde_volume_set_trace_function(
+     libbde_volume_t *volume,
+     void (*trace_function)(
+            intptr_t *user_data,
+            int event_type,
+            off64_t offset,
+            size64_t size,
+            uint64_t start_timestamp,
+            uint64_t end_timestamp ),
+     intptr_t *user_data,
+     libcerror_error_t **error )
 {
 	libbde_internal_volume_t *internal_volume = NULL;
-	static char *function                     = "libbde_volume_read_buffer_at_offset";
-	ssize_t read_count                        = 0;
+	static char *function                     = "libbde_volume_set_trace_function";
 
 	if( volume == NULL )
 	{
@@ -2356,6 +5069,17 @@ ssize_t libbde_volume_read_buffer_at_offset(
 	}
 	internal_volume = (libbde_internal_volume_t *) volume;
 
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
@@ -2371,39 +5095,9 @@ ssize_t libbde_volume_read_buffer_at_offset(
 		return( -1 );
 	}
 #endif
-	if( libbde_internal_volume_seek_offset(
-	     internal_volume,
-	     offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
-		 function );
-
-		goto on_error;
-	}
-	read_count = libbde_internal_volume_read_buffer_from_file_io_handle(
-		      internal_volume,
-		      internal_volume->file_io_handle,
-		      buffer,
-		      buffer_size,
-		      error );
-
-	if( read_count == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer.",
-		 function );
+	internal_volume->io_handle->trace_function  = trace_function;
+	internal_volume->io_handle->trace_user_data = user_data;
 
-		goto on_error;
-	}
 #if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -2419,30 +5113,31 @@ ssize_t libbde_volume_read_buffer_at_offset(
 		return( -1 );
 	}
 #endif
-	return( read_count );
-
-on_error:
-#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_volume->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
+	return( 1 );
 }
 
-/* Seeks a certain offset within the unencrypted data
- * This function is not multi-thread safe acquire write lock before call
- * Returns the offset if seek is successful or -1 on error
+/* Sets the block cache
+ * The block cache contains the data as read from the file IO handle and can be shared
+ * by multiple volumes on the same image, the block cache offset is the offset of the
+ * volume in that image. The image identifier identifies the image, the block cache is
+ * bound to the image of the first volume it is set for and cannot be set for volumes
+ * on another image. The volume does not take ownership of the block cache
+ * and unsets it when the volume is closed
+ * Use a block cache of NULL to stop using the block cache
+ * Returns 1 if successful or -1 on error
  */
-off64_t libbde_internal_volume_seek_offset(
-         libbde_internal_volume_t *internal_volume,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
+int libbde_volume_set_block_cache(
+     libbde_volume_t *volume,
+     libbde_block_cache_t *block_cache,
+     uint64_t image_identifier,
+     off64_t block_cache_offset,
+     libcerror_error_t **error )
 {
-	static char *function = "libbde_internal_volume_seek_offset";
+	libbde_internal_volume_t *internal_volume = NULL;
+	static char *function                     = "libbde_volume_set_block_cache";
+	int result                                = 0;
 
-	if( internal_volume == NULL )
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2453,17 +5148,8 @@ off64_t libbde_internal_volume_seek_offset(
 
 		return( -1 );
 	}
-	if( internal_volume->is_locked != 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - volume is locked.",
-		 function );
+	internal_volume = (libbde_internal_volume_t *) volume;
 
-		return( -1 );
-	}
 	if( internal_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -2475,63 +5161,96 @@ off64_t libbde_internal_volume_seek_offset(
 
 		return( -1 );
 	}
-	if( ( whence != SEEK_CUR )
-	 && ( whence != SEEK_END )
-	 && ( whence != SEEK_SET ) )
+	if( block_cache_offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported whence.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid block cache offset value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	if( whence == SEEK_CUR )
-	{
-		offset += internal_volume->current_offset;
-	}
-	else if( whence == SEEK_END )
+	if( block_cache != NULL )
 	{
-		offset += (off64_t) internal_volume->io_handle->volume_size;
+		result = libbde_block_cache_bind_image(
+		          block_cache,
+		          image_identifier,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to bind block cache to image.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid block cache - bound to another image.",
+			 function );
+
+			return( -1 );
+		}
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
-		libcnotify_printf(
-		 "%s: seeking volume data offset: %" PRIi64 ".\n",
-		 function,
-		 offset );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
 	}
 #endif
-	if( offset < 0 )
+	internal_volume->io_handle->block_cache        = block_cache;
+	internal_volume->io_handle->block_cache_offset = block_cache_offset;
+
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid offset value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	internal_volume->current_offset = offset;
-
-	return( offset );
+#endif
+	return( 1 );
 }
 
-/* Seeks a certain offset within the unencrypted data
- * Returns the offset if seek is successful or -1 on error
+/* Sets the warmup size
+ * The warmup prefetches and decrypts the boot area and the first warmup size bytes
+ * of the MFT after the volume is unlocked and keeps them in memory until the volume
+ * is closed. Use a warmup size of 0 to disable the warmup
+ * Returns 1 if successful or -1 on error
  */
-off64_t libbde_volume_seek_offset(
-         libbde_volume_t *volume,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
+int libbde_volume_set_warmup_size(
+     libbde_volume_t *volume,
+     size64_t warmup_size,
+     libcerror_error_t **error )
 {
 	libbde_internal_volume_t *internal_volume = NULL;
-	static char *function                     = "libbde_volume_seek_offset";
+	static char *function                     = "libbde_volume_set_warmup_size";
 
 	if( volume == NULL )
 	{
@@ -2546,6 +5265,17 @@ off64_t libbde_volume_seek_offset(
 	}
 	internal_volume = (libbde_internal_volume_t *) volume;
 
+	if( warmup_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid warmup size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
@@ -2561,23 +5291,8 @@ off64_t libbde_volume_seek_offset(
 		return( -1 );
 	}
 #endif
-	offset = libbde_internal_volume_seek_offset(
-	          internal_volume,
-	          offset,
-	          whence,
-	          error );
-
-	if( offset == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
-		 function );
+	internal_volume->warmup_size = warmup_size;
 
-		offset = -1;
-	}
 #if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -2593,19 +5308,20 @@ off64_t libbde_volume_seek_offset(
 		return( -1 );
 	}
 #endif
-	return( offset );
+	return( 1 );
 }
 
-/* Retrieves the current offset within the unencrypted data
+/* Retrieves the number of extents
  * Returns 1 if successful or -1 on error
  */
-int libbde_volume_get_offset(
+int libbde_volume_get_number_of_extents(
      libbde_volume_t *volume,
-     off64_t *offset,
+     int *number_of_extents,
      libcerror_error_t **error )
 {
 	libbde_internal_volume_t *internal_volume = NULL;
-	static char *function                     = "libbde_volume_get_offset";
+	static char *function                     = "libbde_volume_get_number_of_extents";
+	int result                                = 1;
 
 	if( volume == NULL )
 	{
@@ -2620,13 +5336,13 @@ int libbde_volume_get_offset(
 	}
 	internal_volume = (libbde_internal_volume_t *) volume;
 
-	if( offset == NULL )
+	if( internal_volume->is_locked != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offset.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - volume is locked.",
 		 function );
 
 		return( -1 );
@@ -2646,8 +5362,20 @@ int libbde_volume_get_offset(
 		return( -1 );
 	}
 #endif
-	*offset = internal_volume->current_offset;
+	if( libcdata_array_get_number_of_entries(
+	     internal_volume->extents_array,
+	     number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents.",
+		 function );
 
+		result = -1;
+	}
 #if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
@@ -2663,19 +5391,24 @@ int libbde_volume_get_offset(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the size
+/* Retrieves a specific extent
  * Returns 1 if successful or -1 on error
  */
-int libbde_volume_get_size(
+int libbde_volume_get_extent_by_index(
      libbde_volume_t *volume,
-     size64_t *size,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     uint32_t *extent_flags,
      libcerror_error_t **error )
 {
+	libbde_extent_t *extent                   = NULL;
 	libbde_internal_volume_t *internal_volume = NULL;
-	static char *function                     = "libbde_volume_get_size";
+	static char *function                     = "libbde_volume_get_extent_by_index";
+	int result                                = 1;
 
 	if( volume == NULL )
 	{
@@ -2690,56 +5423,65 @@ int libbde_volume_get_size(
 	}
 	internal_volume = (libbde_internal_volume_t *) volume;
 
-	if( internal_volume->io_handle == NULL )
+	if( internal_volume->is_locked != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing IO handle.",
+		 "%s: invalid volume - volume is locked.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_volume->is_locked != 0 )
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - volume is locked.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( size == NULL )
+#endif
+	if( libcdata_array_get_entry_by_index(
+	     internal_volume->extents_array,
+	     extent_index,
+	     (intptr_t **) &extent,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid size.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent: %d.",
+		 function,
+		 extent_index );
 
-		return( -1 );
+		result = -1;
 	}
-#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	else if( libbde_extent_get_values(
+	          extent,
+	          extent_offset,
+	          extent_size,
+	          extent_flags,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent: %d values.",
+		 function,
+		 extent_index );
 
-		return( -1 );
+		result = -1;
 	}
-#endif
-	*size = internal_volume->io_handle->volume_size;
-
 #if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
@@ -2755,19 +5497,24 @@ int libbde_volume_get_size(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the encryption method
- * Returns 1 if successful or -1 on error
+/* Retrieves the extent that contains a specific offset
+ * Returns 1 if successful, 0 if the offset is beyond the volume or -1 on error
  */
-int libbde_volume_get_encryption_method(
+int libbde_volume_get_extent_at_offset(
      libbde_volume_t *volume,
-     uint16_t *encryption_method,
+     off64_t offset,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     uint32_t *extent_flags,
      libcerror_error_t **error )
 {
+	libbde_extent_t *extent                   = NULL;
 	libbde_internal_volume_t *internal_volume = NULL;
-	static char *function                     = "libbde_volume_get_encryption_method";
+	static char *function                     = "libbde_volume_get_extent_at_offset";
+	int result                                = 0;
 
 	if( volume == NULL )
 	{
@@ -2782,13 +5529,24 @@ int libbde_volume_get_encryption_method(
 	}
 	internal_volume = (libbde_internal_volume_t *) volume;
 
-	if( encryption_method == NULL )
+	if( internal_volume->is_locked != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - volume is locked.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid encryption method.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
 		 function );
 
 		return( -1 );
@@ -2808,8 +5566,42 @@ int libbde_volume_get_encryption_method(
 		return( -1 );
 	}
 #endif
-	*encryption_method = internal_volume->encryption_method;
+	result = libbde_internal_volume_get_extent_at_offset(
+	          internal_volume,
+	          offset,
+	          &extent,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+	}
+	else if( result != 0 )
+	{
+		if( libbde_extent_get_values(
+		     extent,
+		     extent_offset,
+		     extent_size,
+		     extent_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent values.",
+			 function );
 
+			result = -1;
+		}
+	}
 #if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
@@ -2825,7 +5617,7 @@ int libbde_volume_get_encryption_method(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
 /* Retrieves the volume identifier
@@ -3806,7 +6598,7 @@ int libbde_volume_set_keys(
 		if( memory_set(
 		     internal_volume->full_volume_encryption_key,
 		     0,
-		     64  ) == NULL )
+		     sizeof( internal_volume->full_volume_encryption_key ) ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
@@ -3839,7 +6631,7 @@ int libbde_volume_set_keys(
 		if( memory_set(
 		     internal_volume->tweak_key,
 		     0,
-		     32  ) == NULL )
+		     sizeof( internal_volume->tweak_key ) ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
@@ -3893,17 +6685,218 @@ on_error:
 	memory_set(
 	 internal_volume->tweak_key,
 	 0,
-	 32 );
+	 sizeof( internal_volume->tweak_key ) );
+
+	memory_set(
+	 internal_volume->full_volume_encryption_key,
+	 0,
+	 sizeof( internal_volume->full_volume_encryption_key ) );
+
+	internal_volume->full_volume_encryption_key_size = 0;
+	internal_volume->tweak_key_size                  = 0;
+	internal_volume->keys_are_set                    = 0;
+
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Sets the keys from another volume
+ * The source volume must have been opened and unlocked, the keys are copied
+ * without leaving the library, for example to open additional volumes on the
+ * same image without deriving the keys again
+ * This function needs to be used before one of the open functions
+ * Returns 1 if successful, 0 if the source volume has no keys or -1 on error
+ */
+int libbde_volume_set_keys_from_volume(
+     libbde_volume_t *volume,
+     libbde_volume_t *source_volume,
+     libcerror_error_t **error )
+{
+	libbde_internal_volume_t *internal_source_volume = NULL;
+	libbde_internal_volume_t *internal_volume        = NULL;
+	static char *function                            = "libbde_volume_set_keys_from_volume";
+	int result                                       = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libbde_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_volume == volume )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source volume value same as volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_source_volume = (libbde_internal_volume_t *) source_volume;
+
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_source_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab source read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		libcthreads_read_write_lock_release_for_read(
+		 internal_source_volume->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	if( internal_source_volume->keys_are_set == 0 )
+	{
+		result = 0;
+	}
+	else
+	{
+		if( memory_copy(
+		     internal_volume->full_volume_encryption_key,
+		     internal_source_volume->full_volume_encryption_key,
+		     sizeof( internal_volume->full_volume_encryption_key ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy full volume encryption key.",
+			 function );
+
+			goto on_error;
+		}
+		internal_volume->full_volume_encryption_key_size = internal_source_volume->full_volume_encryption_key_size;
+
+		if( memory_copy(
+		     internal_volume->tweak_key,
+		     internal_source_volume->tweak_key,
+		     sizeof( internal_volume->tweak_key ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy tweak key.",
+			 function );
+
+			goto on_error;
+		}
+		internal_volume->tweak_key_size = internal_source_volume->tweak_key_size;
+
+		internal_volume->keys_are_set = 1;
+	}
+#if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		libcthreads_read_write_lock_release_for_read(
+		 internal_source_volume->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_source_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release source read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+	memory_set(
+	 internal_volume->tweak_key,
+	 0,
+	 sizeof( internal_volume->tweak_key ) );
 
 	memory_set(
 	 internal_volume->full_volume_encryption_key,
 	 0,
-	 64 );
+	 sizeof( internal_volume->full_volume_encryption_key ) );
+
+	internal_volume->full_volume_encryption_key_size = 0;
+	internal_volume->tweak_key_size                  = 0;
+	internal_volume->keys_are_set                    = 0;
 
 #if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
 	libcthreads_read_write_lock_release_for_write(
 	 internal_volume->read_write_lock,
 	 NULL );
+	libcthreads_read_write_lock_release_for_read(
+	 internal_source_volume->read_write_lock,
+	 NULL );
 #endif
 	return( -1 );
 }
@@ -26,13 +26,17 @@
 #include <types.h>
 
 #include "libbde_encryption_context.h"
+#include "libbde_extent.h"
 #include "libbde_extern.h"
 #include "libbde_io_handle.h"
 #include "libbde_libbfio.h"
+#include "libbde_libcdata.h"
 #include "libbde_libcerror.h"
 #include "libbde_libcthreads.h"
+#include "libbde_mapped_file_io_handle.h"
 #include "libbde_metadata.h"
 #include "libbde_password_keep.h"
+#include "libbde_positional_file.h"
 #include "libbde_sector_data_vector.h"
 #include "libbde_types.h"
 #include "libbde_volume_header.h"
@@ -81,6 +85,10 @@ struct libbde_internal_volume
 	 */
 	libbde_sector_data_vector_t *sector_data_vector;
 
+	/* The extents array
+	 */
+	libcdata_array_t *extents_array;
+
 	/* The file IO handle
 	 */
 	libbfio_handle_t *file_io_handle;
@@ -97,6 +105,10 @@ struct libbde_internal_volume
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
+	/* The positional file
+	 */
+	libbde_positional_file_t *positional_file;
+
 	/* External provided full volume encryption key
 	 */
 	uint8_t full_volume_encryption_key[ 64 ];
@@ -125,7 +137,19 @@ struct libbde_internal_volume
 	 */
 	uint8_t is_locked;
 
+	/* The warmup size
+	 */
+	size64_t warmup_size;
+
+	/* Value to indicate the warmup should be aborted
+	 */
+	uint8_t abort_warmup;
+
 #if defined( HAVE_LIBBDE_MULTI_THREAD_SUPPORT )
+	/* The warmup thread
+	 */
+	libcthreads_thread_t *warmup_thread;
+
 	/* The read/write lock
 	 */
 	libcthreads_read_write_lock_t *read_write_lock;
@@ -177,6 +201,15 @@ int libbde_volume_close(
      libbde_volume_t *volume,
      libcerror_error_t **error );
 
+int libbde_internal_volume_open_file_io_handle(
+     libbde_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libbde_mapped_file_io_handle_t *mapped_file_io_handle,
+     libbde_positional_file_t *positional_file,
+     uint8_t file_io_handle_created_in_library,
+     int access_flags,
+     libcerror_error_t **error );
+
 int libbde_internal_volume_open_read(
      libbde_internal_volume_t *internal_volume,
      libbfio_handle_t *file_io_handle,
@@ -201,16 +234,56 @@ int libbde_internal_volume_unlock(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libbde_internal_volume_get_extent_flags_at_offset(
+     libbde_internal_volume_t *internal_volume,
+     off64_t offset,
+     uint32_t *extent_flags,
+     libcerror_error_t **error );
+
+int libbde_internal_volume_read_extents(
+     libbde_internal_volume_t *internal_volume,
+     libcerror_error_t **error );
+
+int libbde_internal_volume_get_extent_at_offset(
+     libbde_internal_volume_t *internal_volume,
+     off64_t offset,
+     libbde_extent_t **extent,
+     libcerror_error_t **error );
+
 LIBBDE_EXTERN \
 int libbde_volume_unlock(
      libbde_volume_t *volume,
      libcerror_error_t **error );
 
+int libbde_internal_volume_warmup(
+     libbde_internal_volume_t *internal_volume,
+     libcerror_error_t **error );
+
+int libbde_internal_volume_warmup_callback(
+     libbde_internal_volume_t *internal_volume );
+
+int libbde_internal_volume_start_warmup(
+     libbde_internal_volume_t *internal_volume,
+     libcerror_error_t **error );
+
+int libbde_internal_volume_stop_warmup(
+     libbde_internal_volume_t *internal_volume,
+     libcerror_error_t **error );
+
+ssize_t libbde_internal_volume_read_unencrypted_buffer_from_file_io_handle(
+         libbde_internal_volume_t *internal_volume,
+         libbfio_handle_t *file_io_handle,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
 ssize_t libbde_internal_volume_read_buffer_from_file_io_handle(
          libbde_internal_volume_t *internal_volume,
          libbfio_handle_t *file_io_handle,
          void *buffer,
          size_t buffer_size,
+         uint8_t read_flags,
          libcerror_error_t **error );
 
 LIBBDE_EXTERN \
@@ -228,6 +301,26 @@ ssize_t libbde_volume_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+LIBBDE_EXTERN \
+ssize_t libbde_volume_read_buffer_at_offset_with_flags(
+         libbde_volume_t *volume,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         uint8_t read_flags,
+         libcerror_error_t **error );
+
+LIBBDE_EXTERN \
+int libbde_volume_read_buffers_at_offsets(
+     libbde_volume_t *volume,
+     uint8_t **buffers,
+     size_t *buffer_sizes,
+     off64_t *offsets,
+     ssize_t *read_counts,
+     int number_of_buffers,
+     int number_of_threads,
+     libcerror_error_t **error );
+
 off64_t libbde_internal_volume_seek_offset(
          libbde_internal_volume_t *internal_volume,
          off64_t offset,
@@ -259,6 +352,64 @@ int libbde_volume_get_encryption_method(
      uint16_t *encryption_method,
      libcerror_error_t **error );
 
+LIBBDE_EXTERN \
+int libbde_volume_get_statistics(
+     libbde_volume_t *volume,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error );
+
+LIBBDE_EXTERN \
+int libbde_volume_set_trace_function(
+     libbde_volume_t *volume,
+     void (*trace_function)(
+            intptr_t *user_data,
+            int event_type,
+            off64_t offset,
+            size64_t size,
+            uint64_t start_timestamp,
+            uint64_t end_timestamp ),
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
+LIBBDE_EXTERN \
+int libbde_volume_set_block_cache(
+     libbde_volume_t *volume,
+     libbde_block_cache_t *block_cache,
+     uint64_t image_identifier,
+     off64_t block_cache_offset,
+     libcerror_error_t **error );
+
+LIBBDE_EXTERN \
+int libbde_volume_set_warmup_size(
+     libbde_volume_t *volume,
+     size64_t warmup_size,
+     libcerror_error_t **error );
+
+LIBBDE_EXTERN \
+int libbde_volume_get_number_of_extents(
+     libbde_volume_t *volume,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+LIBBDE_EXTERN \
+int libbde_volume_get_extent_by_index(
+     libbde_volume_t *volume,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     uint32_t *extent_flags,
+     libcerror_error_t **error );
+
+LIBBDE_EXTERN \
+int libbde_volume_get_extent_at_offset(
+     libbde_volume_t *volume,
+     off64_t offset,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     uint32_t *extent_flags,
+     libcerror_error_t **error );
+
 LIBBDE_EXTERN \
 int libbde_volume_get_volume_identifier(
      libbde_volume_t *volume,
@@ -327,6 +478,12 @@ int libbde_volume_set_keys(
      size_t tweak_key_size,
      libcerror_error_t **error );
 
+LIBBDE_EXTERN \
+int libbde_volume_set_keys_from_volume(
+     libbde_volume_t *volume,
+     libbde_volume_t *source_volume,
+     libcerror_error_t **error );
+
 LIBBDE_EXTERN \
 int libbde_volume_set_utf8_password(
      libbde_volume_t *volume,
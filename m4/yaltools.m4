@@ -101,6 +101,25 @@ AC_DEFUN([AX_BDETOOLS_CHECK_LOCAL],
     [AC_CHECK_FUNCS([clock_gettime getegid geteuid time])
   ])
 
+  dnl Headers included in bdetools/nbd_server.c and bdetools/nbd_connection.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_HEADERS([arpa/inet.h netinet/in.h netinet/tcp.h poll.h sys/socket.h sys/un.h])
+  ])
+
+  dnl Headers and functions included in bdetools/decrypt_handle.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_HEADERS([fcntl.h])
+    AC_CHECK_FUNCS([fsync])
+  ])
+
+  dnl Headers included in bdetools/batch_handle.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_HEADERS([dirent.h sys/stat.h])
+  ])
+
   AX_TOOLS_CHECK_ENABLE_MINGW_BINMODE
 ])
 
@@ -28,6 +28,7 @@
 #endif
 
 #include "pybde.h"
+#include "pybde_chunks.h"
 #include "pybde_encryption_methods.h"
 #include "pybde_error.h"
 #include "pybde_file_object_io_handle.h"
@@ -685,6 +686,23 @@ PyMODINIT_FUNC initpybde(
 	 "key_protectors",
 	 (PyObject *) &pybde_key_protectors_type_object );
 
+	/* Setup the chunks type object
+	 */
+	pybde_chunks_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pybde_chunks_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pybde_chunks_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "chunks",
+	 (PyObject *) &pybde_chunks_type_object );
+
 	/* Setup the volume type object
 	 */
 	pybde_volume_type_object.tp_new = PyType_GenericNew;
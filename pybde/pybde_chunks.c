@@ -0,0 +1,653 @@
+/*
+ * Python object definition of the iterator object of volume data chunks
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pybde_chunks.h"
+#include "pybde_error.h"
+#include "pybde_libbde.h"
+#include "pybde_libcerror.h"
+#include "pybde_libcthreads.h"
+#include "pybde_python.h"
+#include "pybde_volume.h"
+
+PyTypeObject pybde_chunks_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pybde.chunks",
+	/* tp_basicsize */
+	sizeof( pybde_chunks_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pybde_chunks_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_ITER,
+	/* tp_doc */
+	"pybde iterator object of volume data chunks",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	(getiterfunc) pybde_chunks_iter,
+	/* tp_iternext */
+	(iternextfunc) pybde_chunks_iternext,
+	/* tp_methods */
+	0,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	0,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pybde_chunks_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Creates a new chunks iterator object
+ * The read-ahead of the first chunk is started immediately
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pybde_chunks_new(
+           pybde_volume_t *volume_object,
+           size_t chunk_size,
+           off64_t start_offset,
+           off64_t end_offset )
+{
+	pybde_chunks_t *chunks_object = NULL;
+	static char *function         = "pybde_chunks_new";
+
+	if( volume_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume object.",
+		 function );
+
+		return( NULL );
+	}
+	if( ( chunk_size == 0 )
+	 || ( chunk_size > (size_t) SSIZE_MAX ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	if( start_offset < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid start offset value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	/* Make sure the chunks values are initialized
+	 */
+	chunks_object = PyObject_New(
+	                 struct pybde_chunks,
+	                 &pybde_chunks_type_object );
+
+	if( chunks_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create chunks object.",
+		 function );
+
+		goto on_error;
+	}
+	chunks_object->volume_object     = volume_object;
+	chunks_object->chunk_size        = chunk_size;
+	chunks_object->current_offset    = start_offset;
+	chunks_object->end_offset        = end_offset;
+	chunks_object->read_ahead_object = NULL;
+	chunks_object->read_ahead_data   = NULL;
+	chunks_object->read_ahead_size   = 0;
+	chunks_object->read_ahead_count  = 0;
+	chunks_object->read_ahead_error  = NULL;
+	chunks_object->is_busy           = 0;
+
+#if defined( HAVE_PYBDE_MULTI_THREAD_SUPPORT )
+	chunks_object->read_ahead_thread = NULL;
+#endif
+
+	Py_IncRef(
+	 (PyObject *) chunks_object->volume_object );
+
+	if( chunks_object->current_offset < chunks_object->end_offset )
+	{
+		if( pybde_chunks_start_read_ahead(
+		     chunks_object ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	return( (PyObject *) chunks_object );
+
+on_error:
+	if( chunks_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) chunks_object );
+	}
+	return( NULL );
+}
+
+/* Initializes a chunks iterator object
+ * Returns 0 if successful or -1 on error
+ */
+int pybde_chunks_init(
+     pybde_chunks_t *chunks_object )
+{
+	static char *function = "pybde_chunks_init";
+
+	if( chunks_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid chunks object.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the chunks values are initialized
+	 */
+	chunks_object->volume_object     = NULL;
+	chunks_object->chunk_size        = 0;
+	chunks_object->current_offset    = 0;
+	chunks_object->end_offset        = 0;
+	chunks_object->read_ahead_object = NULL;
+	chunks_object->read_ahead_data   = NULL;
+	chunks_object->read_ahead_size   = 0;
+	chunks_object->read_ahead_count  = 0;
+	chunks_object->read_ahead_error  = NULL;
+	chunks_object->is_busy           = 0;
+
+#if defined( HAVE_PYBDE_MULTI_THREAD_SUPPORT )
+	chunks_object->read_ahead_thread = NULL;
+#endif
+
+	PyErr_Format(
+	 PyExc_NotImplementedError,
+	 "%s: initialize of chunks not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Frees a chunks iterator object
+ */
+void pybde_chunks_free(
+      pybde_chunks_t *chunks_object )
+{
+	struct _typeobject *ob_type = NULL;
+	static char *function       = "pybde_chunks_free";
+
+	if( chunks_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid chunks object.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           chunks_object );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+#if defined( HAVE_PYBDE_MULTI_THREAD_SUPPORT )
+	/* Wait for a pending read-ahead since it writes into the read-ahead object
+	 */
+	if( chunks_object->read_ahead_thread != NULL )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		libcthreads_thread_join(
+		 &( chunks_object->read_ahead_thread ),
+		 NULL );
+
+		Py_END_ALLOW_THREADS
+	}
+#endif
+	if( chunks_object->read_ahead_error != NULL )
+	{
+		libcerror_error_free(
+		 &( chunks_object->read_ahead_error ) );
+	}
+	if( chunks_object->read_ahead_object != NULL )
+	{
+		Py_DecRef(
+		 chunks_object->read_ahead_object );
+	}
+	if( chunks_object->volume_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) chunks_object->volume_object );
+	}
+	ob_type->tp_free(
+	 (PyObject*) chunks_object );
+}
+
+/* Reads the data of the next chunk into the read-ahead object
+ * This function is called without holding the GIL
+ * Returns 1 if successful or -1 on error
+ */
+int pybde_chunks_read_ahead(
+     pybde_chunks_t *chunks_object )
+{
+	if( chunks_object == NULL )
+	{
+		return( -1 );
+	}
+	chunks_object->read_ahead_count = libbde_volume_read_buffer_at_offset_with_flags(
+	                                   chunks_object->volume_object->volume,
+	                                   chunks_object->read_ahead_data,
+	                                   chunks_object->read_ahead_size,
+	                                   chunks_object->current_offset,
+	                                   LIBBDE_READ_FLAG_STREAMING,
+	                                   &( chunks_object->read_ahead_error ) );
+
+	if( chunks_object->read_ahead_count == -1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Starts reading the next chunk
+ * If multi-thread support is available the chunk is read by a background thread
+ * Returns 1 if successful or -1 on error
+ */
+int pybde_chunks_start_read_ahead(
+     pybde_chunks_t *chunks_object )
+{
+#if defined( HAVE_PYBDE_MULTI_THREAD_SUPPORT )
+	libcerror_error_t *error = NULL;
+#endif
+
+	static char *function    = "pybde_chunks_start_read_ahead";
+	size_t read_size         = 0;
+
+	if( chunks_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid chunks object.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunks_object->read_ahead_object != NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid chunks object - read-ahead object already set.",
+		 function );
+
+		return( -1 );
+	}
+	read_size = chunks_object->chunk_size;
+
+	if( (off64_t) read_size > ( chunks_object->end_offset - chunks_object->current_offset ) )
+	{
+		read_size = (size_t) ( chunks_object->end_offset - chunks_object->current_offset );
+	}
+#if PY_MAJOR_VERSION >= 3
+	chunks_object->read_ahead_object = PyBytes_FromStringAndSize(
+	                                    NULL,
+	                                    (Py_ssize_t) read_size );
+#else
+	chunks_object->read_ahead_object = PyString_FromStringAndSize(
+	                                    NULL,
+	                                    (Py_ssize_t) read_size );
+#endif
+	if( chunks_object->read_ahead_object == NULL )
+	{
+		return( -1 );
+	}
+#if PY_MAJOR_VERSION >= 3
+	chunks_object->read_ahead_data = (uint8_t *) PyBytes_AsString(
+	                                              chunks_object->read_ahead_object );
+#else
+	chunks_object->read_ahead_data = (uint8_t *) PyString_AsString(
+	                                              chunks_object->read_ahead_object );
+#endif
+	chunks_object->read_ahead_size  = read_size;
+	chunks_object->read_ahead_count = 0;
+
+#if defined( HAVE_PYBDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_thread_create(
+	     &( chunks_object->read_ahead_thread ),
+	     NULL,
+	     (int (*)(void *)) &pybde_chunks_read_ahead,
+	     (void *) chunks_object,
+	     &error ) != 1 )
+	{
+		pybde_error_raise(
+		 error,
+		 PyExc_RuntimeError,
+		 "%s: unable to create read-ahead thread.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		Py_DecRef(
+		 chunks_object->read_ahead_object );
+
+		chunks_object->read_ahead_object = NULL;
+		chunks_object->read_ahead_data   = NULL;
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Waits for the read of the next chunk to complete
+ * Returns 1 if successful or -1 on error
+ */
+int pybde_chunks_wait_for_read_ahead(
+     pybde_chunks_t *chunks_object )
+{
+#if defined( HAVE_PYBDE_MULTI_THREAD_SUPPORT )
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+#endif
+
+	static char *function    = "pybde_chunks_wait_for_read_ahead";
+
+	if( chunks_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid chunks object.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_PYBDE_MULTI_THREAD_SUPPORT )
+	if( chunks_object->read_ahead_thread != NULL )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libcthreads_thread_join(
+		          &( chunks_object->read_ahead_thread ),
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pybde_error_raise(
+			 error,
+			 PyExc_RuntimeError,
+			 "%s: unable to join read-ahead thread.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			return( -1 );
+		}
+	}
+#else
+	Py_BEGIN_ALLOW_THREADS
+
+	pybde_chunks_read_ahead(
+	 chunks_object );
+
+	Py_END_ALLOW_THREADS
+#endif
+	return( 1 );
+}
+
+/* The chunks iter() function
+ */
+PyObject *pybde_chunks_iter(
+           pybde_chunks_t *chunks_object )
+{
+	static char *function = "pybde_chunks_iter";
+
+	if( chunks_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid chunks object.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) chunks_object );
+
+	return( (PyObject *) chunks_object );
+}
+
+/* The chunks iternext() function
+ * Returns the data of the current chunk and starts reading the next chunk
+ */
+PyObject *pybde_chunks_iternext(
+           pybde_chunks_t *chunks_object )
+{
+	PyObject *chunk_object = NULL;
+	static char *function  = "pybde_chunks_iternext";
+	ssize_t read_count     = 0;
+
+	if( chunks_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid chunks object.",
+		 function );
+
+		return( NULL );
+	}
+	if( chunks_object->is_busy != 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: chunks iterator already executing.",
+		 function );
+
+		return( NULL );
+	}
+	if( chunks_object->read_ahead_object == NULL )
+	{
+		PyErr_SetNone(
+		 PyExc_StopIteration );
+
+		return( NULL );
+	}
+	chunks_object->is_busy = 1;
+
+	if( pybde_chunks_wait_for_read_ahead(
+	     chunks_object ) != 1 )
+	{
+		goto on_error;
+	}
+	chunk_object = chunks_object->read_ahead_object;
+	read_count   = chunks_object->read_ahead_count;
+
+	chunks_object->read_ahead_object = NULL;
+	chunks_object->read_ahead_data   = NULL;
+
+	if( read_count == -1 )
+	{
+		pybde_error_raise(
+		 chunks_object->read_ahead_error,
+		 PyExc_IOError,
+		 "%s: unable to read data at offset: %" PRIi64 ".",
+		 function,
+		 chunks_object->current_offset );
+
+		libcerror_error_free(
+		 &( chunks_object->read_ahead_error ) );
+
+		goto on_error;
+	}
+	if( read_count == 0 )
+	{
+		chunks_object->current_offset = chunks_object->end_offset;
+
+		Py_DecRef(
+		 chunk_object );
+
+		chunks_object->is_busy = 0;
+
+		PyErr_SetNone(
+		 PyExc_StopIteration );
+
+		return( NULL );
+	}
+	/* Need to resize the string here in case the chunk was not fully read.
+	 */
+	if( (size_t) read_count != chunks_object->read_ahead_size )
+	{
+#if PY_MAJOR_VERSION >= 3
+		if( _PyBytes_Resize(
+		     &chunk_object,
+		     (Py_ssize_t) read_count ) != 0 )
+#else
+		if( _PyString_Resize(
+		     &chunk_object,
+		     (Py_ssize_t) read_count ) != 0 )
+#endif
+		{
+			goto on_error;
+		}
+	}
+	chunks_object->current_offset += (off64_t) read_count;
+
+	/* The next chunk is read while the caller processes the current chunk
+	 */
+	if( chunks_object->current_offset < chunks_object->end_offset )
+	{
+		if( pybde_chunks_start_read_ahead(
+		     chunks_object ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	chunks_object->is_busy = 0;
+
+	return( chunk_object );
+
+on_error:
+	if( chunk_object != NULL )
+	{
+		Py_DecRef(
+		 chunk_object );
+	}
+	chunks_object->is_busy = 0;
+
+	return( NULL );
+}
+
@@ -0,0 +1,133 @@
+/*
+ * Python object definition of the iterator object of volume data chunks
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYBDE_CHUNKS_H )
+#define _PYBDE_CHUNKS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pybde_libbde.h"
+#include "pybde_libcerror.h"
+#include "pybde_libcthreads.h"
+#include "pybde_python.h"
+#include "pybde_volume.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default chunk size
+ */
+#define PYBDE_CHUNKS_DEFAULT_CHUNK_SIZE		( 1024 * 1024 )
+
+typedef struct pybde_chunks pybde_chunks_t;
+
+struct pybde_chunks
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The volume object
+	 */
+	pybde_volume_t *volume_object;
+
+	/* The chunk size
+	 */
+	size_t chunk_size;
+
+	/* The offset of the next chunk
+	 */
+	off64_t current_offset;
+
+	/* The end offset
+	 */
+	off64_t end_offset;
+
+	/* The read-ahead (bytes) object
+	 * The data of the next chunk is read into this object
+	 */
+	PyObject *read_ahead_object;
+
+	/* The read-ahead data
+	 * Points to the data of the read-ahead object
+	 */
+	uint8_t *read_ahead_data;
+
+	/* The read-ahead size
+	 */
+	size_t read_ahead_size;
+
+	/* The read-ahead read count
+	 */
+	ssize_t read_ahead_count;
+
+	/* The read-ahead error
+	 */
+	libcerror_error_t *read_ahead_error;
+
+	/* Value to indicate the iterator is being advanced
+	 */
+	uint8_t is_busy;
+
+#if defined( HAVE_PYBDE_MULTI_THREAD_SUPPORT )
+	/* The read-ahead thread
+	 */
+	libcthreads_thread_t *read_ahead_thread;
+#endif
+};
+
+extern PyTypeObject pybde_chunks_type_object;
+
+PyObject *pybde_chunks_new(
+           pybde_volume_t *volume_object,
+           size_t chunk_size,
+           off64_t start_offset,
+           off64_t end_offset );
+
+int pybde_chunks_init(
+     pybde_chunks_t *chunks_object );
+
+void pybde_chunks_free(
+      pybde_chunks_t *chunks_object );
+
+int pybde_chunks_read_ahead(
+     pybde_chunks_t *chunks_object );
+
+int pybde_chunks_start_read_ahead(
+     pybde_chunks_t *chunks_object );
+
+int pybde_chunks_wait_for_read_ahead(
+     pybde_chunks_t *chunks_object );
+
+PyObject *pybde_chunks_iter(
+           pybde_chunks_t *chunks_object );
+
+PyObject *pybde_chunks_iternext(
+           pybde_chunks_t *chunks_object );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYBDE_CHUNKS_H ) */
+
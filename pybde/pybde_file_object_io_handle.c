@@ -40,6 +40,7 @@ int pybde_file_object_io_handle_initialize(
      libcerror_error_t **error )
 {
 	static char *function = "pybde_file_object_io_handle_initialize";
+	int block_index       = 0;
 
 	if( file_object_io_handle == NULL )
 	{
@@ -102,6 +103,12 @@ int pybde_file_object_io_handle_initialize(
 
 		goto on_error;
 	}
+	for( block_index = 0;
+	     block_index < PYBDE_FILE_OBJECT_IO_HANDLE_NUMBER_OF_BLOCKS;
+	     block_index++ )
+	{
+		( *file_object_io_handle )->block_offsets[ block_index ] = -1;
+	}
 	( *file_object_io_handle )->file_object = file_object;
 
 	Py_IncRef(
@@ -227,6 +234,11 @@ int pybde_file_object_io_handle_free(
 	}
 	if( *file_object_io_handle != NULL )
 	{
+		if( ( *file_object_io_handle )->block_data != NULL )
+		{
+			memory_free(
+			 ( *file_object_io_handle )->block_data );
+		}
 		gil_state = PyGILState_Ensure();
 
 		Py_DecRef(
@@ -379,6 +391,7 @@ int pybde_file_object_io_handle_close(
      libcerror_error_t **error )
 {
 	static char *function = "pybde_file_object_io_handle_close";
+	int block_index       = 0;
 
 	if( file_object_io_handle == NULL )
 	{
@@ -406,6 +419,13 @@ int pybde_file_object_io_handle_close(
 	 */
 	file_object_io_handle->access_flags = 0;
 
+	for( block_index = 0;
+	     block_index < PYBDE_FILE_OBJECT_IO_HANDLE_NUMBER_OF_BLOCKS;
+	     block_index++ )
+	{
+		file_object_io_handle->block_offsets[ block_index ] = -1;
+	}
+
 	return( 0 );
 }
 
@@ -613,7 +633,309 @@ on_error:
 	return( -1 );
 }
 
+/* Reads a buffer from the file object using its readinto method
+ * Make sure to hold the GIL state before calling this function
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t pybde_file_object_readinto_buffer(
+         PyObject *file_object,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	PyObject *argument_buffer = NULL;
+	PyObject *method_name     = NULL;
+	PyObject *method_result   = NULL;
+	static char *function     = "pybde_file_object_readinto_buffer";
+	int64_t safe_read_count   = 0;
+
+	if( file_object == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file object.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 0 );
+	}
+#if PY_VERSION_HEX >= 0x03030000
+	method_name = PyUnicode_FromString(
+	               "readinto" );
+
+	PyErr_Clear();
+
+	/* The memory view refers to the buffer, which avoids creating a bytes object per read
+	 */
+	argument_buffer = PyMemoryView_FromMemory(
+	                   (char *) buffer,
+	                   (Py_ssize_t) size,
+	                   PyBUF_WRITE );
+
+	if( argument_buffer == NULL )
+	{
+		pybde_error_fetch(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create memory view of buffer.",
+		 function );
+
+		goto on_error;
+	}
+	method_result = PyObject_CallMethodObjArgs(
+	                 file_object,
+	                 method_name,
+	                 argument_buffer,
+	                 NULL );
+
+	if( PyErr_Occurred() )
+	{
+		pybde_error_fetch(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file object.",
+		 function );
+
+		goto on_error;
+	}
+	if( method_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing method result.",
+		 function );
+
+		goto on_error;
+	}
+	if( pybde_integer_signed_copy_to_64bit(
+	     method_result,
+	     &safe_read_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to convert method result into read count.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( safe_read_count < 0 )
+	 || ( safe_read_count > (int64_t) size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read count value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	Py_DecRef(
+	 method_result );
+
+	Py_DecRef(
+	 argument_buffer );
+
+	Py_DecRef(
+	 method_name );
+
+	return( (ssize_t) safe_read_count );
+
+on_error:
+	if( method_result != NULL )
+	{
+		Py_DecRef(
+		 method_result );
+	}
+	if( argument_buffer != NULL )
+	{
+		Py_DecRef(
+		 argument_buffer );
+	}
+	if( method_name != NULL )
+	{
+		Py_DecRef(
+		 method_name );
+	}
+	return( -1 );
+#else
+	/* Memory views of a C buffer are not supported, fall back to read
+	 */
+	return( pybde_file_object_read_buffer(
+	         file_object,
+	         buffer,
+	         size,
+	         error ) );
+#endif
+}
+
+/* Reads a buffer at a specific offset from the file object of the file object IO handle
+ * The buffer is filled until size or the end of the file object is reached, since
+ * file objects are allowed to return less data than requested
+ * Make sure to hold the GIL state before calling this function
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t pybde_file_object_io_handle_read_buffer_at_offset(
+         pybde_file_object_io_handle_t *file_object_io_handle,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	PyObject *method_name = NULL;
+	static char *function = "pybde_file_object_io_handle_read_buffer_at_offset";
+	size_t buffer_offset  = 0;
+	ssize_t read_count    = 0;
+
+	if( file_object_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file object IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_object_io_handle->readinto_support_determined == 0 )
+	{
+#if PY_MAJOR_VERSION >= 3
+		method_name = PyUnicode_FromString(
+		               "readinto" );
+#else
+		method_name = PyString_FromString(
+		               "readinto" );
+#endif
+		PyErr_Clear();
+
+		if( PyObject_HasAttr(
+		     file_object_io_handle->file_object,
+		     method_name ) != 0 )
+		{
+			file_object_io_handle->has_readinto = 1;
+		}
+		Py_DecRef(
+		 method_name );
+
+		file_object_io_handle->readinto_support_determined = 1;
+	}
+	if( pybde_file_object_seek_offset(
+	     file_object_io_handle->file_object,
+	     offset,
+	     SEEK_SET,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in file object.",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	while( buffer_offset < size )
+	{
+		if( file_object_io_handle->has_readinto != 0 )
+		{
+			read_count = pybde_file_object_readinto_buffer(
+			              file_object_io_handle->file_object,
+			              &( buffer[ buffer_offset ] ),
+			              size - buffer_offset,
+			              error );
+		}
+		else
+		{
+			read_count = pybde_file_object_read_buffer(
+			              file_object_io_handle->file_object,
+			              &( buffer[ buffer_offset ] ),
+			              size - buffer_offset,
+			              error );
+		}
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from file object.",
+			 function );
+
+			return( -1 );
+		}
+		if( read_count == 0 )
+		{
+			break;
+		}
+		buffer_offset += (size_t) read_count;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
 /* Reads a buffer from the file object IO handle
+ * Data is read from the file object in blocks that are kept in a small block cache,
+ * so that small reads, such as those of individual sectors, do not each require
+ * a call into Python. Block aligned reads of at least the block size are read
+ * directly into the buffer. The GIL is only acquired when the file object is read.
  * Returns the number of bytes read if successful, or -1 on error
  */
 ssize_t pybde_file_object_io_handle_read(
@@ -622,9 +944,16 @@ ssize_t pybde_file_object_io_handle_read(
          size_t size,
          libcerror_error_t **error )
 {
+	uint8_t *block_data        = NULL;
 	static char *function      = "pybde_file_object_io_handle_read";
 	PyGILState_STATE gil_state = 0;
+	size_t block_data_offset   = 0;
+	size_t buffer_offset       = 0;
+	size_t read_size           = 0;
 	ssize_t read_count         = 0;
+	off64_t block_offset       = 0;
+	uint8_t has_gil_state      = 0;
+	int block_index            = 0;
 
 	if( file_object_io_handle == NULL )
 	{
@@ -637,34 +966,177 @@ ssize_t pybde_file_object_io_handle_read(
 
 		return( -1 );
 	}
-	gil_state = PyGILState_Ensure();
-
-	read_count = pybde_file_object_read_buffer(
-	              file_object_io_handle->file_object,
-	              buffer,
-	              size,
-	              error );
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
 
-	if( read_count == -1 )
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from file object.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	PyGILState_Release(
-	 gil_state );
+	while( buffer_offset < size )
+	{
+		block_offset      = ( file_object_io_handle->current_offset / PYBDE_FILE_OBJECT_IO_HANDLE_BLOCK_SIZE ) * PYBDE_FILE_OBJECT_IO_HANDLE_BLOCK_SIZE;
+		block_data_offset = (size_t) ( file_object_io_handle->current_offset - block_offset );
 
-	return( read_count );
+		if( ( block_data_offset == 0 )
+		 && ( ( size - buffer_offset ) >= PYBDE_FILE_OBJECT_IO_HANDLE_BLOCK_SIZE ) )
+		{
+			read_size = ( ( size - buffer_offset ) / PYBDE_FILE_OBJECT_IO_HANDLE_BLOCK_SIZE ) * PYBDE_FILE_OBJECT_IO_HANDLE_BLOCK_SIZE;
+
+			if( has_gil_state == 0 )
+			{
+				gil_state = PyGILState_Ensure();
+
+				has_gil_state = 1;
+			}
+			read_count = pybde_file_object_io_handle_read_buffer_at_offset(
+			              file_object_io_handle,
+			              file_object_io_handle->current_offset,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              error );
+
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read from file object.",
+				 function );
+
+				goto on_error;
+			}
+			buffer_offset                         += (size_t) read_count;
+			file_object_io_handle->current_offset += (off64_t) read_count;
+
+			if( (size_t) read_count < read_size )
+			{
+				break;
+			}
+			continue;
+		}
+		for( block_index = 0;
+		     block_index < PYBDE_FILE_OBJECT_IO_HANDLE_NUMBER_OF_BLOCKS;
+		     block_index++ )
+		{
+			if( file_object_io_handle->block_offsets[ block_index ] == block_offset )
+			{
+				break;
+			}
+		}
+		if( block_index >= PYBDE_FILE_OBJECT_IO_HANDLE_NUMBER_OF_BLOCKS )
+		{
+			if( file_object_io_handle->block_data == NULL )
+			{
+				file_object_io_handle->block_data = (uint8_t *) memory_allocate(
+				                                                 sizeof( uint8_t ) * PYBDE_FILE_OBJECT_IO_HANDLE_BLOCK_SIZE * PYBDE_FILE_OBJECT_IO_HANDLE_NUMBER_OF_BLOCKS );
+
+				if( file_object_io_handle->block_data == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create block data.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			block_index = file_object_io_handle->next_block_index;
+			block_data  = &( file_object_io_handle->block_data[ block_index * PYBDE_FILE_OBJECT_IO_HANDLE_BLOCK_SIZE ] );
+
+			file_object_io_handle->next_block_index = ( block_index + 1 ) % PYBDE_FILE_OBJECT_IO_HANDLE_NUMBER_OF_BLOCKS;
+
+			file_object_io_handle->block_offsets[ block_index ] = -1;
+
+			if( has_gil_state == 0 )
+			{
+				gil_state = PyGILState_Ensure();
+
+				has_gil_state = 1;
+			}
+			read_count = pybde_file_object_io_handle_read_buffer_at_offset(
+			              file_object_io_handle,
+			              block_offset,
+			              block_data,
+			              PYBDE_FILE_OBJECT_IO_HANDLE_BLOCK_SIZE,
+			              error );
+
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read block at offset: %" PRIi64 " (0x%08" PRIx64 ") from file object.",
+				 function,
+				 block_offset,
+				 block_offset );
+
+				goto on_error;
+			}
+			file_object_io_handle->block_offsets[ block_index ]    = block_offset;
+			file_object_io_handle->block_data_sizes[ block_index ] = (size_t) read_count;
+		}
+		if( block_data_offset >= file_object_io_handle->block_data_sizes[ block_index ] )
+		{
+			break;
+		}
+		read_size = file_object_io_handle->block_data_sizes[ block_index ] - block_data_offset;
 
-on_error:
-	PyGILState_Release(
-	 gil_state );
+		if( read_size > ( size - buffer_offset ) )
+		{
+			read_size = size - buffer_offset;
+		}
+		block_data = &( file_object_io_handle->block_data[ block_index * PYBDE_FILE_OBJECT_IO_HANDLE_BLOCK_SIZE ] );
+
+		if( memory_copy(
+		     &( buffer[ buffer_offset ] ),
+		     &( block_data[ block_data_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy block data to buffer.",
+			 function );
+
+			goto on_error;
+		}
+		buffer_offset                         += read_size;
+		file_object_io_handle->current_offset += (off64_t) read_size;
+	}
+	if( has_gil_state != 0 )
+	{
+		PyGILState_Release(
+		 gil_state );
+	}
+	return( (ssize_t) buffer_offset );
 
+on_error:
+	if( has_gil_state != 0 )
+	{
+		PyGILState_Release(
+		 gil_state );
+	}
 	return( -1 );
 }
 
@@ -810,6 +1282,7 @@ ssize_t pybde_file_object_io_handle_write(
 	static char *function      = "pybde_file_object_io_handle_write";
 	PyGILState_STATE gil_state = 0;
 	ssize_t write_count        = 0;
+	int block_index            = 0;
 
 	if( file_object_io_handle == NULL )
 	{
@@ -822,8 +1295,31 @@ ssize_t pybde_file_object_io_handle_write(
 
 		return( -1 );
 	}
+	/* The cached blocks are no longer valid after a write
+	 */
+	for( block_index = 0;
+	     block_index < PYBDE_FILE_OBJECT_IO_HANDLE_NUMBER_OF_BLOCKS;
+	     block_index++ )
+	{
+		file_object_io_handle->block_offsets[ block_index ] = -1;
+	}
 	gil_state = PyGILState_Ensure();
 
+	if( pybde_file_object_seek_offset(
+	     file_object_io_handle->file_object,
+	     file_object_io_handle->current_offset,
+	     SEEK_SET,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek current offset in file object.",
+		 function );
+
+		goto on_error;
+	}
 	write_count = pybde_file_object_write_buffer(
 	               file_object_io_handle->file_object,
 	               buffer,
@@ -841,6 +1337,8 @@ ssize_t pybde_file_object_io_handle_write(
 
 		goto on_error;
 	}
+	file_object_io_handle->current_offset += (off64_t) write_count;
+
 	PyGILState_Release(
 	 gil_state );
 
@@ -1130,6 +1628,8 @@ on_error:
 }
 
 /* Seeks a certain offset within the file object IO handle
+ * The file object itself is only seeked when it is read or written,
+ * so that seeking does not require a call into Python
  * Returns the offset if the seek is successful or -1 on error
  */
 off64_t pybde_file_object_io_handle_seek_offset(
@@ -1138,8 +1638,8 @@ off64_t pybde_file_object_io_handle_seek_offset(
          int whence,
          libcerror_error_t **error )
 {
-	static char *function      = "pybde_file_object_io_handle_seek_offset";
-	PyGILState_STATE gil_state = 0;
+	static char *function = "pybde_file_object_io_handle_seek_offset";
+	size64_t size         = 0;
 
 	if( file_object_io_handle == NULL )
 	{
@@ -1152,47 +1652,55 @@ off64_t pybde_file_object_io_handle_seek_offset(
 
 		return( -1 );
 	}
-	gil_state = PyGILState_Ensure();
-
-	if( pybde_file_object_seek_offset(
-	     file_object_io_handle->file_object,
-	     offset,
-	     whence,
-	     error ) != 1 )
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek in file object.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( pybde_file_object_get_offset(
-	     file_object_io_handle->file_object,
-	     &offset,
-	     error ) != 1 )
+	if( whence == SEEK_CUR )
+	{
+		offset += file_object_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		if( pybde_file_object_io_handle_get_size(
+		     file_object_io_handle,
+		     &size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of file object.",
+			 function );
+
+			return( -1 );
+		}
+		offset += (off64_t) size;
+	}
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to retrieve current offset in file object.",
+		 "%s: invalid offset value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	PyGILState_Release(
-	 gil_state );
+	file_object_io_handle->current_offset = offset;
 
 	return( offset );
-
-on_error:
-	PyGILState_Release(
-	 gil_state );
-
-	return( -1 );
 }
 
 /* Function to determine if a file exists
@@ -33,6 +33,14 @@
 extern "C" {
 #endif
 
+/* The size of the blocks read from the file object
+ */
+#define PYBDE_FILE_OBJECT_IO_HANDLE_BLOCK_SIZE		( 1024 * 1024 )
+
+/* The number of blocks in the block cache
+ */
+#define PYBDE_FILE_OBJECT_IO_HANDLE_NUMBER_OF_BLOCKS	8
+
 typedef struct pybde_file_object_io_handle pybde_file_object_io_handle_t;
 
 struct pybde_file_object_io_handle
@@ -44,6 +52,34 @@ struct pybde_file_object_io_handle
 	/* The access flags
 	 */
 	int access_flags;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* Value to indicate if the readinto method support was determined
+	 */
+	uint8_t readinto_support_determined;
+
+	/* Value to indicate the file object has a readinto method
+	 */
+	uint8_t has_readinto;
+
+	/* The block cache data
+	 */
+	uint8_t *block_data;
+
+	/* The offsets of the cached blocks, -1 if not set
+	 */
+	off64_t block_offsets[ PYBDE_FILE_OBJECT_IO_HANDLE_NUMBER_OF_BLOCKS ];
+
+	/* The sizes of the data of the cached blocks
+	 */
+	size_t block_data_sizes[ PYBDE_FILE_OBJECT_IO_HANDLE_NUMBER_OF_BLOCKS ];
+
+	/* The index of the next cached block to replace
+	 */
+	int next_block_index;
 };
 
 int pybde_file_object_io_handle_initialize(
@@ -80,6 +116,19 @@ ssize_t pybde_file_object_read_buffer(
          size_t size,
          libcerror_error_t **error );
 
+ssize_t pybde_file_object_readinto_buffer(
+         PyObject *file_object,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t pybde_file_object_io_handle_read_buffer_at_offset(
+         pybde_file_object_io_handle_t *file_object_io_handle,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
 ssize_t pybde_file_object_io_handle_read(
          pybde_file_object_io_handle_t *file_object_io_handle,
          uint8_t *buffer,
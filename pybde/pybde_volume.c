@@ -28,6 +28,7 @@
 #include <stdlib.h>
 #endif
 
+#include "pybde_chunks.h"
 #include "pybde_datetime.h"
 #include "pybde_error.h"
 #include "pybde_file_object_io_handle.h"
@@ -111,6 +112,36 @@ PyMethodDef pybde_volume_object_methods[] = {
 	  "\n"
 	  "Reads a buffer of unencrypted data at a specific offset." },
 
+	{ "read_buffer_into",
+	  (PyCFunction) pybde_volume_read_buffer_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffer_into(buffer) -> Integer\n"
+	  "\n"
+	  "Reads unencrypted data into a writable buffer object and returns the number of bytes read." },
+
+	{ "read_buffer_at_offset_into",
+	  (PyCFunction) pybde_volume_read_buffer_at_offset_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffer_at_offset_into(buffer, offset) -> Integer\n"
+	  "\n"
+	  "Reads unencrypted data at a specific offset into a writable buffer object and returns the number of bytes read." },
+
+	{ "read_buffers",
+	  (PyCFunction) pybde_volume_read_buffers,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffers(ranges, buffers=None, number_of_threads=4) -> List\n"
+	  "\n"
+	  "Reads unencrypted data for a sequence of (offset, size) tuples using multiple threads.\n"
+	  "Returns a list of bytes or, if buffers contains a writable buffer object for every range, a list of the number of bytes read." },
+
+	{ "iter_chunks",
+	  (PyCFunction) pybde_volume_iter_chunks,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "iter_chunks(chunk_size=1048576, start=0, end=None) -> Object\n"
+	  "\n"
+	  "Returns an iterator over chunks of unencrypted data from start up to end.\n"
+	  "The next chunk is read in the background while the current chunk is processed." },
+
 	{ "seek_offset",
 	  (PyCFunction) pybde_volume_seek_offset,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -132,6 +163,13 @@ PyMethodDef pybde_volume_object_methods[] = {
 	  "\n"
 	  "Reads a buffer of unencrypted data." },
 
+	{ "readinto",
+	  (PyCFunction) pybde_volume_read_buffer_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "readinto(buffer) -> Integer\n"
+	  "\n"
+	  "Reads unencrypted data into a writable buffer object and returns the number of bytes read." },
+
 	{ "seek",
 	  (PyCFunction) pybde_volume_seek_offset,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -160,6 +198,13 @@ PyMethodDef pybde_volume_object_methods[] = {
 	  "\n"
 	  "Retrieves the encryption method." },
 
+	{ "get_statistics",
+	  (PyCFunction) pybde_volume_get_statistics,
+	  METH_NOARGS,
+	  "get_statistics() -> Dictionary\n"
+	  "\n"
+	  "Retrieves the statistics, such as the number of cache hits and misses, the number of bytes read and decrypted and the time spent in nanoseconds." },
+
 	{ "get_volume_identifier",
 	  (PyCFunction) pybde_volume_get_volume_identifier,
 	  METH_NOARGS,
@@ -254,6 +299,12 @@ PyGetSetDef pybde_volume_object_get_set_definitions[] = {
 	  "The encryption method.",
 	  NULL },
 
+	{ "statistics",
+	  (getter) pybde_volume_get_statistics,
+	  (setter) 0,
+	  "The statistics.",
+	  NULL },
+
 	{ "identifier",
 	  (getter) pybde_volume_get_volume_identifier,
 	  (setter) 0,
@@ -1518,6 +1569,734 @@ PyObject *pybde_volume_read_buffer_at_offset(
 	return( string_object );
 }
 
+/* Reads data at the current offset into a writable buffer object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pybde_volume_read_buffer_into(
+           pybde_volume_t *pybde_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer_view;
+
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pybde_volume_read_buffer_into";
+	static char *keyword_list[] = { "buffer", NULL };
+	ssize_t read_count          = 0;
+
+	if( pybde_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "w*",
+	     keyword_list,
+	     &buffer_view ) == 0 )
+	{
+		return( NULL );
+	}
+	if( buffer_view.len > 0 )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		read_count = libbde_volume_read_buffer(
+		              pybde_volume->volume,
+		              (uint8_t *) buffer_view.buf,
+		              (size_t) buffer_view.len,
+		              &error );
+
+		Py_END_ALLOW_THREADS
+	}
+	PyBuffer_Release(
+	 &buffer_view );
+
+	if( read_count == -1 )
+	{
+		pybde_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( pybde_integer_signed_new_from_64bit(
+	         (int64_t) read_count ) );
+}
+
+/* Reads data at a specific offset into a writable buffer object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pybde_volume_read_buffer_at_offset_into(
+           pybde_volume_t *pybde_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer_view;
+
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pybde_volume_read_buffer_at_offset_into";
+	static char *keyword_list[] = { "buffer", "offset", NULL };
+	ssize_t read_count          = 0;
+	off64_t read_offset         = 0;
+
+	if( pybde_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "w*L",
+	     keyword_list,
+	     &buffer_view,
+	     &read_offset ) == 0 )
+	{
+		return( NULL );
+	}
+	if( read_offset < 0 )
+	{
+		PyBuffer_Release(
+		 &buffer_view );
+
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid read offset value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	if( buffer_view.len > 0 )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		read_count = libbde_volume_read_buffer_at_offset(
+		              pybde_volume->volume,
+		              (uint8_t *) buffer_view.buf,
+		              (size_t) buffer_view.len,
+		              (off64_t) read_offset,
+		              &error );
+
+		Py_END_ALLOW_THREADS
+	}
+	PyBuffer_Release(
+	 &buffer_view );
+
+	if( read_count == -1 )
+	{
+		pybde_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( pybde_integer_signed_new_from_64bit(
+	         (int64_t) read_count ) );
+}
+
+/* Reads data at multiple offsets
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pybde_volume_read_buffers(
+           pybde_volume_t *pybde_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *buffers_object       = NULL;
+	PyObject *buffers_sequence     = NULL;
+	PyObject *list_object          = NULL;
+	PyObject *range_object         = NULL;
+	PyObject *ranges_object        = NULL;
+	PyObject *ranges_sequence      = NULL;
+	PyObject *value_object         = NULL;
+	PyObject **string_objects      = NULL;
+	Py_buffer *buffer_views        = NULL;
+	libcerror_error_t *error       = NULL;
+	off64_t *offsets               = NULL;
+	size_t *buffer_sizes           = NULL;
+	ssize_t *read_counts           = NULL;
+	uint8_t **buffers              = NULL;
+	static char *function          = "pybde_volume_read_buffers";
+	static char *keyword_list[]    = { "ranges", "buffers", "number_of_threads", NULL };
+	Py_ssize_t number_of_ranges    = 0;
+	int64_t read_offset            = 0;
+	int64_t read_size              = 0;
+	int number_of_buffer_views     = 0;
+	int number_of_threads          = PYBDE_VOLUME_DEFAULT_NUMBER_OF_READ_THREADS;
+	int range_index                = 0;
+	int result                     = 0;
+
+	if( pybde_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O|Oi",
+	     keyword_list,
+	     &ranges_object,
+	     &buffers_object,
+	     &number_of_threads ) == 0 )
+	{
+		return( NULL );
+	}
+	if( number_of_threads < 1 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( NULL );
+	}
+	/* The file object IO handle cannot be cloned for concurrent reads
+	 */
+	if( pybde_volume->file_io_handle != NULL )
+	{
+		number_of_threads = 1;
+	}
+	if( buffers_object == Py_None )
+	{
+		buffers_object = NULL;
+	}
+	ranges_sequence = PySequence_Fast(
+	                   ranges_object,
+	                   "ranges must be a sequence of (offset, size) tuples" );
+
+	if( ranges_sequence == NULL )
+	{
+		goto on_error;
+	}
+	number_of_ranges = PySequence_Fast_GET_SIZE(
+	                    ranges_sequence );
+
+	if( number_of_ranges > (Py_ssize_t) INT_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of ranges value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	if( buffers_object != NULL )
+	{
+		buffers_sequence = PySequence_Fast(
+		                    buffers_object,
+		                    "buffers must be a sequence of writable buffer objects" );
+
+		if( buffers_sequence == NULL )
+		{
+			goto on_error;
+		}
+		if( PySequence_Fast_GET_SIZE( buffers_sequence ) != number_of_ranges )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: number of buffers does not match number of ranges.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( number_of_ranges > 0 )
+	{
+		buffers = (uint8_t **) PyMem_Malloc(
+		                        sizeof( uint8_t * ) * number_of_ranges );
+
+		buffer_sizes = (size_t *) PyMem_Malloc(
+		                           sizeof( size_t ) * number_of_ranges );
+
+		offsets = (off64_t *) PyMem_Malloc(
+		                       sizeof( off64_t ) * number_of_ranges );
+
+		read_counts = (ssize_t *) PyMem_Malloc(
+		                           sizeof( ssize_t ) * number_of_ranges );
+
+		if( buffers_sequence != NULL )
+		{
+			buffer_views = (Py_buffer *) PyMem_Malloc(
+			                              sizeof( Py_buffer ) * number_of_ranges );
+		}
+		else
+		{
+			string_objects = (PyObject **) PyMem_Malloc(
+			                                sizeof( PyObject * ) * number_of_ranges );
+		}
+		if( ( buffers == NULL )
+		 || ( buffer_sizes == NULL )
+		 || ( offsets == NULL )
+		 || ( read_counts == NULL )
+		 || ( ( buffers_sequence != NULL )
+		  &&  ( buffer_views == NULL ) )
+		 || ( ( buffers_sequence == NULL )
+		  &&  ( string_objects == NULL ) ) )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create buffers.",
+			 function );
+
+			goto on_error;
+		}
+		if( string_objects != NULL )
+		{
+			memory_set(
+			 string_objects,
+			 0,
+			 sizeof( PyObject * ) * number_of_ranges );
+		}
+	}
+	for( range_index = 0;
+	     range_index < (int) number_of_ranges;
+	     range_index++ )
+	{
+		range_object = PySequence_Fast_GET_ITEM(
+		                ranges_sequence,
+		                (Py_ssize_t) range_index );
+
+		if( PyArg_ParseTuple(
+		     range_object,
+		     "LL",
+		     &read_offset,
+		     &read_size ) == 0 )
+		{
+			goto on_error;
+		}
+		if( read_offset < 0 )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid range: %d offset value less than zero.",
+			 function,
+			 range_index );
+
+			goto on_error;
+		}
+		if( read_size < 0 )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid range: %d size value less than zero.",
+			 function,
+			 range_index );
+
+			goto on_error;
+		}
+		/* Make sure the data fits into a memory buffer
+		 */
+		if( ( read_size > (int64_t) INT_MAX )
+		 || ( read_size > (int64_t) SSIZE_MAX ) )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid range: %d size value exceeds maximum.",
+			 function,
+			 range_index );
+
+			goto on_error;
+		}
+		if( buffers_sequence != NULL )
+		{
+			if( PyObject_GetBuffer(
+			     PySequence_Fast_GET_ITEM(
+			      buffers_sequence,
+			      (Py_ssize_t) range_index ),
+			     &( buffer_views[ range_index ] ),
+			     PyBUF_WRITABLE ) != 0 )
+			{
+				goto on_error;
+			}
+			number_of_buffer_views++;
+
+			if( buffer_views[ range_index ].len < (Py_ssize_t) read_size )
+			{
+				PyErr_Format(
+				 PyExc_ValueError,
+				 "%s: invalid buffer: %d value too small.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+			buffers[ range_index ] = (uint8_t *) buffer_views[ range_index ].buf;
+		}
+		else
+		{
+#if PY_MAJOR_VERSION >= 3
+			string_objects[ range_index ] = PyBytes_FromStringAndSize(
+			                                 NULL,
+			                                 (Py_ssize_t) read_size );
+#else
+			string_objects[ range_index ] = PyString_FromStringAndSize(
+			                                 NULL,
+			                                 (Py_ssize_t) read_size );
+#endif
+			if( string_objects[ range_index ] == NULL )
+			{
+				goto on_error;
+			}
+#if PY_MAJOR_VERSION >= 3
+			buffers[ range_index ] = (uint8_t *) PyBytes_AsString(
+			                                      string_objects[ range_index ] );
+#else
+			buffers[ range_index ] = (uint8_t *) PyString_AsString(
+			                                      string_objects[ range_index ] );
+#endif
+		}
+		buffer_sizes[ range_index ] = (size_t) read_size;
+		offsets[ range_index ]      = (off64_t) read_offset;
+	}
+	if( number_of_ranges > 0 )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libbde_volume_read_buffers_at_offsets(
+		          pybde_volume->volume,
+		          buffers,
+		          buffer_sizes,
+		          offsets,
+		          read_counts,
+		          (int) number_of_ranges,
+		          number_of_threads,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pybde_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to read data.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+	}
+	list_object = PyList_New(
+	               number_of_ranges );
+
+	if( list_object == NULL )
+	{
+		goto on_error;
+	}
+	for( range_index = 0;
+	     range_index < (int) number_of_ranges;
+	     range_index++ )
+	{
+		if( string_objects != NULL )
+		{
+			/* Need to resize the string here in case the range was not fully read.
+			 */
+#if PY_MAJOR_VERSION >= 3
+			if( _PyBytes_Resize(
+			     &( string_objects[ range_index ] ),
+			     (Py_ssize_t) read_counts[ range_index ] ) != 0 )
+#else
+			if( _PyString_Resize(
+			     &( string_objects[ range_index ] ),
+			     (Py_ssize_t) read_counts[ range_index ] ) != 0 )
+#endif
+			{
+				goto on_error;
+			}
+			value_object = string_objects[ range_index ];
+
+			string_objects[ range_index ] = NULL;
+		}
+		else
+		{
+			value_object = pybde_integer_signed_new_from_64bit(
+			                (int64_t) read_counts[ range_index ] );
+
+			if( value_object == NULL )
+			{
+				goto on_error;
+			}
+		}
+		/* PyList_SET_ITEM steals the reference to value_object
+		 */
+		PyList_SET_ITEM(
+		 list_object,
+		 (Py_ssize_t) range_index,
+		 value_object );
+	}
+	if( buffer_views != NULL )
+	{
+		for( range_index = 0;
+		     range_index < number_of_buffer_views;
+		     range_index++ )
+		{
+			PyBuffer_Release(
+			 &( buffer_views[ range_index ] ) );
+		}
+		PyMem_Free(
+		 buffer_views );
+	}
+	if( string_objects != NULL )
+	{
+		PyMem_Free(
+		 string_objects );
+	}
+	if( read_counts != NULL )
+	{
+		PyMem_Free(
+		 read_counts );
+	}
+	if( offsets != NULL )
+	{
+		PyMem_Free(
+		 offsets );
+	}
+	if( buffer_sizes != NULL )
+	{
+		PyMem_Free(
+		 buffer_sizes );
+	}
+	if( buffers != NULL )
+	{
+		PyMem_Free(
+		 buffers );
+	}
+	if( buffers_sequence != NULL )
+	{
+		Py_DecRef(
+		 buffers_sequence );
+	}
+	Py_DecRef(
+	 ranges_sequence );
+
+	return( list_object );
+
+on_error:
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	if( buffer_views != NULL )
+	{
+		for( range_index = 0;
+		     range_index < number_of_buffer_views;
+		     range_index++ )
+		{
+			PyBuffer_Release(
+			 &( buffer_views[ range_index ] ) );
+		}
+		PyMem_Free(
+		 buffer_views );
+	}
+	if( string_objects != NULL )
+	{
+		for( range_index = 0;
+		     range_index < (int) number_of_ranges;
+		     range_index++ )
+		{
+			if( string_objects[ range_index ] != NULL )
+			{
+				Py_DecRef(
+				 string_objects[ range_index ] );
+			}
+		}
+		PyMem_Free(
+		 string_objects );
+	}
+	if( read_counts != NULL )
+	{
+		PyMem_Free(
+		 read_counts );
+	}
+	if( offsets != NULL )
+	{
+		PyMem_Free(
+		 offsets );
+	}
+	if( buffer_sizes != NULL )
+	{
+		PyMem_Free(
+		 buffer_sizes );
+	}
+	if( buffers != NULL )
+	{
+		PyMem_Free(
+		 buffers );
+	}
+	if( buffers_sequence != NULL )
+	{
+		Py_DecRef(
+		 buffers_sequence );
+	}
+	if( ranges_sequence != NULL )
+	{
+		Py_DecRef(
+		 ranges_sequence );
+	}
+	return( NULL );
+}
+
+/* Creates an iterator over chunks of the unencrypted data
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pybde_volume_iter_chunks(
+           pybde_volume_t *pybde_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *end_offset_object = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pybde_volume_iter_chunks";
+	static char *keyword_list[] = { "chunk_size", "start", "end", NULL };
+	Py_ssize_t chunk_size       = PYBDE_CHUNKS_DEFAULT_CHUNK_SIZE;
+	size64_t size               = 0;
+	off64_t end_offset          = 0;
+	off64_t start_offset        = 0;
+	int64_t integer_value       = 0;
+	int result                  = 0;
+
+	if( pybde_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|nLO",
+	     keyword_list,
+	     &chunk_size,
+	     &start_offset,
+	     &end_offset_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( chunk_size <= 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid chunk size value zero or less.",
+		 function );
+
+		return( NULL );
+	}
+	/* Make sure the data fits into a memory buffer
+	 */
+	if( ( (int64_t) chunk_size > (int64_t) INT_MAX )
+	 || ( (int64_t) chunk_size > (int64_t) SSIZE_MAX ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid chunk size value exceeds maximum.",
+		 function );
+
+		return( NULL );
+	}
+	if( start_offset < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid start offset value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libbde_volume_get_size(
+	          pybde_volume->volume,
+	          &size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pybde_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: failed to retrieve size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	end_offset = (off64_t) size;
+
+	if( ( end_offset_object != NULL )
+	 && ( end_offset_object != Py_None ) )
+	{
+		if( pybde_integer_signed_copy_to_64bit(
+		     end_offset_object,
+		     &integer_value,
+		     &error ) != 1 )
+		{
+			pybde_error_raise(
+			 error,
+			 PyExc_ValueError,
+			 "%s: unable to convert end offset object into end offset.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+		if( integer_value < 0 )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid end offset value less than zero.",
+			 function );
+
+			return( NULL );
+		}
+		if( integer_value < (int64_t) end_offset )
+		{
+			end_offset = (off64_t) integer_value;
+		}
+	}
+	return( pybde_chunks_new(
+	         pybde_volume,
+	         (size_t) chunk_size,
+	         start_offset,
+	         end_offset ) );
+}
+
 /* Seeks a certain offset
  * Returns a Python object if successful or NULL on error
  */
@@ -1740,6 +2519,128 @@ PyObject *pybde_volume_get_encryption_method(
 	return( integer_object );
 }
 
+/* Retrieves the statistics
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pybde_volume_get_statistics(
+           pybde_volume_t *pybde_volume,
+           PyObject *arguments PYBDE_ATTRIBUTE_UNUSED )
+{
+	uint64_t values[ LIBBDE_NUMBER_OF_STATISTICS_VALUES ];
+
+	const char *value_names[ LIBBDE_NUMBER_OF_STATISTICS_VALUES ] = {
+		"number_of_read_calls",
+		"number_of_cache_hits",
+		"number_of_cache_misses",
+		"number_of_bytes_read",
+		"number_of_bytes_decrypted",
+		"read_time",
+		"decryption_time",
+		"unlock_time",
+		"number_of_block_cache_hits",
+		"number_of_block_cache_misses",
+		"number_of_bytes_decrypted_aes_cbc",
+		"number_of_bytes_decrypted_aes_cbc_diffuser",
+		"number_of_bytes_decrypted_aes_xts",
+		"number_of_warmup_bytes" };
+
+	PyObject *dictionary_object = NULL;
+	PyObject *integer_object    = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pybde_volume_get_statistics";
+	int result                  = 0;
+	int value_index             = 0;
+
+	PYBDE_UNREFERENCED_PARAMETER( arguments )
+
+	if( pybde_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libbde_volume_get_statistics(
+	          pybde_volume->volume,
+	          values,
+	          LIBBDE_NUMBER_OF_STATISTICS_VALUES,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pybde_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	dictionary_object = PyDict_New();
+
+	if( dictionary_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create dictionary object.",
+		 function );
+
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < LIBBDE_NUMBER_OF_STATISTICS_VALUES;
+	     value_index++ )
+	{
+		integer_object = pybde_integer_unsigned_new_from_64bit(
+		                  values[ value_index ] );
+
+		if( integer_object == NULL )
+		{
+			goto on_error;
+		}
+		if( PyDict_SetItemString(
+		     dictionary_object,
+		     value_names[ value_index ],
+		     integer_object ) != 0 )
+		{
+			PyErr_Format(
+			 PyExc_RuntimeError,
+			 "%s: unable to set statistics value: %s.",
+			 function,
+			 value_names[ value_index ] );
+
+			goto on_error;
+		}
+		Py_DecRef(
+		 integer_object );
+
+		integer_object = NULL;
+	}
+	return( dictionary_object );
+
+on_error:
+	if( integer_object != NULL )
+	{
+		Py_DecRef(
+		 integer_object );
+	}
+	if( dictionary_object != NULL )
+	{
+		Py_DecRef(
+		 dictionary_object );
+	}
+	return( NULL );
+}
+
 /* Retrieves the volume identifier
  * Returns a Python object if successful or NULL on error
  */
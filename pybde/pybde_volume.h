@@ -33,6 +33,10 @@
 extern "C" {
 #endif
 
+/* The default number of threads used by read_buffers
+ */
+#define PYBDE_VOLUME_DEFAULT_NUMBER_OF_READ_THREADS	4
+
 typedef struct pybde_volume pybde_volume_t;
 
 struct pybde_volume
@@ -95,6 +99,26 @@ PyObject *pybde_volume_read_buffer_at_offset(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pybde_volume_read_buffer_into(
+           pybde_volume_t *pybde_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pybde_volume_read_buffer_at_offset_into(
+           pybde_volume_t *pybde_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pybde_volume_read_buffers(
+           pybde_volume_t *pybde_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pybde_volume_iter_chunks(
+           pybde_volume_t *pybde_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pybde_volume_seek_offset(
            pybde_volume_t *pybde_volume,
            PyObject *arguments,
@@ -112,6 +136,10 @@ PyObject *pybde_volume_get_encryption_method(
            pybde_volume_t *pybde_volume,
            PyObject *arguments );
 
+PyObject *pybde_volume_get_statistics(
+           pybde_volume_t *pybde_volume,
+           PyObject *arguments );
+
 PyObject *pybde_volume_get_volume_identifier(
            pybde_volume_t *pybde_volume,
            PyObject *arguments );
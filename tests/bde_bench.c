@@ -0,0 +1,1169 @@
+/*
+ * Library read throughput and unlock latency benchmark program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bde_test_functions.h"
+#include "bde_test_getopt.h"
+#include "bde_test_libbde.h"
+#include "bde_test_libbfio.h"
+#include "bde_test_libcerror.h"
+#include "bde_test_unused.h"
+
+#include "../libbde/libbde_definitions.h"
+#include "../libbde/libbde_diffuser.h"
+#include "../libbde/libbde_encryption_context.h"
+#include "../libbde/libbde_statistics.h"
+
+/* The benchmark writes one JSON object per line to stdout, e.g.
+ * {"benchmark": "read", "pattern": "random", "method": "aes_128_xts", "block_size": 4096, ...}
+ * so that results of different releases can be compared by a script
+ */
+
+#define BDE_BENCH_DEFAULT_DATA_SIZE		( 64 * 1024 * 1024 )
+#define BDE_BENCH_MAXIMUM_BLOCK_SIZE		( 1024 * 1024 )
+
+#if !defined( LIBBDE_HAVE_BFIO )
+
+LIBBDE_EXTERN \
+int libbde_volume_open_file_io_handle(
+     libbde_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libbde_error_t **error );
+
+#endif /* !defined( LIBBDE_HAVE_BFIO ) */
+
+#if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
+
+/* The block sizes used by the benchmarks
+ */
+size_t bde_bench_block_sizes[ 4 ] = {
+	512,
+	4096,
+	65536,
+	BDE_BENCH_MAXIMUM_BLOCK_SIZE };
+
+/* The encryption methods used by the crypt benchmarks
+ */
+uint16_t bde_bench_encryption_methods[ 6 ] = {
+	LIBBDE_ENCRYPTION_METHOD_AES_128_CBC_DIFFUSER,
+	LIBBDE_ENCRYPTION_METHOD_AES_256_CBC_DIFFUSER,
+	LIBBDE_ENCRYPTION_METHOD_AES_128_CBC,
+	LIBBDE_ENCRYPTION_METHOD_AES_256_CBC,
+	LIBBDE_ENCRYPTION_METHOD_AES_128_XTS,
+	LIBBDE_ENCRYPTION_METHOD_AES_256_XTS };
+
+/* Retrieves a string representation of an encryption method
+ */
+const char *bde_bench_get_encryption_method_name(
+             uint32_t encryption_method )
+{
+	switch( encryption_method )
+	{
+		case LIBBDE_ENCRYPTION_METHOD_NONE:
+			return( "none" );
+
+		case LIBBDE_ENCRYPTION_METHOD_AES_128_CBC_DIFFUSER:
+			return( "aes_128_cbc_diffuser" );
+
+		case LIBBDE_ENCRYPTION_METHOD_AES_256_CBC_DIFFUSER:
+			return( "aes_256_cbc_diffuser" );
+
+		case LIBBDE_ENCRYPTION_METHOD_AES_128_CBC:
+			return( "aes_128_cbc" );
+
+		case LIBBDE_ENCRYPTION_METHOD_AES_256_CBC:
+			return( "aes_256_cbc" );
+
+		case LIBBDE_ENCRYPTION_METHOD_AES_128_XTS:
+			return( "aes_128_xts" );
+
+		case LIBBDE_ENCRYPTION_METHOD_AES_256_XTS:
+			return( "aes_256_xts" );
+
+		default:
+			break;
+	}
+	return( "unknown" );
+}
+
+/* Determines the throughput in megabytes (1024 * 1024 bytes) per second
+ */
+double bde_bench_get_megabytes_per_second(
+        uint64_t number_of_bytes,
+        uint64_t elapsed_time )
+{
+	if( elapsed_time == 0 )
+	{
+		return( 0.0 );
+	}
+	return( ( (double) number_of_bytes * 1000000000.0 ) / ( (double) elapsed_time * 1024.0 * 1024.0 ) );
+}
+
+/* Benchmarks libbde_encryption_context_crypt
+ * Returns 1 if successful or -1 on error
+ */
+int bde_bench_encryption_context_crypt(
+     uint16_t encryption_method,
+     size_t block_size,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t key_data[ 64 ];
+	uint8_t tweak_key_data[ 32 ];
+
+	libbde_encryption_context_t *encryption_context = NULL;
+	uint8_t *input_data                             = NULL;
+	uint8_t *output_data                            = NULL;
+	static char *function                           = "bde_bench_encryption_context_crypt";
+	size64_t number_of_bytes                        = 0;
+	size_t data_index                               = 0;
+	uint64_t block_key                              = 0;
+	uint64_t end_time                               = 0;
+	uint64_t start_time                             = 0;
+
+	for( data_index = 0;
+	     data_index < 64;
+	     data_index++ )
+	{
+		key_data[ data_index ] = (uint8_t) data_index;
+	}
+	for( data_index = 0;
+	     data_index < 32;
+	     data_index++ )
+	{
+		tweak_key_data[ data_index ] = (uint8_t) ( 0xff - data_index );
+	}
+	input_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * block_size );
+
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create input data.",
+		 function );
+
+		goto on_error;
+	}
+	output_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * block_size );
+
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create output data.",
+		 function );
+
+		goto on_error;
+	}
+	for( data_index = 0;
+	     data_index < block_size;
+	     data_index++ )
+	{
+		input_data[ data_index ] = (uint8_t) ( data_index * 7 );
+	}
+	if( libbde_encryption_context_initialize(
+	     &encryption_context,
+	     encryption_method,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize encryption context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbde_encryption_context_set_keys(
+	     encryption_context,
+	     key_data,
+	     64,
+	     tweak_key_data,
+	     32,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set keys in encryption context.",
+		 function );
+
+		goto on_error;
+	}
+	start_time = libbde_statistics_get_timestamp();
+
+	while( number_of_bytes < data_size )
+	{
+		if( libbde_encryption_context_crypt(
+		     encryption_context,
+		     LIBBDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+		     input_data,
+		     block_size,
+		     output_data,
+		     block_size,
+		     block_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+			 "%s: unable to decrypt data.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_bytes += block_size;
+		block_key       += 1;
+	}
+	end_time = libbde_statistics_get_timestamp();
+
+	fprintf(
+	 stdout,
+	 "{\"benchmark\": \"crypt\", \"method\": \"%s\", \"mode\": \"decrypt\", \"block_size\": %" PRIzd ", \"bytes\": %" PRIu64 ", \"nanoseconds\": %" PRIu64 ", \"megabytes_per_second\": %.2f}\n",
+	 bde_bench_get_encryption_method_name(
+	  (uint32_t) encryption_method ),
+	 block_size,
+	 number_of_bytes,
+	 end_time - start_time,
+	 bde_bench_get_megabytes_per_second(
+	  number_of_bytes,
+	  end_time - start_time ) );
+
+	if( libbde_encryption_context_free(
+	     &encryption_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free encryption context.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 output_data );
+
+	memory_free(
+	 input_data );
+
+	return( 1 );
+
+on_error:
+	if( encryption_context != NULL )
+	{
+		libbde_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	if( output_data != NULL )
+	{
+		memory_free(
+		 output_data );
+	}
+	if( input_data != NULL )
+	{
+		memory_free(
+		 input_data );
+	}
+	return( -1 );
+}
+
+/* Benchmarks the Elephant diffuser
+ * Returns 1 if successful or -1 on error
+ */
+int bde_bench_diffuser(
+     int mode,
+     size_t block_size,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *data            = NULL;
+	static char *function    = "bde_bench_diffuser";
+	size64_t number_of_bytes = 0;
+	size_t data_index        = 0;
+	uint64_t end_time        = 0;
+	uint64_t start_time      = 0;
+	int result               = 0;
+
+	if( ( mode != LIBBDE_ENCRYPTION_CRYPT_MODE_DECRYPT )
+	 && ( mode != LIBBDE_ENCRYPTION_CRYPT_MODE_ENCRYPT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * block_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	for( data_index = 0;
+	     data_index < block_size;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) ( data_index * 7 );
+	}
+	start_time = libbde_statistics_get_timestamp();
+
+	while( number_of_bytes < data_size )
+	{
+		if( mode == LIBBDE_ENCRYPTION_CRYPT_MODE_ENCRYPT )
+		{
+			result = libbde_diffuser_encrypt(
+			          data,
+			          block_size,
+			          error );
+		}
+		else
+		{
+			result = libbde_diffuser_decrypt(
+			          data,
+			          block_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to process data using Diffuser.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_bytes += block_size;
+	}
+	end_time = libbde_statistics_get_timestamp();
+
+	fprintf(
+	 stdout,
+	 "{\"benchmark\": \"diffuser\", \"mode\": \"%s\", \"block_size\": %" PRIzd ", \"bytes\": %" PRIu64 ", \"nanoseconds\": %" PRIu64 ", \"megabytes_per_second\": %.2f}\n",
+	 ( mode == LIBBDE_ENCRYPTION_CRYPT_MODE_ENCRYPT ) ? "encrypt" : "decrypt",
+	 block_size,
+	 number_of_bytes,
+	 end_time - start_time,
+	 bde_bench_get_megabytes_per_second(
+	  number_of_bytes,
+	  end_time - start_time ) );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Opens a source volume and reports the unlock time
+ * Returns 1 if successful or -1 on error
+ */
+int bde_bench_volume_open(
+     libbde_volume_t **volume,
+     libbfio_handle_t *file_io_handle,
+     const system_character_t *password,
+     const system_character_t *recovery_password,
+     const system_character_t *startup_key,
+     libcerror_error_t **error )
+{
+	uint64_t values[ LIBBDE_NUMBER_OF_STATISTICS_VALUES ];
+
+	const char *protector_name = "none";
+	static char *function      = "bde_bench_volume_open";
+	size_t string_length       = 0;
+	uint64_t end_time          = 0;
+	uint64_t start_time        = 0;
+	int is_locked              = 0;
+	int result                 = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbde_volume_initialize(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( password != NULL )
+	{
+		protector_name = "password";
+
+		string_length = system_string_length(
+		                 password );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbde_volume_set_utf16_password(
+		          *volume,
+		          (uint16_t *) password,
+		          string_length,
+		          error );
+#else
+		result = libbde_volume_set_utf8_password(
+		          *volume,
+		          (uint8_t *) password,
+		          string_length,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set password.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( recovery_password != NULL )
+	{
+		protector_name = "recovery_password";
+
+		string_length = system_string_length(
+		                 recovery_password );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbde_volume_set_utf16_recovery_password(
+		          *volume,
+		          (uint16_t *) recovery_password,
+		          string_length,
+		          error );
+#else
+		result = libbde_volume_set_utf8_recovery_password(
+		          *volume,
+		          (uint8_t *) recovery_password,
+		          string_length,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set recovery password.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( startup_key != NULL )
+	{
+		protector_name = "startup_key";
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbde_volume_read_startup_key_wide(
+		          *volume,
+		          startup_key,
+		          error );
+#else
+		result = libbde_volume_read_startup_key(
+		          *volume,
+		          startup_key,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read startup key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	start_time = libbde_statistics_get_timestamp();
+
+	if( libbde_volume_open_file_io_handle(
+	     *volume,
+	     file_io_handle,
+	     LIBBDE_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	end_time = libbde_statistics_get_timestamp();
+
+	is_locked = libbde_volume_is_locked(
+	             *volume,
+	             error );
+
+	if( is_locked == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if volume is locked.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbde_volume_get_statistics(
+	     *volume,
+	     values,
+	     LIBBDE_NUMBER_OF_STATISTICS_VALUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "{\"benchmark\": \"unlock\", \"protector\": \"%s\", \"locked\": %s, \"open_nanoseconds\": %" PRIu64 ", \"unlock_nanoseconds\": %" PRIu64 "}\n",
+	 protector_name,
+	 ( is_locked != 0 ) ? "true" : "false",
+	 end_time - start_time,
+	 values[ LIBBDE_STATISTICS_VALUE_UNLOCK_TIME ] );
+
+	return( 1 );
+
+on_error:
+	if( *volume != NULL )
+	{
+		libbde_volume_free(
+		 volume,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Benchmarks libbde_volume_read_buffer_at_offset
+ * Returns 1 if successful, 0 if the volume is too small or -1 on error
+ */
+int bde_bench_volume_read(
+     libbde_volume_t *volume,
+     int random_access,
+     size_t block_size,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	uint64_t values_after[ LIBBDE_NUMBER_OF_STATISTICS_VALUES ];
+	uint64_t values_before[ LIBBDE_NUMBER_OF_STATISTICS_VALUES ];
+
+	uint8_t *buffer            = NULL;
+	static char *function      = "bde_bench_volume_read";
+	size64_t number_of_bytes   = 0;
+	size64_t volume_size       = 0;
+	ssize_t read_count         = 0;
+	off64_t offset             = 0;
+	uint64_t cache_hits        = 0;
+	uint64_t cache_misses      = 0;
+	uint64_t end_time          = 0;
+	uint64_t number_of_blocks  = 0;
+	uint64_t random_value      = 0x2545f4914f6cdd1dUL;
+	uint64_t start_time        = 0;
+	uint16_t encryption_method = 0;
+
+	if( libbde_volume_get_size(
+	     volume,
+	     &volume_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume size.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_size < (size64_t) block_size )
+	{
+		return( 0 );
+	}
+	if( libbde_volume_get_encryption_method(
+	     volume,
+	     &encryption_method,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve encryption method.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_blocks = volume_size / block_size;
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * block_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbde_volume_get_statistics(
+	     volume,
+	     values_before,
+	     LIBBDE_NUMBER_OF_STATISTICS_VALUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		goto on_error;
+	}
+	start_time = libbde_statistics_get_timestamp();
+
+	while( number_of_bytes < data_size )
+	{
+		if( random_access != 0 )
+		{
+			/* Use a fixed xorshift sequence so that runs are comparable
+			 */
+			random_value ^= random_value << 13;
+			random_value ^= random_value >> 7;
+			random_value ^= random_value << 17;
+
+			offset = (off64_t) ( ( random_value % number_of_blocks ) * block_size );
+		}
+		else if( (size64_t) offset >= ( number_of_blocks * block_size ) )
+		{
+			offset = 0;
+		}
+		read_count = libbde_volume_read_buffer_at_offset(
+		              volume,
+		              buffer,
+		              block_size,
+		              offset,
+		              error );
+
+		if( read_count != (ssize_t) block_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			goto on_error;
+		}
+		number_of_bytes += block_size;
+
+		if( random_access == 0 )
+		{
+			offset += block_size;
+		}
+	}
+	end_time = libbde_statistics_get_timestamp();
+
+	if( libbde_volume_get_statistics(
+	     volume,
+	     values_after,
+	     LIBBDE_NUMBER_OF_STATISTICS_VALUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		goto on_error;
+	}
+	cache_hits   = values_after[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_CACHE_HITS ] - values_before[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_CACHE_HITS ];
+	cache_misses = values_after[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_CACHE_MISSES ] - values_before[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_CACHE_MISSES ];
+
+	fprintf(
+	 stdout,
+	 "{\"benchmark\": \"read\", \"pattern\": \"%s\", \"method\": \"%s\", \"block_size\": %" PRIzd ", \"bytes\": %" PRIu64 ", \"nanoseconds\": %" PRIu64 ", \"megabytes_per_second\": %.2f, \"cache_hits\": %" PRIu64 ", \"cache_misses\": %" PRIu64 ", \"cache_hit_ratio\": %.4f}\n",
+	 ( random_access != 0 ) ? "random" : "sequential",
+	 bde_bench_get_encryption_method_name(
+	  (uint32_t) encryption_method ),
+	 block_size,
+	 number_of_bytes,
+	 end_time - start_time,
+	 bde_bench_get_megabytes_per_second(
+	  number_of_bytes,
+	  end_time - start_time ),
+	 cache_hits,
+	 cache_misses,
+	 ( ( cache_hits + cache_misses ) == 0 ) ? 0.0 : ( (double) cache_hits / (double) ( cache_hits + cache_misses ) ) );
+
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
+
+/* Prints usage information
+ */
+void bde_bench_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use bde_bench to measure the read throughput and unlock latency of libbde.\n\n" );
+
+	fprintf( stream, "Usage: bde_bench [ -n megabytes ] [ -o offset ] [ -p password ]\n"
+	                 "                 [ -r recovery_password ] [ -s startup_key_path ]\n"
+	                 "                 [ -h ] [ source ]\n\n" );
+
+	fprintf( stream, "\tsource: the source volume, if not provided only the crypt and\n"
+	                 "\t        diffuser benchmarks are run\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-n:     number of megabytes to process per benchmark, default is 64\n" );
+	fprintf( stream, "\t-o:     specify the volume offset in bytes\n" );
+	fprintf( stream, "\t-p:     specify the password (or passphrase)\n" );
+	fprintf( stream, "\t-r:     specify the recovery password (or passphrase)\n" );
+	fprintf( stream, "\t-s:     specify the file containing the startup key.\n" );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
+	libbde_volume_t *volume                        = NULL;
+	libbfio_handle_t *file_io_handle               = NULL;
+	libcerror_error_t *error                       = NULL;
+	size64_t data_size                             = BDE_BENCH_DEFAULT_DATA_SIZE;
+	size_t block_size_index                        = 0;
+	size_t method_index                            = 0;
+	size_t string_length                           = 0;
+	off64_t volume_offset                          = 0;
+	uint64_t number_of_megabytes                   = 0;
+	int random_access                              = 0;
+#endif
+	system_character_t *option_number_of_megabytes = NULL;
+	system_character_t *option_offset              = NULL;
+	system_character_t *option_password            = NULL;
+	system_character_t *option_recovery_password   = NULL;
+	system_character_t *option_startup_key         = NULL;
+	system_character_t *source                     = NULL;
+	system_integer_t option                        = 0;
+
+	while( ( option = bde_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hn:o:p:r:s:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				bde_bench_usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				bde_bench_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'n':
+				option_number_of_megabytes = optarg;
+
+				break;
+
+			case (system_integer_t) 'o':
+				option_offset = optarg;
+
+				break;
+
+			case (system_integer_t) 'p':
+				option_password = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				option_recovery_password = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_startup_key = optarg;
+
+				break;
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+#if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
+	if( option_number_of_megabytes != NULL )
+	{
+		string_length = system_string_length(
+		                 option_number_of_megabytes );
+
+		if( bde_test_system_string_copy_from_64_bit_in_decimal(
+		     option_number_of_megabytes,
+		     string_length + 1,
+		     &number_of_megabytes,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine number of megabytes.\n" );
+
+			goto on_error;
+		}
+		if( ( number_of_megabytes == 0 )
+		 || ( number_of_megabytes > ( (uint64_t) INT64_MAX / ( 1024 * 1024 ) ) ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of megabytes.\n" );
+
+			goto on_error;
+		}
+		data_size = (size64_t) number_of_megabytes * 1024 * 1024;
+	}
+	if( option_offset != NULL )
+	{
+		string_length = system_string_length(
+		                 option_offset );
+
+		if( bde_test_system_string_copy_from_64_bit_in_decimal(
+		     option_offset,
+		     string_length + 1,
+		     (uint64_t *) &volume_offset,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine volume offset.\n" );
+
+			goto on_error;
+		}
+	}
+	for( method_index = 0;
+	     method_index < 6;
+	     method_index++ )
+	{
+		for( block_size_index = 0;
+		     block_size_index < 4;
+		     block_size_index++ )
+		{
+			if( bde_bench_encryption_context_crypt(
+			     bde_bench_encryption_methods[ method_index ],
+			     bde_bench_block_sizes[ block_size_index ],
+			     data_size,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to run crypt benchmark.\n" );
+
+				goto on_error;
+			}
+		}
+	}
+	for( block_size_index = 0;
+	     block_size_index < 4;
+	     block_size_index++ )
+	{
+		if( bde_bench_diffuser(
+		     LIBBDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+		     bde_bench_block_sizes[ block_size_index ],
+		     data_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run diffuser benchmark.\n" );
+
+			goto on_error;
+		}
+		if( bde_bench_diffuser(
+		     LIBBDE_ENCRYPTION_CRYPT_MODE_ENCRYPT,
+		     bde_bench_block_sizes[ block_size_index ],
+		     data_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run diffuser benchmark.\n" );
+
+			goto on_error;
+		}
+	}
+	if( source != NULL )
+	{
+		if( libbfio_file_range_initialize(
+		     &file_io_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize file IO handle.\n" );
+
+			goto on_error;
+		}
+		string_length = system_string_length(
+		                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libbfio_file_range_set_name_wide(
+		     file_io_handle,
+		     source,
+		     string_length,
+		     &error ) != 1 )
+#else
+		if( libbfio_file_range_set_name(
+		     file_io_handle,
+		     source,
+		     string_length,
+		     &error ) != 1 )
+#endif
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set file IO handle name.\n" );
+
+			goto on_error;
+		}
+		if( libbfio_file_range_set(
+		     file_io_handle,
+		     volume_offset,
+		     0,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set file IO handle range.\n" );
+
+			goto on_error;
+		}
+		if( bde_bench_volume_open(
+		     &volume,
+		     file_io_handle,
+		     option_password,
+		     option_recovery_password,
+		     option_startup_key,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open source volume.\n" );
+
+			goto on_error;
+		}
+		for( random_access = 0;
+		     random_access < 2;
+		     random_access++ )
+		{
+			for( block_size_index = 0;
+			     block_size_index < 4;
+			     block_size_index++ )
+			{
+				if( bde_bench_volume_read(
+				     volume,
+				     random_access,
+				     bde_bench_block_sizes[ block_size_index ],
+				     data_size,
+				     &error ) == -1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to run read benchmark.\n" );
+
+					goto on_error;
+				}
+			}
+		}
+		if( libbde_volume_close(
+		     volume,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close volume.\n" );
+
+			goto on_error;
+		}
+		if( libbde_volume_free(
+		     &volume,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free volume.\n" );
+
+			goto on_error;
+		}
+		if( libbfio_handle_free(
+		     &file_io_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free file IO handle.\n" );
+
+			goto on_error;
+		}
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libbde_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+
+#else
+	fprintf(
+	 stderr,
+	 "Benchmarks require access to the internal library functions.\n" );
+
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,2302 @@
+/*
+ * Synthetic BitLocker volume generator program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bde_test_functions.h"
+#include "bde_test_getopt.h"
+#include "bde_test_libbde.h"
+#include "bde_test_libbfio.h"
+#include "bde_test_libcerror.h"
+#include "bde_test_unused.h"
+
+#include "../libbde/bde_metadata.h"
+#include "../libbde/bde_volume.h"
+#include "../libbde/libbde_definitions.h"
+#include "../libbde/libbde_encryption_context.h"
+#include "../libbde/libbde_io_handle.h"
+#include "../libbde/libbde_libcaes.h"
+#include "../libbde/libbde_password.h"
+#include "../libbde/libbde_recovery.h"
+
+/* The generator writes a BitLocker volume image that can be opened by libbde
+ * and by Windows. The image is reproducible: all keys, salts, nonces and
+ * identifiers are derived from the seed. Sectors that contain no data
+ * are not written, hence the image is sparse on file systems that support it.
+ *
+ * The plain text of every used sector starts with its 64-bit logical offset
+ * followed by the seed, so that the decrypted data can be verified.
+ */
+
+#define BDE_GENERATE_DEFAULT_VOLUME_SIZE	( 64 * 1024 * 1024 )
+#define BDE_GENERATE_MINIMUM_VOLUME_SIZE	( 4 * 1024 * 1024 )
+
+/* The creation date and time of the generated volumes
+ * Contains a FILETIME of Jan 1, 2020 00:00:00 UTC
+ */
+#define BDE_GENERATE_CREATION_TIME		0x01d5c03669a5c000ULL
+
+#if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
+
+typedef struct bde_generate_volume bde_generate_volume_t;
+
+struct bde_generate_volume
+{
+	/* The format version (layout)
+	 */
+	int version;
+
+	/* The encryption method
+	 */
+	uint16_t encryption_method;
+
+	/* The number of bytes per sector
+	 */
+	uint16_t bytes_per_sector;
+
+	/* The number of sectors per cluster block
+	 */
+	uint8_t sectors_per_cluster_block;
+
+	/* The volume size
+	 */
+	size64_t volume_size;
+
+	/* The encrypted volume size
+	 */
+	size64_t encrypted_volume_size;
+
+	/* The used data size
+	 */
+	size64_t used_data_size;
+
+	/* The metadata offsets
+	 */
+	off64_t metadata_offsets[ 3 ];
+
+	/* The metadata size
+	 */
+	size64_t metadata_size;
+
+	/* The (relocated) volume header offset
+	 */
+	off64_t volume_header_offset;
+
+	/* The (relocated) volume header size
+	 */
+	size64_t volume_header_size;
+
+	/* The MFT cluster block number
+	 */
+	uint64_t mft_cluster_block_number;
+
+	/* The MFT mirror cluster block number
+	 */
+	uint64_t mft_mirror_cluster_block_number;
+
+	/* The volume identifier
+	 */
+	uint8_t volume_identifier[ 16 ];
+
+	/* The full volume encryption key
+	 */
+	uint8_t full_volume_encryption_key[ 64 ];
+
+	/* The tweak key
+	 */
+	uint8_t tweak_key[ 32 ];
+
+	/* The volume master key
+	 */
+	uint8_t volume_master_key[ 32 ];
+
+	/* The seed
+	 */
+	uint64_t seed;
+
+	/* The pseudo random number generator state
+	 */
+	uint64_t random_state;
+
+	/* The next nonce counter
+	 */
+	uint32_t nonce_counter;
+};
+
+/* Fills data with pseudo random bytes
+ * This uses xorshift64* which is fast and reproducible, but not suitable
+ * for anything other than generating test data
+ */
+void bde_generate_random_data(
+      bde_generate_volume_t *generate_volume,
+      uint8_t *data,
+      size_t data_size )
+{
+	uint64_t random_value = 0;
+	size_t data_offset    = 0;
+	uint8_t byte_index    = 0;
+
+	while( data_offset < data_size )
+	{
+		generate_volume->random_state ^= generate_volume->random_state >> 12;
+		generate_volume->random_state ^= generate_volume->random_state << 25;
+		generate_volume->random_state ^= generate_volume->random_state >> 27;
+
+		random_value = generate_volume->random_state * 0x2545f4914f6cdd1dULL;
+
+		for( byte_index = 0;
+		     ( byte_index < 8 ) && ( data_offset < data_size );
+		     byte_index++ )
+		{
+			data[ data_offset++ ] = (uint8_t) ( random_value & 0xff );
+
+			random_value >>= 8;
+		}
+	}
+}
+
+/* Determines the encryption method from a string
+ * Returns 1 if successful, 0 if not supported
+ */
+int bde_generate_get_encryption_method(
+     const system_character_t *string,
+     uint16_t *encryption_method )
+{
+	size_t string_length = system_string_length(
+	                        string );
+
+	if( ( string_length == 11 )
+	 && ( system_string_compare(
+	       string,
+	       _SYSTEM_STRING( "aes_128_cbc" ),
+	       11 ) == 0 ) )
+	{
+		*encryption_method = LIBBDE_ENCRYPTION_METHOD_AES_128_CBC;
+	}
+	else if( ( string_length == 11 )
+	      && ( system_string_compare(
+	            string,
+	            _SYSTEM_STRING( "aes_256_cbc" ),
+	            11 ) == 0 ) )
+	{
+		*encryption_method = LIBBDE_ENCRYPTION_METHOD_AES_256_CBC;
+	}
+	else if( ( string_length == 20 )
+	      && ( system_string_compare(
+	            string,
+	            _SYSTEM_STRING( "aes_128_cbc_diffuser" ),
+	            20 ) == 0 ) )
+	{
+		*encryption_method = LIBBDE_ENCRYPTION_METHOD_AES_128_CBC_DIFFUSER;
+	}
+	else if( ( string_length == 20 )
+	      && ( system_string_compare(
+	            string,
+	            _SYSTEM_STRING( "aes_256_cbc_diffuser" ),
+	            20 ) == 0 ) )
+	{
+		*encryption_method = LIBBDE_ENCRYPTION_METHOD_AES_256_CBC_DIFFUSER;
+	}
+	else if( ( string_length == 11 )
+	      && ( system_string_compare(
+	            string,
+	            _SYSTEM_STRING( "aes_128_xts" ),
+	            11 ) == 0 ) )
+	{
+		*encryption_method = LIBBDE_ENCRYPTION_METHOD_AES_128_XTS;
+	}
+	else if( ( string_length == 11 )
+	      && ( system_string_compare(
+	            string,
+	            _SYSTEM_STRING( "aes_256_xts" ),
+	            11 ) == 0 ) )
+	{
+		*encryption_method = LIBBDE_ENCRYPTION_METHOD_AES_256_XTS;
+	}
+	else
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines the format version (layout) from a string
+ * Returns 1 if successful, 0 if not supported
+ */
+int bde_generate_get_version(
+     const system_character_t *string,
+     int *version )
+{
+	size_t string_length = system_string_length(
+	                        string );
+
+	if( ( string_length == 5 )
+	 && ( system_string_compare(
+	       string,
+	       _SYSTEM_STRING( "vista" ),
+	       5 ) == 0 ) )
+	{
+		*version = LIBBDE_VERSION_WINDOWS_VISTA;
+	}
+	else if( ( string_length == 4 )
+	      && ( system_string_compare(
+	            string,
+	            _SYSTEM_STRING( "win7" ),
+	            4 ) == 0 ) )
+	{
+		*version = LIBBDE_VERSION_WINDOWS_7;
+	}
+	else if( ( string_length == 4 )
+	      && ( system_string_compare(
+	            string,
+	            _SYSTEM_STRING( "togo" ),
+	            4 ) == 0 ) )
+	{
+		*version = LIBBDE_VERSION_TO_GO;
+	}
+	else
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines the layout of the volume and the keys
+ * Returns 1 if successful or -1 on error
+ */
+int bde_generate_volume_initialize_layout(
+     bde_generate_volume_t *generate_volume,
+     libcerror_error_t **error )
+{
+	static char *function       = "bde_generate_volume_initialize_layout";
+	size64_t cluster_block_size = 0;
+	int metadata_index          = 0;
+
+	if( generate_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( generate_volume->bytes_per_sector != 512 )
+	 && ( generate_volume->bytes_per_sector != 1024 )
+	 && ( generate_volume->bytes_per_sector != 2048 )
+	 && ( generate_volume->bytes_per_sector != 4096 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	generate_volume->sectors_per_cluster_block = 8;
+
+	cluster_block_size = (size64_t) generate_volume->sectors_per_cluster_block * generate_volume->bytes_per_sector;
+
+	generate_volume->volume_size -= generate_volume->volume_size % cluster_block_size;
+
+	if( generate_volume->volume_size < BDE_GENERATE_MINIMUM_VOLUME_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid volume size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( generate_volume->encrypted_volume_size == 0 )
+	 || ( generate_volume->encrypted_volume_size > generate_volume->volume_size ) )
+	{
+		generate_volume->encrypted_volume_size = generate_volume->volume_size;
+	}
+	generate_volume->encrypted_volume_size -= generate_volume->encrypted_volume_size % generate_volume->bytes_per_sector;
+
+	if( ( generate_volume->used_data_size == 0 )
+	 || ( generate_volume->used_data_size > generate_volume->volume_size ) )
+	{
+		generate_volume->used_data_size = generate_volume->volume_size;
+	}
+	if( generate_volume->version == LIBBDE_VERSION_WINDOWS_VISTA )
+	{
+		generate_volume->metadata_size = 16384;
+	}
+	else
+	{
+		generate_volume->metadata_size = 65536;
+	}
+	/* Spread the metadata blocks over the volume like Windows does,
+	 * aligned to 64 KiB which is a multiple of the cluster block size
+	 */
+	for( metadata_index = 0;
+	     metadata_index < 3;
+	     metadata_index++ )
+	{
+		generate_volume->metadata_offsets[ metadata_index ] = (off64_t) ( ( generate_volume->volume_size / 4 ) * ( metadata_index + 1 ) );
+
+		generate_volume->metadata_offsets[ metadata_index ] -= generate_volume->metadata_offsets[ metadata_index ] % 65536;
+	}
+	if( generate_volume->version != LIBBDE_VERSION_WINDOWS_VISTA )
+	{
+		/* The first 8192 bytes of the volume are stored after the first metadata block
+		 */
+		generate_volume->volume_header_offset = generate_volume->metadata_offsets[ 0 ] + (off64_t) generate_volume->metadata_size;
+		generate_volume->volume_header_size   = 8192;
+	}
+	generate_volume->mft_cluster_block_number        = 4;
+	generate_volume->mft_mirror_cluster_block_number = 2;
+
+	generate_volume->random_state = generate_volume->seed ^ 0x9e3779b97f4a7c15ULL;
+
+	if( generate_volume->random_state == 0 )
+	{
+		generate_volume->random_state = 0x9e3779b97f4a7c15ULL;
+	}
+	bde_generate_random_data(
+	 generate_volume,
+	 generate_volume->volume_identifier,
+	 16 );
+
+	bde_generate_random_data(
+	 generate_volume,
+	 generate_volume->full_volume_encryption_key,
+	 64 );
+
+	bde_generate_random_data(
+	 generate_volume,
+	 generate_volume->tweak_key,
+	 32 );
+
+	bde_generate_random_data(
+	 generate_volume,
+	 generate_volume->volume_master_key,
+	 32 );
+
+	/* Only the first 16 bytes of the keys are used by the 128-bit CBC methods,
+	 * clear the remainder so that the metadata matches the key size
+	 */
+	if( ( generate_volume->encryption_method == LIBBDE_ENCRYPTION_METHOD_AES_128_CBC )
+	 || ( generate_volume->encryption_method == LIBBDE_ENCRYPTION_METHOD_AES_128_CBC_DIFFUSER ) )
+	{
+		memory_set(
+		 &( generate_volume->full_volume_encryption_key[ 16 ] ),
+		 0,
+		 48 );
+
+		memory_set(
+		 &( generate_volume->tweak_key[ 16 ] ),
+		 0,
+		 16 );
+	}
+	return( 1 );
+}
+
+/* Writes a NTFS volume header
+ */
+void bde_generate_ntfs_volume_header(
+      bde_generate_volume_t *generate_volume,
+      uint8_t *data )
+{
+	bde_ntfs_volume_header_t *ntfs_volume_header = (bde_ntfs_volume_header_t *) data;
+
+	memory_set(
+	 data,
+	 0,
+	 512 );
+
+	ntfs_volume_header->boot_entry_point[ 0 ] = 0xeb;
+	ntfs_volume_header->boot_entry_point[ 1 ] = 0x52;
+	ntfs_volume_header->boot_entry_point[ 2 ] = 0x90;
+
+	memory_copy(
+	 ntfs_volume_header->file_system_signature,
+	 "NTFS    ",
+	 8 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ntfs_volume_header->bytes_per_sector,
+	 generate_volume->bytes_per_sector );
+
+	ntfs_volume_header->sectors_per_cluster_block = generate_volume->sectors_per_cluster_block;
+	ntfs_volume_header->media_descriptor          = 0xf8;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ntfs_volume_header->sectors_per_track,
+	 63 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ntfs_volume_header->number_of_heads,
+	 255 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ntfs_volume_header->unknown4,
+	 0x00800080UL );
+
+	/* The NTFS total number of sectors does not include the backup volume header
+	 */
+	byte_stream_copy_from_uint64_little_endian(
+	 ntfs_volume_header->total_number_of_sectors,
+	 ( generate_volume->volume_size / generate_volume->bytes_per_sector ) - 1 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ntfs_volume_header->mft_cluster_block_number,
+	 generate_volume->mft_cluster_block_number );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ntfs_volume_header->mirror_mft_cluster_block_number,
+	 generate_volume->mft_mirror_cluster_block_number );
+
+	/* MFT entry size: 2 ^ ( 256 - 0xf6 ) = 1024 bytes, index entry size: 1 cluster block
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 ntfs_volume_header->mft_entry_size,
+	 0x000000f6UL );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ntfs_volume_header->index_entry_size,
+	 0x00000001UL );
+
+	memory_copy(
+	 ntfs_volume_header->volume_serial_number,
+	 generate_volume->volume_identifier,
+	 8 );
+
+	ntfs_volume_header->sector_signature[ 0 ] = 0x55;
+	ntfs_volume_header->sector_signature[ 1 ] = 0xaa;
+}
+
+/* Writes the BitLocker volume header
+ */
+void bde_generate_volume_header(
+      bde_generate_volume_t *generate_volume,
+      uint8_t *data )
+{
+	uint64_t first_metadata_cluster_block_number = 0;
+
+	if( generate_volume->version == LIBBDE_VERSION_WINDOWS_VISTA )
+	{
+		/* The Windows Vista volume header is a NTFS volume header with a different
+		 * signature and the MFT mirror cluster block number replaced by
+		 * the first metadata cluster block number
+		 */
+		bde_generate_ntfs_volume_header(
+		 generate_volume,
+		 data );
+
+		memory_copy(
+		 &( data[ 3 ] ),
+		 bde_signature,
+		 8 );
+
+		first_metadata_cluster_block_number = (uint64_t) generate_volume->metadata_offsets[ 0 ]
+		                                    / ( (uint64_t) generate_volume->sectors_per_cluster_block * generate_volume->bytes_per_sector );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (bde_volume_header_windows_vista_t *) data )->first_metadata_cluster_block_number,
+		 first_metadata_cluster_block_number );
+
+		return;
+	}
+	memory_set(
+	 data,
+	 0,
+	 512 );
+
+	memory_copy(
+	 data,
+	 bde_boot_entry_point_windows7,
+	 3 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (bde_volume_header_windows_7_t *) data )->bytes_per_sector,
+	 generate_volume->bytes_per_sector );
+
+	( (bde_volume_header_windows_7_t *) data )->sectors_per_cluster_block = generate_volume->sectors_per_cluster_block;
+	( (bde_volume_header_windows_7_t *) data )->media_descriptor          = 0xf8;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (bde_volume_header_windows_7_t *) data )->sectors_per_track,
+	 63 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (bde_volume_header_windows_7_t *) data )->number_of_heads,
+	 255 );
+
+	memory_copy(
+	 ( (bde_volume_header_windows_7_t *) data )->volume_serial_number,
+	 generate_volume->volume_identifier,
+	 4 );
+
+	memory_copy(
+	 ( (bde_volume_header_windows_7_t *) data )->volume_label,
+	 "NO NAME    ",
+	 11 );
+
+	memory_copy(
+	 ( (bde_volume_header_windows_7_t *) data )->file_system_signature,
+	 "FAT32   ",
+	 8 );
+
+	if( generate_volume->version == LIBBDE_VERSION_WINDOWS_7 )
+	{
+		/* The volume size is determined from the NTFS volume header
+		 */
+		memory_copy(
+		 &( data[ 3 ] ),
+		 bde_signature,
+		 8 );
+
+		memory_copy(
+		 ( (bde_volume_header_windows_7_t *) data )->identifier,
+		 bde_identifier,
+		 16 );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (bde_volume_header_windows_7_t *) data )->first_metadata_offset,
+		 (uint64_t) generate_volume->metadata_offsets[ 0 ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (bde_volume_header_windows_7_t *) data )->second_metadata_offset,
+		 (uint64_t) generate_volume->metadata_offsets[ 1 ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (bde_volume_header_windows_7_t *) data )->third_metadata_offset,
+		 (uint64_t) generate_volume->metadata_offsets[ 2 ] );
+	}
+	else
+	{
+		memory_copy(
+		 &( data[ 3 ] ),
+		 "MSWIN4.1",
+		 8 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (bde_volume_header_to_go_t *) data )->total_number_of_sectors_32bit,
+		 (uint32_t) ( generate_volume->volume_size / generate_volume->bytes_per_sector ) );
+
+		memory_copy(
+		 ( (bde_volume_header_to_go_t *) data )->identifier,
+		 bde_identifier,
+		 16 );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (bde_volume_header_to_go_t *) data )->first_metadata_offset,
+		 (uint64_t) generate_volume->metadata_offsets[ 0 ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (bde_volume_header_to_go_t *) data )->second_metadata_offset,
+		 (uint64_t) generate_volume->metadata_offsets[ 1 ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (bde_volume_header_to_go_t *) data )->third_metadata_offset,
+		 (uint64_t) generate_volume->metadata_offsets[ 2 ] );
+	}
+	data[ 510 ] = 0x55;
+	data[ 511 ] = 0xaa;
+}
+
+/* Writes a metadata entry header
+ * Returns the size of the entry header
+ */
+size_t bde_generate_metadata_entry_header(
+        uint8_t *data,
+        uint16_t entry_size,
+        uint16_t entry_type,
+        uint16_t value_type )
+{
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (bde_metadata_entry_v1_t *) data )->size,
+	 entry_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (bde_metadata_entry_v1_t *) data )->type,
+	 entry_type );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (bde_metadata_entry_v1_t *) data )->value_type,
+	 value_type );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (bde_metadata_entry_v1_t *) data )->version,
+	 1 );
+
+	return( sizeof( bde_metadata_entry_v1_t ) );
+}
+
+/* Writes an AES-CCM encrypted key value
+ * The value consists of the nonce followed by the encrypted MAC and key entry
+ * Returns the size of the value if successful or -1 on error
+ */
+ssize_t bde_generate_aes_ccm_encrypted_key(
+         bde_generate_volume_t *generate_volume,
+         const uint8_t *key,
+         const uint8_t *unencrypted_data,
+         size_t unencrypted_data_size,
+         uint8_t *value_data,
+         size_t value_data_size,
+         libcerror_error_t **error )
+{
+	uint8_t initialization_vector[ 16 ];
+	uint8_t mac_data[ 16 + 128 ];
+	uint8_t nonce[ 12 ];
+	uint8_t unencrypted_key_data[ 16 + 128 ];
+
+	libcaes_context_t *aes_context = NULL;
+	static char *function          = "bde_generate_aes_ccm_encrypted_key";
+	size_t mac_data_size           = 0;
+
+	if( ( unencrypted_data_size == 0 )
+	 || ( unencrypted_data_size > 128 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid unencrypted data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size < ( 12 + 16 + unencrypted_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid value data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The nonce consists of the nonce date and time and the nonce counter
+	 */
+	byte_stream_copy_from_uint64_little_endian(
+	 nonce,
+	 BDE_GENERATE_CREATION_TIME );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( nonce[ 8 ] ),
+	 generate_volume->nonce_counter );
+
+	generate_volume->nonce_counter += 1;
+
+	/* Calculate the CCM MAC (CBC-MAC) over the B0 block followed by the data
+	 * B0 contains the flags: 8-byte MAC (M' = 7) and 3-byte length (L' = 2)
+	 */
+	memory_set(
+	 mac_data,
+	 0,
+	 16 + 128 );
+
+	mac_data[ 0 ] = 0x3a;
+
+	memory_copy(
+	 &( mac_data[ 1 ] ),
+	 nonce,
+	 12 );
+
+	mac_data[ 13 ] = (uint8_t) ( ( unencrypted_data_size >> 16 ) & 0xff );
+	mac_data[ 14 ] = (uint8_t) ( ( unencrypted_data_size >> 8 ) & 0xff );
+	mac_data[ 15 ] = (uint8_t) ( unencrypted_data_size & 0xff );
+
+	memory_copy(
+	 &( mac_data[ 16 ] ),
+	 unencrypted_data,
+	 unencrypted_data_size );
+
+	mac_data_size = 16 + ( ( unencrypted_data_size + 15 ) / 16 ) * 16;
+
+	memory_set(
+	 initialization_vector,
+	 0,
+	 16 );
+
+	if( libcaes_context_initialize(
+	     &aes_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable initialize AES context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcaes_context_set_key(
+	     aes_context,
+	     LIBCAES_CRYPT_MODE_ENCRYPT,
+	     key,
+	     256,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set encryption key in AES context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcaes_crypt_cbc(
+	     aes_context,
+	     LIBCAES_CRYPT_MODE_ENCRYPT,
+	     initialization_vector,
+	     16,
+	     mac_data,
+	     mac_data_size,
+	     mac_data,
+	     mac_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_ENCRYPT_FAILED,
+		 "%s: unable to calculate MAC.",
+		 function );
+
+		goto on_error;
+	}
+	/* The MAC precedes the data and both are encrypted in counter mode
+	 */
+	memory_copy(
+	 unencrypted_key_data,
+	 &( mac_data[ mac_data_size - 16 ] ),
+	 16 );
+
+	memory_copy(
+	 &( unencrypted_key_data[ 16 ] ),
+	 unencrypted_data,
+	 unencrypted_data_size );
+
+	memory_copy(
+	 value_data,
+	 nonce,
+	 12 );
+
+	if( libcaes_crypt_ccm(
+	     aes_context,
+	     LIBCAES_CRYPT_MODE_ENCRYPT,
+	     nonce,
+	     12,
+	     unencrypted_key_data,
+	     16 + unencrypted_data_size,
+	     &( value_data[ 12 ] ),
+	     16 + unencrypted_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_ENCRYPT_FAILED,
+		 "%s: unable to encrypt data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcaes_context_free(
+	     &aes_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable free AES context.",
+		 function );
+
+		goto on_error;
+	}
+	memory_set(
+	 unencrypted_key_data,
+	 0,
+	 16 + 128 );
+
+	memory_set(
+	 mac_data,
+	 0,
+	 16 + 128 );
+
+	return( (ssize_t) ( 12 + 16 + unencrypted_data_size ) );
+
+on_error:
+	if( aes_context != NULL )
+	{
+		libcaes_context_free(
+		 &aes_context,
+		 NULL );
+	}
+	memory_set(
+	 unencrypted_key_data,
+	 0,
+	 16 + 128 );
+
+	memory_set(
+	 mac_data,
+	 0,
+	 16 + 128 );
+
+	return( -1 );
+}
+
+/* Writes a volume master key metadata entry
+ * If password_hash is NULL the volume master key is stored with a clear key
+ * Returns the size of the entry if successful or -1 on error
+ */
+ssize_t bde_generate_volume_master_key_entry(
+         bde_generate_volume_t *generate_volume,
+         uint16_t protection_type,
+         const uint8_t *password_hash,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error )
+{
+	uint8_t aes_ccm_key[ 32 ];
+	uint8_t key_data[ 44 ];
+	uint8_t salt[ 16 ];
+
+	static char *function = "bde_generate_volume_master_key_entry";
+	size_t data_offset    = 0;
+	size_t entry_offset   = 0;
+	ssize_t value_size    = 0;
+
+	if( data_size < 512 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = sizeof( bde_metadata_entry_v1_t );
+
+	bde_generate_random_data(
+	 generate_volume,
+	 ( (bde_metadata_entry_volume_master_key_header_t *) &( data[ data_offset ] ) )->identifier,
+	 16 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (bde_metadata_entry_volume_master_key_header_t *) &( data[ data_offset ] ) )->modification_time,
+	 BDE_GENERATE_CREATION_TIME );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (bde_metadata_entry_volume_master_key_header_t *) &( data[ data_offset ] ) )->unknown1,
+	 0 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (bde_metadata_entry_volume_master_key_header_t *) &( data[ data_offset ] ) )->protection_type,
+	 protection_type );
+
+	data_offset += sizeof( bde_metadata_entry_volume_master_key_header_t );
+
+	if( password_hash == NULL )
+	{
+		/* The clear key is stored as a key property
+		 */
+		bde_generate_random_data(
+		 generate_volume,
+		 aes_ccm_key,
+		 32 );
+
+		entry_offset = data_offset;
+
+		data_offset += bde_generate_metadata_entry_header(
+		                &( data[ data_offset ] ),
+		                (uint16_t) ( sizeof( bde_metadata_entry_v1_t ) + 4 + 32 ),
+		                LIBBDE_ENTRY_TYPE_PROPERTY,
+		                LIBBDE_VALUE_TYPE_KEY );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ data_offset ] ),
+		 0x00002000UL );
+
+		memory_copy(
+		 &( data[ data_offset + 4 ] ),
+		 aes_ccm_key,
+		 32 );
+
+		data_offset += 4 + 32;
+	}
+	else
+	{
+		bde_generate_random_data(
+		 generate_volume,
+		 salt,
+		 16 );
+
+		if( libbde_password_calculate_key(
+		     password_hash,
+		     32,
+		     salt,
+		     16,
+		     aes_ccm_key,
+		     32,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine password key.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += bde_generate_metadata_entry_header(
+		                &( data[ data_offset ] ),
+		                (uint16_t) ( sizeof( bde_metadata_entry_v1_t ) + sizeof( bde_metadata_entry_stretch_key_header_t ) ),
+		                LIBBDE_ENTRY_TYPE_PROPERTY,
+		                LIBBDE_VALUE_TYPE_STRETCH_KEY );
+
+		if( protection_type == LIBBDE_KEY_PROTECTION_TYPE_PASSWORD )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (bde_metadata_entry_stretch_key_header_t *) &( data[ data_offset ] ) )->encryption_method,
+			 0x00001001UL );
+		}
+		else
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (bde_metadata_entry_stretch_key_header_t *) &( data[ data_offset ] ) )->encryption_method,
+			 0x00001000UL );
+		}
+		memory_copy(
+		 ( (bde_metadata_entry_stretch_key_header_t *) &( data[ data_offset ] ) )->salt,
+		 salt,
+		 16 );
+
+		data_offset += sizeof( bde_metadata_entry_stretch_key_header_t );
+	}
+	/* The volume master key is stored as an AES-CCM encrypted key entry
+	 */
+	bde_generate_metadata_entry_header(
+	 key_data,
+	 44,
+	 LIBBDE_ENTRY_TYPE_PROPERTY,
+	 LIBBDE_VALUE_TYPE_KEY );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( key_data[ 8 ] ),
+	 0x00002000UL );
+
+	memory_copy(
+	 &( key_data[ 12 ] ),
+	 generate_volume->volume_master_key,
+	 32 );
+
+	entry_offset = data_offset;
+
+	data_offset += sizeof( bde_metadata_entry_v1_t );
+
+	value_size = bde_generate_aes_ccm_encrypted_key(
+	              generate_volume,
+	              aes_ccm_key,
+	              key_data,
+	              44,
+	              &( data[ data_offset ] ),
+	              data_size - data_offset,
+	              error );
+
+	if( value_size == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_ENCRYPT_FAILED,
+		 "%s: unable to encrypt volume master key.",
+		 function );
+
+		goto on_error;
+	}
+	bde_generate_metadata_entry_header(
+	 &( data[ entry_offset ] ),
+	 (uint16_t) ( sizeof( bde_metadata_entry_v1_t ) + value_size ),
+	 LIBBDE_ENTRY_TYPE_PROPERTY,
+	 LIBBDE_VALUE_TYPE_AES_CCM_ENCRYPTED_KEY );
+
+	data_offset += (size_t) value_size;
+
+	bde_generate_metadata_entry_header(
+	 data,
+	 (uint16_t) data_offset,
+	 LIBBDE_ENTRY_TYPE_VOLUME_MASTER_KEY,
+	 LIBBDE_VALUE_TYPE_VOLUME_MASTER_KEY );
+
+	memory_set(
+	 aes_ccm_key,
+	 0,
+	 32 );
+
+	memory_set(
+	 key_data,
+	 0,
+	 44 );
+
+	return( (ssize_t) data_offset );
+
+on_error:
+	memory_set(
+	 aes_ccm_key,
+	 0,
+	 32 );
+
+	memory_set(
+	 key_data,
+	 0,
+	 44 );
+
+	return( -1 );
+}
+
+/* Writes the full volume encryption key metadata entry
+ * Returns the size of the entry if successful or -1 on error
+ */
+ssize_t bde_generate_full_volume_encryption_key_entry(
+         bde_generate_volume_t *generate_volume,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error )
+{
+	uint8_t key_data[ 76 ];
+
+	static char *function = "bde_generate_full_volume_encryption_key_entry";
+	ssize_t value_size    = 0;
+	uint16_t key_size     = 0;
+
+	switch( generate_volume->encryption_method )
+	{
+		case LIBBDE_ENCRYPTION_METHOD_AES_128_CBC:
+			key_size = 16;
+			break;
+
+		case LIBBDE_ENCRYPTION_METHOD_AES_256_CBC:
+		case LIBBDE_ENCRYPTION_METHOD_AES_128_XTS:
+			key_size = 32;
+			break;
+
+		default:
+			key_size = 64;
+			break;
+	}
+	bde_generate_metadata_entry_header(
+	 key_data,
+	 12 + key_size,
+	 LIBBDE_ENTRY_TYPE_PROPERTY,
+	 LIBBDE_VALUE_TYPE_KEY );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( key_data[ 8 ] ),
+	 (uint32_t) generate_volume->encryption_method );
+
+	if( ( generate_volume->encryption_method == LIBBDE_ENCRYPTION_METHOD_AES_128_CBC_DIFFUSER )
+	 || ( generate_volume->encryption_method == LIBBDE_ENCRYPTION_METHOD_AES_256_CBC_DIFFUSER ) )
+	{
+		/* The key data contains the FVEK followed by the TWEAK key
+		 */
+		memory_copy(
+		 &( key_data[ 12 ] ),
+		 generate_volume->full_volume_encryption_key,
+		 32 );
+
+		memory_copy(
+		 &( key_data[ 44 ] ),
+		 generate_volume->tweak_key,
+		 32 );
+	}
+	else
+	{
+		memory_copy(
+		 &( key_data[ 12 ] ),
+		 generate_volume->full_volume_encryption_key,
+		 key_size );
+	}
+	value_size = bde_generate_aes_ccm_encrypted_key(
+	              generate_volume,
+	              generate_volume->volume_master_key,
+	              key_data,
+	              12 + key_size,
+	              &( data[ sizeof( bde_metadata_entry_v1_t ) ] ),
+	              data_size - sizeof( bde_metadata_entry_v1_t ),
+	              error );
+
+	memory_set(
+	 key_data,
+	 0,
+	 76 );
+
+	if( value_size == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_ENCRYPT_FAILED,
+		 "%s: unable to encrypt full volume encryption key.",
+		 function );
+
+		return( -1 );
+	}
+	bde_generate_metadata_entry_header(
+	 data,
+	 (uint16_t) ( sizeof( bde_metadata_entry_v1_t ) + value_size ),
+	 LIBBDE_ENTRY_TYPE_FULL_VOLUME_ENCRYPTION_KEY,
+	 LIBBDE_VALUE_TYPE_AES_CCM_ENCRYPTED_KEY );
+
+	return( (ssize_t) ( sizeof( bde_metadata_entry_v1_t ) + value_size ) );
+}
+
+/* Writes the metadata entries
+ * Returns the size of the entries if successful or -1 on error
+ */
+ssize_t bde_generate_metadata_entries(
+         bde_generate_volume_t *generate_volume,
+         const system_character_t *password,
+         const system_character_t *recovery_password,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error )
+{
+	uint8_t password_hash[ 32 ];
+
+	const char *description = "bde_generate";
+	static char *function   = "bde_generate_metadata_entries";
+	size_t data_offset      = 0;
+	size_t string_index     = 0;
+	ssize_t entry_size      = 0;
+	int result              = 0;
+
+	if( password != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbde_utf16_password_calculate_hash(
+		          (uint16_t *) password,
+		          system_string_length( password ),
+		          password_hash,
+		          32,
+		          error );
+#else
+		result = libbde_utf8_password_calculate_hash(
+		          (uint8_t *) password,
+		          system_string_length( password ),
+		          password_hash,
+		          32,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine password hash.",
+			 function );
+
+			goto on_error;
+		}
+		entry_size = bde_generate_volume_master_key_entry(
+		              generate_volume,
+		              LIBBDE_KEY_PROTECTION_TYPE_PASSWORD,
+		              password_hash,
+		              &( data[ data_offset ] ),
+		              data_size - data_offset,
+		              error );
+
+		if( entry_size == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write password volume master key entry.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += (size_t) entry_size;
+	}
+	if( recovery_password != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbde_utf16_recovery_password_calculate_hash(
+		          (uint16_t *) recovery_password,
+		          system_string_length( recovery_password ),
+		          password_hash,
+		          32,
+		          error );
+#else
+		result = libbde_utf8_recovery_password_calculate_hash(
+		          (uint8_t *) recovery_password,
+		          system_string_length( recovery_password ),
+		          password_hash,
+		          32,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported recovery password.",
+			 function );
+
+			goto on_error;
+		}
+		entry_size = bde_generate_volume_master_key_entry(
+		              generate_volume,
+		              LIBBDE_KEY_PROTECTION_TYPE_RECOVERY_PASSWORD,
+		              password_hash,
+		              &( data[ data_offset ] ),
+		              data_size - data_offset,
+		              error );
+
+		if( entry_size == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write recovery password volume master key entry.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += (size_t) entry_size;
+	}
+	if( ( password == NULL )
+	 && ( recovery_password == NULL ) )
+	{
+		/* Without a password the volume is unprotected (BitLocker suspended)
+		 */
+		entry_size = bde_generate_volume_master_key_entry(
+		              generate_volume,
+		              LIBBDE_KEY_PROTECTION_TYPE_CLEAR_KEY,
+		              NULL,
+		              &( data[ data_offset ] ),
+		              data_size - data_offset,
+		              error );
+
+		if( entry_size == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write clear key volume master key entry.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += (size_t) entry_size;
+	}
+	entry_size = bde_generate_full_volume_encryption_key_entry(
+	              generate_volume,
+	              &( data[ data_offset ] ),
+	              data_size - data_offset,
+	              error );
+
+	if( entry_size == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write full volume encryption key entry.",
+		 function );
+
+		goto on_error;
+	}
+	data_offset += (size_t) entry_size;
+
+	/* The description is stored as an UTF-16 little-endian string with end-of-string character
+	 */
+	entry_size = (ssize_t) ( sizeof( bde_metadata_entry_v1_t ) + ( ( 12 + 1 ) * 2 ) );
+
+	bde_generate_metadata_entry_header(
+	 &( data[ data_offset ] ),
+	 (uint16_t) entry_size,
+	 LIBBDE_ENTRY_TYPE_DESCRIPTION,
+	 LIBBDE_VALUE_TYPE_UNICODE_STRING );
+
+	data_offset += sizeof( bde_metadata_entry_v1_t );
+
+	for( string_index = 0;
+	     string_index < 13;
+	     string_index++ )
+	{
+		data[ data_offset++ ] = (uint8_t) description[ string_index ];
+		data[ data_offset++ ] = 0;
+	}
+	if( generate_volume->version != LIBBDE_VERSION_WINDOWS_VISTA )
+	{
+		data_offset += bde_generate_metadata_entry_header(
+		                &( data[ data_offset ] ),
+		                (uint16_t) ( sizeof( bde_metadata_entry_v1_t ) + 16 ),
+		                LIBBDE_ENTRY_TYPE_VOLUME_HEADER_BLOCK,
+		                LIBBDE_VALUE_TYPE_OFFSET_AND_SIZE );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ data_offset ] ),
+		 (uint64_t) generate_volume->volume_header_offset );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ data_offset + 8 ] ),
+		 (uint64_t) generate_volume->volume_header_size );
+
+		data_offset += 16;
+	}
+	memory_set(
+	 password_hash,
+	 0,
+	 32 );
+
+	return( (ssize_t) data_offset );
+
+on_error:
+	memory_set(
+	 password_hash,
+	 0,
+	 32 );
+
+	return( -1 );
+}
+
+/* Writes a metadata block
+ * The entries are shared by all metadata blocks
+ */
+void bde_generate_metadata_block(
+      bde_generate_volume_t *generate_volume,
+      const uint8_t *entries_data,
+      size_t entries_data_size,
+      uint8_t *data )
+{
+	size_t data_offset = 0;
+
+	memory_set(
+	 data,
+	 0,
+	 (size_t) generate_volume->metadata_size );
+
+	memory_copy(
+	 data,
+	 bde_signature,
+	 8 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (bde_metadata_block_header_v1_t *) data )->size,
+	 sizeof( bde_metadata_block_header_v1_t ) );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (bde_metadata_block_header_v1_t *) data )->first_metadata_offset,
+	 (uint64_t) generate_volume->metadata_offsets[ 0 ] );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (bde_metadata_block_header_v1_t *) data )->second_metadata_offset,
+	 (uint64_t) generate_volume->metadata_offsets[ 1 ] );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (bde_metadata_block_header_v1_t *) data )->third_metadata_offset,
+	 (uint64_t) generate_volume->metadata_offsets[ 2 ] );
+
+	if( generate_volume->version == LIBBDE_VERSION_WINDOWS_VISTA )
+	{
+		byte_stream_copy_from_uint16_little_endian(
+		 ( (bde_metadata_block_header_v1_t *) data )->version,
+		 1 );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (bde_metadata_block_header_v1_t *) data )->mft_mirror_cluster_block,
+		 generate_volume->mft_mirror_cluster_block_number );
+	}
+	else
+	{
+		byte_stream_copy_from_uint16_little_endian(
+		 ( (bde_metadata_block_header_v2_t *) data )->version,
+		 2 );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (bde_metadata_block_header_v2_t *) data )->encrypted_volume_size,
+		 generate_volume->encrypted_volume_size );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (bde_metadata_block_header_v2_t *) data )->number_of_volume_header_sectors,
+		 (uint32_t) ( generate_volume->volume_header_size / generate_volume->bytes_per_sector ) );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (bde_metadata_block_header_v2_t *) data )->volume_header_offset,
+		 (uint64_t) generate_volume->volume_header_offset );
+	}
+	data_offset = sizeof( bde_metadata_block_header_v1_t );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (bde_metadata_header_v1_t *) &( data[ data_offset ] ) )->metadata_size,
+	 (uint32_t) ( sizeof( bde_metadata_header_v1_t ) + entries_data_size ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (bde_metadata_header_v1_t *) &( data[ data_offset ] ) )->version,
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (bde_metadata_header_v1_t *) &( data[ data_offset ] ) )->metadata_header_size,
+	 sizeof( bde_metadata_header_v1_t ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (bde_metadata_header_v1_t *) &( data[ data_offset ] ) )->metadata_size_copy,
+	 (uint32_t) ( sizeof( bde_metadata_header_v1_t ) + entries_data_size ) );
+
+	memory_copy(
+	 ( (bde_metadata_header_v1_t *) &( data[ data_offset ] ) )->volume_identifier,
+	 generate_volume->volume_identifier,
+	 16 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (bde_metadata_header_v1_t *) &( data[ data_offset ] ) )->next_nonce_counter,
+	 generate_volume->nonce_counter );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (bde_metadata_header_v1_t *) &( data[ data_offset ] ) )->encryption_method,
+	 generate_volume->encryption_method );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (bde_metadata_header_v1_t *) &( data[ data_offset ] ) )->encryption_method_copy,
+	 generate_volume->encryption_method );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (bde_metadata_header_v1_t *) &( data[ data_offset ] ) )->creation_time,
+	 BDE_GENERATE_CREATION_TIME );
+
+	data_offset += sizeof( bde_metadata_header_v1_t );
+
+	memory_copy(
+	 &( data[ data_offset ] ),
+	 entries_data,
+	 entries_data_size );
+}
+
+/* Determines if a logical offset is stored in a metadata area
+ * Returns 1 if the offset is in a metadata area or 0 if not
+ */
+int bde_generate_is_metadata_offset(
+     bde_generate_volume_t *generate_volume,
+     off64_t offset )
+{
+	int metadata_index = 0;
+
+	for( metadata_index = 0;
+	     metadata_index < 3;
+	     metadata_index++ )
+	{
+		if( ( offset >= generate_volume->metadata_offsets[ metadata_index ] )
+		 && ( offset < ( generate_volume->metadata_offsets[ metadata_index ] + (off64_t) generate_volume->metadata_size ) ) )
+		{
+			return( 1 );
+		}
+	}
+	if( ( generate_volume->volume_header_size != 0 )
+	 && ( offset >= generate_volume->volume_header_offset )
+	 && ( offset < ( generate_volume->volume_header_offset + (off64_t) generate_volume->volume_header_size ) ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Writes the volume
+ * Returns 1 if successful or -1 on error
+ */
+int bde_generate_volume_write(
+     bde_generate_volume_t *generate_volume,
+     libbfio_handle_t *file_io_handle,
+     const system_character_t *password,
+     const system_character_t *recovery_password,
+     libcerror_error_t **error )
+{
+	libbde_encryption_context_t *encryption_context = NULL;
+	uint8_t *encrypted_data                         = NULL;
+	uint8_t *entries_data                           = NULL;
+	uint8_t *metadata_data                          = NULL;
+	uint8_t *sector_data                            = NULL;
+	static char *function                           = "bde_generate_volume_write";
+	off64_t logical_offset                          = 0;
+	off64_t physical_offset                         = 0;
+	off64_t write_end_offset                        = 0;
+	ssize_t entries_data_size                       = 0;
+	ssize_t write_count                             = 0;
+	int metadata_index                              = 0;
+
+	entries_data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * 4096 );
+
+	metadata_data = (uint8_t *) memory_allocate(
+	                             sizeof( uint8_t ) * (size_t) generate_volume->metadata_size );
+
+	sector_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * generate_volume->bytes_per_sector );
+
+	encrypted_data = (uint8_t *) memory_allocate(
+	                              sizeof( uint8_t ) * generate_volume->bytes_per_sector );
+
+	if( ( entries_data == NULL )
+	 || ( metadata_data == NULL )
+	 || ( sector_data == NULL )
+	 || ( encrypted_data == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffers.",
+		 function );
+
+		goto on_error;
+	}
+	memory_set(
+	 entries_data,
+	 0,
+	 4096 );
+
+	entries_data_size = bde_generate_metadata_entries(
+	                     generate_volume,
+	                     password,
+	                     recovery_password,
+	                     entries_data,
+	                     4096,
+	                     error );
+
+	if( entries_data_size == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write metadata entries.",
+		 function );
+
+		goto on_error;
+	}
+	bde_generate_metadata_block(
+	 generate_volume,
+	 entries_data,
+	 (size_t) entries_data_size,
+	 metadata_data );
+
+	for( metadata_index = 0;
+	     metadata_index < 3;
+	     metadata_index++ )
+	{
+		write_count = libbfio_handle_write_buffer_at_offset(
+		               file_io_handle,
+		               metadata_data,
+		               (size_t) generate_volume->metadata_size,
+		               generate_volume->metadata_offsets[ metadata_index ],
+		               error );
+
+		if( write_count != (ssize_t) generate_volume->metadata_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write metadata block: %d.",
+			 function,
+			 metadata_index );
+
+			goto on_error;
+		}
+	}
+	bde_generate_volume_header(
+	 generate_volume,
+	 sector_data );
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               sector_data,
+	               generate_volume->bytes_per_sector,
+	               0,
+	               error );
+
+	if( write_count != (ssize_t) generate_volume->bytes_per_sector )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write volume header.",
+		 function );
+
+		goto on_error;
+	}
+	write_end_offset = (off64_t) generate_volume->metadata_offsets[ 2 ] + (off64_t) generate_volume->metadata_size;
+
+	if( libbde_encryption_context_initialize(
+	     &encryption_context,
+	     generate_volume->encryption_method,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create encryption context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbde_encryption_context_set_keys(
+	     encryption_context,
+	     generate_volume->full_volume_encryption_key,
+	     64,
+	     generate_volume->tweak_key,
+	     32,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set keys in encryption context.",
+		 function );
+
+		goto on_error;
+	}
+	for( logical_offset = 0;
+	     logical_offset < (off64_t) generate_volume->volume_size;
+	     logical_offset += generate_volume->bytes_per_sector )
+	{
+		if( bde_generate_is_metadata_offset(
+		     generate_volume,
+		     logical_offset ) != 0 )
+		{
+			continue;
+		}
+		if( logical_offset == 0 )
+		{
+			/* In Windows Vista the volume header is stored in the first sector
+			 */
+			if( generate_volume->version == LIBBDE_VERSION_WINDOWS_VISTA )
+			{
+				continue;
+			}
+			bde_generate_ntfs_volume_header(
+			 generate_volume,
+			 sector_data );
+		}
+		else if( (size64_t) logical_offset < generate_volume->used_data_size )
+		{
+			memory_set(
+			 sector_data,
+			 0,
+			 generate_volume->bytes_per_sector );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 sector_data,
+			 (uint64_t) logical_offset );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 &( sector_data[ 8 ] ),
+			 generate_volume->seed );
+		}
+		else
+		{
+			/* Unused space is not written, hence the image is sparse
+			 */
+			continue;
+		}
+		physical_offset = logical_offset;
+
+		if( ( generate_volume->volume_header_size != 0 )
+		 && ( (size64_t) logical_offset < generate_volume->volume_header_size ) )
+		{
+			physical_offset += generate_volume->volume_header_offset;
+		}
+		if( ( ( generate_volume->version == LIBBDE_VERSION_WINDOWS_VISTA )
+		  &&  ( physical_offset < 8192 ) )
+		 || ( (size64_t) physical_offset >= generate_volume->encrypted_volume_size ) )
+		{
+			memory_copy(
+			 encrypted_data,
+			 sector_data,
+			 generate_volume->bytes_per_sector );
+		}
+		else
+		{
+			if( libbde_encryption_context_crypt_sectors(
+			     encryption_context,
+			     LIBBDE_ENCRYPTION_CRYPT_MODE_ENCRYPT,
+			     sector_data,
+			     generate_volume->bytes_per_sector,
+			     encrypted_data,
+			     generate_volume->bytes_per_sector,
+			     (uint64_t) physical_offset,
+			     generate_volume->bytes_per_sector,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+				 LIBCERROR_ENCRYPTION_ERROR_ENCRYPT_FAILED,
+				 "%s: unable to encrypt sector data at offset: %" PRIi64 ".",
+				 function,
+				 logical_offset );
+
+				goto on_error;
+			}
+		}
+		write_count = libbfio_handle_write_buffer_at_offset(
+		               file_io_handle,
+		               encrypted_data,
+		               generate_volume->bytes_per_sector,
+		               physical_offset,
+		               error );
+
+		if( write_count != (ssize_t) generate_volume->bytes_per_sector )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write sector data at offset: %" PRIi64 ".",
+			 function,
+			 physical_offset );
+
+			goto on_error;
+		}
+		if( ( physical_offset + generate_volume->bytes_per_sector ) > write_end_offset )
+		{
+			write_end_offset = physical_offset + generate_volume->bytes_per_sector;
+		}
+	}
+	/* Extend the image to the volume size without allocating the unused space
+	 */
+	if( write_end_offset < (off64_t) generate_volume->volume_size )
+	{
+		sector_data[ 0 ] = 0;
+
+		write_count = libbfio_handle_write_buffer_at_offset(
+		               file_io_handle,
+		               sector_data,
+		               1,
+		               (off64_t) generate_volume->volume_size - 1,
+		               error );
+
+		if( write_count != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write end of volume.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libbde_encryption_context_free(
+	     &encryption_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free encryption context.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 encrypted_data );
+
+	memory_free(
+	 sector_data );
+
+	memory_free(
+	 metadata_data );
+
+	memory_free(
+	 entries_data );
+
+	return( 1 );
+
+on_error:
+	if( encryption_context != NULL )
+	{
+		libbde_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	if( encrypted_data != NULL )
+	{
+		memory_free(
+		 encrypted_data );
+	}
+	if( sector_data != NULL )
+	{
+		memory_free(
+		 sector_data );
+	}
+	if( metadata_data != NULL )
+	{
+		memory_free(
+		 metadata_data );
+	}
+	if( entries_data != NULL )
+	{
+		memory_free(
+		 entries_data );
+	}
+	return( -1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
+
+/* Prints usage information
+ */
+void bde_generate_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use bde_generate to create a synthetic BitLocker volume image.\n\n" );
+
+	fprintf( stream, "Usage: bde_generate [ -b bytes_per_sector ] [ -e encrypted_size ]\n"
+	                 "                    [ -l layout ] [ -m method ] [ -p password ]\n"
+	                 "                    [ -r recovery_password ] [ -s seed ] [ -S size ]\n"
+	                 "                    [ -u used_size ] [ -h ] target\n\n" );
+
+	fprintf( stream, "\ttarget: the target image file\n\n" );
+
+	fprintf( stream, "\t-b:     bytes per sector, options: 512 (default), 1024, 2048 or 4096\n" );
+	fprintf( stream, "\t-e:     encrypted volume size in bytes, data beyond it is not\n"
+	                 "\t        encrypted, default is the volume size\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-l:     layout, options: vista, win7 (default) or togo\n" );
+	fprintf( stream, "\t-m:     encryption method, options: aes_128_cbc, aes_256_cbc,\n"
+	                 "\t        aes_128_cbc_diffuser, aes_256_cbc_diffuser,\n"
+	                 "\t        aes_128_xts (default) or aes_256_xts\n" );
+	fprintf( stream, "\t-p:     protect the volume master key with a password\n" );
+	fprintf( stream, "\t-r:     protect the volume master key with a recovery password,\n"
+	                 "\t        if neither -p or -r is provided a clear key is used\n" );
+	fprintf( stream, "\t-s:     seed of the keys and identifiers, default is 0\n" );
+	fprintf( stream, "\t-S:     volume size in bytes, default is 64 MiB\n" );
+	fprintf( stream, "\t-u:     size of the data in bytes, the remainder of the volume is\n"
+	                 "\t        left unused (sparse), default is the volume size\n" );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
+	bde_generate_volume_t generate_volume;
+
+	libbfio_handle_t *file_io_handle                = NULL;
+	libcerror_error_t *error                        = NULL;
+	size_t string_length                            = 0;
+	uint64_t value_64bit                            = 0;
+#endif
+	system_character_t *option_bytes_per_sector     = NULL;
+	system_character_t *option_encrypted_size       = NULL;
+	system_character_t *option_layout               = NULL;
+	system_character_t *option_method               = NULL;
+	system_character_t *option_password             = NULL;
+	system_character_t *option_recovery_password    = NULL;
+	system_character_t *option_seed                 = NULL;
+	system_character_t *option_size                 = NULL;
+	system_character_t *option_used_size            = NULL;
+	system_character_t *target                      = NULL;
+	system_integer_t option                         = 0;
+
+	while( ( option = bde_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "b:e:hl:m:p:r:s:S:u:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				bde_generate_usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'b':
+				option_bytes_per_sector = optarg;
+
+				break;
+
+			case (system_integer_t) 'e':
+				option_encrypted_size = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				bde_generate_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'l':
+				option_layout = optarg;
+
+				break;
+
+			case (system_integer_t) 'm':
+				option_method = optarg;
+
+				break;
+
+			case (system_integer_t) 'p':
+				option_password = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				option_recovery_password = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_seed = optarg;
+
+				break;
+
+			case (system_integer_t) 'S':
+				option_size = optarg;
+
+				break;
+
+			case (system_integer_t) 'u':
+				option_used_size = optarg;
+
+				break;
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing target.\n" );
+
+		bde_generate_usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	target = argv[ optind ];
+
+#if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
+	memory_set(
+	 &generate_volume,
+	 0,
+	 sizeof( bde_generate_volume_t ) );
+
+	generate_volume.version           = LIBBDE_VERSION_WINDOWS_7;
+	generate_volume.encryption_method = LIBBDE_ENCRYPTION_METHOD_AES_128_XTS;
+	generate_volume.bytes_per_sector  = 512;
+	generate_volume.volume_size       = BDE_GENERATE_DEFAULT_VOLUME_SIZE;
+
+	if( option_layout != NULL )
+	{
+		if( bde_generate_get_version(
+		     option_layout,
+		     &( generate_volume.version ) ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported layout.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_method != NULL )
+	{
+		if( bde_generate_get_encryption_method(
+		     option_method,
+		     &( generate_volume.encryption_method ) ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported encryption method.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_bytes_per_sector != NULL )
+	{
+		string_length = system_string_length(
+		                 option_bytes_per_sector );
+
+		if( ( bde_test_system_string_copy_from_64_bit_in_decimal(
+		       option_bytes_per_sector,
+		       string_length + 1,
+		       &value_64bit,
+		       &error ) != 1 )
+		 || ( value_64bit > 4096 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported bytes per sector.\n" );
+
+			goto on_error;
+		}
+		generate_volume.bytes_per_sector = (uint16_t) value_64bit;
+	}
+	if( option_size != NULL )
+	{
+		string_length = system_string_length(
+		                 option_size );
+
+		if( ( bde_test_system_string_copy_from_64_bit_in_decimal(
+		       option_size,
+		       string_length + 1,
+		       &value_64bit,
+		       &error ) != 1 )
+		 || ( value_64bit > (uint64_t) INT64_MAX ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported volume size.\n" );
+
+			goto on_error;
+		}
+		generate_volume.volume_size = (size64_t) value_64bit;
+	}
+	if( option_encrypted_size != NULL )
+	{
+		string_length = system_string_length(
+		                 option_encrypted_size );
+
+		if( bde_test_system_string_copy_from_64_bit_in_decimal(
+		     option_encrypted_size,
+		     string_length + 1,
+		     &value_64bit,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported encrypted volume size.\n" );
+
+			goto on_error;
+		}
+		generate_volume.encrypted_volume_size = (size64_t) value_64bit;
+	}
+	if( option_used_size != NULL )
+	{
+		string_length = system_string_length(
+		                 option_used_size );
+
+		if( bde_test_system_string_copy_from_64_bit_in_decimal(
+		     option_used_size,
+		     string_length + 1,
+		     &value_64bit,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported used size.\n" );
+
+			goto on_error;
+		}
+		generate_volume.used_data_size = (size64_t) value_64bit;
+	}
+	if( option_seed != NULL )
+	{
+		string_length = system_string_length(
+		                 option_seed );
+
+		if( bde_test_system_string_copy_from_64_bit_in_decimal(
+		     option_seed,
+		     string_length + 1,
+		     &( generate_volume.seed ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported seed.\n" );
+
+			goto on_error;
+		}
+	}
+	if( bde_generate_volume_initialize_layout(
+	     &generate_volume,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine volume layout.\n" );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize file IO handle.\n" );
+
+		goto on_error;
+	}
+	string_length = system_string_length(
+	                 target );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     target,
+	     string_length,
+	     &error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     target,
+	     string_length,
+	     &error ) != 1 )
+#endif
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set file IO handle name.\n" );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open target: %" PRIs_SYSTEM ".\n",
+		 target );
+
+		goto on_error;
+	}
+	if( bde_generate_volume_write(
+	     &generate_volume,
+	     file_io_handle,
+	     option_password,
+	     option_recovery_password,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write volume.\n" );
+
+		goto on_error;
+	}
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close target.\n" );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free file IO handle.\n" );
+
+		goto on_error;
+	}
+	memory_set(
+	 &generate_volume,
+	 0,
+	 sizeof( bde_generate_volume_t ) );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	memory_set(
+	 &generate_volume,
+	 0,
+	 sizeof( bde_generate_volume_t ) );
+
+	return( EXIT_FAILURE );
+#else
+	fprintf(
+	 stderr,
+	 "Unable to generate volume: internal functions are not available.\n" );
+
+	return( EXIT_FAILURE );
+#endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,988 @@
+/*
+ * Library block_cache type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bde_test_functions.h"
+#include "bde_test_libbde.h"
+#include "bde_test_libbfio.h"
+#include "bde_test_libcerror.h"
+#include "bde_test_macros.h"
+#include "bde_test_memory.h"
+#include "bde_test_unused.h"
+
+#include "../libbde/libbde_block_cache.h"
+#include "../libbde/libbde_io_handle.h"
+
+#define BDE_TEST_BLOCK_CACHE_DATA_SIZE		( 200 * 1024 )
+
+uint8_t bde_test_block_cache_data[ BDE_TEST_BLOCK_CACHE_DATA_SIZE ];
+
+/* Tests the libbde_block_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_block_cache_initialize(
+     void )
+{
+	libbde_block_cache_t *block_cache = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_BDE_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 1;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libbde_block_cache_initialize(
+	          &block_cache,
+	          1024 * 1024,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbde_block_cache_initialize(
+	          NULL,
+	          1024 * 1024,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	block_cache = (libbde_block_cache_t *) 0x12345678UL;
+
+	result = libbde_block_cache_initialize(
+	          &block_cache,
+	          1024 * 1024,
+	          &error );
+
+	block_cache = NULL;
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The maximum size must be able to contain at least one block
+	 */
+	result = libbde_block_cache_initialize(
+	          &block_cache,
+	          512,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BDE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libbde_block_cache_initialize with malloc failing
+		 */
+		bde_test_malloc_attempts_before_fail = test_number;
+
+		result = libbde_block_cache_initialize(
+		          &block_cache,
+		          1024 * 1024,
+		          &error );
+
+		if( bde_test_malloc_attempts_before_fail != -1 )
+		{
+			bde_test_malloc_attempts_before_fail = -1;
+
+			if( block_cache != NULL )
+			{
+				libbde_block_cache_free(
+				 &block_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			BDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BDE_TEST_ASSERT_IS_NULL(
+			 "block_cache",
+			 block_cache );
+
+			BDE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libbde_block_cache_initialize with memset failing
+		 */
+		bde_test_memset_attempts_before_fail = test_number;
+
+		result = libbde_block_cache_initialize(
+		          &block_cache,
+		          1024 * 1024,
+		          &error );
+
+		if( bde_test_memset_attempts_before_fail != -1 )
+		{
+			bde_test_memset_attempts_before_fail = -1;
+
+			if( block_cache != NULL )
+			{
+				libbde_block_cache_free(
+				 &block_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			BDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BDE_TEST_ASSERT_IS_NULL(
+			 "block_cache",
+			 block_cache );
+
+			BDE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_BDE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libbde_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_block_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_block_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libbde_block_cache_free(
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
+
+/* Tests the libbde_block_cache_bind_image function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_block_cache_bind_image(
+     void )
+{
+	libbde_block_cache_t *block_cache = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libbde_block_cache_initialize(
+	          &block_cache,
+	          128 * 1024,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbde_block_cache_bind_image(
+	          block_cache,
+	          0x1234,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the block cache can be bound again to the same image
+	 */
+	result = libbde_block_cache_bind_image(
+	          block_cache,
+	          0x1234,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the block cache cannot be bound to another image
+	 */
+	result = libbde_block_cache_bind_image(
+	          block_cache,
+	          0x5678,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbde_block_cache_bind_image(
+	          NULL,
+	          0x1234,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbde_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libbde_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_block_cache_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_block_cache_read_buffer_at_offset(
+     void )
+{
+	uint8_t buffer[ 512 ];
+
+	libbde_block_cache_t *block_cache = NULL;
+	libbde_io_handle_t *io_handle     = NULL;
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	size_t data_index                 = 0;
+	ssize_t read_count                = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < BDE_TEST_BLOCK_CACHE_DATA_SIZE;
+	     data_index++ )
+	{
+		bde_test_block_cache_data[ data_index ] = (uint8_t) ( ( data_index * 7 ) % 251 );
+	}
+	result = libbde_block_cache_initialize(
+	          &block_cache,
+	          128 * 1024,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_cache = block_cache;
+
+	result = bde_test_open_file_io_handle(
+	          &file_io_handle,
+	          bde_test_block_cache_data,
+	          BDE_TEST_BLOCK_CACHE_DATA_SIZE,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libbde_block_cache_read_buffer_at_offset(
+	              block_cache,
+	              io_handle,
+	              file_io_handle,
+	              buffer,
+	              512,
+	              1024,
+	              &( io_handle->statistics ),
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( bde_test_block_cache_data[ 1024 ] ),
+	          512 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics.number_of_block_cache_misses",
+	 io_handle->statistics.number_of_block_cache_misses,
+	 (uint64_t) 1 );
+
+	/* The block that contains the sector was read as a whole
+	 */
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics.number_of_bytes_read",
+	 io_handle->statistics.number_of_bytes_read,
+	 (uint64_t) 65536 );
+
+	/* Read data from the block cache
+	 */
+	read_count = libbde_block_cache_read_buffer_at_offset(
+	              block_cache,
+	              io_handle,
+	              file_io_handle,
+	              buffer,
+	              512,
+	              4096,
+	              &( io_handle->statistics ),
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( bde_test_block_cache_data[ 4096 ] ),
+	          512 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics.number_of_block_cache_hits",
+	 io_handle->statistics.number_of_block_cache_hits,
+	 (uint64_t) 1 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics.number_of_bytes_read",
+	 io_handle->statistics.number_of_bytes_read,
+	 (uint64_t) 65536 );
+
+	/* Read data that spans 2 blocks
+	 */
+	read_count = libbde_block_cache_read_buffer_at_offset(
+	              block_cache,
+	              io_handle,
+	              file_io_handle,
+	              buffer,
+	              512,
+	              65536 - 256,
+	              &( io_handle->statistics ),
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( bde_test_block_cache_data[ 65536 - 256 ] ),
+	          512 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics.number_of_block_cache_hits",
+	 io_handle->statistics.number_of_block_cache_hits,
+	 (uint64_t) 2 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics.number_of_block_cache_misses",
+	 io_handle->statistics.number_of_block_cache_misses,
+	 (uint64_t) 2 );
+
+	/* Read data from the last block, which is not complete
+	 */
+	read_count = libbde_block_cache_read_buffer_at_offset(
+	              block_cache,
+	              io_handle,
+	              file_io_handle,
+	              buffer,
+	              512,
+	              BDE_TEST_BLOCK_CACHE_DATA_SIZE - 512,
+	              &( io_handle->statistics ),
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( bde_test_block_cache_data[ BDE_TEST_BLOCK_CACHE_DATA_SIZE - 512 ] ),
+	          512 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Read data that spans the end of the data
+	 */
+	read_count = libbde_block_cache_read_buffer_at_offset(
+	              block_cache,
+	              io_handle,
+	              file_io_handle,
+	              buffer,
+	              512,
+	              BDE_TEST_BLOCK_CACHE_DATA_SIZE - 256,
+	              &( io_handle->statistics ),
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 256 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Read data beyond the end of the data
+	 */
+	read_count = libbde_block_cache_read_buffer_at_offset(
+	              block_cache,
+	              io_handle,
+	              file_io_handle,
+	              buffer,
+	              512,
+	              BDE_TEST_BLOCK_CACHE_DATA_SIZE + 512,
+	              &( io_handle->statistics ),
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Blocks are shared by their offset in the image
+	 */
+	io_handle->block_cache_offset = 65536;
+
+	read_count = libbde_block_cache_read_buffer_at_offset(
+	              block_cache,
+	              io_handle,
+	              file_io_handle,
+	              buffer,
+	              512,
+	              1024,
+	              &( io_handle->statistics ),
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( bde_test_block_cache_data[ 65536 + 1024 ] ),
+	          512 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics.number_of_block_cache_hits",
+	 io_handle->statistics.number_of_block_cache_hits,
+	 (uint64_t) 3 );
+
+	io_handle->block_cache_offset = 0;
+
+	/* Test error cases
+	 */
+	read_count = libbde_block_cache_read_buffer_at_offset(
+	              NULL,
+	              io_handle,
+	              file_io_handle,
+	              buffer,
+	              512,
+	              0,
+	              &( io_handle->statistics ),
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbde_block_cache_read_buffer_at_offset(
+	              block_cache,
+	              NULL,
+	              file_io_handle,
+	              buffer,
+	              512,
+	              0,
+	              &( io_handle->statistics ),
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbde_block_cache_read_buffer_at_offset(
+	              block_cache,
+	              io_handle,
+	              file_io_handle,
+	              NULL,
+	              512,
+	              0,
+	              &( io_handle->statistics ),
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbde_block_cache_read_buffer_at_offset(
+	              block_cache,
+	              io_handle,
+	              file_io_handle,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &( io_handle->statistics ),
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbde_block_cache_read_buffer_at_offset(
+	              block_cache,
+	              io_handle,
+	              file_io_handle,
+	              buffer,
+	              512,
+	              -1,
+	              &( io_handle->statistics ),
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = bde_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libbde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( block_cache != NULL )
+	{
+		libbde_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc BDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] BDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc BDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] BDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	BDE_TEST_UNREFERENCED_PARAMETER( argc )
+	BDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	BDE_TEST_RUN(
+	 "libbde_block_cache_initialize",
+	 bde_test_block_cache_initialize );
+
+	BDE_TEST_RUN(
+	 "libbde_block_cache_free",
+	 bde_test_block_cache_free );
+
+#if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
+
+	BDE_TEST_RUN(
+	 "libbde_block_cache_bind_image",
+	 bde_test_block_cache_bind_image );
+
+	BDE_TEST_RUN(
+	 "libbde_block_cache_read_buffer_at_offset",
+	 bde_test_block_cache_read_buffer_at_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1473 @@
+/*
+ * Library direct_file_io_handle type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bde_test_functions.h"
+#include "bde_test_libbde.h"
+#include "bde_test_libbfio.h"
+#include "bde_test_libcerror.h"
+#include "bde_test_macros.h"
+#include "bde_test_memory.h"
+#include "bde_test_unused.h"
+
+#include "../libbde/libbde_direct_file_io_handle.h"
+
+#define BDE_TEST_DIRECT_FILE_IO_HANDLE_FILENAME		"bde_test_direct_file.raw"
+
+#if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
+
+/* Tests the libbde_direct_file_io_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_direct_file_io_handle_initialize(
+     void )
+{
+	libbde_direct_file_io_handle_t *direct_file_io_handle = NULL;
+	libcerror_error_t *error                              = NULL;
+	int result                                            = 0;
+
+#if defined( HAVE_BDE_TEST_MEMORY )
+	int number_of_malloc_fail_tests                       = 1;
+	int number_of_memset_fail_tests                       = 1;
+	int test_number                                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libbde_direct_file_io_handle_initialize(
+	          &direct_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "direct_file_io_handle",
+	 direct_file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_direct_file_io_handle_free(
+	          &direct_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "direct_file_io_handle",
+	 direct_file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbde_direct_file_io_handle_initialize(
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	direct_file_io_handle = (libbde_direct_file_io_handle_t *) 0x12345678UL;
+
+	result = libbde_direct_file_io_handle_initialize(
+	          &direct_file_io_handle,
+	          &error );
+
+	direct_file_io_handle = NULL;
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BDE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libbde_direct_file_io_handle_initialize with malloc failing
+		 */
+		bde_test_malloc_attempts_before_fail = test_number;
+
+		result = libbde_direct_file_io_handle_initialize(
+		          &direct_file_io_handle,
+		          &error );
+
+		if( bde_test_malloc_attempts_before_fail != -1 )
+		{
+			bde_test_malloc_attempts_before_fail = -1;
+
+			if( direct_file_io_handle != NULL )
+			{
+				libbde_direct_file_io_handle_free(
+				 &direct_file_io_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			BDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BDE_TEST_ASSERT_IS_NULL(
+			 "direct_file_io_handle",
+			 direct_file_io_handle );
+
+			BDE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libbde_direct_file_io_handle_initialize with memset failing
+		 */
+		bde_test_memset_attempts_before_fail = test_number;
+
+		result = libbde_direct_file_io_handle_initialize(
+		          &direct_file_io_handle,
+		          &error );
+
+		if( bde_test_memset_attempts_before_fail != -1 )
+		{
+			bde_test_memset_attempts_before_fail = -1;
+
+			if( direct_file_io_handle != NULL )
+			{
+				libbde_direct_file_io_handle_free(
+				 &direct_file_io_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			BDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BDE_TEST_ASSERT_IS_NULL(
+			 "direct_file_io_handle",
+			 direct_file_io_handle );
+
+			BDE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_BDE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( direct_file_io_handle != NULL )
+	{
+		libbde_direct_file_io_handle_free(
+		 &direct_file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_direct_file_io_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_direct_file_io_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libbde_direct_file_io_handle_free(
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_direct_file_io_handle_set_name function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_direct_file_io_handle_set_name(
+     void )
+{
+	libbde_direct_file_io_handle_t *destination_direct_file_io_handle = NULL;
+	libbde_direct_file_io_handle_t *direct_file_io_handle             = NULL;
+	libcerror_error_t *error                                          = NULL;
+	int result                                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libbde_direct_file_io_handle_initialize(
+	          &direct_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "direct_file_io_handle",
+	 direct_file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbde_direct_file_io_handle_set_name(
+	          direct_file_io_handle,
+	          BDE_TEST_DIRECT_FILE_IO_HANDLE_FILENAME,
+	          24,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BDE_TEST_ASSERT_EQUAL_SIZE(
+	 "direct_file_io_handle->name_size",
+	 direct_file_io_handle->name_size,
+	 (size_t) 25 );
+
+	BDE_TEST_ASSERT_EQUAL_SIZE(
+	 "direct_file_io_handle->block_size",
+	 direct_file_io_handle->block_size,
+	 (size_t) LIBBDE_DIRECT_FILE_IO_HANDLE_BLOCK_SIZE );
+
+	/* Test that the name is copied when the direct file IO handle is cloned
+	 */
+	result = libbde_direct_file_io_handle_clone(
+	          &destination_direct_file_io_handle,
+	          direct_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_direct_file_io_handle",
+	 destination_direct_file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BDE_TEST_ASSERT_EQUAL_SIZE(
+	 "destination_direct_file_io_handle->name_size",
+	 destination_direct_file_io_handle->name_size,
+	 (size_t) 25 );
+
+	BDE_TEST_ASSERT_EQUAL_SIZE(
+	 "destination_direct_file_io_handle->block_size",
+	 destination_direct_file_io_handle->block_size,
+	 (size_t) LIBBDE_DIRECT_FILE_IO_HANDLE_CLONE_BLOCK_SIZE );
+
+	result = libbde_direct_file_io_handle_free(
+	          &destination_direct_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbde_direct_file_io_handle_set_name(
+	          NULL,
+	          BDE_TEST_DIRECT_FILE_IO_HANDLE_FILENAME,
+	          24,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_direct_file_io_handle_set_name(
+	          direct_file_io_handle,
+	          NULL,
+	          24,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_direct_file_io_handle_set_name(
+	          direct_file_io_handle,
+	          BDE_TEST_DIRECT_FILE_IO_HANDLE_FILENAME,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbde_direct_file_io_handle_free(
+	          &direct_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "direct_file_io_handle",
+	 direct_file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_direct_file_io_handle != NULL )
+	{
+		libbde_direct_file_io_handle_free(
+		 &destination_direct_file_io_handle,
+		 NULL );
+	}
+	if( direct_file_io_handle != NULL )
+	{
+		libbde_direct_file_io_handle_free(
+		 &direct_file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_LIBBDE_DIRECT_FILE_SUPPORT )
+
+/* Tests the libbde_direct_file_io_handle_read_block function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_direct_file_io_handle_read_block(
+     void )
+{
+	uint8_t data[ 4096 ];
+	char filename[ 512 ];
+
+	libbde_direct_file_io_handle_t *direct_file_io_handle = NULL;
+	libcerror_error_t *error                              = NULL;
+	uint8_t *block_data                                   = NULL;
+	ssize_t read_count                                    = 0;
+	size_t data_index                                     = 0;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	filename[ 0 ] = 0;
+
+	for( data_index = 0;
+	     data_index < 4096;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) ( data_index % 251 );
+	}
+	result = bde_test_create_temporary_file(
+	          filename,
+	          512,
+	          data,
+	          4096,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The block data is not necessarily aligned, which is expected
+	 * to be handled by falling back to reading without direct IO
+	 */
+	block_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * LIBBDE_DIRECT_FILE_IO_HANDLE_ALIGNMENT );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "block_data",
+	 block_data );
+
+	result = libbde_direct_file_io_handle_initialize(
+	          &direct_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "direct_file_io_handle",
+	 direct_file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_direct_file_io_handle_set_name(
+	          direct_file_io_handle,
+	          filename,
+	          narrow_string_length(
+	           filename ),
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_direct_file_io_handle_open(
+	          direct_file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libbde_direct_file_io_handle_read_block(
+	              direct_file_io_handle,
+	              0,
+	              block_data,
+	              LIBBDE_DIRECT_FILE_IO_HANDLE_ALIGNMENT,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4096 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          block_data,
+	          data,
+	          4096 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	read_count = libbde_direct_file_io_handle_read_block(
+	              NULL,
+	              0,
+	              block_data,
+	              LIBBDE_DIRECT_FILE_IO_HANDLE_ALIGNMENT,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbde_direct_file_io_handle_read_block(
+	              direct_file_io_handle,
+	              -1,
+	              block_data,
+	              LIBBDE_DIRECT_FILE_IO_HANDLE_ALIGNMENT,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbde_direct_file_io_handle_read_block(
+	              direct_file_io_handle,
+	              0,
+	              NULL,
+	              LIBBDE_DIRECT_FILE_IO_HANDLE_ALIGNMENT,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbde_direct_file_io_handle_close(
+	          direct_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_direct_file_io_handle_free(
+	          &direct_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "direct_file_io_handle",
+	 direct_file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 block_data );
+
+	result = bde_test_remove_temporary_file(
+	          filename,
+	          &error );
+
+	filename[ 0 ] = 0;
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( direct_file_io_handle != NULL )
+	{
+		libbde_direct_file_io_handle_free(
+		 &direct_file_io_handle,
+		 NULL );
+	}
+	if( block_data != NULL )
+	{
+		memory_free(
+		 block_data );
+	}
+	if( filename[ 0 ] != 0 )
+	{
+		bde_test_remove_temporary_file(
+		 filename,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_direct_file_io_handle_read function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_direct_file_io_handle_read(
+     void )
+{
+	uint8_t buffer[ 1024 ];
+	char filename[ 512 ];
+
+	libbde_direct_file_io_handle_t *destination_direct_file_io_handle = NULL;
+	libbde_direct_file_io_handle_t *direct_file_io_handle             = NULL;
+	libcerror_error_t *error                                          = NULL;
+	uint8_t *data                                                     = NULL;
+	size_t data_index                                                 = 0;
+	size_t data_size                                                  = 0;
+	ssize_t read_count                                                = 0;
+	off64_t offset                                                    = 0;
+	int result                                                        = 0;
+
+	/* Initialize test
+	 * The file spans more blocks than fit in the block pool of a clone
+	 * and does not end on a block boundary
+	 */
+	filename[ 0 ] = 0;
+
+	data_size = ( 3 * LIBBDE_DIRECT_FILE_IO_HANDLE_CLONE_BLOCK_SIZE ) + 512;
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	for( data_index = 0;
+	     data_index < data_size;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) ( data_index % 251 );
+	}
+	result = bde_test_create_temporary_file(
+	          filename,
+	          512,
+	          data,
+	          data_size,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_direct_file_io_handle_initialize(
+	          &direct_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_direct_file_io_handle_set_name(
+	          direct_file_io_handle,
+	          filename,
+	          narrow_string_length(
+	           filename ),
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The read workers read from a clone hence the clone is tested
+	 */
+	result = libbde_direct_file_io_handle_clone(
+	          &destination_direct_file_io_handle,
+	          direct_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_direct_file_io_handle_open(
+	          destination_direct_file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	offset = libbde_direct_file_io_handle_seek_offset(
+	          destination_direct_file_io_handle,
+	          1000,
+	          SEEK_SET,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 1000 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbde_direct_file_io_handle_read(
+	              destination_direct_file_io_handle,
+	              buffer,
+	              1000,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1000 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ 1000 ] ),
+	          1000 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read that spans the boundary of two blocks
+	 */
+	offset = libbde_direct_file_io_handle_seek_offset(
+	          destination_direct_file_io_handle,
+	          LIBBDE_DIRECT_FILE_IO_HANDLE_CLONE_BLOCK_SIZE - 300,
+	          SEEK_SET,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) ( LIBBDE_DIRECT_FILE_IO_HANDLE_CLONE_BLOCK_SIZE - 300 ) );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbde_direct_file_io_handle_read(
+	              destination_direct_file_io_handle,
+	              buffer,
+	              1000,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1000 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ LIBBDE_DIRECT_FILE_IO_HANDLE_CLONE_BLOCK_SIZE - 300 ] ),
+	          1000 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read that requires a block in the block pool to be replaced
+	 */
+	offset = libbde_direct_file_io_handle_seek_offset(
+	          destination_direct_file_io_handle,
+	          ( 2 * LIBBDE_DIRECT_FILE_IO_HANDLE_CLONE_BLOCK_SIZE ) + 7,
+	          SEEK_SET,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) ( ( 2 * LIBBDE_DIRECT_FILE_IO_HANDLE_CLONE_BLOCK_SIZE ) + 7 ) );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbde_direct_file_io_handle_read(
+	              destination_direct_file_io_handle,
+	              buffer,
+	              1000,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1000 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ ( 2 * LIBBDE_DIRECT_FILE_IO_HANDLE_CLONE_BLOCK_SIZE ) + 7 ] ),
+	          1000 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read that is truncated at the end of the file
+	 */
+	offset = libbde_direct_file_io_handle_seek_offset(
+	          destination_direct_file_io_handle,
+	          -256,
+	          SEEK_END,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) ( data_size - 256 ) );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbde_direct_file_io_handle_read(
+	              destination_direct_file_io_handle,
+	              buffer,
+	              1024,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 256 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ data_size - 256 ] ),
+	          256 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "destination_direct_file_io_handle->current_offset",
+	 (int64_t) destination_direct_file_io_handle->current_offset,
+	 (int64_t) data_size );
+
+	/* Test a read at the end of the file
+	 */
+
+	read_count = libbde_direct_file_io_handle_read(
+	              destination_direct_file_io_handle,
+	              buffer,
+	              1024,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libbde_direct_file_io_handle_read(
+	              NULL,
+	              buffer,
+	              1024,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbde_direct_file_io_handle_read(
+	              destination_direct_file_io_handle,
+	              NULL,
+	              1024,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that a read of a direct file IO handle that is not open fails
+	 */
+	read_count = libbde_direct_file_io_handle_read(
+	              direct_file_io_handle,
+	              buffer,
+	              1024,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbde_direct_file_io_handle_close(
+	          destination_direct_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_direct_file_io_handle_free(
+	          &destination_direct_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_direct_file_io_handle_free(
+	          &direct_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bde_test_remove_temporary_file(
+	          filename,
+	          &error );
+
+	filename[ 0 ] = 0;
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_direct_file_io_handle != NULL )
+	{
+		libbde_direct_file_io_handle_free(
+		 &destination_direct_file_io_handle,
+		 NULL );
+	}
+	if( direct_file_io_handle != NULL )
+	{
+		libbde_direct_file_io_handle_free(
+		 &direct_file_io_handle,
+		 NULL );
+	}
+	if( filename[ 0 ] != 0 )
+	{
+		bde_test_remove_temporary_file(
+		 filename,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_direct_file_open function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_direct_file_open(
+     void )
+{
+	uint8_t buffer[ 512 ];
+	uint8_t data[ 4096 ];
+	char filename[ 512 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	size64_t size                    = 0;
+	ssize_t read_count               = 0;
+	size_t data_index                = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	filename[ 0 ] = 0;
+
+	for( data_index = 0;
+	     data_index < 4096;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) ( data_index % 251 );
+	}
+	result = bde_test_create_temporary_file(
+	          filename,
+	          512,
+	          data,
+	          4096,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbde_direct_file_open(
+	          &file_io_handle,
+	          filename,
+	          narrow_string_length(
+	           filename ),
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_size(
+	          file_io_handle,
+	          &size,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 4096 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              512,
+	              1024,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ 1024 ] ),
+	          512 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read at the end of the file
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              512,
+	              3840,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 256 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bde_test_remove_temporary_file(
+	          filename,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a file that cannot be opened is not an error
+	 */
+	result = libbde_direct_file_open(
+	          &file_io_handle,
+	          filename,
+	          narrow_string_length(
+	           filename ),
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( filename[ 0 ] != 0 )
+	{
+		bde_test_remove_temporary_file(
+		 filename,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBBDE_DIRECT_FILE_SUPPORT ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc BDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] BDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc BDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] BDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	BDE_TEST_UNREFERENCED_PARAMETER( argc )
+	BDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
+
+	BDE_TEST_RUN(
+	 "libbde_direct_file_io_handle_initialize",
+	 bde_test_direct_file_io_handle_initialize );
+
+	BDE_TEST_RUN(
+	 "libbde_direct_file_io_handle_free",
+	 bde_test_direct_file_io_handle_free );
+
+	BDE_TEST_RUN(
+	 "libbde_direct_file_io_handle_set_name",
+	 bde_test_direct_file_io_handle_set_name );
+
+#if defined( HAVE_LIBBDE_DIRECT_FILE_SUPPORT )
+
+	BDE_TEST_RUN(
+	 "libbde_direct_file_io_handle_read_block",
+	 bde_test_direct_file_io_handle_read_block );
+
+	BDE_TEST_RUN(
+	 "libbde_direct_file_io_handle_read",
+	 bde_test_direct_file_io_handle_read );
+
+	BDE_TEST_RUN(
+	 "libbde_direct_file_open",
+	 bde_test_direct_file_open );
+
+#endif /* defined( HAVE_LIBBDE_DIRECT_FILE_SUPPORT ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -276,6 +277,750 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libbde_encryption_context_crypt function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_encryption_context_crypt(
+     void )
+{
+	uint16_t methods[ 6 ] = {
+		LIBBDE_ENCRYPTION_METHOD_AES_128_CBC,
+		LIBBDE_ENCRYPTION_METHOD_AES_128_CBC_DIFFUSER,
+		LIBBDE_ENCRYPTION_METHOD_AES_256_CBC,
+		LIBBDE_ENCRYPTION_METHOD_AES_256_CBC_DIFFUSER,
+		LIBBDE_ENCRYPTION_METHOD_AES_128_XTS,
+		LIBBDE_ENCRYPTION_METHOD_AES_256_XTS };
+
+	uint8_t decrypted_data[ 512 ];
+	uint8_t encrypted_data[ 512 ];
+	uint8_t key_data[ 64 ];
+	uint8_t plaintext_data[ 512 ];
+	uint8_t tweak_key_data[ 32 ];
+
+	libbde_encryption_context_t *encryption_context = NULL;
+	libcerror_error_t *error                        = NULL;
+	size_t data_index                               = 0;
+	int method_index                                = 0;
+	int result                                      = 0;
+
+	for( data_index = 0;
+	     data_index < 64;
+	     data_index++ )
+	{
+		key_data[ data_index ] = (uint8_t) data_index;
+	}
+	for( data_index = 0;
+	     data_index < 32;
+	     data_index++ )
+	{
+		tweak_key_data[ data_index ] = (uint8_t) ( 0xff - data_index );
+	}
+	for( data_index = 0;
+	     data_index < 512;
+	     data_index++ )
+	{
+		plaintext_data[ data_index ] = (uint8_t) ( data_index % 251 );
+	}
+	/* Test regular cases
+	 */
+	for( method_index = 0;
+	     method_index < 6;
+	     method_index++ )
+	{
+		result = libbde_encryption_context_initialize(
+		          &encryption_context,
+		          methods[ method_index ],
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BDE_TEST_ASSERT_IS_NOT_NULL(
+		 "encryption_context",
+		 encryption_context );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbde_encryption_context_set_keys(
+		          encryption_context,
+		          key_data,
+		          64,
+		          tweak_key_data,
+		          32,
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbde_encryption_context_crypt(
+		          encryption_context,
+		          LIBBDE_ENCRYPTION_CRYPT_MODE_ENCRYPT,
+		          plaintext_data,
+		          512,
+		          encrypted_data,
+		          512,
+		          4096,
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          encrypted_data,
+		          plaintext_data,
+		          512 );
+
+		BDE_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libbde_encryption_context_crypt(
+		          encryption_context,
+		          LIBBDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+		          encrypted_data,
+		          512,
+		          decrypted_data,
+		          512,
+		          4096,
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          decrypted_data,
+		          plaintext_data,
+		          512 );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libbde_encryption_context_free(
+		          &encryption_context,
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libbde_encryption_context_crypt(
+	          NULL,
+	          LIBBDE_ENCRYPTION_CRYPT_MODE_ENCRYPT,
+	          plaintext_data,
+	          512,
+	          encrypted_data,
+	          512,
+	          4096,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( encryption_context != NULL )
+	{
+		libbde_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_encryption_context_crypt_sectors function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_encryption_context_crypt_sectors(
+     void )
+{
+	uint16_t methods[ 6 ] = {
+		LIBBDE_ENCRYPTION_METHOD_AES_128_CBC,
+		LIBBDE_ENCRYPTION_METHOD_AES_128_CBC_DIFFUSER,
+		LIBBDE_ENCRYPTION_METHOD_AES_256_CBC,
+		LIBBDE_ENCRYPTION_METHOD_AES_256_CBC_DIFFUSER,
+		LIBBDE_ENCRYPTION_METHOD_AES_128_XTS,
+		LIBBDE_ENCRYPTION_METHOD_AES_256_XTS };
+
+	uint8_t decrypted_data[ 2048 ];
+	uint8_t encrypted_data[ 2048 ];
+	uint8_t key_data[ 64 ];
+	uint8_t plaintext_data[ 2048 ];
+	uint8_t sector_encrypted_data[ 512 ];
+	uint8_t tweak_key_data[ 32 ];
+
+	libbde_encryption_context_t *encryption_context = NULL;
+	libcerror_error_t *error                        = NULL;
+	size_t data_index                               = 0;
+	uint64_t block_key                              = 0;
+	int method_index                                = 0;
+	int result                                      = 0;
+	int sector_index                                = 0;
+
+	for( data_index = 0;
+	     data_index < 64;
+	     data_index++ )
+	{
+		key_data[ data_index ] = (uint8_t) data_index;
+	}
+	for( data_index = 0;
+	     data_index < 32;
+	     data_index++ )
+	{
+		tweak_key_data[ data_index ] = (uint8_t) ( 0xff - data_index );
+	}
+	for( data_index = 0;
+	     data_index < 2048;
+	     data_index++ )
+	{
+		plaintext_data[ data_index ] = (uint8_t) ( data_index % 251 );
+	}
+	/* Test regular cases
+	 */
+	for( method_index = 0;
+	     method_index < 6;
+	     method_index++ )
+	{
+		result = libbde_encryption_context_initialize(
+		          &encryption_context,
+		          methods[ method_index ],
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BDE_TEST_ASSERT_IS_NOT_NULL(
+		 "encryption_context",
+		 encryption_context );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test error case where the keys have not been set
+		 */
+		result = libbde_encryption_context_crypt_sectors(
+		          encryption_context,
+		          LIBBDE_ENCRYPTION_CRYPT_MODE_ENCRYPT,
+		          plaintext_data,
+		          2048,
+		          encrypted_data,
+		          2048,
+		          4096,
+		          512,
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BDE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libbde_encryption_context_set_keys(
+		          encryption_context,
+		          key_data,
+		          64,
+		          tweak_key_data,
+		          32,
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbde_encryption_context_crypt_sectors(
+		          encryption_context,
+		          LIBBDE_ENCRYPTION_CRYPT_MODE_ENCRYPT,
+		          plaintext_data,
+		          2048,
+		          encrypted_data,
+		          2048,
+		          4096,
+		          512,
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Every sector should match the sector encrypted individually
+		 * with the block key derived from its offset
+		 */
+		for( sector_index = 0;
+		     sector_index < 4;
+		     sector_index++ )
+		{
+			block_key = 4096 + ( (uint64_t) sector_index * 512 );
+
+			if( ( methods[ method_index ] == LIBBDE_ENCRYPTION_METHOD_AES_128_XTS )
+			 || ( methods[ method_index ] == LIBBDE_ENCRYPTION_METHOD_AES_256_XTS ) )
+			{
+				block_key /= 512;
+			}
+			result = libbde_encryption_context_crypt(
+			          encryption_context,
+			          LIBBDE_ENCRYPTION_CRYPT_MODE_ENCRYPT,
+			          &( plaintext_data[ sector_index * 512 ] ),
+			          512,
+			          sector_encrypted_data,
+			          512,
+			          block_key,
+			          &error );
+
+			BDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			BDE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          &( encrypted_data[ sector_index * 512 ] ),
+			          sector_encrypted_data,
+			          512 );
+
+			BDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		result = libbde_encryption_context_crypt_sectors(
+		          encryption_context,
+		          LIBBDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+		          encrypted_data,
+		          2048,
+		          decrypted_data,
+		          2048,
+		          4096,
+		          512,
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          decrypted_data,
+		          plaintext_data,
+		          2048 );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* Test with more sectors than are handled in a single batch
+		 */
+		result = libbde_encryption_context_crypt_sectors(
+		          encryption_context,
+		          LIBBDE_ENCRYPTION_CRYPT_MODE_ENCRYPT,
+		          plaintext_data,
+		          2048,
+		          encrypted_data,
+		          2048,
+		          4096,
+		          32,
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( sector_index = 0;
+		     sector_index < 64;
+		     sector_index++ )
+		{
+			block_key = 4096 + ( (uint64_t) sector_index * 32 );
+
+			if( ( methods[ method_index ] == LIBBDE_ENCRYPTION_METHOD_AES_128_XTS )
+			 || ( methods[ method_index ] == LIBBDE_ENCRYPTION_METHOD_AES_256_XTS ) )
+			{
+				block_key /= 32;
+			}
+			result = libbde_encryption_context_crypt(
+			          encryption_context,
+			          LIBBDE_ENCRYPTION_CRYPT_MODE_ENCRYPT,
+			          &( plaintext_data[ sector_index * 32 ] ),
+			          32,
+			          sector_encrypted_data,
+			          32,
+			          block_key,
+			          &error );
+
+			BDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			BDE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          &( encrypted_data[ sector_index * 32 ] ),
+			          sector_encrypted_data,
+			          32 );
+
+			BDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		result = libbde_encryption_context_crypt_sectors(
+		          encryption_context,
+		          LIBBDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+		          encrypted_data,
+		          2048,
+		          decrypted_data,
+		          2048,
+		          4096,
+		          32,
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          decrypted_data,
+		          plaintext_data,
+		          2048 );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libbde_encryption_context_free(
+		          &encryption_context,
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Initialize test
+	 */
+	result = libbde_encryption_context_initialize(
+	          &encryption_context,
+	          LIBBDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_encryption_context_set_keys(
+	          encryption_context,
+	          key_data,
+	          64,
+	          NULL,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbde_encryption_context_crypt_sectors(
+	          NULL,
+	          LIBBDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          encrypted_data,
+	          2048,
+	          decrypted_data,
+	          2048,
+	          4096,
+	          512,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_encryption_context_crypt_sectors(
+	          encryption_context,
+	          -1,
+	          encrypted_data,
+	          2048,
+	          decrypted_data,
+	          2048,
+	          4096,
+	          512,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_encryption_context_crypt_sectors(
+	          encryption_context,
+	          LIBBDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          NULL,
+	          2048,
+	          decrypted_data,
+	          2048,
+	          4096,
+	          512,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_encryption_context_crypt_sectors(
+	          encryption_context,
+	          LIBBDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          encrypted_data,
+	          2048,
+	          NULL,
+	          2048,
+	          4096,
+	          512,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_encryption_context_crypt_sectors(
+	          encryption_context,
+	          LIBBDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          encrypted_data,
+	          2048,
+	          decrypted_data,
+	          1024,
+	          4096,
+	          512,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_encryption_context_crypt_sectors(
+	          encryption_context,
+	          LIBBDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          encrypted_data,
+	          2048,
+	          decrypted_data,
+	          2048,
+	          4096,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_encryption_context_crypt_sectors(
+	          encryption_context,
+	          LIBBDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          encrypted_data,
+	          2000,
+	          decrypted_data,
+	          2048,
+	          4096,
+	          512,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbde_encryption_context_free(
+	          &encryption_context,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( encryption_context != NULL )
+	{
+		libbde_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
 
 /* The main program
@@ -305,7 +1050,13 @@ int main(
 
 	/* TODO: add tests for libbde_encryption_set_keys */
 
-	/* TODO: add tests for libbde_encryption_crypt */
+	BDE_TEST_RUN(
+	 "libbde_encryption_context_crypt",
+	 bde_test_encryption_context_crypt );
+
+	BDE_TEST_RUN(
+	 "libbde_encryption_context_crypt_sectors",
+	 bde_test_encryption_context_crypt_sectors );
 
 #endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
 
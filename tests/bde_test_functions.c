@@ -30,6 +30,10 @@
 #include <stdlib.h>
 #endif
 
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
 #include "bde_test_libbfio.h"
 #include "bde_test_libcerror.h"
 #include "bde_test_libclocale.h"
@@ -670,3 +674,268 @@ int bde_test_close_file_io_handle(
 	return( result );
 }
 
+
+/* Creates a temporary file that contains test data
+ * The filename of the temporary file is stored in filename
+ * Returns 1 if successful or -1 on error
+ */
+int bde_test_create_temporary_file(
+     char *filename,
+     size_t filename_size,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	FILE *file_stream     = NULL;
+	static char *function = "bde_test_create_temporary_file";
+	size_t write_count    = 0;
+
+#if defined( WINAPI )
+	char temporary_path[ MAX_PATH ];
+
+	DWORD temporary_path_length = 0;
+
+#elif defined( HAVE_MKSTEMP )
+	const char *temporary_directory = NULL;
+	int file_descriptor             = 0;
+	int print_count                 = 0;
+#endif
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( filename_size < MAX_PATH )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid filename size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	temporary_path_length = GetTempPathA(
+	                         MAX_PATH,
+	                         temporary_path );
+
+	if( ( temporary_path_length == 0 )
+	 || ( temporary_path_length > MAX_PATH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve temporary path.",
+		 function );
+
+		return( -1 );
+	}
+	/* GetTempFileNameA creates an empty file
+	 */
+	if( GetTempFileNameA(
+	     temporary_path,
+	     "bde",
+	     0,
+	     filename ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create temporary file.",
+		 function );
+
+		return( -1 );
+	}
+#elif defined( HAVE_MKSTEMP )
+	temporary_directory = getenv(
+	                       "TMPDIR" );
+
+	if( ( temporary_directory == NULL )
+	 || ( temporary_directory[ 0 ] == 0 ) )
+	{
+		temporary_directory = "/tmp";
+	}
+	print_count = narrow_string_snprintf(
+	               filename,
+	               filename_size,
+	               "%s/bde_test_XXXXXX",
+	               temporary_directory );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= filename_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename.",
+		 function );
+
+		return( -1 );
+	}
+	file_descriptor = mkstemp(
+	                   filename );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create temporary file.",
+		 function );
+
+		return( -1 );
+	}
+	close(
+	 file_descriptor );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: temporary files not supported.",
+	 function );
+
+	return( -1 );
+#endif
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open temporary file.",
+		 function );
+
+		goto on_error;
+	}
+	if( data_size > 0 )
+	{
+		write_count = file_stream_write(
+		               file_stream,
+		               data,
+		               data_size );
+
+		if( write_count != data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data to temporary file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		file_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close temporary file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	bde_test_remove_temporary_file(
+	 filename,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Removes a temporary file
+ * Returns 1 if successful or -1 on error
+ */
+int bde_test_remove_temporary_file(
+     const char *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "bde_test_remove_temporary_file";
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( DeleteFileA(
+	     filename ) == 0 )
+#elif defined( HAVE_UNLINK )
+	if( unlink(
+	     filename ) != 0 )
+#else
+	if( remove(
+	     filename ) != 0 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+		 "%s: unable to remove temporary file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -64,6 +64,17 @@ int bde_test_close_file_io_handle(
      libbfio_handle_t **file_io_handle,
      libcerror_error_t **error );
 
+int bde_test_create_temporary_file(
+     char *filename,
+     size_t filename_size,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int bde_test_remove_temporary_file(
+     const char *filename,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
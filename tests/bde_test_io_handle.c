@@ -33,6 +33,7 @@
 #include "bde_test_memory.h"
 #include "bde_test_unused.h"
 
+#include "../libbde/libbde_block_cache.h"
 #include "../libbde/libbde_io_handle.h"
 
 #if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
@@ -276,9 +277,10 @@ on_error:
 int bde_test_io_handle_clear(
      void )
 {
-	libbde_io_handle_t *io_handle = NULL;
-	libcerror_error_t *error      = NULL;
-	int result                    = 0;
+	libbde_block_cache_t *block_cache = NULL;
+	libbde_io_handle_t *io_handle     = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
 
 	/* Initialize test
 	 */
@@ -299,6 +301,23 @@ int bde_test_io_handle_clear(
 	 "error",
 	 error );
 
+	result = libbde_block_cache_initialize(
+	          &block_cache,
+	          128 * 1024,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_cache        = block_cache;
+	io_handle->block_cache_offset = 4096;
+
 	/* Test regular cases
 	 */
 	result = libbde_io_handle_clear(
@@ -314,6 +333,28 @@ int bde_test_io_handle_clear(
 	 "error",
 	 error );
 
+	BDE_TEST_ASSERT_IS_NULL(
+	 "io_handle->block_cache",
+	 io_handle->block_cache );
+
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "io_handle->block_cache_offset",
+	 (int64_t) io_handle->block_cache_offset,
+	 (int64_t) 0 );
+
+	result = libbde_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
 	result = libbde_io_handle_clear(
@@ -389,6 +430,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( block_cache != NULL )
+	{
+		libbde_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
 	if( io_handle != NULL )
 	{
 		libbde_io_handle_free(
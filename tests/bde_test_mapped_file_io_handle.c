@@ -0,0 +1,1303 @@
+/*
+ * Library mapped_file_io_handle type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bde_test_functions.h"
+#include "bde_test_libbde.h"
+#include "bde_test_libbfio.h"
+#include "bde_test_libcerror.h"
+#include "bde_test_macros.h"
+#include "bde_test_memory.h"
+#include "bde_test_unused.h"
+
+#include "../libbde/libbde_mapped_file_io_handle.h"
+
+#define BDE_TEST_MAPPED_FILE_IO_HANDLE_FILENAME		"bde_test_mapped_file.raw"
+
+#if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
+
+/* Tests the libbde_mapped_file_io_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_mapped_file_io_handle_initialize(
+     void )
+{
+	libbde_mapped_file_io_handle_t *mapped_file_io_handle = NULL;
+	libcerror_error_t *error                              = NULL;
+	int result                                            = 0;
+
+#if defined( HAVE_BDE_TEST_MEMORY )
+	int number_of_malloc_fail_tests                       = 1;
+	int number_of_memset_fail_tests                       = 1;
+	int test_number                                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libbde_mapped_file_io_handle_initialize(
+	          &mapped_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "mapped_file_io_handle",
+	 mapped_file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_mapped_file_io_handle_free(
+	          &mapped_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "mapped_file_io_handle",
+	 mapped_file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbde_mapped_file_io_handle_initialize(
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	mapped_file_io_handle = (libbde_mapped_file_io_handle_t *) 0x12345678UL;
+
+	result = libbde_mapped_file_io_handle_initialize(
+	          &mapped_file_io_handle,
+	          &error );
+
+	mapped_file_io_handle = NULL;
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BDE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libbde_mapped_file_io_handle_initialize with malloc failing
+		 */
+		bde_test_malloc_attempts_before_fail = test_number;
+
+		result = libbde_mapped_file_io_handle_initialize(
+		          &mapped_file_io_handle,
+		          &error );
+
+		if( bde_test_malloc_attempts_before_fail != -1 )
+		{
+			bde_test_malloc_attempts_before_fail = -1;
+
+			if( mapped_file_io_handle != NULL )
+			{
+				libbde_mapped_file_io_handle_free(
+				 &mapped_file_io_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			BDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BDE_TEST_ASSERT_IS_NULL(
+			 "mapped_file_io_handle",
+			 mapped_file_io_handle );
+
+			BDE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libbde_mapped_file_io_handle_initialize with memset failing
+		 */
+		bde_test_memset_attempts_before_fail = test_number;
+
+		result = libbde_mapped_file_io_handle_initialize(
+		          &mapped_file_io_handle,
+		          &error );
+
+		if( bde_test_memset_attempts_before_fail != -1 )
+		{
+			bde_test_memset_attempts_before_fail = -1;
+
+			if( mapped_file_io_handle != NULL )
+			{
+				libbde_mapped_file_io_handle_free(
+				 &mapped_file_io_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			BDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BDE_TEST_ASSERT_IS_NULL(
+			 "mapped_file_io_handle",
+			 mapped_file_io_handle );
+
+			BDE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_BDE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mapped_file_io_handle != NULL )
+	{
+		libbde_mapped_file_io_handle_free(
+		 &mapped_file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_mapped_file_io_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_mapped_file_io_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libbde_mapped_file_io_handle_free(
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_mapped_file_io_handle_set_name function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_mapped_file_io_handle_set_name(
+     void )
+{
+	libbde_mapped_file_io_handle_t *destination_mapped_file_io_handle = NULL;
+	libbde_mapped_file_io_handle_t *mapped_file_io_handle             = NULL;
+	libcerror_error_t *error                                          = NULL;
+	int result                                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libbde_mapped_file_io_handle_initialize(
+	          &mapped_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "mapped_file_io_handle",
+	 mapped_file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbde_mapped_file_io_handle_set_name(
+	          mapped_file_io_handle,
+	          BDE_TEST_MAPPED_FILE_IO_HANDLE_FILENAME,
+	          24,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BDE_TEST_ASSERT_EQUAL_SIZE(
+	 "mapped_file_io_handle->name_size",
+	 mapped_file_io_handle->name_size,
+	 (size_t) 25 );
+
+	/* Test that the name is copied when the mapped file IO handle is cloned
+	 */
+	result = libbde_mapped_file_io_handle_clone(
+	          &destination_mapped_file_io_handle,
+	          mapped_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_mapped_file_io_handle",
+	 destination_mapped_file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BDE_TEST_ASSERT_EQUAL_SIZE(
+	 "destination_mapped_file_io_handle->name_size",
+	 destination_mapped_file_io_handle->name_size,
+	 (size_t) 25 );
+
+	result = libbde_mapped_file_io_handle_free(
+	          &destination_mapped_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbde_mapped_file_io_handle_set_name(
+	          NULL,
+	          BDE_TEST_MAPPED_FILE_IO_HANDLE_FILENAME,
+	          24,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_mapped_file_io_handle_set_name(
+	          mapped_file_io_handle,
+	          NULL,
+	          24,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_mapped_file_io_handle_set_name(
+	          mapped_file_io_handle,
+	          BDE_TEST_MAPPED_FILE_IO_HANDLE_FILENAME,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbde_mapped_file_io_handle_free(
+	          &mapped_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "mapped_file_io_handle",
+	 mapped_file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_mapped_file_io_handle != NULL )
+	{
+		libbde_mapped_file_io_handle_free(
+		 &destination_mapped_file_io_handle,
+		 NULL );
+	}
+	if( mapped_file_io_handle != NULL )
+	{
+		libbde_mapped_file_io_handle_free(
+		 &mapped_file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_mapped_file_io_handle_advise_read function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_mapped_file_io_handle_advise_read(
+     void )
+{
+	uint8_t data[ 8192 ];
+
+	libbde_mapped_file_io_handle_t mapped_file_io_handle;
+
+	off64_t offset = 0;
+	int read_index = 0;
+
+	memory_set(
+	 &mapped_file_io_handle,
+	 0,
+	 sizeof( libbde_mapped_file_io_handle_t ) );
+
+	/* The advice is not applied to an actual mapping, the data is only
+	 * used to mark the mapped file IO handle as open
+	 */
+	mapped_file_io_handle.mapped_data          = data;
+	mapped_file_io_handle.mapped_data_size     = 8192;
+	mapped_file_io_handle.page_size            = 4096;
+	mapped_file_io_handle.last_read_end_offset = -1;
+
+	/* Test that contiguous reads result in sequential access
+	 */
+	for( read_index = 0;
+	     read_index < LIBBDE_MAPPED_FILE_IO_HANDLE_ADVICE_THRESHOLD + 1;
+	     read_index++ )
+	{
+		libbde_mapped_file_io_handle_advise_read(
+		 &mapped_file_io_handle,
+		 offset,
+		 512 );
+
+		offset += 512;
+	}
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "mapped_file_io_handle.advice",
+	 mapped_file_io_handle.advice,
+	 LIBBDE_MAPPED_FILE_IO_HANDLE_ADVICE_SEQUENTIAL );
+
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "mapped_file_io_handle.read_ahead_end_offset",
+	 (int64_t) mapped_file_io_handle.read_ahead_end_offset,
+	 (int64_t) 8192 );
+
+	/* Test that non-contiguous reads result in random access
+	 */
+	for( read_index = 0;
+	     read_index < LIBBDE_MAPPED_FILE_IO_HANDLE_ADVICE_THRESHOLD;
+	     read_index++ )
+	{
+		offset = (off64_t) ( ( 3 - read_index ) * 1024 );
+
+		libbde_mapped_file_io_handle_advise_read(
+		 &mapped_file_io_handle,
+		 offset,
+		 512 );
+	}
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "mapped_file_io_handle.advice",
+	 mapped_file_io_handle.advice,
+	 LIBBDE_MAPPED_FILE_IO_HANDLE_ADVICE_RANDOM );
+
+	/* Test error cases
+	 */
+	libbde_mapped_file_io_handle_advise_read(
+	 NULL,
+	 0,
+	 512 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#if defined( HAVE_LIBBDE_MAPPED_FILE_SUPPORT )
+
+/* Tests the libbde_mapped_file_io_handle_read function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_mapped_file_io_handle_read(
+     void )
+{
+	uint8_t buffer[ 512 ];
+	uint8_t data[ 4096 ];
+	char filename[ 512 ];
+
+	libbde_mapped_file_io_handle_t *mapped_file_io_handle = NULL;
+	libcerror_error_t *error                              = NULL;
+	size64_t size                                         = 0;
+	ssize_t read_count                                    = 0;
+	off64_t offset                                        = 0;
+	size_t data_index                                     = 0;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	filename[ 0 ] = 0;
+
+	for( data_index = 0;
+	     data_index < 4096;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) ( data_index % 253 );
+	}
+	result = bde_test_create_temporary_file(
+	          filename,
+	          512,
+	          data,
+	          4096,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_mapped_file_io_handle_initialize(
+	          &mapped_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "mapped_file_io_handle",
+	 mapped_file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_mapped_file_io_handle_set_name(
+	          mapped_file_io_handle,
+	          filename,
+	          narrow_string_length(
+	           filename ),
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a read of a mapped file IO handle that is not open fails
+	 */
+	read_count = libbde_mapped_file_io_handle_read(
+	              mapped_file_io_handle,
+	              buffer,
+	              512,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_mapped_file_io_handle_open(
+	          mapped_file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_mapped_file_io_handle_get_size(
+	          mapped_file_io_handle,
+	          &size,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 4096 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	offset = libbde_mapped_file_io_handle_seek_offset(
+	          mapped_file_io_handle,
+	          1024,
+	          SEEK_SET,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 1024 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbde_mapped_file_io_handle_read(
+	              mapped_file_io_handle,
+	              buffer,
+	              512,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ 1024 ] ),
+	          512 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that the read continues at the end of the previous read
+	 */
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "mapped_file_io_handle->current_offset",
+	 (int64_t) mapped_file_io_handle->current_offset,
+	 (int64_t) 1536 );
+
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "mapped_file_io_handle->last_read_end_offset",
+	 (int64_t) mapped_file_io_handle->last_read_end_offset,
+	 (int64_t) 1536 );
+
+	/* Test a read that crosses the end of the mapping
+	 */
+	offset = libbde_mapped_file_io_handle_seek_offset(
+	          mapped_file_io_handle,
+	          -256,
+	          SEEK_END,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 3840 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbde_mapped_file_io_handle_read(
+	              mapped_file_io_handle,
+	              buffer,
+	              512,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 256 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ 3840 ] ),
+	          256 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libbde_mapped_file_io_handle_read(
+	              mapped_file_io_handle,
+	              buffer,
+	              512,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libbde_mapped_file_io_handle_read(
+	              NULL,
+	              buffer,
+	              512,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbde_mapped_file_io_handle_read(
+	              mapped_file_io_handle,
+	              NULL,
+	              512,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that the mapping cannot be written
+	 */
+	read_count = libbde_mapped_file_io_handle_write(
+	              mapped_file_io_handle,
+	              buffer,
+	              512,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbde_mapped_file_io_handle_close(
+	          mapped_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_mapped_file_io_handle_free(
+	          &mapped_file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "mapped_file_io_handle",
+	 mapped_file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bde_test_remove_temporary_file(
+	          filename,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mapped_file_io_handle != NULL )
+	{
+		libbde_mapped_file_io_handle_free(
+		 &mapped_file_io_handle,
+		 NULL );
+	}
+	if( filename[ 0 ] != 0 )
+	{
+		bde_test_remove_temporary_file(
+		 filename,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_mapped_file_open function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_mapped_file_open(
+     void )
+{
+	uint8_t buffer[ 512 ];
+	uint8_t data[ 4096 ];
+
+	char filename[ 512 ];
+
+	libbde_mapped_file_io_handle_t *mapped_file_io_handle = NULL;
+	libbfio_handle_t *file_io_handle                      = NULL;
+	libcerror_error_t *error                              = NULL;
+	const uint8_t *mapped_data                            = NULL;
+	size64_t size                                         = 0;
+	ssize_t read_count                                    = 0;
+	size_t data_index                                     = 0;
+	size_t filename_length                                = 0;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	filename[ 0 ] = 0;
+
+	for( data_index = 0;
+	     data_index < 4096;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) ( data_index % 251 );
+	}
+	result = bde_test_create_temporary_file(
+	          filename,
+	          512,
+	          data,
+	          4096,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	filename_length = narrow_string_length(
+	                   filename );
+
+	/* Test regular cases
+	 */
+	result = libbde_mapped_file_open(
+	          &file_io_handle,
+	          &mapped_file_io_handle,
+	          filename,
+	          filename_length,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "mapped_file_io_handle",
+	 mapped_file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_size(
+	          file_io_handle,
+	          &size,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 4096 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              512,
+	              1024,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ 1024 ] ),
+	          512 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read at the end of the file
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              512,
+	              3840,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 256 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_mapped_file_io_handle_get_data_at_offset(
+	          mapped_file_io_handle,
+	          2048,
+	          512,
+	          &mapped_data,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "mapped_data",
+	 mapped_data );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The data is not copied but refers to the mapping
+	 */
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "mapped_data",
+	 (int) ( mapped_data == &( mapped_file_io_handle->mapped_data[ 2048 ] ) ),
+	 1 );
+
+	result = memory_compare(
+	          mapped_data,
+	          &( data[ 2048 ] ),
+	          512 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that data outside the mapping is not available
+	 */
+	mapped_data = NULL;
+
+	result = libbde_mapped_file_io_handle_get_data_at_offset(
+	          mapped_file_io_handle,
+	          3840,
+	          512,
+	          &mapped_data,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "mapped_data",
+	 mapped_data );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbde_mapped_file_io_handle_get_data_at_offset(
+	          NULL,
+	          2048,
+	          512,
+	          &mapped_data,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_mapped_file_io_handle_get_data_at_offset(
+	          mapped_file_io_handle,
+	          2048,
+	          512,
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	mapped_file_io_handle = NULL;
+
+	result = bde_test_remove_temporary_file(
+	          filename,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a file that cannot be mapped is not an error
+	 */
+	result = libbde_mapped_file_open(
+	          &file_io_handle,
+	          &mapped_file_io_handle,
+	          filename,
+	          filename_length,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( filename[ 0 ] != 0 )
+	{
+		bde_test_remove_temporary_file(
+		 filename,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBBDE_MAPPED_FILE_SUPPORT ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc BDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] BDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc BDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] BDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	BDE_TEST_UNREFERENCED_PARAMETER( argc )
+	BDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
+
+	BDE_TEST_RUN(
+	 "libbde_mapped_file_io_handle_initialize",
+	 bde_test_mapped_file_io_handle_initialize );
+
+	BDE_TEST_RUN(
+	 "libbde_mapped_file_io_handle_free",
+	 bde_test_mapped_file_io_handle_free );
+
+	BDE_TEST_RUN(
+	 "libbde_mapped_file_io_handle_set_name",
+	 bde_test_mapped_file_io_handle_set_name );
+
+	BDE_TEST_RUN(
+	 "libbde_mapped_file_io_handle_advise_read",
+	 bde_test_mapped_file_io_handle_advise_read );
+
+#if defined( HAVE_LIBBDE_MAPPED_FILE_SUPPORT )
+
+	BDE_TEST_RUN(
+	 "libbde_mapped_file_io_handle_read",
+	 bde_test_mapped_file_io_handle_read );
+
+	BDE_TEST_RUN(
+	 "libbde_mapped_file_open",
+	 bde_test_mapped_file_open );
+
+#endif /* defined( HAVE_LIBBDE_MAPPED_FILE_SUPPORT ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
+}
+
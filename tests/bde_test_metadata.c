@@ -21,20 +21,51 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "bde_test_functions.h"
 #include "bde_test_libbde.h"
+#include "bde_test_libbfio.h"
 #include "bde_test_libcerror.h"
 #include "bde_test_macros.h"
 #include "bde_test_memory.h"
 #include "bde_test_unused.h"
 
+#include "../libbde/libbde_definitions.h"
+#include "../libbde/libbde_io_handle.h"
 #include "../libbde/libbde_metadata.h"
 
+/* Metadata block with a version 1 (Windows Vista) block header, the metadata offsets
+ * 0x0000, 0x0080 and 0x0100 and MFT mirror cluster block number 0x1234
+ */
+uint8_t bde_test_metadata_block_v1_data1[ 120 ] = {
+	0x2d, 0x46, 0x56, 0x45, 0x2d, 0x46, 0x53, 0x2d, 0x38, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+	0x03, 0x0d, 0x59, 0x3a, 0x5e, 0x5c, 0xe1, 0x4b, 0x90, 0xb0, 0x37, 0xaf, 0x00, 0x83, 0x2e, 0xcf,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0xd7, 0x98, 0xc0, 0x54, 0x5b, 0x53, 0xcc, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Metadata block with a version 2 (Windows 7) block header, the metadata offsets
+ * 0x0000, 0x0080 and 0x0100, 16 volume header sectors and volume header offset 0x80000
+ */
+uint8_t bde_test_metadata_block_v2_data1[ 120 ] = {
+	0x2d, 0x46, 0x56, 0x45, 0x2d, 0x46, 0x53, 0x2d, 0x38, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+	0x03, 0x0d, 0x59, 0x3a, 0x5e, 0x5c, 0xe1, 0x4b, 0x90, 0xb0, 0x37, 0xaf, 0x00, 0x83, 0x2e, 0xcf,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0xd7, 0x98, 0xc0, 0x54, 0x5b, 0x53, 0xcc, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
 #if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
 
 /* Tests the libbde_metadata_initialize function
@@ -270,6 +301,391 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libbde_metadata_read_block function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_metadata_read_block(
+     void )
+{
+	uint8_t image_data[ 384 ];
+
+	libbde_io_handle_t *io_handle    = NULL;
+	libbde_metadata_t *metadata      = NULL;
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	off64_t metadata_offset          = 0;
+	int metadata_index               = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbde_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a Windows Vista volume where the second and third metadata offsets
+	 * are not stored in the volume header but in the first metadata block
+	 */
+	for( metadata_index = 0;
+	     metadata_index < 3;
+	     metadata_index++ )
+	{
+		memory_copy(
+		 &( image_data[ metadata_index * 128 ] ),
+		 bde_test_metadata_block_v1_data1,
+		 120 );
+
+		memory_set(
+		 &( image_data[ ( metadata_index * 128 ) + 120 ] ),
+		 0,
+		 8 );
+	}
+	result = bde_test_open_file_io_handle(
+	          &file_io_handle,
+	          image_data,
+	          384,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->version                = LIBBDE_VERSION_WINDOWS_VISTA;
+	io_handle->bytes_per_sector       = 512;
+	io_handle->first_metadata_offset  = 0;
+	io_handle->second_metadata_offset = 0;
+	io_handle->third_metadata_offset  = 0;
+
+	for( metadata_index = 0;
+	     metadata_index < 3;
+	     metadata_index++ )
+	{
+		/* The secondary and tertiary metadata blocks are read at the offsets
+		 * that reading the primary metadata block stored in the IO handle
+		 */
+		if( metadata_index == 0 )
+		{
+			metadata_offset = io_handle->first_metadata_offset;
+		}
+		else if( metadata_index == 1 )
+		{
+			metadata_offset = io_handle->second_metadata_offset;
+		}
+		else
+		{
+			metadata_offset = io_handle->third_metadata_offset;
+		}
+		result = libbde_metadata_initialize(
+		          &metadata,
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BDE_TEST_ASSERT_IS_NOT_NULL(
+		 "metadata",
+		 metadata );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbde_metadata_read_block(
+		          metadata,
+		          io_handle,
+		          file_io_handle,
+		          metadata_offset,
+		          NULL,
+		          0,
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		BDE_TEST_ASSERT_EQUAL_INT64(
+		 "io_handle->second_metadata_offset",
+		 (int64_t) io_handle->second_metadata_offset,
+		 (int64_t) 0x0080 );
+
+		BDE_TEST_ASSERT_EQUAL_INT64(
+		 "io_handle->third_metadata_offset",
+		 (int64_t) io_handle->third_metadata_offset,
+		 (int64_t) 0x0100 );
+
+		/* The MFT mirror cluster block number shares storage with the volume header offset
+		 * in the block header and must not be overwritten for version 1
+		 */
+		BDE_TEST_ASSERT_EQUAL_UINT16(
+		 "metadata->version",
+		 metadata->version,
+		 1 );
+
+		BDE_TEST_ASSERT_EQUAL_UINT64(
+		 "metadata->mft_mirror_cluster_block_number",
+		 metadata->mft_mirror_cluster_block_number,
+		 (uint64_t) 0x1234 );
+
+		BDE_TEST_ASSERT_EQUAL_INT64(
+		 "metadata->volume_header_offset",
+		 (int64_t) metadata->volume_header_offset,
+		 (int64_t) 0 );
+
+		result = libbde_metadata_free(
+		          &metadata,
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = bde_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a Windows 7 volume where the block header contains the volume header offset
+	 */
+	result = bde_test_open_file_io_handle(
+	          &file_io_handle,
+	          bde_test_metadata_block_v2_data1,
+	          120,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->version = LIBBDE_VERSION_WINDOWS_7;
+
+	result = libbde_metadata_initialize(
+	          &metadata,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata",
+	 metadata );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_metadata_read_block(
+	          metadata,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          NULL,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BDE_TEST_ASSERT_EQUAL_UINT16(
+	 "metadata->version",
+	 metadata->version,
+	 2 );
+
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "metadata->volume_header_offset",
+	 (int64_t) metadata->volume_header_offset,
+	 (int64_t) 0x80000 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "metadata->volume_header_size",
+	 (uint64_t) metadata->volume_header_size,
+	 (uint64_t) 8192 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "metadata->mft_mirror_cluster_block_number",
+	 metadata->mft_mirror_cluster_block_number,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libbde_metadata_read_block(
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          NULL,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_metadata_read_block(
+	          metadata,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          NULL,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbde_metadata_free(
+	          &metadata,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "metadata",
+	 metadata );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bde_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata != NULL )
+	{
+		libbde_metadata_free(
+		 &metadata,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libbde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libbde_metadata_get_creation_time function
  * Returns 1 if successful or 0 if not
  */
@@ -1115,7 +1531,9 @@ int main(
 	 "libbde_metadata_free",
 	 bde_test_metadata_free );
 
-	/* TODO: add tests for libbde_metadata_read_block */
+	BDE_TEST_RUN(
+	 "libbde_metadata_read_block",
+	 bde_test_metadata_read_block );
 
 	/* TODO: add tests for libbde_metadata_read_header */
 
@@ -0,0 +1,701 @@
+/*
+ * Library read_worker type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bde_test_functions.h"
+#include "bde_test_libbde.h"
+#include "bde_test_libbfio.h"
+#include "bde_test_libcerror.h"
+#include "bde_test_macros.h"
+#include "bde_test_memory.h"
+#include "bde_test_unused.h"
+
+#include "../libbde/libbde_definitions.h"
+#include "../libbde/libbde_io_handle.h"
+#include "../libbde/libbde_read_worker.h"
+
+uint8_t bde_test_read_worker_data1[ 2048 ];
+
+#if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
+
+/* Trace function that counts the read events
+ */
+void bde_test_read_worker_trace_function(
+      intptr_t *user_data,
+      int event_type,
+      off64_t offset BDE_TEST_ATTRIBUTE_UNUSED,
+      size64_t size BDE_TEST_ATTRIBUTE_UNUSED,
+      uint64_t start_timestamp BDE_TEST_ATTRIBUTE_UNUSED,
+      uint64_t end_timestamp BDE_TEST_ATTRIBUTE_UNUSED )
+{
+	BDE_TEST_UNREFERENCED_PARAMETER( offset )
+	BDE_TEST_UNREFERENCED_PARAMETER( size )
+	BDE_TEST_UNREFERENCED_PARAMETER( start_timestamp )
+	BDE_TEST_UNREFERENCED_PARAMETER( end_timestamp )
+
+	if( ( user_data != NULL )
+	 && ( event_type == LIBBDE_TRACE_EVENT_TYPE_READ ) )
+	{
+		*( (int *) user_data ) += 1;
+	}
+}
+
+/* Tests the libbde_read_worker_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_read_worker_initialize(
+     void )
+{
+	uint8_t key_data[ 16 ] = {
+		0x54, 0xe6, 0x30, 0x48, 0x2e, 0xb9, 0xdb, 0x51, 0x53, 0x33, 0xc4, 0x1e, 0x4a, 0x5a, 0xe8, 0xa6 };
+
+	libbde_io_handle_t *io_handle     = NULL;
+	libbde_read_worker_t *read_worker = NULL;
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libbde_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bde_test_open_file_io_handle(
+	          &file_io_handle,
+	          bde_test_read_worker_data1,
+	          2048,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbde_read_worker_initialize(
+	          &read_worker,
+	          io_handle,
+	          file_io_handle,
+	          LIBBDE_ENCRYPTION_METHOD_AES_128_CBC,
+	          key_data,
+	          16,
+	          NULL,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "read_worker",
+	 read_worker );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_read_worker_free(
+	          &read_worker,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "read_worker",
+	 read_worker );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbde_read_worker_initialize(
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          LIBBDE_ENCRYPTION_METHOD_AES_128_CBC,
+	          key_data,
+	          16,
+	          NULL,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_worker = (libbde_read_worker_t *) 0x12345678UL;
+
+	result = libbde_read_worker_initialize(
+	          &read_worker,
+	          io_handle,
+	          file_io_handle,
+	          LIBBDE_ENCRYPTION_METHOD_AES_128_CBC,
+	          key_data,
+	          16,
+	          NULL,
+	          0,
+	          &error );
+
+	read_worker = NULL;
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_read_worker_initialize(
+	          &read_worker,
+	          NULL,
+	          file_io_handle,
+	          LIBBDE_ENCRYPTION_METHOD_AES_128_CBC,
+	          key_data,
+	          16,
+	          NULL,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_read_worker_initialize(
+	          &read_worker,
+	          io_handle,
+	          NULL,
+	          LIBBDE_ENCRYPTION_METHOD_AES_128_CBC,
+	          key_data,
+	          16,
+	          NULL,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = bde_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_worker != NULL )
+	{
+		libbde_read_worker_free(
+		 &read_worker,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libbde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_read_worker_free function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_read_worker_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libbde_read_worker_free(
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_read_worker_read_buffers function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_read_worker_read_buffers(
+     void )
+{
+	uint8_t key_data[ 16 ] = {
+		0x54, 0xe6, 0x30, 0x48, 0x2e, 0xb9, 0xdb, 0x51, 0x53, 0x33, 0xc4, 0x1e, 0x4a, 0x5a, 0xe8, 0xa6 };
+
+	uint8_t buffer1[ 600 ];
+	uint8_t buffer2[ 512 ];
+	uint8_t *buffers[ 2 ]     = { buffer1, buffer2 };
+	size_t buffer_sizes[ 2 ]  = { 600, 512 };
+	off64_t offsets[ 2 ]      = { 100, 1800 };
+	ssize_t read_counts[ 2 ]  = { 0, 0 };
+
+	libbde_io_handle_t *io_handle     = NULL;
+	libbde_read_worker_t *read_worker = NULL;
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	size_t data_index                 = 0;
+	int number_of_read_events         = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < 2048;
+	     data_index++ )
+	{
+		bde_test_read_worker_data1[ data_index ] = (uint8_t) ( data_index % 251 );
+	}
+	result = libbde_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->volume_size     = 2048;
+	io_handle->trace_function  = &bde_test_read_worker_trace_function;
+	io_handle->trace_user_data = (intptr_t *) &number_of_read_events;
+
+	result = bde_test_open_file_io_handle(
+	          &file_io_handle,
+	          bde_test_read_worker_data1,
+	          2048,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_read_worker_initialize(
+	          &read_worker,
+	          io_handle,
+	          file_io_handle,
+	          LIBBDE_ENCRYPTION_METHOD_NONE,
+	          key_data,
+	          16,
+	          NULL,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "read_worker",
+	 read_worker );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_read_worker_set_buffers(
+	          read_worker,
+	          buffers,
+	          buffer_sizes,
+	          offsets,
+	          read_counts,
+	          2,
+	          0,
+	          1,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbde_read_worker_read_buffers(
+	          read_worker,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_counts[ 0 ]",
+	 read_counts[ 0 ],
+	 (ssize_t) 600 );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_counts[ 1 ]",
+	 read_counts[ 1 ],
+	 (ssize_t) 248 );
+
+	result = memory_compare(
+	          buffer1,
+	          &( bde_test_read_worker_data1[ 100 ] ),
+	          600 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          buffer2,
+	          &( bde_test_read_worker_data1[ 1800 ] ),
+	          248 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The read worker updates the statistics of the shared IO handle
+	 * and calls its trace function
+	 */
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics.number_of_read_calls",
+	 io_handle->statistics.number_of_read_calls,
+	 (uint64_t) 2 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics.number_of_bytes_read",
+	 io_handle->statistics.number_of_bytes_read,
+	 (uint64_t) 1536 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_read_events",
+	 number_of_read_events,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libbde_read_worker_read_buffers(
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_read_worker_set_buffers(
+	          read_worker,
+	          buffers,
+	          buffer_sizes,
+	          offsets,
+	          read_counts,
+	          2,
+	          0,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbde_read_worker_free(
+	          &read_worker,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bde_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_worker != NULL )
+	{
+		libbde_read_worker_free(
+		 &read_worker,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libbde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc BDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] BDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc BDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] BDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	BDE_TEST_UNREFERENCED_PARAMETER( argc )
+	BDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
+
+	BDE_TEST_RUN(
+	 "libbde_read_worker_initialize",
+	 bde_test_read_worker_initialize );
+
+	BDE_TEST_RUN(
+	 "libbde_read_worker_free",
+	 bde_test_read_worker_free );
+
+	/* TODO: add tests for libbde_read_worker_set_buffers */
+
+	/* TODO: add tests for libbde_read_worker_read_buffer_at_offset */
+
+	BDE_TEST_RUN(
+	 "libbde_read_worker_read_buffers",
+	 bde_test_read_worker_read_buffers );
+
+	/* TODO: add tests for libbde_read_worker_callback */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
+}
+
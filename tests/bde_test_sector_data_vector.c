@@ -22,6 +22,7 @@
 #include <common.h>
 #include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -37,8 +38,14 @@
 #include "bde_test_unused.h"
 
 #include "../libbde/libbde_definitions.h"
+#include "../libbde/libbde_encryption_context.h"
+#include "../libbde/libbde_io_handle.h"
 #include "../libbde/libbde_sector_data_vector.h"
 
+/* The number of sectors in the test data
+ */
+#define BDE_TEST_SECTOR_DATA_VECTOR_NUMBER_OF_SECTORS	64
+
 #if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
 
 /* Tests the libbde_sector_data_vector_initialize function
@@ -289,6 +296,661 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libbde_sector_data_vector_get_sector_data_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_sector_data_vector_get_sector_data_at_offset(
+     void )
+{
+	uint8_t data[ BDE_TEST_SECTOR_DATA_VECTOR_NUMBER_OF_SECTORS * 512 ];
+
+	libbde_encryption_context_t *encryption_context = NULL;
+	libbde_io_handle_t *io_handle                   = NULL;
+	libbde_sector_data_t *sector_data               = NULL;
+	libbde_sector_data_vector_t *sector_data_vector = NULL;
+	libbfio_handle_t *file_io_handle                = NULL;
+	libcerror_error_t *error                        = NULL;
+	uint64_t number_of_cache_hits                   = 0;
+	uint64_t number_of_cache_misses                 = 0;
+	int read_flags                                  = 0;
+	int result                                      = 0;
+	int scan_index                                  = 0;
+	int sector_index                                = 0;
+
+	/* Initialize test
+	 */
+	for( sector_index = 0;
+	     sector_index < BDE_TEST_SECTOR_DATA_VECTOR_NUMBER_OF_SECTORS;
+	     sector_index++ )
+	{
+		memory_set(
+		 &( data[ sector_index * 512 ] ),
+		 (uint8_t) sector_index,
+		 512 );
+	}
+	result = libbde_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->version          = LIBBDE_VERSION_WINDOWS_7;
+	io_handle->bytes_per_sector = 512;
+
+	result = libbde_encryption_context_initialize(
+	          &encryption_context,
+	          LIBBDE_ENCRYPTION_METHOD_NONE,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bde_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          BDE_TEST_SECTOR_DATA_VECTOR_NUMBER_OF_SECTORS * 512,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_sector_data_vector_initialize(
+	          &sector_data_vector,
+	          512,
+	          0,
+	          BDE_TEST_SECTOR_DATA_VECTOR_NUMBER_OF_SECTORS * 512,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_data_vector",
+	 sector_data_vector );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbde_sector_data_vector_get_sector_data_at_offset(
+	          sector_data_vector,
+	          io_handle,
+	          file_io_handle,
+	          encryption_context,
+	          512,
+	          0,
+	          &sector_data,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_data",
+	 sector_data );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BDE_TEST_ASSERT_EQUAL_UINT8(
+	 "sector_data->data[ 0 ]",
+	 sector_data->data[ 0 ],
+	 (uint8_t) 1 );
+
+	/* A sector that is read again while in the probationary cache is promoted
+	 * into the main cache
+	 */
+	result = libbde_sector_data_vector_get_sector_data_at_offset(
+	          sector_data_vector,
+	          io_handle,
+	          file_io_handle,
+	          encryption_context,
+	          512,
+	          0,
+	          &sector_data,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_data",
+	 sector_data );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BDE_TEST_ASSERT_EQUAL_UINT8(
+	 "sector_data->data[ 0 ]",
+	 sector_data->data[ 0 ],
+	 (uint8_t) 1 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics.number_of_cache_hits",
+	 io_handle->statistics.number_of_cache_hits,
+	 (uint64_t) 1 );
+
+	/* Scan more sectors than fit in the probationary cache, first streaming
+	 * and then regular reads that are admitted into the probationary cache
+	 */
+	for( scan_index = 0;
+	     scan_index < 2;
+	     scan_index++ )
+	{
+		if( scan_index == 0 )
+		{
+			read_flags = LIBBDE_READ_FLAG_STREAMING;
+		}
+		else
+		{
+			read_flags = 0;
+		}
+		for( sector_index = 2;
+		     sector_index < BDE_TEST_SECTOR_DATA_VECTOR_NUMBER_OF_SECTORS;
+		     sector_index++ )
+		{
+			result = libbde_sector_data_vector_get_sector_data_at_offset(
+			          sector_data_vector,
+			          io_handle,
+			          file_io_handle,
+			          encryption_context,
+			          (off64_t) sector_index * 512,
+			          (uint8_t) read_flags,
+			          &sector_data,
+			          &error );
+
+			BDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			BDE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			BDE_TEST_ASSERT_EQUAL_UINT8(
+			 "sector_data->data[ 0 ]",
+			 sector_data->data[ 0 ],
+			 (uint8_t) sector_index );
+		}
+	}
+	/* The sector that was read twice must have survived the scans
+	 */
+	number_of_cache_hits   = io_handle->statistics.number_of_cache_hits;
+	number_of_cache_misses = io_handle->statistics.number_of_cache_misses;
+
+	result = libbde_sector_data_vector_get_sector_data_at_offset(
+	          sector_data_vector,
+	          io_handle,
+	          file_io_handle,
+	          encryption_context,
+	          512,
+	          0,
+	          &sector_data,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BDE_TEST_ASSERT_EQUAL_UINT8(
+	 "sector_data->data[ 0 ]",
+	 sector_data->data[ 0 ],
+	 (uint8_t) 1 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics.number_of_cache_hits",
+	 io_handle->statistics.number_of_cache_hits,
+	 number_of_cache_hits + 1 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics.number_of_cache_misses",
+	 io_handle->statistics.number_of_cache_misses,
+	 number_of_cache_misses );
+
+	/* Test error cases
+	 */
+	result = libbde_sector_data_vector_get_sector_data_at_offset(
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          encryption_context,
+	          0,
+	          0,
+	          &sector_data,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_sector_data_vector_get_sector_data_at_offset(
+	          sector_data_vector,
+	          NULL,
+	          file_io_handle,
+	          encryption_context,
+	          0,
+	          0,
+	          &sector_data,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_sector_data_vector_get_sector_data_at_offset(
+	          sector_data_vector,
+	          io_handle,
+	          file_io_handle,
+	          encryption_context,
+	          0,
+	          0,
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbde_sector_data_vector_free(
+	          &sector_data_vector,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "sector_data_vector",
+	 sector_data_vector );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bde_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_encryption_context_free(
+	          &encryption_context,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_data_vector != NULL )
+	{
+		libbde_sector_data_vector_free(
+		 &sector_data_vector,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( encryption_context != NULL )
+	{
+		libbde_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libbde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_sector_data_vector_append_warm_range function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_sector_data_vector_append_warm_range(
+     void )
+{
+	libbde_sector_data_t *warm_range                = NULL;
+	libbde_sector_data_vector_t *sector_data_vector = NULL;
+	libcerror_error_t *error                        = NULL;
+	uint8_t *data                                   = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libbde_sector_data_vector_initialize(
+	          &sector_data_vector,
+	          512,
+	          0,
+	          BDE_TEST_SECTOR_DATA_VECTOR_NUMBER_OF_SECTORS * 512,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_sector_data_initialize(
+	          &warm_range,
+	          1024,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 warm_range->data,
+	 0xa5,
+	 1024 );
+
+	/* Test error cases
+	 */
+	result = libbde_sector_data_vector_append_warm_range(
+	          NULL,
+	          1024,
+	          warm_range,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_sector_data_vector_append_warm_range(
+	          sector_data_vector,
+	          1000,
+	          warm_range,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_sector_data_vector_append_warm_range(
+	          sector_data_vector,
+	          1024,
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = libbde_sector_data_vector_append_warm_range(
+	          sector_data_vector,
+	          1024,
+	          warm_range,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The sector data vector now manages the warm range
+	 */
+	warm_range = NULL;
+
+	result = libbde_sector_data_vector_get_warm_data_at_offset(
+	          sector_data_vector,
+	          1536,
+	          &data,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BDE_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 0 ]",
+	 data[ 0 ],
+	 (uint8_t) 0xa5 );
+
+	result = libbde_sector_data_vector_get_warm_data_at_offset(
+	          sector_data_vector,
+	          2048,
+	          &data,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_sector_data_vector_get_warm_data_at_offset(
+	          sector_data_vector,
+	          512,
+	          &data,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_sector_data_vector_get_warm_data_at_offset(
+	          sector_data_vector,
+	          1536,
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbde_sector_data_vector_free(
+	          &sector_data_vector,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( warm_range != NULL )
+	{
+		libbde_sector_data_free(
+		 &warm_range,
+		 NULL );
+	}
+	if( sector_data_vector != NULL )
+	{
+		libbde_sector_data_vector_free(
+		 &sector_data_vector,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
 
 /* The main program
@@ -316,7 +978,13 @@ int main(
 	 "libbde_sector_data_vector_free",
 	 bde_test_sector_data_vector_free );
 
-	/* TODO add tests for libbde_sector_data_vector_get_sector_data_at_offset */
+	BDE_TEST_RUN(
+	 "libbde_sector_data_vector_get_sector_data_at_offset",
+	 bde_test_sector_data_vector_get_sector_data_at_offset );
+
+	BDE_TEST_RUN(
+	 "libbde_sector_data_vector_append_warm_range",
+	 bde_test_sector_data_vector_append_warm_range );
 
 #endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
 
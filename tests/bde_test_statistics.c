@@ -0,0 +1,490 @@
+/*
+ * Library statistics functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bde_test_libbde.h"
+#include "bde_test_libcerror.h"
+#include "bde_test_macros.h"
+#include "bde_test_memory.h"
+#include "bde_test_unused.h"
+
+#include "../libbde/libbde_statistics.h"
+
+#if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
+
+/* Tests the libbde_statistics_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_statistics_clear(
+     void )
+{
+	libbde_statistics_t statistics;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	statistics.number_of_read_calls = 1;
+	statistics.unlock_time          = 2;
+
+	result = libbde_statistics_clear(
+	          &statistics,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.number_of_read_calls",
+	 statistics.number_of_read_calls,
+	 (uint64_t) 0 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.unlock_time",
+	 statistics.unlock_time,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libbde_statistics_clear(
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_statistics_get_values function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_statistics_get_values(
+     void )
+{
+	uint64_t values[ LIBBDE_NUMBER_OF_STATISTICS_VALUES + 1 ];
+
+	libbde_statistics_t statistics;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbde_statistics_clear(
+	          &statistics,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	statistics.number_of_read_calls         = 3;
+	statistics.number_of_cache_hits         = 5;
+	statistics.number_of_cache_misses       = 7;
+	statistics.number_of_bytes_read         = 3584;
+	statistics.number_of_bytes_decrypted    = 3072;
+	statistics.unlock_time                  = 11;
+	statistics.number_of_block_cache_hits   = 13;
+	statistics.number_of_block_cache_misses = 17;
+
+	statistics.number_of_bytes_decrypted_aes_cbc          = 512;
+	statistics.number_of_bytes_decrypted_aes_cbc_diffuser = 1024;
+	statistics.number_of_bytes_decrypted_aes_xts          = 1536;
+	statistics.number_of_warmup_bytes                     = 8192;
+
+	/* Test regular cases
+	 */
+	values[ LIBBDE_NUMBER_OF_STATISTICS_VALUES ] = 0xffffffffffffffffUL;
+
+	result = libbde_statistics_get_values(
+	          &statistics,
+	          values,
+	          LIBBDE_NUMBER_OF_STATISTICS_VALUES + 1,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "number of read calls",
+	 values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_READ_CALLS ],
+	 (uint64_t) 3 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "number of cache hits",
+	 values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_CACHE_HITS ],
+	 (uint64_t) 5 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "number of cache misses",
+	 values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_CACHE_MISSES ],
+	 (uint64_t) 7 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "number of bytes read",
+	 values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_BYTES_READ ],
+	 (uint64_t) 3584 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "number of bytes decrypted",
+	 values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_BYTES_DECRYPTED ],
+	 (uint64_t) 3072 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "unlock time",
+	 values[ LIBBDE_STATISTICS_VALUE_UNLOCK_TIME ],
+	 (uint64_t) 11 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "number of block cache hits",
+	 values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_BLOCK_CACHE_HITS ],
+	 (uint64_t) 13 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "number of block cache misses",
+	 values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_BLOCK_CACHE_MISSES ],
+	 (uint64_t) 17 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "number of bytes decrypted with AES-CBC",
+	 values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_BYTES_DECRYPTED_AES_CBC ],
+	 (uint64_t) 512 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "number of bytes decrypted with AES-CBC and diffuser",
+	 values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_BYTES_DECRYPTED_AES_CBC_DIFFUSER ],
+	 (uint64_t) 1024 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "number of bytes decrypted with AES-XTS",
+	 values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_BYTES_DECRYPTED_AES_XTS ],
+	 (uint64_t) 1536 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "number of warmup bytes",
+	 values[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_WARMUP_BYTES ],
+	 (uint64_t) 8192 );
+
+	/* Values beyond the number of statistics values are not set
+	 */
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "value beyond statistics values",
+	 values[ LIBBDE_NUMBER_OF_STATISTICS_VALUES ],
+	 (uint64_t) 0xffffffffffffffffUL );
+
+	/* Test error cases
+	 */
+	result = libbde_statistics_get_values(
+	          NULL,
+	          values,
+	          LIBBDE_NUMBER_OF_STATISTICS_VALUES,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_statistics_get_values(
+	          &statistics,
+	          NULL,
+	          LIBBDE_NUMBER_OF_STATISTICS_VALUES,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_statistics_get_values(
+	          &statistics,
+	          values,
+	          -1,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_statistics_add_value and libbde_statistics_get_value functions
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_statistics_add_value(
+     void )
+{
+	uint64_t value = 0;
+
+	/* Test regular cases
+	 */
+	libbde_statistics_add_value(
+	 &value,
+	 5 );
+
+	libbde_statistics_add_value(
+	 &value,
+	 0x100000000UL );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 libbde_statistics_get_value(
+	  &value ),
+	 (uint64_t) 0x100000005UL );
+
+	/* Test error cases
+	 */
+	libbde_statistics_add_value(
+	 NULL,
+	 5 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 libbde_statistics_get_value(
+	  NULL ),
+	 (uint64_t) 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libbde_statistics_add_decrypted function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_statistics_add_decrypted(
+     void )
+{
+	libbde_statistics_t statistics;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbde_statistics_clear(
+	          &statistics,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	libbde_statistics_add_decrypted(
+	 &statistics,
+	 LIBBDE_ENCRYPTION_METHOD_AES_128_CBC,
+	 512,
+	 1 );
+
+	libbde_statistics_add_decrypted(
+	 &statistics,
+	 LIBBDE_ENCRYPTION_METHOD_AES_256_CBC_DIFFUSER,
+	 1024,
+	 2 );
+
+	libbde_statistics_add_decrypted(
+	 &statistics,
+	 LIBBDE_ENCRYPTION_METHOD_AES_128_XTS,
+	 2048,
+	 3 );
+
+	libbde_statistics_add_decrypted(
+	 &statistics,
+	 LIBBDE_ENCRYPTION_METHOD_AES_256_XTS,
+	 2048,
+	 4 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.number_of_bytes_decrypted",
+	 statistics.number_of_bytes_decrypted,
+	 (uint64_t) 5632 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.decryption_time",
+	 statistics.decryption_time,
+	 (uint64_t) 10 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.number_of_bytes_decrypted_aes_cbc",
+	 statistics.number_of_bytes_decrypted_aes_cbc,
+	 (uint64_t) 512 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.number_of_bytes_decrypted_aes_cbc_diffuser",
+	 statistics.number_of_bytes_decrypted_aes_cbc_diffuser,
+	 (uint64_t) 1024 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.number_of_bytes_decrypted_aes_xts",
+	 statistics.number_of_bytes_decrypted_aes_xts,
+	 (uint64_t) 4096 );
+
+	/* Test error cases
+	 */
+	libbde_statistics_add_decrypted(
+	 NULL,
+	 LIBBDE_ENCRYPTION_METHOD_AES_128_CBC,
+	 512,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc BDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] BDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc BDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] BDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	BDE_TEST_UNREFERENCED_PARAMETER( argc )
+	BDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
+
+	BDE_TEST_RUN(
+	 "libbde_statistics_clear",
+	 bde_test_statistics_clear );
+
+	BDE_TEST_RUN(
+	 "libbde_statistics_get_values",
+	 bde_test_statistics_get_values );
+
+	BDE_TEST_RUN(
+	 "libbde_statistics_add_value",
+	 bde_test_statistics_add_value );
+
+	BDE_TEST_RUN(
+	 "libbde_statistics_add_decrypted",
+	 bde_test_statistics_add_decrypted );
+
+	/* TODO: add tests for libbde_statistics_get_timestamp */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
+}
+
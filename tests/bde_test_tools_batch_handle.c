@@ -0,0 +1,588 @@
+/*
+ * Tools batch_handle type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bde_test_libcerror.h"
+#include "bde_test_macros.h"
+#include "bde_test_memory.h"
+#include "bde_test_unused.h"
+
+#include "../bdetools/batch_handle.h"
+
+/* Tests the batch_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_batch_handle_initialize(
+     void )
+{
+	batch_handle_t *batch_handle = NULL;
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = batch_handle_initialize(
+	          &batch_handle,
+	          stdout,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "batch_handle",
+	 batch_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = batch_handle_free(
+	          &batch_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "batch_handle",
+	 batch_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = batch_handle_initialize(
+	          NULL,
+	          stdout,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	batch_handle = (batch_handle_t *) 0x12345678UL;
+
+	result = batch_handle_initialize(
+	          &batch_handle,
+	          stdout,
+	          &error );
+
+	batch_handle = NULL;
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = batch_handle_initialize(
+	          &batch_handle,
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch_handle != NULL )
+	{
+		batch_handle_free(
+		 &batch_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the batch_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_batch_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = batch_handle_free(
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the batch_handle_set_number_of_workers function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_batch_handle_set_number_of_workers(
+     void )
+{
+	batch_handle_t *batch_handle = NULL;
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = batch_handle_initialize(
+	          &batch_handle,
+	          stdout,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "batch_handle->number_of_workers",
+	 batch_handle->number_of_workers,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = batch_handle_set_number_of_workers(
+	          batch_handle,
+	          _SYSTEM_STRING( "1" ),
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = batch_handle_set_number_of_workers(
+	          NULL,
+	          _SYSTEM_STRING( "1" ),
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = batch_handle_set_number_of_workers(
+	          batch_handle,
+	          _SYSTEM_STRING( "0" ),
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = batch_handle_free(
+	          &batch_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch_handle != NULL )
+	{
+		batch_handle_free(
+		 &batch_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the batch_handle_read_list_file and batch_handle_process functions
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_batch_handle_process(
+     void )
+{
+	char output_line[ 256 ];
+
+	batch_handle_t *batch_handle = NULL;
+	libcerror_error_t *error     = NULL;
+	FILE *list_stream            = NULL;
+	FILE *output_stream          = NULL;
+	int number_of_lines          = 0;
+	int number_of_sources        = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	list_stream = file_stream_open(
+	               "bde_test_batch.list",
+	               FILE_STREAM_OPEN_WRITE );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "list_stream",
+	 list_stream );
+
+	fprintf(
+	 list_stream,
+	 "# comment\n\nbde_test_batch_missing1.raw\nbde_test_batch_missing2.raw\r\n" );
+
+	result = file_stream_close(
+	          list_stream );
+
+	list_stream = NULL;
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_stream = file_stream_open(
+	                 "bde_test_batch.output",
+	                 FILE_STREAM_OPEN_WRITE );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "output_stream",
+	 output_stream );
+
+	result = batch_handle_initialize(
+	          &batch_handle,
+	          output_stream,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = batch_handle_read_list_file(
+	          batch_handle,
+	          _SYSTEM_STRING( "bde_test_batch.list" ),
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = batch_handle_get_number_of_sources(
+	          batch_handle,
+	          &number_of_sources,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sources",
+	 number_of_sources,
+	 2 );
+
+	/* Sources that cannot be opened are reported as an error line
+	 */
+	result = batch_handle_process(
+	          batch_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "batch_handle->number_of_failures",
+	 batch_handle->number_of_failures,
+	 2 );
+
+	result = batch_handle_free(
+	          &batch_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = file_stream_close(
+	          output_stream );
+
+	output_stream = NULL;
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_stream = file_stream_open(
+	                 "bde_test_batch.output",
+	                 FILE_STREAM_OPEN_READ );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "output_stream",
+	 output_stream );
+
+	while( file_stream_get_string(
+	        output_stream,
+	        output_line,
+	        256 ) != NULL )
+	{
+		result = narrow_string_compare(
+		          output_line,
+		          "{\"source\": \"bde_test_batch_missing",
+		          34 );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		number_of_lines++;
+	}
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_lines",
+	 number_of_lines,
+	 2 );
+
+	result = file_stream_close(
+	          output_stream );
+
+	output_stream = NULL;
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = batch_handle_read_list_file(
+	          NULL,
+	          _SYSTEM_STRING( "bde_test_batch.list" ),
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = batch_handle_process(
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	remove(
+	 "bde_test_batch.list" );
+	remove(
+	 "bde_test_batch.output" );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch_handle != NULL )
+	{
+		batch_handle_free(
+		 &batch_handle,
+		 NULL );
+	}
+	if( output_stream != NULL )
+	{
+		file_stream_close(
+		 output_stream );
+	}
+	if( list_stream != NULL )
+	{
+		file_stream_close(
+		 list_stream );
+	}
+	remove(
+	 "bde_test_batch.list" );
+	remove(
+	 "bde_test_batch.output" );
+
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc BDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] BDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc BDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] BDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	BDE_TEST_UNREFERENCED_PARAMETER( argc )
+	BDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	BDE_TEST_RUN(
+	 "batch_handle_initialize",
+	 bde_test_tools_batch_handle_initialize );
+
+	BDE_TEST_RUN(
+	 "batch_handle_free",
+	 bde_test_tools_batch_handle_free );
+
+	BDE_TEST_RUN(
+	 "batch_handle_set_number_of_workers",
+	 bde_test_tools_batch_handle_set_number_of_workers );
+
+	BDE_TEST_RUN(
+	 "batch_handle_process",
+	 bde_test_tools_batch_handle_process );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
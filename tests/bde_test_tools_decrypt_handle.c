@@ -0,0 +1,517 @@
+/*
+ * Tools decrypt_handle type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bde_test_libcerror.h"
+#include "bde_test_macros.h"
+#include "bde_test_memory.h"
+#include "bde_test_unused.h"
+
+#include "../bdetools/decrypt_handle.h"
+
+/* Tests the decrypt_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_decrypt_handle_initialize(
+     void )
+{
+	decrypt_handle_t *decrypt_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+	/* Test error cases
+	 */
+	result = decrypt_handle_initialize(
+	          NULL,
+	          (mount_file_system_t *) 0x12345678UL,
+	          1,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	decrypt_handle = (decrypt_handle_t *) 0x12345678UL;
+
+	result = decrypt_handle_initialize(
+	          &decrypt_handle,
+	          (mount_file_system_t *) 0x12345678UL,
+	          1,
+	          &error );
+
+	decrypt_handle = NULL;
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = decrypt_handle_initialize(
+	          &decrypt_handle,
+	          NULL,
+	          1,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the decrypt_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_decrypt_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = decrypt_handle_free(
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the decrypt_handle_checkpoint functions
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_decrypt_handle_checkpoint(
+     void )
+{
+	system_character_t checkpoint_filename[ 32 ];
+
+	decrypt_handle_t decrypt_handle;
+
+	libcerror_error_t *error  = NULL;
+	off64_t checkpoint_offset = 0;
+	int result                = 0;
+
+	result = system_string_copy(
+	          checkpoint_filename,
+	          _SYSTEM_STRING( "bde_test_decrypt.checkpoint" ),
+	          28 ) != NULL;
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_set(
+	 &decrypt_handle,
+	 0,
+	 sizeof( decrypt_handle_t ) );
+
+	memory_set(
+	 decrypt_handle.volume_identifier,
+	 'V',
+	 16 );
+
+	decrypt_handle.volume_size         = 4 * 1048576;
+	decrypt_handle.block_size          = 1048576;
+	decrypt_handle.checkpoint_filename = checkpoint_filename;
+
+	/* Test regular cases
+	 */
+	result = decrypt_handle_write_checkpoint(
+	          &decrypt_handle,
+	          2 * 1048576,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = decrypt_handle_read_checkpoint(
+	          &decrypt_handle,
+	          &checkpoint_offset,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "checkpoint_offset",
+	 (int64_t) checkpoint_offset,
+	 (int64_t) ( 2 * 1048576 ) );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a checkpoint with a different block size is ignored
+	 */
+	decrypt_handle.block_size = 4096;
+
+	result = decrypt_handle_read_checkpoint(
+	          &decrypt_handle,
+	          &checkpoint_offset,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	decrypt_handle.block_size = 1048576;
+
+	/* Test that a checkpoint with a different volume size is ignored
+	 */
+	decrypt_handle.volume_size = 8 * 1048576;
+
+	result = decrypt_handle_read_checkpoint(
+	          &decrypt_handle,
+	          &checkpoint_offset,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	decrypt_handle.volume_size = 4 * 1048576;
+
+	/* Test that a checkpoint of a different volume is ignored
+	 */
+	decrypt_handle.volume_identifier[ 15 ] = 'W';
+
+	result = decrypt_handle_read_checkpoint(
+	          &decrypt_handle,
+	          &checkpoint_offset,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	decrypt_handle.volume_identifier[ 15 ] = 'V';
+
+	result = decrypt_handle_read_checkpoint(
+	          &decrypt_handle,
+	          &checkpoint_offset,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = decrypt_handle_remove_checkpoint(
+	          &decrypt_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a removed checkpoint is no longer available
+	 */
+	result = decrypt_handle_read_checkpoint(
+	          &decrypt_handle,
+	          &checkpoint_offset,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = decrypt_handle_write_checkpoint(
+	          NULL,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = decrypt_handle_write_checkpoint(
+	          &decrypt_handle,
+	          8 * 1048576,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = decrypt_handle_read_checkpoint(
+	          NULL,
+	          &checkpoint_offset,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = decrypt_handle_read_checkpoint(
+	          &decrypt_handle,
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the decrypt_handle_is_sparse_data function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_decrypt_handle_is_sparse_data(
+     void )
+{
+	uint8_t data[ 4099 ];
+
+	int result = 0;
+
+	memory_set(
+	 data,
+	 0,
+	 4099 );
+
+	/* Test regular cases
+	 */
+	result = decrypt_handle_is_sparse_data(
+	          data,
+	          4099 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	data[ 4098 ] = 0x01;
+
+	result = decrypt_handle_is_sparse_data(
+	          data,
+	          4099 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	data[ 4098 ] = 0x00;
+	data[ 1024 ] = 0x80;
+
+	result = decrypt_handle_is_sparse_data(
+	          data,
+	          4099 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = decrypt_handle_is_sparse_data(
+	          NULL,
+	          4099 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc BDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] BDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc BDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] BDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	BDE_TEST_UNREFERENCED_PARAMETER( argc )
+	BDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	BDE_TEST_RUN(
+	 "decrypt_handle_initialize",
+	 bde_test_tools_decrypt_handle_initialize );
+
+	BDE_TEST_RUN(
+	 "decrypt_handle_free",
+	 bde_test_tools_decrypt_handle_free );
+
+	BDE_TEST_RUN(
+	 "decrypt_handle_checkpoint",
+	 bde_test_tools_decrypt_handle_checkpoint );
+
+	BDE_TEST_RUN(
+	 "decrypt_handle_is_sparse_data",
+	 bde_test_tools_decrypt_handle_is_sparse_data );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,621 @@
+/*
+ * Tools hash_handle type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bde_test_libcerror.h"
+#include "bde_test_macros.h"
+#include "bde_test_memory.h"
+#include "bde_test_unused.h"
+
+#include "../bdetools/digest_hash.h"
+#include "../bdetools/hash_handle.h"
+
+/* The expected hashes of the data "abc"
+ */
+const system_character_t *bde_test_tools_hash_handle_md5_string = \
+	_SYSTEM_STRING( "900150983cd24fb0d6963f7d28e17f72" );
+
+const system_character_t *bde_test_tools_hash_handle_sha1_string = \
+	_SYSTEM_STRING( "a9993e364706816aba3e25717850c26c9cd0d89d" );
+
+const system_character_t *bde_test_tools_hash_handle_sha256_string = \
+	_SYSTEM_STRING( "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" );
+
+/* Tests the hash_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_hash_handle_initialize(
+     void )
+{
+	hash_handle_t *hash_handle = NULL;
+	libcerror_error_t *error   = NULL;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = hash_handle_initialize(
+	          &hash_handle,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_handle",
+	 hash_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = hash_handle_free(
+	          &hash_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "hash_handle",
+	 hash_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = hash_handle_initialize(
+	          NULL,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	hash_handle = (hash_handle_t *) 0x12345678UL;
+
+	result = hash_handle_initialize(
+	          &hash_handle,
+	          0,
+	          &error );
+
+	hash_handle = NULL;
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_handle != NULL )
+	{
+		hash_handle_free(
+		 &hash_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the hash_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_hash_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = hash_handle_free(
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the hash_handle_update and hash_handle_finalize functions
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_hash_handle_update_with_lanes(
+     uint8_t use_parallel_lanes )
+{
+	system_character_t hash_string[ 65 ];
+
+	hash_handle_t *hash_handle = NULL;
+	libcerror_error_t *error   = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = hash_handle_initialize(
+	          &hash_handle,
+	          use_parallel_lanes,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_handle",
+	 hash_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases where the data is hashed in multiple chunks
+	 */
+	result = hash_handle_update(
+	          hash_handle,
+	          (uint8_t *) "ab",
+	          2,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = hash_handle_update(
+	          hash_handle,
+	          (uint8_t *) "c",
+	          1,
+	          2,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = hash_handle_finalize(
+	          hash_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_hash_copy_to_string(
+	          hash_handle->md5_hash,
+	          16,
+	          hash_string,
+	          65,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = system_string_compare(
+	          hash_string,
+	          bde_test_tools_hash_handle_md5_string,
+	          33 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = digest_hash_copy_to_string(
+	          hash_handle->sha1_hash,
+	          20,
+	          hash_string,
+	          65,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = system_string_compare(
+	          hash_string,
+	          bde_test_tools_hash_handle_sha1_string,
+	          41 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = digest_hash_copy_to_string(
+	          hash_handle->sha256_hash,
+	          32,
+	          hash_string,
+	          65,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = system_string_compare(
+	          hash_string,
+	          bde_test_tools_hash_handle_sha256_string,
+	          65 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = hash_handle_update(
+	          NULL,
+	          (uint8_t *) "abc",
+	          3,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test hash_handle_update after the hashes were finalized
+	 */
+	result = hash_handle_update(
+	          hash_handle,
+	          (uint8_t *) "abc",
+	          3,
+	          3,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = hash_handle_finalize(
+	          hash_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = hash_handle_free(
+	          &hash_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "hash_handle",
+	 hash_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_handle != NULL )
+	{
+		hash_handle_free(
+		 &hash_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the hash_handle_update function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_hash_handle_update(
+     void )
+{
+	int result = 0;
+
+	result = bde_test_tools_hash_handle_update_with_lanes(
+	          0 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+#if defined( HAVE_BDETOOLS_MULTI_THREAD_SUPPORT )
+	result = bde_test_tools_hash_handle_update_with_lanes(
+	          1 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+#endif
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the digest_hash_copy_to_string function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_digest_hash_copy_to_string(
+     void )
+{
+	system_character_t string[ 5 ];
+
+	uint8_t digest_hash[ 2 ] = { 0x0a, 0xf3 };
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = digest_hash_copy_to_string(
+	          digest_hash,
+	          2,
+	          string,
+	          5,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = system_string_compare(
+	          string,
+	          _SYSTEM_STRING( "0af3" ),
+	          5 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = digest_hash_copy_to_string(
+	          NULL,
+	          2,
+	          string,
+	          5,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_hash_copy_to_string(
+	          digest_hash,
+	          2,
+	          NULL,
+	          5,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_hash_copy_to_string(
+	          digest_hash,
+	          2,
+	          string,
+	          4,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc BDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] BDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc BDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] BDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	BDE_TEST_UNREFERENCED_PARAMETER( argc )
+	BDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	BDE_TEST_RUN(
+	 "hash_handle_initialize",
+	 bde_test_tools_hash_handle_initialize );
+
+	BDE_TEST_RUN(
+	 "hash_handle_free",
+	 bde_test_tools_hash_handle_free );
+
+	BDE_TEST_RUN(
+	 "hash_handle_update",
+	 bde_test_tools_hash_handle_update );
+
+	BDE_TEST_RUN(
+	 "digest_hash_copy_to_string",
+	 bde_test_tools_digest_hash_copy_to_string );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
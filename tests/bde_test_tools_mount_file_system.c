@@ -0,0 +1,563 @@
+/*
+ * Tools mount_file_system type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bde_test_libbde.h"
+#include "bde_test_libcerror.h"
+#include "bde_test_macros.h"
+#include "bde_test_memory.h"
+#include "bde_test_unused.h"
+
+#include "../bdetools/mount_file_system.h"
+
+/* The largest read request the FUSE kernel module sends by default,
+ * which is 32 pages of 4 KiB
+ */
+#define BDE_TEST_TOOLS_MOUNT_FILE_SYSTEM_FUSE_READ_SIZE	131072
+
+/* Tests the mount_file_system_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_mount_file_system_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	mount_file_system_t *file_system = NULL;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = mount_file_system_initialize(
+	          &file_system,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system",
+	 file_system );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BDE_TEST_ASSERT_EQUAL_SIZE(
+	 "file_system->streaming_read_size",
+	 file_system->streaming_read_size,
+	 (size_t) MOUNT_FILE_SYSTEM_STREAMING_READ_SIZE );
+
+	result = mount_file_system_free(
+	          &file_system,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "file_system",
+	 file_system );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = mount_file_system_initialize(
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_system != NULL )
+	{
+		mount_file_system_free(
+		 &file_system,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the mount_file_system_set_streaming_read_size function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_mount_file_system_set_streaming_read_size(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	mount_file_system_t *file_system = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = mount_file_system_initialize(
+	          &file_system,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system",
+	 file_system );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = mount_file_system_set_streaming_read_size(
+	          file_system,
+	          65536,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BDE_TEST_ASSERT_EQUAL_SIZE(
+	 "file_system->streaming_read_size",
+	 file_system->streaming_read_size,
+	 (size_t) 65536 );
+
+	/* Test error cases
+	 */
+	result = mount_file_system_set_streaming_read_size(
+	          NULL,
+	          65536,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_file_system_set_streaming_read_size(
+	          file_system,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_file_system_set_streaming_read_size(
+	          file_system,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	BDE_TEST_ASSERT_EQUAL_SIZE(
+	 "file_system->streaming_read_size",
+	 file_system->streaming_read_size,
+	 (size_t) 65536 );
+
+	/* Clean up
+	 */
+	result = mount_file_system_free(
+	          &file_system,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "file_system",
+	 file_system );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_system != NULL )
+	{
+		mount_file_system_free(
+		 &file_system,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the mount_file_system_get_read_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_mount_file_system_get_read_flags(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	mount_file_system_t *file_system = NULL;
+	int result                       = 0;
+	uint8_t read_flags               = 0;
+
+	/* Initialize test
+	 */
+	result = mount_file_system_initialize(
+	          &file_system,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system",
+	 file_system );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The largest request FUSE sends by default must be streamed
+	 */
+	result = mount_file_system_get_read_flags(
+	          file_system,
+	          BDE_TEST_TOOLS_MOUNT_FILE_SYSTEM_FUSE_READ_SIZE,
+	          &read_flags,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BDE_TEST_ASSERT_EQUAL_UINT8(
+	 "read_flags",
+	 read_flags,
+	 (uint8_t) LIBBDE_READ_FLAG_STREAMING );
+
+	/* A page sized request is cached
+	 */
+	read_flags = 0xff;
+
+	result = mount_file_system_get_read_flags(
+	          file_system,
+	          4096,
+	          &read_flags,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BDE_TEST_ASSERT_EQUAL_UINT8(
+	 "read_flags",
+	 read_flags,
+	 0 );
+
+	/* A smaller negotiated read-ahead lowers the threshold
+	 */
+	result = mount_file_system_set_streaming_read_size(
+	          file_system,
+	          65536,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mount_file_system_get_read_flags(
+	          file_system,
+	          65536,
+	          &read_flags,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BDE_TEST_ASSERT_EQUAL_UINT8(
+	 "read_flags",
+	 read_flags,
+	 (uint8_t) LIBBDE_READ_FLAG_STREAMING );
+
+	result = mount_file_system_get_read_flags(
+	          file_system,
+	          65535,
+	          &read_flags,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BDE_TEST_ASSERT_EQUAL_UINT8(
+	 "read_flags",
+	 read_flags,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = mount_file_system_get_read_flags(
+	          NULL,
+	          4096,
+	          &read_flags,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_file_system_get_read_flags(
+	          file_system,
+	          4096,
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = mount_file_system_free(
+	          &file_system,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "file_system",
+	 file_system );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_system != NULL )
+	{
+		mount_file_system_free(
+		 &file_system,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the mount_file_system_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_mount_file_system_read_buffer_at_offset(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+
+	/* Test error cases
+	 */
+	read_count = mount_file_system_read_buffer_at_offset(
+	              NULL,
+	              NULL,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc BDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] BDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc BDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] BDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	BDE_TEST_UNREFERENCED_PARAMETER( argc )
+	BDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	BDE_TEST_RUN(
+	 "mount_file_system_initialize",
+	 bde_test_tools_mount_file_system_initialize );
+
+	/* mount_file_system_free is tested by bde_test_tools_mount_file_system_initialize */
+
+	BDE_TEST_RUN(
+	 "mount_file_system_set_streaming_read_size",
+	 bde_test_tools_mount_file_system_set_streaming_read_size );
+
+	BDE_TEST_RUN(
+	 "mount_file_system_get_read_flags",
+	 bde_test_tools_mount_file_system_get_read_flags );
+
+	BDE_TEST_RUN(
+	 "mount_file_system_read_buffer_at_offset",
+	 bde_test_tools_mount_file_system_read_buffer_at_offset );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,826 @@
+/*
+ * Tools nbd_connection type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_SYS_SOCKET_H )
+#include <sys/socket.h>
+#endif
+
+#include "bde_test_libcerror.h"
+#include "bde_test_macros.h"
+#include "bde_test_memory.h"
+#include "bde_test_unused.h"
+
+#include "../bdetools/nbd_connection.h"
+#include "../bdetools/nbd_server.h"
+
+#if defined( HAVE_SYS_SOCKET_H ) && !defined( WINAPI )
+
+/* Initializes a NBD server for testing without a file system
+ */
+void bde_test_tools_nbd_connection_server_initialize(
+      nbd_server_t *nbd_server )
+{
+	memory_set(
+	 nbd_server,
+	 0,
+	 sizeof( nbd_server_t ) );
+
+	nbd_server->export_name        = "bde1";
+	nbd_server->export_name_length = 4;
+	nbd_server->volume_size        = 1048576;
+	nbd_server->socket_descriptor  = -1;
+}
+
+/* Tests the nbd_connection_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_nbd_connection_initialize(
+     void )
+{
+	nbd_server_t nbd_server;
+
+	libcerror_error_t *error     = NULL;
+	nbd_connection_t *connection = NULL;
+	int socket_descriptors[ 2 ]  = { -1, -1 };
+	int result                   = 0;
+
+	bde_test_tools_nbd_connection_server_initialize(
+	 &nbd_server );
+
+	result = socketpair(
+	          AF_UNIX,
+	          SOCK_STREAM,
+	          0,
+	          socket_descriptors );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test regular cases
+	 */
+	result = nbd_connection_initialize(
+	          &connection,
+	          &nbd_server,
+	          socket_descriptors[ 0 ],
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "connection",
+	 connection );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The connection closes the socket descriptor
+	 */
+	socket_descriptors[ 0 ] = -1;
+
+	result = nbd_connection_free(
+	          &connection,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "connection",
+	 connection );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = nbd_connection_initialize(
+	          NULL,
+	          &nbd_server,
+	          socket_descriptors[ 1 ],
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = nbd_connection_initialize(
+	          &connection,
+	          NULL,
+	          socket_descriptors[ 1 ],
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = nbd_connection_initialize(
+	          &connection,
+	          &nbd_server,
+	          -1,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	close(
+	 socket_descriptors[ 1 ] );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( connection != NULL )
+	{
+		nbd_connection_free(
+		 &connection,
+		 NULL );
+	}
+	if( socket_descriptors[ 0 ] != -1 )
+	{
+		close(
+		 socket_descriptors[ 0 ] );
+	}
+	if( socket_descriptors[ 1 ] != -1 )
+	{
+		close(
+		 socket_descriptors[ 1 ] );
+	}
+	return( 0 );
+}
+
+/* Tests the nbd_connection_negotiate function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_nbd_connection_negotiate(
+     void )
+{
+	uint8_t client_data[ 4 + 16 + 16 + 8 ];
+	uint8_t server_data[ 18 + 20 + 32 + 34 + 20 ];
+
+	nbd_server_t nbd_server;
+
+	libcerror_error_t *error     = NULL;
+	nbd_connection_t *connection = NULL;
+	ssize_t read_count           = 0;
+	ssize_t write_count          = 0;
+	size_t server_data_offset    = 0;
+	uint64_t value_64bit         = 0;
+	uint32_t value_32bit         = 0;
+	uint16_t value_16bit         = 0;
+	int socket_descriptors[ 2 ]  = { -1, -1 };
+	int result                   = 0;
+
+	bde_test_tools_nbd_connection_server_initialize(
+	 &nbd_server );
+
+	result = socketpair(
+	          AF_UNIX,
+	          SOCK_STREAM,
+	          0,
+	          socket_descriptors );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = nbd_connection_initialize(
+	          &connection,
+	          &nbd_server,
+	          socket_descriptors[ 0 ],
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	socket_descriptors[ 0 ] = -1;
+
+	/* The client data is written upfront: the client flags, a structured reply
+	 * option and a go option for the default export that requests the block size
+	 */
+	byte_stream_copy_from_uint32_big_endian(
+	 client_data,
+	 NBD_FLAG_C_FIXED_NEWSTYLE | NBD_FLAG_C_NO_ZEROES );
+
+	memory_copy(
+	 &( client_data[ 4 ] ),
+	 "IHAVEOPT",
+	 8 );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( client_data[ 12 ] ),
+	 NBD_OPT_STRUCTURED_REPLY );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( client_data[ 16 ] ),
+	 0 );
+
+	memory_copy(
+	 &( client_data[ 20 ] ),
+	 "IHAVEOPT",
+	 8 );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( client_data[ 28 ] ),
+	 NBD_OPT_GO );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( client_data[ 32 ] ),
+	 8 );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( client_data[ 36 ] ),
+	 0 );
+
+	byte_stream_copy_from_uint16_big_endian(
+	 &( client_data[ 40 ] ),
+	 1 );
+
+	byte_stream_copy_from_uint16_big_endian(
+	 &( client_data[ 42 ] ),
+	 NBD_INFO_BLOCK_SIZE );
+
+	write_count = write(
+	               socket_descriptors[ 1 ],
+	               client_data,
+	               sizeof( client_data ) );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) sizeof( client_data ) );
+
+	/* Test regular cases
+	 */
+	result = nbd_connection_negotiate(
+	          connection,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BDE_TEST_ASSERT_EQUAL_UINT8(
+	 "connection->use_structured_replies",
+	 connection->use_structured_replies,
+	 1 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT8(
+	 "connection->no_zeroes",
+	 connection->no_zeroes,
+	 1 );
+
+	while( server_data_offset < sizeof( server_data ) )
+	{
+		read_count = read(
+		              socket_descriptors[ 1 ],
+		              &( server_data[ server_data_offset ] ),
+		              sizeof( server_data ) - server_data_offset );
+
+		BDE_TEST_ASSERT_GREATER_THAN_INT(
+		 "read_count",
+		 (int) read_count,
+		 0 );
+
+		server_data_offset += (size_t) read_count;
+	}
+	/* Check the handshake
+	 */
+	result = memory_compare(
+	          server_data,
+	          "NBDMAGICIHAVEOPT",
+	          16 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Check the structured reply acknowledgement
+	 */
+	byte_stream_copy_to_uint32_big_endian(
+	 &( server_data[ 18 + 12 ] ),
+	 value_32bit );
+
+	BDE_TEST_ASSERT_EQUAL_UINT32(
+	 "reply_type",
+	 value_32bit,
+	 (uint32_t) NBD_REP_ACK );
+
+	/* Check the export information
+	 */
+	byte_stream_copy_to_uint32_big_endian(
+	 &( server_data[ 38 + 12 ] ),
+	 value_32bit );
+
+	BDE_TEST_ASSERT_EQUAL_UINT32(
+	 "reply_type",
+	 value_32bit,
+	 (uint32_t) NBD_REP_INFO );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 &( server_data[ 38 + 20 + 2 ] ),
+	 value_64bit );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "export_size",
+	 value_64bit,
+	 (uint64_t) 1048576 );
+
+	byte_stream_copy_to_uint16_big_endian(
+	 &( server_data[ 38 + 20 + 10 ] ),
+	 value_16bit );
+
+	BDE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "transmission_flags & NBD_FLAG_READ_ONLY",
+	 (int) ( value_16bit & NBD_FLAG_READ_ONLY ),
+	 0 );
+
+	/* Check the block size information
+	 */
+	byte_stream_copy_to_uint16_big_endian(
+	 &( server_data[ 70 + 20 ] ),
+	 value_16bit );
+
+	BDE_TEST_ASSERT_EQUAL_UINT16(
+	 "information_type",
+	 value_16bit,
+	 (uint16_t) NBD_INFO_BLOCK_SIZE );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( server_data[ 70 + 20 + 10 ] ),
+	 value_32bit );
+
+	BDE_TEST_ASSERT_EQUAL_UINT32(
+	 "maximum_block_size",
+	 value_32bit,
+	 (uint32_t) NBD_SERVER_MAXIMUM_REQUEST_SIZE );
+
+	/* Check the go acknowledgement
+	 */
+	byte_stream_copy_to_uint32_big_endian(
+	 &( server_data[ 104 + 12 ] ),
+	 value_32bit );
+
+	BDE_TEST_ASSERT_EQUAL_UINT32(
+	 "reply_type",
+	 value_32bit,
+	 (uint32_t) NBD_REP_ACK );
+
+	/* Test error cases
+	 */
+	result = nbd_connection_negotiate(
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = nbd_connection_free(
+	          &connection,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	close(
+	 socket_descriptors[ 1 ] );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( connection != NULL )
+	{
+		nbd_connection_free(
+		 &connection,
+		 NULL );
+	}
+	if( socket_descriptors[ 0 ] != -1 )
+	{
+		close(
+		 socket_descriptors[ 0 ] );
+	}
+	if( socket_descriptors[ 1 ] != -1 )
+	{
+		close(
+		 socket_descriptors[ 1 ] );
+	}
+	return( 0 );
+}
+
+/* Tests the nbd_connection_write_read_reply function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_nbd_connection_write_read_reply(
+     void )
+{
+	uint8_t data[ 512 ];
+	uint8_t reply_data[ 28 + 512 ];
+
+	nbd_server_t nbd_server;
+
+	libcerror_error_t *error     = NULL;
+	nbd_connection_t *connection = NULL;
+	ssize_t read_count           = 0;
+	size_t reply_data_offset     = 0;
+	uint64_t value_64bit         = 0;
+	uint32_t value_32bit         = 0;
+	int socket_descriptors[ 2 ]  = { -1, -1 };
+	int result                   = 0;
+
+	bde_test_tools_nbd_connection_server_initialize(
+	 &nbd_server );
+
+	memory_set(
+	 data,
+	 0x5a,
+	 512 );
+
+	result = socketpair(
+	          AF_UNIX,
+	          SOCK_STREAM,
+	          0,
+	          socket_descriptors );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = nbd_connection_initialize(
+	          &connection,
+	          &nbd_server,
+	          socket_descriptors[ 0 ],
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	socket_descriptors[ 0 ] = -1;
+
+	/* Test regular cases
+	 */
+	connection->use_structured_replies = 1;
+
+	result = nbd_connection_write_read_reply(
+	          connection,
+	          0x0102030405060708ULL,
+	          4096,
+	          0,
+	          data,
+	          512,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	while( reply_data_offset < sizeof( reply_data ) )
+	{
+		read_count = read(
+		              socket_descriptors[ 1 ],
+		              &( reply_data[ reply_data_offset ] ),
+		              sizeof( reply_data ) - reply_data_offset );
+
+		BDE_TEST_ASSERT_GREATER_THAN_INT(
+		 "read_count",
+		 (int) read_count,
+		 0 );
+
+		reply_data_offset += (size_t) read_count;
+	}
+	byte_stream_copy_to_uint32_big_endian(
+	 reply_data,
+	 value_32bit );
+
+	BDE_TEST_ASSERT_EQUAL_UINT32(
+	 "magic",
+	 value_32bit,
+	 (uint32_t) NBD_STRUCTURED_REPLY_MAGIC );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 &( reply_data[ 8 ] ),
+	 value_64bit );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "cookie",
+	 value_64bit,
+	 (uint64_t) 0x0102030405060708ULL );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( reply_data[ 16 ] ),
+	 value_32bit );
+
+	BDE_TEST_ASSERT_EQUAL_UINT32(
+	 "length",
+	 value_32bit,
+	 (uint32_t) ( 8 + 512 ) );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 &( reply_data[ 20 ] ),
+	 value_64bit );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "offset",
+	 value_64bit,
+	 (uint64_t) 4096 );
+
+	result = memory_compare(
+	          &( reply_data[ 28 ] ),
+	          data,
+	          512 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a simple reply with an error
+	 */
+	connection->use_structured_replies = 0;
+
+	result = nbd_connection_write_read_reply(
+	          connection,
+	          1,
+	          0,
+	          NBD_EINVAL,
+	          NULL,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = read(
+	              socket_descriptors[ 1 ],
+	              reply_data,
+	              16 );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( reply_data[ 4 ] ),
+	 value_32bit );
+
+	BDE_TEST_ASSERT_EQUAL_UINT32(
+	 "error_value",
+	 value_32bit,
+	 (uint32_t) NBD_EINVAL );
+
+	/* Test error cases
+	 */
+	result = nbd_connection_write_read_reply(
+	          NULL,
+	          1,
+	          0,
+	          0,
+	          data,
+	          512,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = nbd_connection_write_read_reply(
+	          connection,
+	          1,
+	          0,
+	          0,
+	          NULL,
+	          512,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = nbd_connection_free(
+	          &connection,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	close(
+	 socket_descriptors[ 1 ] );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( connection != NULL )
+	{
+		nbd_connection_free(
+		 &connection,
+		 NULL );
+	}
+	if( socket_descriptors[ 0 ] != -1 )
+	{
+		close(
+		 socket_descriptors[ 0 ] );
+	}
+	if( socket_descriptors[ 1 ] != -1 )
+	{
+		close(
+		 socket_descriptors[ 1 ] );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_SYS_SOCKET_H ) && !defined( WINAPI ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc BDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] BDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc BDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] BDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	BDE_TEST_UNREFERENCED_PARAMETER( argc )
+	BDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_SYS_SOCKET_H ) && !defined( WINAPI )
+
+	BDE_TEST_RUN(
+	 "nbd_connection_initialize",
+	 bde_test_tools_nbd_connection_initialize )
+
+	/* nbd_connection_free is tested by bde_test_tools_nbd_connection_initialize */
+
+	BDE_TEST_RUN(
+	 "nbd_connection_negotiate",
+	 bde_test_tools_nbd_connection_negotiate )
+
+	BDE_TEST_RUN(
+	 "nbd_connection_write_read_reply",
+	 bde_test_tools_nbd_connection_write_read_reply )
+
+#endif /* defined( HAVE_SYS_SOCKET_H ) && !defined( WINAPI ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( HAVE_SYS_SOCKET_H ) && !defined( WINAPI )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( HAVE_SYS_SOCKET_H ) && !defined( WINAPI ) */
+}
+
@@ -0,0 +1,741 @@
+/*
+ * Tools scan_handle type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bde_test_libcerror.h"
+#include "bde_test_macros.h"
+#include "bde_test_memory.h"
+#include "bde_test_unused.h"
+
+#include "../bdetools/scan_handle.h"
+
+uint8_t bde_test_tools_scan_handle_bde_identifier[ 16 ] = {
+	0x3b, 0xd6, 0x67, 0x49, 0x29, 0x2e, 0xd8, 0x4a, 0x83, 0x99, 0xf6, 0xa3, 0x39, 0xe3, 0xd0, 0x01 };
+
+/* Writes a Windows 7 volume header to a sector
+ */
+void bde_test_tools_scan_handle_set_volume_header(
+      uint8_t *sector_data,
+      uint64_t metadata_offset )
+{
+	int metadata_offset_index = 0;
+
+	memory_set(
+	 sector_data,
+	 0,
+	 SCAN_HANDLE_SECTOR_SIZE );
+
+	sector_data[ 0 ] = 0xeb;
+	sector_data[ 1 ] = 0x58;
+	sector_data[ 2 ] = 0x90;
+
+	memory_copy(
+	 &( sector_data[ 3 ] ),
+	 "-FVE-FS-",
+	 8 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( sector_data[ 11 ] ),
+	 512 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( sector_data[ 32 ] ),
+	 8192 );
+
+	memory_copy(
+	 &( sector_data[ 160 ] ),
+	 bde_test_tools_scan_handle_bde_identifier,
+	 16 );
+
+	for( metadata_offset_index = 0;
+	     metadata_offset_index < 3;
+	     metadata_offset_index++ )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 &( sector_data[ 176 + ( metadata_offset_index * 8 ) ] ),
+		 metadata_offset + ( metadata_offset_index * 1024 ) );
+	}
+	sector_data[ 510 ] = 0x55;
+	sector_data[ 511 ] = 0xaa;
+}
+
+/* Writes a version 2 FVE metadata block header to a sector
+ */
+void bde_test_tools_scan_handle_set_metadata_block_header(
+      uint8_t *sector_data,
+      uint64_t metadata_offset )
+{
+	int metadata_offset_index = 0;
+
+	memory_set(
+	 sector_data,
+	 0,
+	 SCAN_HANDLE_SECTOR_SIZE );
+
+	memory_copy(
+	 sector_data,
+	 "-FVE-FS-",
+	 8 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( sector_data[ 10 ] ),
+	 2 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( sector_data[ 16 ] ),
+	 (uint64_t) 4096 );
+
+	for( metadata_offset_index = 0;
+	     metadata_offset_index < 3;
+	     metadata_offset_index++ )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 &( sector_data[ 32 + ( metadata_offset_index * 8 ) ] ),
+		 metadata_offset + ( metadata_offset_index * 1024 ) );
+	}
+}
+
+/* Tests the scan_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_scan_handle_initialize(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	scan_handle_t *scan_handle = NULL;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = scan_handle_initialize(
+	          &scan_handle,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_handle",
+	 scan_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = scan_handle_free(
+	          &scan_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "scan_handle",
+	 scan_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = scan_handle_initialize(
+	          NULL,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	scan_handle = (scan_handle_t *) 0x12345678UL;
+
+	result = scan_handle_initialize(
+	          &scan_handle,
+	          0,
+	          &error );
+
+	scan_handle = NULL;
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_handle != NULL )
+	{
+		scan_handle_free(
+		 &scan_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the scan_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_scan_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = scan_handle_free(
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the scan_handle_check_volume_header function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_scan_handle_check_volume_header(
+     void )
+{
+	uint8_t sector_data[ SCAN_HANDLE_SECTOR_SIZE ];
+
+	scan_result_t scan_result;
+
+	int result = 0;
+
+	bde_test_tools_scan_handle_set_volume_header(
+	 sector_data,
+	 0x02100000UL );
+
+	/* Test regular cases
+	 */
+	result = scan_handle_check_volume_header(
+	          sector_data,
+	          SCAN_HANDLE_SECTOR_SIZE,
+	          &scan_result );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "scan_result.type",
+	 scan_result.type,
+	 SCAN_RESULT_TYPE_VOLUME_HEADER );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "scan_result.version",
+	 scan_result.version,
+	 SCAN_VOLUME_VERSION_WINDOWS_7 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "scan_result.volume_size",
+	 (uint64_t) scan_result.volume_size,
+	 (uint64_t) ( 8192 * 512 ) );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "scan_result.metadata_offsets[ 2 ]",
+	 scan_result.metadata_offsets[ 2 ],
+	 (uint64_t) 0x02100800UL );
+
+	/* Test an invalid bytes per sector
+	 */
+	sector_data[ 11 ] = 0x01;
+
+	result = scan_handle_check_volume_header(
+	          sector_data,
+	          SCAN_HANDLE_SECTOR_SIZE,
+	          &scan_result );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	sector_data[ 11 ] = 0x00;
+
+	/* Test a NTFS volume header without the BitLocker identifier
+	 */
+	sector_data[ 160 ] = 0x00;
+
+	result = scan_handle_check_volume_header(
+	          sector_data,
+	          SCAN_HANDLE_SECTOR_SIZE,
+	          &scan_result );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = scan_handle_check_volume_header(
+	          NULL,
+	          SCAN_HANDLE_SECTOR_SIZE,
+	          &scan_result );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = scan_handle_check_volume_header(
+	          sector_data,
+	          64,
+	          &scan_result );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the scan_handle_check_metadata_block_header function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_scan_handle_check_metadata_block_header(
+     void )
+{
+	uint8_t sector_data[ SCAN_HANDLE_SECTOR_SIZE ];
+
+	scan_result_t scan_result;
+
+	int result = 0;
+
+	bde_test_tools_scan_handle_set_metadata_block_header(
+	 sector_data,
+	 0x02100000UL );
+
+	/* Test regular cases
+	 */
+	result = scan_handle_check_metadata_block_header(
+	          sector_data,
+	          SCAN_HANDLE_SECTOR_SIZE,
+	          &scan_result );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "scan_result.type",
+	 scan_result.type,
+	 SCAN_RESULT_TYPE_METADATA_BLOCK );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "scan_result.version",
+	 scan_result.version,
+	 2 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "scan_result.encrypted_volume_size",
+	 (uint64_t) scan_result.encrypted_volume_size,
+	 (uint64_t) 4096 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "scan_result.metadata_offsets[ 1 ]",
+	 scan_result.metadata_offsets[ 1 ],
+	 (uint64_t) 0x02100400UL );
+
+	/* Test an unsupported format version
+	 */
+	sector_data[ 10 ] = 3;
+
+	result = scan_handle_check_metadata_block_header(
+	          sector_data,
+	          SCAN_HANDLE_SECTOR_SIZE,
+	          &scan_result );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	sector_data[ 10 ] = 2;
+
+	/* Test a missing metadata offset
+	 */
+	memory_set(
+	 &( sector_data[ 40 ] ),
+	 0,
+	 8 );
+
+	result = scan_handle_check_metadata_block_header(
+	          sector_data,
+	          SCAN_HANDLE_SECTOR_SIZE,
+	          &scan_result );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = scan_handle_check_metadata_block_header(
+	          NULL,
+	          SCAN_HANDLE_SECTOR_SIZE,
+	          &scan_result );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the scan_handle_scan_data and scan_handle_resolve_results functions
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_tools_scan_handle_scan_data(
+     void )
+{
+	uint8_t data[ 8 * SCAN_HANDLE_SECTOR_SIZE ];
+
+	libcerror_error_t *error   = NULL;
+	scan_handle_t *scan_handle = NULL;
+	scan_result_t *scan_result = NULL;
+	int number_of_results      = 0;
+	int result                 = 0;
+
+	/* A volume at sector 1 with its metadata at sectors 3 and 5,
+	 * and a stray signature at sector 6
+	 */
+	memory_set(
+	 data,
+	 0,
+	 8 * SCAN_HANDLE_SECTOR_SIZE );
+
+	bde_test_tools_scan_handle_set_volume_header(
+	 &( data[ 1 * SCAN_HANDLE_SECTOR_SIZE ] ),
+	 2 * SCAN_HANDLE_SECTOR_SIZE );
+
+	bde_test_tools_scan_handle_set_metadata_block_header(
+	 &( data[ 3 * SCAN_HANDLE_SECTOR_SIZE ] ),
+	 2 * SCAN_HANDLE_SECTOR_SIZE );
+
+	bde_test_tools_scan_handle_set_metadata_block_header(
+	 &( data[ 5 * SCAN_HANDLE_SECTOR_SIZE ] ),
+	 2 * SCAN_HANDLE_SECTOR_SIZE );
+
+	memory_copy(
+	 &( data[ 6 * SCAN_HANDLE_SECTOR_SIZE ] ),
+	 "-FVE-FS-",
+	 8 );
+
+	result = scan_handle_initialize(
+	          &scan_handle,
+	          0,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_handle",
+	 scan_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = scan_handle_scan_data(
+	          data,
+	          8 * SCAN_HANDLE_SECTOR_SIZE,
+	          0,
+	          scan_handle->results_array,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          scan_handle->results_array,
+	          &number_of_results,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 3 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = scan_handle_resolve_results(
+	          scan_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = scan_handle_get_result_by_offset(
+	          scan_handle,
+	          5 * SCAN_HANDLE_SECTOR_SIZE,
+	          SCAN_RESULT_TYPE_METADATA_BLOCK,
+	          &scan_result,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_result",
+	 scan_result );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "scan_result->volume_offset",
+	 (int64_t) scan_result->volume_offset,
+	 (int64_t) SCAN_HANDLE_SECTOR_SIZE );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "scan_result->copy_number",
+	 scan_result->copy_number,
+	 3 );
+
+	/* Test that a result of another type is not returned
+	 */
+	result = scan_handle_get_result_by_offset(
+	          scan_handle,
+	          5 * SCAN_HANDLE_SECTOR_SIZE,
+	          SCAN_RESULT_TYPE_VOLUME_HEADER,
+	          &scan_result,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = scan_handle_scan_data(
+	          NULL,
+	          8 * SCAN_HANDLE_SECTOR_SIZE,
+	          0,
+	          scan_handle->results_array,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scan_handle_resolve_results(
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = scan_handle_free(
+	          &scan_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "scan_handle",
+	 scan_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_handle != NULL )
+	{
+		scan_handle_free(
+		 &scan_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc BDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] BDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc BDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] BDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	BDE_TEST_UNREFERENCED_PARAMETER( argc )
+	BDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	BDE_TEST_RUN(
+	 "scan_handle_initialize",
+	 bde_test_tools_scan_handle_initialize );
+
+	BDE_TEST_RUN(
+	 "scan_handle_free",
+	 bde_test_tools_scan_handle_free );
+
+	BDE_TEST_RUN(
+	 "scan_handle_check_volume_header",
+	 bde_test_tools_scan_handle_check_volume_header );
+
+	BDE_TEST_RUN(
+	 "scan_handle_check_metadata_block_header",
+	 bde_test_tools_scan_handle_check_metadata_block_header );
+
+	BDE_TEST_RUN(
+	 "scan_handle_scan_data",
+	 bde_test_tools_scan_handle_scan_data );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -43,7 +44,12 @@
 #include "bde_test_libcerror.h"
 #include "bde_test_macros.h"
 #include "bde_test_memory.h"
+#include "bde_test_unused.h"
 
+#include "../libbde/libbde_block_cache.h"
+#include "../libbde/libbde_definitions.h"
+#include "../libbde/libbde_encryption_context.h"
+#include "../libbde/libbde_sector_data_vector.h"
 #include "../libbde/libbde_volume.h"
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
@@ -738,6 +744,81 @@ int bde_test_volume_open(
 	libcerror_error_free(
 	 &error );
 
+	/* Test open with memory mapping, which falls back to reading
+	 * the file if it cannot be memory mapped
+	 */
+	result = libbde_volume_close(
+	          volume,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_volume_open(
+	          volume,
+	          narrow_source,
+	          LIBBDE_OPEN_READ_MEMORY_MAPPED,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_volume_close(
+	          volume,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open with direct IO, which falls back to reading
+	 * the file if it cannot be opened for direct IO
+	 */
+	result = libbde_volume_open(
+	          volume,
+	          narrow_source,
+	          LIBBDE_OPEN_READ_DIRECT_IO,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_volume_close(
+	          volume,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Clean up
 	 */
 	result = libbde_volume_free(
@@ -1775,6 +1856,7 @@ int bde_test_internal_volume_read_buffer_from_file_io_handle(
 	              ( (libbde_internal_volume_t *) volume )->file_io_handle,
 	              buffer,
 	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+	              0,
 	              &error );
 
 	BDE_TEST_ASSERT_EQUAL_SSIZE(
@@ -1812,6 +1894,7 @@ int bde_test_internal_volume_read_buffer_from_file_io_handle(
 		              ( (libbde_internal_volume_t *) volume )->file_io_handle,
 		              buffer,
 		              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+		              0,
 		              &error );
 
 		BDE_TEST_ASSERT_EQUAL_SSIZE(
@@ -1830,6 +1913,7 @@ int bde_test_internal_volume_read_buffer_from_file_io_handle(
 		              ( (libbde_internal_volume_t *) volume )->file_io_handle,
 		              buffer,
 		              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+		              0,
 		              &error );
 
 		BDE_TEST_ASSERT_EQUAL_SSIZE(
@@ -1892,6 +1976,7 @@ int bde_test_internal_volume_read_buffer_from_file_io_handle(
 		              ( (libbde_internal_volume_t *) volume )->file_io_handle,
 		              buffer,
 		              read_size,
+		              0,
 		              &error );
 
 		if( read_size > remaining_size )
@@ -1976,6 +2061,7 @@ int bde_test_internal_volume_read_buffer_from_file_io_handle(
 	              ( (libbde_internal_volume_t *) volume )->file_io_handle,
 	              buffer,
 	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+	              0,
 	              &error );
 
 	BDE_TEST_ASSERT_EQUAL_SSIZE(
@@ -1995,6 +2081,7 @@ int bde_test_internal_volume_read_buffer_from_file_io_handle(
 	              ( (libbde_internal_volume_t *) volume )->file_io_handle,
 	              NULL,
 	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+	              0,
 	              &error );
 
 	BDE_TEST_ASSERT_EQUAL_SSIZE(
@@ -2014,6 +2101,7 @@ int bde_test_internal_volume_read_buffer_from_file_io_handle(
 	              ( (libbde_internal_volume_t *) volume )->file_io_handle,
 	              buffer,
 	              (size_t) SSIZE_MAX + 1,
+	              0,
 	              &error );
 
 	BDE_TEST_ASSERT_EQUAL_SSIZE(
@@ -2039,34 +2127,37 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
-
-/* Tests the libbde_volume_read_buffer function
+/* Tests the libbde_internal_volume_read_unencrypted_buffer_from_file_io_handle function
  * Returns 1 if successful or 0 if not
  */
-int bde_test_volume_read_buffer(
-     libbde_volume_t *volume )
+int bde_test_internal_volume_read_unencrypted_buffer_from_file_io_handle(
+     void )
 {
-	uint8_t buffer[ BDE_TEST_VOLUME_READ_BUFFER_SIZE ];
+	uint8_t buffer[ 1024 ];
+	uint8_t data[ 8192 ];
 
-	libcerror_error_t *error = NULL;
-	time_t timestamp         = 0;
-	size64_t remaining_size  = 0;
-	size64_t size            = 0;
-	size_t read_size         = 0;
-	ssize_t read_count       = 0;
-	off64_t offset           = 0;
-	off64_t read_offset      = 0;
-	int number_of_tests      = 1024;
-	int random_number        = 0;
-	int result               = 0;
-	int test_number          = 0;
+	libbde_block_cache_t *block_cache     = NULL;
+	libbde_io_handle_t *io_handle         = NULL;
+	libbde_volume_t *volume               = NULL;
+	libbfio_handle_t *file_io_handle      = NULL;
+	libcerror_error_t *error              = NULL;
+	uint64_t number_of_block_cache_misses = 0;
+	size_t data_offset                    = 0;
+	ssize_t read_count                    = 0;
+	int result                            = 0;
 
-	/* Determine size
+	/* Initialize test
 	 */
-	result = libbde_volume_get_size(
-	          volume,
-	          &size,
+	for( data_offset = 0;
+	     data_offset < 8192;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( ( data_offset / 512 ) + data_offset );
+	}
+	result = bde_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          8192,
 	          &error );
 
 	BDE_TEST_ASSERT_EQUAL_INT(
@@ -2074,22 +2165,49 @@ int bde_test_volume_read_buffer(
 	 result,
 	 1 );
 
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
 	BDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Reset offset to 0
+	result = libbde_volume_initialize(
+	          &volume,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The last 4096 bytes of the volume are not encrypted
 	 */
-	offset = libbde_volume_seek_offset(
-	          volume,
-	          0,
-	          SEEK_SET,
+	io_handle = ( (libbde_internal_volume_t *) volume )->io_handle;
+
+	io_handle->version               = LIBBDE_VERSION_WINDOWS_7;
+	io_handle->volume_size           = 8192;
+	io_handle->volume_header_offset  = 1024;
+	io_handle->volume_header_size    = 512;
+	io_handle->encrypted_volume_size = 4096;
+
+	result = libbde_internal_volume_read_extents(
+	          (libbde_internal_volume_t *) volume,
 	          &error );
 
-	BDE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	BDE_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2097,213 +2215,162 @@ int bde_test_volume_read_buffer(
 
 	/* Test regular cases
 	 */
-	read_size = BDE_TEST_VOLUME_READ_BUFFER_SIZE;
+	read_count = libbde_internal_volume_read_unencrypted_buffer_from_file_io_handle(
+	              (libbde_internal_volume_t *) volume,
+	              file_io_handle,
+	              1536,
+	              buffer,
+	              1024,
+	              &error );
 
-	if( size < BDE_TEST_VOLUME_READ_BUFFER_SIZE )
-	{
-		read_size = (size_t) size;
-	}
-	read_count = libbde_volume_read_buffer(
-	              volume,
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbde_internal_volume_read_unencrypted_buffer_from_file_io_handle(
+	              (libbde_internal_volume_t *) volume,
+	              file_io_handle,
+	              4096,
 	              buffer,
-	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+	              1024,
 	              &error );
 
 	BDE_TEST_ASSERT_EQUAL_SSIZE(
 	 "read_count",
 	 read_count,
-	 (ssize_t) read_size );
+	 (ssize_t) 1024 );
 
 	BDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	if( size > 8 )
-	{
-		/* Set offset to size - 8
-		 */
-		offset = libbde_volume_seek_offset(
-		          volume,
-		          -8,
-		          SEEK_END,
-		          &error );
+	result = memory_compare(
+	          buffer,
+	          &( data[ 4096 ] ),
+	          1024 );
 
-		BDE_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 offset,
-		 (int64_t) size - 8 );
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		BDE_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	/* Test a read that crosses the end of the volume
+	 */
+	read_count = libbde_internal_volume_read_unencrypted_buffer_from_file_io_handle(
+	              (libbde_internal_volume_t *) volume,
+	              file_io_handle,
+	              7680,
+	              buffer,
+	              1024,
+	              &error );
 
-		/* Read buffer on size boundary
-		 */
-		read_count = libbde_volume_read_buffer(
-		              volume,
-		              buffer,
-		              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
-		              &error );
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
 
-		BDE_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) 8 );
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		BDE_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	result = memory_compare(
+	          buffer,
+	          &( data[ 7680 ] ),
+	          512 );
 
-		/* Read buffer beyond size boundary
-		 */
-		read_count = libbde_volume_read_buffer(
-		              volume,
-		              buffer,
-		              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
-		              &error );
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		BDE_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) 0 );
+	read_count = libbde_internal_volume_read_unencrypted_buffer_from_file_io_handle(
+	              (libbde_internal_volume_t *) volume,
+	              file_io_handle,
+	              8192,
+	              buffer,
+	              1024,
+	              &error );
 
-		BDE_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-	/* Stress test read buffer
-	 */
-	timestamp = time(
-	             NULL );
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
 
-	srand(
-	 (unsigned int) timestamp );
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	offset = libbde_volume_seek_offset(
-	          volume,
-	          0,
-	          SEEK_SET,
+	/* Test a read using the block cache
+	 */
+	result = libbde_block_cache_initialize(
+	          &block_cache,
+	          LIBBDE_BLOCK_CACHE_BLOCK_SIZE,
 	          &error );
 
-	BDE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
 
 	BDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	remaining_size = size;
+	io_handle->block_cache = block_cache;
 
-	for( test_number = 0;
-	     test_number < number_of_tests;
-	     test_number++ )
-	{
-		random_number = rand();
-
-		BDE_TEST_ASSERT_GREATER_THAN_INT(
-		 "random_number",
-		 random_number,
-		 -1 );
-
-		read_size = (size_t) random_number % BDE_TEST_VOLUME_READ_BUFFER_SIZE;
-
-#if defined( BDE_TEST_VOLUME_VERBOSE )
-		fprintf(
-		 stdout,
-		 "libbde_volume_read_buffer: at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd "\n",
-		 read_offset,
-		 read_offset,
-		 read_size );
-#endif
-		read_count = libbde_volume_read_buffer(
-		              volume,
-		              buffer,
-		              read_size,
-		              &error );
-
-		if( read_size > remaining_size )
-		{
-			read_size = (size_t) remaining_size;
-		}
-		BDE_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) read_size );
-
-		BDE_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-
-		read_offset += read_count;
-
-		result = libbde_volume_get_offset(
-		          volume,
-		          &offset,
-		          &error );
-
-		BDE_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
-
-		BDE_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 offset,
-		 read_offset );
-
-		BDE_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-
-		remaining_size -= read_count;
-
-		if( remaining_size == 0 )
-		{
-			offset = libbde_volume_seek_offset(
-			          volume,
-			          0,
-			          SEEK_SET,
-			          &error );
-
-			BDE_TEST_ASSERT_EQUAL_INT64(
-			 "offset",
-			 offset,
-			 (int64_t) 0 );
+	number_of_block_cache_misses = io_handle->statistics.number_of_block_cache_misses;
 
-			BDE_TEST_ASSERT_IS_NULL(
-			 "error",
-			 error );
-
-			read_offset = 0;
+	read_count = libbde_internal_volume_read_unencrypted_buffer_from_file_io_handle(
+	              (libbde_internal_volume_t *) volume,
+	              file_io_handle,
+	              6144,
+	              buffer,
+	              1024,
+	              &error );
 
-			remaining_size = size;
-		}
-	}
-	/* Reset offset to 0
-	 */
-	offset = libbde_volume_seek_offset(
-	          volume,
-	          0,
-	          SEEK_SET,
-	          &error );
+	io_handle->block_cache = NULL;
 
-	BDE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1024 );
 
 	BDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	result = memory_compare(
+	          buffer,
+	          &( data[ 6144 ] ),
+	          1024 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_block_cache_misses",
+	 io_handle->statistics.number_of_block_cache_misses,
+	 number_of_block_cache_misses + 1 );
+
 	/* Test error cases
 	 */
-	read_count = libbde_volume_read_buffer(
+	read_count = libbde_internal_volume_read_unencrypted_buffer_from_file_io_handle(
 	              NULL,
+	              file_io_handle,
+	              4096,
 	              buffer,
-	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+	              1024,
 	              &error );
 
 	BDE_TEST_ASSERT_EQUAL_SSIZE(
@@ -2318,10 +2385,12 @@ int bde_test_volume_read_buffer(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libbde_volume_read_buffer(
-	              volume,
+	read_count = libbde_internal_volume_read_unencrypted_buffer_from_file_io_handle(
+	              (libbde_internal_volume_t *) volume,
+	              file_io_handle,
+	              4096,
 	              NULL,
-	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+	              1024,
 	              &error );
 
 	BDE_TEST_ASSERT_EQUAL_SSIZE(
@@ -2336,83 +2405,54 @@ int bde_test_volume_read_buffer(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libbde_volume_read_buffer(
-	              volume,
-	              buffer,
-	              (size_t) SSIZE_MAX + 1,
-	              &error );
+	/* Clean up
+	 */
+	result = libbde_block_cache_free(
+	          &block_cache,
+	          &error );
 
-	BDE_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	BDE_TEST_ASSERT_IS_NOT_NULL(
+	BDE_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	BDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-#if defined( HAVE_BDE_TEST_RWLOCK )
-
-	/* Test libbde_volume_read_buffer with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
-	 */
-	bde_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
-
-	read_count = libbde_volume_read_buffer(
-	              volume,
-	              buffer,
-	              BDE_TEST_PARTITION_READ_BUFFER_SIZE,
-	              &error );
-
-	if( bde_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
-	{
-		bde_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		BDE_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) -1 );
+	result = libbde_volume_free(
+	          &volume,
+	          &error );
 
-		BDE_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libbde_volume_read_buffer with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
-	 */
-	bde_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+	BDE_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
 
-	read_count = libbde_volume_read_buffer(
-	              volume,
-	              buffer,
-	              BDE_TEST_PARTITION_READ_BUFFER_SIZE,
-	              &error );
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	if( bde_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		bde_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		BDE_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) -1 );
+	result = bde_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
 
-		BDE_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_BDE_TEST_RWLOCK ) */
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	return( 1 );
 
@@ -2422,35 +2462,58 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( io_handle != NULL )
+	{
+		io_handle->block_cache = NULL;
+	}
+	if( block_cache != NULL )
+	{
+		libbde_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libbde_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libbde_volume_read_buffer_at_offset function
+/* Tests the libbde_internal_volume_open_file_io_handle function
  * Returns 1 if successful or 0 if not
  */
-int bde_test_volume_read_buffer_at_offset(
-     libbde_volume_t *volume )
+int bde_test_internal_volume_open_file_io_handle(
+     void )
 {
-	uint8_t buffer[ BDE_TEST_VOLUME_READ_BUFFER_SIZE ];
+	uint8_t data[ 8192 ];
 
-	libcerror_error_t *error = NULL;
-	time_t timestamp         = 0;
-	size64_t remaining_size  = 0;
-	size64_t size            = 0;
-	size_t read_size         = 0;
-	ssize_t read_count       = 0;
-	off64_t offset           = 0;
-	off64_t read_offset      = 0;
-	int number_of_tests      = 1024;
-	int random_number        = 0;
-	int result               = 0;
-	int test_number          = 0;
+	libbde_positional_file_t *positional_file = NULL;
+	libbde_volume_t *volume                   = NULL;
+	libbfio_handle_t *file_io_handle          = NULL;
+	libcerror_error_t *error                  = NULL;
+	int result                                = 0;
 
-	/* Determine size
+	/* Initialize test
 	 */
-	result = libbde_volume_get_size(
-	          volume,
-	          &size,
+	if( memory_set(
+	     data,
+	     0,
+	     8192 ) == NULL )
+	{
+		goto on_error;
+	}
+	result = bde_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          8192,
 	          &error );
 
 	BDE_TEST_ASSERT_EQUAL_INT(
@@ -2458,161 +2521,1739 @@ int bde_test_volume_read_buffer_at_offset(
 	 result,
 	 1 );
 
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
 	BDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	result = libbde_volume_initialize(
+	          &volume,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_positional_file_initialize(
+	          &positional_file,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the positional file is not attached to the volume
+	 * when the open fails, so that it remains owned by the caller
+	 */
+	result = libbde_internal_volume_open_file_io_handle(
+	          (libbde_internal_volume_t *) volume,
+	          file_io_handle,
+	          NULL,
+	          positional_file,
+	          1,
+	          LIBBDE_OPEN_READ,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "internal_volume->file_io_handle",
+	 ( (libbde_internal_volume_t *) volume )->file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "internal_volume->positional_file",
+	 ( (libbde_internal_volume_t *) volume )->positional_file );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "internal_volume->io_handle->positional_file",
+	 ( (libbde_internal_volume_t *) volume )->io_handle->positional_file );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "internal_volume->file_io_handle_created_in_library",
+	 (int) ( (libbde_internal_volume_t *) volume )->file_io_handle_created_in_library,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libbde_internal_volume_open_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          NULL,
+	          positional_file,
+	          1,
+	          LIBBDE_OPEN_READ,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbde_positional_file_free(
+	          &positional_file,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_volume_free(
+	          &volume,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bde_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( positional_file != NULL )
+	{
+		libbde_positional_file_free(
+		 &positional_file,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libbde_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_internal_volume_warmup function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_internal_volume_warmup(
+     void )
+{
+	uint8_t buffer[ 512 ];
+
+	libbde_encryption_context_t *encryption_context   = NULL;
+	libbde_internal_volume_t *internal_volume         = NULL;
+	libbde_sector_data_vector_t *sector_data_vector   = NULL;
+	libbde_volume_t *volume                           = NULL;
+	libbfio_handle_t *file_io_handle                  = NULL;
+	libcerror_error_t *error                          = NULL;
+	uint8_t *data                                     = NULL;
+	uint64_t number_of_cache_hits                     = 0;
+	size_t data_offset                                = 0;
+	ssize_t read_count                                = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * 4 * 65536 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	for( data_offset = 0;
+	     data_offset < 4 * 65536;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( ( data_offset / 512 ) + data_offset );
+	}
+	result = bde_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          4 * 65536,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_volume_initialize(
+	          &volume,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_encryption_context_initialize(
+	          &encryption_context,
+	          LIBBDE_ENCRYPTION_METHOD_NONE,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_sector_data_vector_initialize(
+	          &sector_data_vector,
+	          512,
+	          0,
+	          4 * 65536,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Emulate an unlocked volume with the MFT in the second 64 KiB
+	 */
+	internal_volume = (libbde_internal_volume_t *) volume;
+
+	internal_volume->file_io_handle                      = file_io_handle;
+	internal_volume->encryption_context                  = encryption_context;
+	internal_volume->sector_data_vector                  = sector_data_vector;
+	internal_volume->is_locked                           = 0;
+	internal_volume->current_offset                      = 1234;
+	internal_volume->warmup_size                         = 65536;
+	internal_volume->io_handle->volume_size              = 4 * 65536;
+	internal_volume->io_handle->cluster_block_size       = 4096;
+	internal_volume->io_handle->mft_cluster_block_number = 65536 / 4096;
+
+	/* Test regular cases
+	 */
+	result = libbde_internal_volume_warmup(
+	          internal_volume,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The warmup does not change the current offset
+	 */
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "internal_volume->current_offset",
+	 (int64_t) internal_volume->current_offset,
+	 (int64_t) 1234 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "sector_data_vector->number_of_warm_ranges",
+	 sector_data_vector->number_of_warm_ranges,
+	 2 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics.number_of_warmup_bytes",
+	 internal_volume->io_handle->statistics.number_of_warmup_bytes,
+	 (uint64_t) ( LIBBDE_WARMUP_BOOT_AREA_SIZE + 65536 ) );
+
+	/* The warmup reads are included in the read statistics
+	 */
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics.number_of_bytes_read",
+	 internal_volume->io_handle->statistics.number_of_bytes_read,
+	 (uint64_t) ( LIBBDE_WARMUP_BOOT_AREA_SIZE + 65536 ) );
+
+	/* Sectors in the warmup ranges are read from memory
+	 */
+	number_of_cache_hits = internal_volume->io_handle->statistics.number_of_cache_hits;
+
+	internal_volume->current_offset = 65536 + 512;
+
+	read_count = libbde_internal_volume_read_buffer_from_file_io_handle(
+	              internal_volume,
+	              file_io_handle,
+	              buffer,
+	              512,
+	              0,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ 65536 + 512 ] ),
+	          512 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics.number_of_cache_hits",
+	 internal_volume->io_handle->statistics.number_of_cache_hits,
+	 number_of_cache_hits + 1 );
+
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics.number_of_bytes_read",
+	 internal_volume->io_handle->statistics.number_of_bytes_read,
+	 (uint64_t) ( LIBBDE_WARMUP_BOOT_AREA_SIZE + 65536 ) );
+
+	/* Test error cases
+	 */
+	result = libbde_internal_volume_warmup(
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	internal_volume->file_io_handle     = NULL;
+	internal_volume->encryption_context = NULL;
+	internal_volume->sector_data_vector = NULL;
+
+	result = libbde_volume_free(
+	          &volume,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_sector_data_vector_free(
+	          &sector_data_vector,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_encryption_context_free(
+	          &encryption_context,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bde_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( internal_volume != NULL )
+	{
+		internal_volume->file_io_handle     = NULL;
+		internal_volume->encryption_context = NULL;
+		internal_volume->sector_data_vector = NULL;
+	}
+	if( volume != NULL )
+	{
+		libbde_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( sector_data_vector != NULL )
+	{
+		libbde_sector_data_vector_free(
+		 &sector_data_vector,
+		 NULL );
+	}
+	if( encryption_context != NULL )
+	{
+		libbde_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
+
+/* Tests the libbde_volume_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_volume_read_buffer(
+     libbde_volume_t *volume )
+{
+	uint8_t buffer[ BDE_TEST_VOLUME_READ_BUFFER_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	time_t timestamp         = 0;
+	size64_t remaining_size  = 0;
+	size64_t size            = 0;
+	size_t read_size         = 0;
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
+	off64_t read_offset      = 0;
+	int number_of_tests      = 1024;
+	int random_number        = 0;
+	int result               = 0;
+	int test_number          = 0;
+
+	/* Determine size
+	 */
+	result = libbde_volume_get_size(
+	          volume,
+	          &size,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Reset offset to 0
+	 */
+	offset = libbde_volume_seek_offset(
+	          volume,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_size = BDE_TEST_VOLUME_READ_BUFFER_SIZE;
+
+	if( size < BDE_TEST_VOLUME_READ_BUFFER_SIZE )
+	{
+		read_size = (size_t) size;
+	}
+	read_count = libbde_volume_read_buffer(
+	              volume,
+	              buffer,
+	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( size > 8 )
+	{
+		/* Set offset to size - 8
+		 */
+		offset = libbde_volume_seek_offset(
+		          volume,
+		          -8,
+		          SEEK_END,
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 (int64_t) size - 8 );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Read buffer on size boundary
+		 */
+		read_count = libbde_volume_read_buffer(
+		              volume,
+		              buffer,
+		              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+		              &error );
+
+		BDE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 8 );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Read buffer beyond size boundary
+		 */
+		read_count = libbde_volume_read_buffer(
+		              volume,
+		              buffer,
+		              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+		              &error );
+
+		BDE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 0 );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Stress test read buffer
+	 */
+	timestamp = time(
+	             NULL );
+
+	srand(
+	 (unsigned int) timestamp );
+
+	offset = libbde_volume_seek_offset(
+	          volume,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remaining_size = size;
+
+	for( test_number = 0;
+	     test_number < number_of_tests;
+	     test_number++ )
+	{
+		random_number = rand();
+
+		BDE_TEST_ASSERT_GREATER_THAN_INT(
+		 "random_number",
+		 random_number,
+		 -1 );
+
+		read_size = (size_t) random_number % BDE_TEST_VOLUME_READ_BUFFER_SIZE;
+
+#if defined( BDE_TEST_VOLUME_VERBOSE )
+		fprintf(
+		 stdout,
+		 "libbde_volume_read_buffer: at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd "\n",
+		 read_offset,
+		 read_offset,
+		 read_size );
+#endif
+		read_count = libbde_volume_read_buffer(
+		              volume,
+		              buffer,
+		              read_size,
+		              &error );
+
+		if( read_size > remaining_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		BDE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) read_size );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_offset += read_count;
+
+		result = libbde_volume_get_offset(
+		          volume,
+		          &offset,
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BDE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 read_offset );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		remaining_size -= read_count;
+
+		if( remaining_size == 0 )
+		{
+			offset = libbde_volume_seek_offset(
+			          volume,
+			          0,
+			          SEEK_SET,
+			          &error );
+
+			BDE_TEST_ASSERT_EQUAL_INT64(
+			 "offset",
+			 offset,
+			 (int64_t) 0 );
+
+			BDE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			read_offset = 0;
+
+			remaining_size = size;
+		}
+	}
+	/* Reset offset to 0
+	 */
+	offset = libbde_volume_seek_offset(
+	          volume,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libbde_volume_read_buffer(
+	              NULL,
+	              buffer,
+	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbde_volume_read_buffer(
+	              volume,
+	              NULL,
+	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbde_volume_read_buffer(
+	              volume,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BDE_TEST_RWLOCK )
+
+	/* Test libbde_volume_read_buffer with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	bde_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	read_count = libbde_volume_read_buffer(
+	              volume,
+	              buffer,
+	              BDE_TEST_PARTITION_READ_BUFFER_SIZE,
+	              &error );
+
+	if( bde_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		bde_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BDE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		BDE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbde_volume_read_buffer with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	bde_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	read_count = libbde_volume_read_buffer(
+	              volume,
+	              buffer,
+	              BDE_TEST_PARTITION_READ_BUFFER_SIZE,
+	              &error );
+
+	if( bde_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bde_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BDE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		BDE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BDE_TEST_RWLOCK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_volume_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_volume_read_buffer_at_offset(
+     libbde_volume_t *volume )
+{
+	uint8_t buffer[ BDE_TEST_VOLUME_READ_BUFFER_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	time_t timestamp         = 0;
+	size64_t remaining_size  = 0;
+	size64_t size            = 0;
+	size_t read_size         = 0;
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
+	off64_t read_offset      = 0;
+	int number_of_tests      = 1024;
+	int random_number        = 0;
+	int result               = 0;
+	int test_number          = 0;
+
+	/* Determine size
+	 */
+	result = libbde_volume_get_size(
+	          volume,
+	          &size,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_size = BDE_TEST_VOLUME_READ_BUFFER_SIZE;
+
+	if( size < BDE_TEST_VOLUME_READ_BUFFER_SIZE )
+	{
+		read_size = (size_t) size;
+	}
+	read_count = libbde_volume_read_buffer_at_offset(
+	              volume,
+	              buffer,
+	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+	              0,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( size > 8 )
+	{
+		/* Read buffer on size boundary
+		 */
+		read_count = libbde_volume_read_buffer_at_offset(
+		              volume,
+		              buffer,
+		              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+		              size - 8,
+		              &error );
+
+		BDE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 8 );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Read buffer beyond size boundary
+		 */
+		read_count = libbde_volume_read_buffer_at_offset(
+		              volume,
+		              buffer,
+		              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+		              size + 8,
+		              &error );
+
+		BDE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 0 );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Stress test read buffer
+	 */
+	timestamp = time(
+	             NULL );
+
+	srand(
+	 (unsigned int) timestamp );
+
+	for( test_number = 0;
+	     test_number < number_of_tests;
+	     test_number++ )
+	{
+		random_number = rand();
+
+		BDE_TEST_ASSERT_GREATER_THAN_INT(
+		 "random_number",
+		 random_number,
+		 -1 );
+
+		if( size > 0 )
+		{
+			read_offset = (off64_t) random_number % size;
+		}
+		read_size = (size_t) random_number % BDE_TEST_VOLUME_READ_BUFFER_SIZE;
+
+#if defined( BDE_TEST_VOLUME_VERBOSE )
+		fprintf(
+		 stdout,
+		 "libbde_volume_read_buffer_at_offset: at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd "\n",
+		 read_offset,
+		 read_offset,
+		 read_size );
+#endif
+		read_count = libbde_volume_read_buffer_at_offset(
+		              volume,
+		              buffer,
+		              read_size,
+		              read_offset,
+		              &error );
+
+		remaining_size = size - read_offset;
+
+		if( read_size > remaining_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		BDE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) read_size );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_offset += read_count;
+
+		result = libbde_volume_get_offset(
+		          volume,
+		          &offset,
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BDE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 read_offset );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	read_count = libbde_volume_read_buffer_at_offset(
+	              NULL,
+	              buffer,
+	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+	              0,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbde_volume_read_buffer_at_offset(
+	              volume,
+	              NULL,
+	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+	              0,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbde_volume_read_buffer_at_offset(
+	              volume,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbde_volume_read_buffer_at_offset(
+	              volume,
+	              buffer,
+	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+	              -1,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BDE_TEST_RWLOCK )
+
+	/* Test libbde_volume_read_buffer_at_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	bde_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	read_count = libbde_volume_read_buffer_at_offset(
+	              volume,
+	              buffer,
+	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+	              0,
+	              &error );
+
+	if( bde_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		bde_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BDE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		BDE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libbde_volume_read_buffer_at_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	bde_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	read_count = libbde_volume_read_buffer_at_offset(
+	              volume,
+	              buffer,
+	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+	              0,
+	              &error );
+
+	if( bde_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		bde_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		BDE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		BDE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BDE_TEST_RWLOCK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_volume_read_buffer_at_offset_with_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_volume_read_buffer_at_offset_with_flags(
+     libbde_volume_t *volume )
+{
+	uint8_t buffer[ BDE_TEST_VOLUME_READ_BUFFER_SIZE ];
+	uint8_t streaming_buffer[ BDE_TEST_VOLUME_READ_BUFFER_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	size_t read_size         = 0;
+	ssize_t read_count       = 0;
+	int result               = 0;
+
+	/* Determine size
+	 */
+	result = libbde_volume_get_size(
+	          volume,
+	          &size,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
 	 */
 	read_size = BDE_TEST_VOLUME_READ_BUFFER_SIZE;
 
-	if( size < BDE_TEST_VOLUME_READ_BUFFER_SIZE )
+	if( size < BDE_TEST_VOLUME_READ_BUFFER_SIZE )
+	{
+		read_size = (size_t) size;
+	}
+	read_count = libbde_volume_read_buffer_at_offset_with_flags(
+	              volume,
+	              buffer,
+	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+	              0,
+	              0,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Sectors read with the streaming flag must contain the same data
+	 */
+	read_count = libbde_volume_read_buffer_at_offset_with_flags(
+	              volume,
+	              streaming_buffer,
+	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+	              0,
+	              LIBBDE_READ_FLAG_STREAMING,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          streaming_buffer,
+	          read_size );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Sectors that are not cached are decrypted directly into the buffer
+	 * when streaming, the data must match a subsequent cached read
+	 */
+	if( size >= ( 2 * BDE_TEST_VOLUME_READ_BUFFER_SIZE ) )
 	{
-		read_size = (size_t) size;
+		read_count = libbde_volume_read_buffer_at_offset_with_flags(
+		              volume,
+		              streaming_buffer,
+		              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+		              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+		              LIBBDE_READ_FLAG_STREAMING,
+		              &error );
+
+		BDE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) BDE_TEST_VOLUME_READ_BUFFER_SIZE );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libbde_volume_read_buffer_at_offset_with_flags(
+		              volume,
+		              buffer,
+		              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+		              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+		              0,
+		              &error );
+
+		BDE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) BDE_TEST_VOLUME_READ_BUFFER_SIZE );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          buffer,
+		          streaming_buffer,
+		          BDE_TEST_VOLUME_READ_BUFFER_SIZE );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
 	}
-	read_count = libbde_volume_read_buffer_at_offset(
+	/* Test error cases
+	 */
+	read_count = libbde_volume_read_buffer_at_offset_with_flags(
+	              NULL,
+	              buffer,
+	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+	              0,
+	              0,
+	              &error );
+
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbde_volume_read_buffer_at_offset_with_flags(
 	              volume,
 	              buffer,
 	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
 	              0,
+	              0xff,
 	              &error );
 
-	BDE_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) read_size );
+	BDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_volume_read_buffers_at_offsets function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_volume_read_buffers_at_offsets(
+     libbde_volume_t *volume )
+{
+	uint8_t buffer1[ BDE_TEST_VOLUME_READ_BUFFER_SIZE ];
+	uint8_t buffer2[ BDE_TEST_VOLUME_READ_BUFFER_SIZE ];
+	uint8_t expected_buffer[ BDE_TEST_VOLUME_READ_BUFFER_SIZE ];
+
+	uint8_t *buffers[ 2 ]    = { buffer1, buffer2 };
+	size_t buffer_sizes[ 2 ] = { BDE_TEST_VOLUME_READ_BUFFER_SIZE, BDE_TEST_VOLUME_READ_BUFFER_SIZE - 3 };
+	off64_t offsets[ 2 ]     = { 0, 0 };
+	ssize_t read_counts[ 2 ] = { 0, 0 };
+
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	ssize_t read_count       = 0;
+	off64_t current_offset   = 0;
+	off64_t offset           = 0;
+	int buffer_index         = 0;
+	int number_of_threads    = 0;
+	int result               = 0;
+
+	/* Determine size
+	 */
+	result = libbde_volume_get_size(
+	          volume,
+	          &size,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offsets[ 1 ] = (off64_t) ( size / 2 ) + 3;
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 2;
+	     number_of_threads++ )
+	{
+		current_offset = libbde_volume_seek_offset(
+		                  volume,
+		                  (off64_t) ( size / 4 ),
+		                  SEEK_SET,
+		                  &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT64(
+		 "current_offset",
+		 (int64_t) current_offset,
+		 (int64_t) ( size / 4 ) );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbde_volume_read_buffers_at_offsets(
+		          volume,
+		          buffers,
+		          buffer_sizes,
+		          offsets,
+		          read_counts,
+		          2,
+		          number_of_threads,
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The current offset of the volume must not be changed
+		 */
+		result = libbde_volume_get_offset(
+		          volume,
+		          &offset,
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BDE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) current_offset );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The buffers must contain the same data as a regular read
+		 */
+		for( buffer_index = 0;
+		     buffer_index < 2;
+		     buffer_index++ )
+		{
+			read_count = libbde_volume_read_buffer_at_offset(
+			              volume,
+			              expected_buffer,
+			              buffer_sizes[ buffer_index ],
+			              offsets[ buffer_index ],
+			              &error );
+
+			BDE_TEST_ASSERT_EQUAL_SSIZE(
+			 "read_count",
+			 read_count,
+			 read_counts[ buffer_index ] );
+
+			BDE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = memory_compare(
+			          buffers[ buffer_index ],
+			          expected_buffer,
+			          (size_t) read_count );
+
+			BDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libbde_volume_read_buffers_at_offsets(
+	          NULL,
+	          buffers,
+	          buffer_sizes,
+	          offsets,
+	          read_counts,
+	          2,
+	          2,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_volume_read_buffers_at_offsets(
+	          volume,
+	          NULL,
+	          buffer_sizes,
+	          offsets,
+	          read_counts,
+	          2,
+	          2,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_volume_read_buffers_at_offsets(
+	          volume,
+	          buffers,
+	          buffer_sizes,
+	          offsets,
+	          read_counts,
+	          -1,
+	          2,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_volume_read_buffers_at_offsets(
+	          volume,
+	          buffers,
+	          buffer_sizes,
+	          offsets,
+	          read_counts,
+	          2,
+	          -1,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_volume_seek_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_volume_seek_offset(
+     libbde_volume_t *volume )
+{
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	off64_t offset           = 0;
+
+	/* Test regular cases
+	 */
+	offset = libbde_volume_seek_offset(
+	          volume,
+	          0,
+	          SEEK_END,
+	          &error );
+
+	BDE_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
 
 	BDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	if( size > 8 )
-	{
-		/* Read buffer on size boundary
-		 */
-		read_count = libbde_volume_read_buffer_at_offset(
-		              volume,
-		              buffer,
-		              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
-		              size - 8,
-		              &error );
-
-		BDE_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) 8 );
-
-		BDE_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-
-		/* Read buffer beyond size boundary
-		 */
-		read_count = libbde_volume_read_buffer_at_offset(
-		              volume,
-		              buffer,
-		              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
-		              size + 8,
-		              &error );
-
-		BDE_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) 0 );
-
-		BDE_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-	/* Stress test read buffer
-	 */
-	timestamp = time(
-	             NULL );
+	size = (size64_t) offset;
 
-	srand(
-	 (unsigned int) timestamp );
+	offset = libbde_volume_seek_offset(
+	          volume,
+	          1024,
+	          SEEK_SET,
+	          &error );
 
-	for( test_number = 0;
-	     test_number < number_of_tests;
-	     test_number++ )
-	{
-		random_number = rand();
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 1024 );
 
-		BDE_TEST_ASSERT_GREATER_THAN_INT(
-		 "random_number",
-		 random_number,
-		 -1 );
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		if( size > 0 )
-		{
-			read_offset = (off64_t) random_number % size;
-		}
-		read_size = (size_t) random_number % BDE_TEST_VOLUME_READ_BUFFER_SIZE;
+	offset = libbde_volume_seek_offset(
+	          volume,
+	          -512,
+	          SEEK_CUR,
+	          &error );
 
-#if defined( BDE_TEST_VOLUME_VERBOSE )
-		fprintf(
-		 stdout,
-		 "libbde_volume_read_buffer_at_offset: at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd "\n",
-		 read_offset,
-		 read_offset,
-		 read_size );
-#endif
-		read_count = libbde_volume_read_buffer_at_offset(
-		              volume,
-		              buffer,
-		              read_size,
-		              read_offset,
-		              &error );
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 512 );
 
-		remaining_size = size - read_offset;
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		if( read_size > remaining_size )
-		{
-			read_size = (size_t) remaining_size;
-		}
-		BDE_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) read_size );
+	offset = libbde_volume_seek_offset(
+	          volume,
+	          (off64_t) ( size + 512 ),
+	          SEEK_SET,
+	          &error );
 
-		BDE_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) ( size + 512 ) );
 
-		read_offset += read_count;
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		result = libbde_volume_get_offset(
-		          volume,
-		          &offset,
-		          &error );
+	/* Reset offset to 0
+	 */
+	offset = libbde_volume_seek_offset(
+	          volume,
+	          0,
+	          SEEK_SET,
+	          &error );
 
-		BDE_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
 
-		BDE_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 offset,
-		 read_offset );
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		BDE_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
 	/* Test error cases
 	 */
-	read_count = libbde_volume_read_buffer_at_offset(
-	              NULL,
-	              buffer,
-	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
-	              0,
-	              &error );
+	offset = libbde_volume_seek_offset(
+	          NULL,
+	          0,
+	          SEEK_SET,
+	          &error );
 
-	BDE_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
 
 	BDE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2621,17 +4262,16 @@ int bde_test_volume_read_buffer_at_offset(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libbde_volume_read_buffer_at_offset(
-	              volume,
-	              NULL,
-	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
-	              0,
-	              &error );
+	offset = libbde_volume_seek_offset(
+	          volume,
+	          -1,
+	          SEEK_SET,
+	          &error );
 
-	BDE_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
 
 	BDE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2640,36 +4280,31 @@ int bde_test_volume_read_buffer_at_offset(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libbde_volume_read_buffer_at_offset(
-	              volume,
-	              buffer,
-	              (size_t) SSIZE_MAX + 1,
-	              0,
-	              &error );
+	offset = libbde_volume_seek_offset(
+	          volume,
+	          -1,
+	          SEEK_CUR,
+	          &error );
 
-	BDE_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
 
 	BDE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	read_count = libbde_volume_read_buffer_at_offset(
-	              volume,
-	              buffer,
-	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
-	              -1,
-	              &error );
+	offset = libbde_volume_seek_offset(
+	          volume,
+	          (off64_t) ( -1 * ( size + 1 ) ),
+	          SEEK_END,
+	          &error );
 
-	BDE_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	BDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
 
 	BDE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2680,16 +4315,15 @@ int bde_test_volume_read_buffer_at_offset(
 
 #if defined( HAVE_BDE_TEST_RWLOCK )
 
-	/* Test libbde_volume_read_buffer_at_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	/* Test libbde_volume_seek_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
 	 */
 	bde_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
 
-	read_count = libbde_volume_read_buffer_at_offset(
-	              volume,
-	              buffer,
-	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
-	              0,
-	              &error );
+	offset = libbde_volume_seek_offset(
+	          volume,
+	          0,
+	          SEEK_SET,
+	          &error );
 
 	if( bde_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
 	{
@@ -2697,10 +4331,10 @@ int bde_test_volume_read_buffer_at_offset(
 	}
 	else
 	{
-		BDE_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) -1 );
+		BDE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) -1 );
 
 		BDE_TEST_ASSERT_IS_NOT_NULL(
 		 "error",
@@ -2709,16 +4343,15 @@ int bde_test_volume_read_buffer_at_offset(
 		libcerror_error_free(
 		 &error );
 	}
-	/* Test libbde_volume_read_buffer_at_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	/* Test libbde_volume_seek_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
 	 */
 	bde_test_pthread_rwlock_unlock_attempts_before_fail = 0;
 
-	read_count = libbde_volume_read_buffer_at_offset(
-	              volume,
-	              buffer,
-	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
-	              0,
-	              &error );
+	offset = libbde_volume_seek_offset(
+	          volume,
+	          0,
+	          SEEK_SET,
+	          &error );
 
 	if( bde_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
 	{
@@ -2726,10 +4359,10 @@ int bde_test_volume_read_buffer_at_offset(
 	}
 	else
 	{
-		BDE_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) -1 );
+		BDE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) -1 );
 
 		BDE_TEST_ASSERT_IS_NOT_NULL(
 		 "error",
@@ -2751,92 +4384,173 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libbde_volume_seek_offset function
+/* Tests the libbde_volume_get_offset function
  * Returns 1 if successful or 0 if not
  */
-int bde_test_volume_seek_offset(
+int bde_test_volume_get_offset(
      libbde_volume_t *volume )
 {
 	libcerror_error_t *error = NULL;
-	size64_t size            = 0;
 	off64_t offset           = 0;
+	int result               = 0;
 
 	/* Test regular cases
 	 */
-	offset = libbde_volume_seek_offset(
+	result = libbde_volume_get_offset(
 	          volume,
-	          0,
-	          SEEK_END,
+	          &offset,
 	          &error );
 
-	BDE_TEST_ASSERT_NOT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	BDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	size = (size64_t) offset;
+	/* Test error cases
+	 */
+	result = libbde_volume_get_offset(
+	          NULL,
+	          &offset,
+	          &error );
 
-	offset = libbde_volume_seek_offset(
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_volume_get_offset(
 	          volume,
-	          1024,
-	          SEEK_SET,
+	          NULL,
 	          &error );
 
-	BDE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 1024 );
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	BDE_TEST_ASSERT_IS_NULL(
+	BDE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	offset = libbde_volume_seek_offset(
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_volume_get_size function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_volume_get_size(
+     libbde_volume_t *volume )
+{
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbde_volume_get_size(
 	          volume,
-	          -512,
-	          SEEK_CUR,
+	          &size,
 	          &error );
 
-	BDE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 512 );
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	BDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	offset = libbde_volume_seek_offset(
+	/* Test error cases
+	 */
+	result = libbde_volume_get_size(
+	          NULL,
+	          &size,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_volume_get_size(
 	          volume,
-	          (off64_t) ( size + 512 ),
-	          SEEK_SET,
+	          NULL,
 	          &error );
 
-	BDE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) ( size + 512 ) );
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	BDE_TEST_ASSERT_IS_NULL(
+	BDE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Reset offset to 0
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_volume_get_encryption_method function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_volume_get_encryption_method(
+     libbde_volume_t *volume )
+{
+	libcerror_error_t *error   = NULL;
+	uint16_t encryption_method = 0;
+	int result                 = 0;
+
+	/* Test regular cases
 	 */
-	offset = libbde_volume_seek_offset(
+	result = libbde_volume_get_encryption_method(
 	          volume,
-	          0,
-	          SEEK_SET,
+	          &encryption_method,
 	          &error );
 
-	BDE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	BDE_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2844,16 +4558,15 @@ int bde_test_volume_seek_offset(
 
 	/* Test error cases
 	 */
-	offset = libbde_volume_seek_offset(
+	result = libbde_volume_get_encryption_method(
 	          NULL,
-	          0,
-	          SEEK_SET,
+	          &encryption_method,
 	          &error );
 
-	BDE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	BDE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2862,49 +4575,92 @@ int bde_test_volume_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	offset = libbde_volume_seek_offset(
+	result = libbde_volume_get_encryption_method(
 	          volume,
-	          -1,
-	          SEEK_SET,
+	          NULL,
 	          &error );
 
-	BDE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbde_volume_get_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_volume_get_statistics(
+     libbde_volume_t *volume )
+{
+	uint64_t values[ LIBBDE_NUMBER_OF_STATISTICS_VALUES ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbde_volume_get_statistics(
+	          volume,
+	          values,
+	          LIBBDE_NUMBER_OF_STATISTICS_VALUES,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	BDE_TEST_ASSERT_IS_NOT_NULL(
+	BDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	offset = libbde_volume_seek_offset(
-	          volume,
-	          -1,
-	          SEEK_CUR,
+	/* Test error cases
+	 */
+	result = libbde_volume_get_statistics(
+	          NULL,
+	          values,
+	          LIBBDE_NUMBER_OF_STATISTICS_VALUES,
 	          &error );
 
-	BDE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	BDE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	offset = libbde_volume_seek_offset(
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_volume_get_statistics(
 	          volume,
-	          (off64_t) ( -1 * ( size + 1 ) ),
-	          SEEK_END,
+	          NULL,
+	          LIBBDE_NUMBER_OF_STATISTICS_VALUES,
 	          &error );
 
-	BDE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) -1 );
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	BDE_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -2913,92 +4669,68 @@ int bde_test_volume_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_BDE_TEST_RWLOCK )
-
-	/* Test libbde_volume_seek_offset with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
-	 */
-	bde_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
-
-	offset = libbde_volume_seek_offset(
-	          volume,
-	          0,
-	          SEEK_SET,
-	          &error );
+	return( 1 );
 
-	if( bde_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
-	{
-		bde_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
-	}
-	else
+on_error:
+	if( error != NULL )
 	{
-		BDE_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 (int64_t) offset,
-		 (int64_t) -1 );
-
-		BDE_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
 		libcerror_error_free(
 		 &error );
 	}
-	/* Test libbde_volume_seek_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
-	 */
-	bde_test_pthread_rwlock_unlock_attempts_before_fail = 0;
-
-	offset = libbde_volume_seek_offset(
-	          volume,
-	          0,
-	          SEEK_SET,
-	          &error );
+	return( 0 );
+}
 
-	if( bde_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
-	{
-		bde_test_pthread_rwlock_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		BDE_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 (int64_t) offset,
-		 (int64_t) -1 );
+/* Trace function used by the libbde_volume_set_trace_function test
+ */
+void bde_test_volume_trace_function(
+      intptr_t *user_data,
+      int event_type,
+      off64_t offset BDE_TEST_ATTRIBUTE_UNUSED,
+      size64_t size BDE_TEST_ATTRIBUTE_UNUSED,
+      uint64_t start_timestamp BDE_TEST_ATTRIBUTE_UNUSED,
+      uint64_t end_timestamp BDE_TEST_ATTRIBUTE_UNUSED )
+{
+	uint64_t *number_of_events = (uint64_t *) user_data;
 
-		BDE_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	BDE_TEST_UNREFERENCED_PARAMETER( offset )
+	BDE_TEST_UNREFERENCED_PARAMETER( size )
+	BDE_TEST_UNREFERENCED_PARAMETER( start_timestamp )
+	BDE_TEST_UNREFERENCED_PARAMETER( end_timestamp )
 
-		libcerror_error_free(
-		 &error );
+	if( event_type == LIBBDE_TRACE_EVENT_TYPE_READ )
+	{
+		number_of_events[ 0 ] += 1;
 	}
-#endif /* defined( HAVE_BDE_TEST_RWLOCK ) */
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
+	else if( event_type == LIBBDE_TRACE_EVENT_TYPE_DECRYPT )
 	{
-		libcerror_error_free(
-		 &error );
+		number_of_events[ 1 ] += 1;
 	}
-	return( 0 );
 }
 
-/* Tests the libbde_volume_get_offset function
+/* Tests the libbde_volume_set_trace_function function
  * Returns 1 if successful or 0 if not
  */
-int bde_test_volume_get_offset(
+int bde_test_volume_set_trace_function(
      libbde_volume_t *volume )
 {
+	uint8_t buffer[ BDE_TEST_VOLUME_READ_BUFFER_SIZE ];
+	uint64_t number_of_events[ 2 ];
+	uint64_t values_after[ LIBBDE_NUMBER_OF_STATISTICS_VALUES ];
+	uint64_t values_before[ LIBBDE_NUMBER_OF_STATISTICS_VALUES ];
+
 	libcerror_error_t *error = NULL;
-	off64_t offset           = 0;
+	ssize_t read_count       = 0;
 	int result               = 0;
 
+	number_of_events[ 0 ] = 0;
+	number_of_events[ 1 ] = 0;
+
 	/* Test regular cases
 	 */
-	result = libbde_volume_get_offset(
+	result = libbde_volume_set_trace_function(
 	          volume,
-	          &offset,
+	          &bde_test_volume_trace_function,
+	          (intptr_t *) number_of_events,
 	          &error );
 
 	BDE_TEST_ASSERT_EQUAL_INT(
@@ -3010,28 +4742,81 @@ int bde_test_volume_get_offset(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libbde_volume_get_offset(
-	          NULL,
-	          &offset,
+	result = libbde_volume_get_statistics(
+	          volume,
+	          values_before,
+	          LIBBDE_NUMBER_OF_STATISTICS_VALUES,
 	          &error );
 
 	BDE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	BDE_TEST_ASSERT_IS_NOT_NULL(
+	BDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	read_count = libbde_volume_read_buffer_at_offset_with_flags(
+	              volume,
+	              buffer,
+	              BDE_TEST_VOLUME_READ_BUFFER_SIZE,
+	              0,
+	              LIBBDE_READ_FLAG_STREAMING,
+	              &error );
 
-	result = libbde_volume_get_offset(
+	BDE_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_volume_get_statistics(
+	          volume,
+	          values_after,
+	          LIBBDE_NUMBER_OF_STATISTICS_VALUES,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Every sector data cache miss results in a read event
+	 */
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_events[ 0 ]",
+	 number_of_events[ 0 ],
+	 values_after[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_CACHE_MISSES ] - values_before[ LIBBDE_STATISTICS_VALUE_NUMBER_OF_CACHE_MISSES ] );
+
+	result = libbde_volume_set_trace_function(
 	          volume,
 	          NULL,
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbde_volume_set_trace_function(
+	          NULL,
+	          &bde_test_volume_trace_function,
+	          (intptr_t *) number_of_events,
 	          &error );
 
 	BDE_TEST_ASSERT_EQUAL_INT(
@@ -3054,24 +4839,45 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( volume != NULL )
+	{
+		libbde_volume_set_trace_function(
+		 volume,
+		 NULL,
+		 NULL,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libbde_volume_get_size function
+/* Tests the libbde_volume_set_warmup_size function
  * Returns 1 if successful or 0 if not
  */
-int bde_test_volume_get_size(
+int bde_test_volume_set_warmup_size(
      libbde_volume_t *volume )
 {
 	libcerror_error_t *error = NULL;
-	size64_t size            = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libbde_volume_get_size(
+	result = libbde_volume_set_warmup_size(
 	          volume,
-	          &size,
+	          1024 * 1024,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_volume_set_warmup_size(
+	          volume,
+	          0,
 	          &error );
 
 	BDE_TEST_ASSERT_EQUAL_INT(
@@ -3085,9 +4891,9 @@ int bde_test_volume_get_size(
 
 	/* Test error cases
 	 */
-	result = libbde_volume_get_size(
+	result = libbde_volume_set_warmup_size(
 	          NULL,
-	          &size,
+	          1024 * 1024,
 	          &error );
 
 	BDE_TEST_ASSERT_EQUAL_INT(
@@ -3102,9 +4908,9 @@ int bde_test_volume_get_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libbde_volume_get_size(
+	result = libbde_volume_set_warmup_size(
 	          volume,
-	          NULL,
+	          (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE + 1,
 	          &error );
 
 	BDE_TEST_ASSERT_EQUAL_INT(
@@ -3130,27 +4936,124 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libbde_volume_get_encryption_method function
+/* Tests the libbde_volume_get_number_of_extents, libbde_volume_get_extent_by_index
+ * and libbde_volume_get_extent_at_offset functions
  * Returns 1 if successful or 0 if not
  */
-int bde_test_volume_get_encryption_method(
+int bde_test_volume_get_extents(
      libbde_volume_t *volume )
 {
-	libcerror_error_t *error   = NULL;
-	uint16_t encryption_method = 0;
-	int result                 = 0;
+	libcerror_error_t *error = NULL;
+	size64_t extent_size     = 0;
+	size64_t volume_size     = 0;
+	off64_t expected_offset  = 0;
+	off64_t extent_offset    = 0;
+	uint32_t extent_flags    = 0;
+	int extent_index         = 0;
+	int number_of_extents    = 0;
+	int result               = 0;
+
+	result = libbde_volume_get_size(
+	          volume,
+	          &volume_size,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test regular cases
 	 */
-	result = libbde_volume_get_encryption_method(
+	result = libbde_volume_get_number_of_extents(
+	          volume,
+	          &number_of_extents,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The extents are expected to be adjacent and cover the entire volume
+	 */
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		result = libbde_volume_get_extent_by_index(
+		          volume,
+		          extent_index,
+		          &extent_offset,
+		          &extent_size,
+		          &extent_flags,
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BDE_TEST_ASSERT_EQUAL_INT64(
+		 "extent_offset",
+		 (int64_t) extent_offset,
+		 (int64_t) expected_offset );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		expected_offset += (off64_t) extent_size;
+	}
+	BDE_TEST_ASSERT_EQUAL_UINT64(
+	 "expected_offset",
+	 (uint64_t) expected_offset,
+	 (uint64_t) volume_size );
+
+	if( volume_size > 0 )
+	{
+		result = libbde_volume_get_extent_at_offset(
+		          volume,
+		          (off64_t) volume_size - 1,
+		          &extent_offset,
+		          &extent_size,
+		          &extent_flags,
+		          &error );
+
+		BDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BDE_TEST_ASSERT_EQUAL_UINT64(
+		 "extent_end_offset",
+		 (uint64_t) extent_offset + extent_size,
+		 (uint64_t) volume_size );
+
+		BDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libbde_volume_get_extent_at_offset(
 	          volume,
-	          &encryption_method,
+	          (off64_t) volume_size,
+	          &extent_offset,
+	          &extent_size,
+	          &extent_flags,
 	          &error );
 
 	BDE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	BDE_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -3158,9 +5061,9 @@ int bde_test_volume_get_encryption_method(
 
 	/* Test error cases
 	 */
-	result = libbde_volume_get_encryption_method(
+	result = libbde_volume_get_number_of_extents(
 	          NULL,
-	          &encryption_method,
+	          &number_of_extents,
 	          &error );
 
 	BDE_TEST_ASSERT_EQUAL_INT(
@@ -3175,9 +5078,32 @@ int bde_test_volume_get_encryption_method(
 	libcerror_error_free(
 	 &error );
 
-	result = libbde_volume_get_encryption_method(
+	result = libbde_volume_get_extent_by_index(
 	          volume,
-	          NULL,
+	          -1,
+	          &extent_offset,
+	          &extent_size,
+	          &extent_flags,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_volume_get_extent_at_offset(
+	          volume,
+	          -1,
+	          &extent_offset,
+	          &extent_size,
+	          &extent_flags,
 	          &error );
 
 	BDE_TEST_ASSERT_EQUAL_INT(
@@ -3999,6 +5925,261 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libbde_volume_set_keys_from_volume function
+ * Returns 1 if successful or 0 if not
+ */
+int bde_test_volume_set_keys_from_volume(
+     void )
+{
+	uint8_t full_volume_encryption_key[ 32 ];
+	uint8_t tweak_key[ 32 ];
+
+	libbde_volume_t *source_volume = NULL;
+	libbde_volume_t *volume        = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 full_volume_encryption_key,
+	 'K',
+	 32 );
+
+	memory_set(
+	 tweak_key,
+	 'T',
+	 32 );
+
+	result = libbde_volume_initialize(
+	          &source_volume,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "source_volume",
+	 source_volume );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_volume_initialize(
+	          &volume,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test set keys from volume without keys
+	 */
+	result = libbde_volume_set_keys_from_volume(
+	          volume,
+	          source_volume,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbde_volume_set_keys(
+	          source_volume,
+	          full_volume_encryption_key,
+	          32,
+	          tweak_key,
+	          32,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_volume_set_keys_from_volume(
+	          volume,
+	          source_volume,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
+
+	BDE_TEST_ASSERT_EQUAL_UINT8(
+	 "keys_are_set",
+	 ( (libbde_internal_volume_t *) volume )->keys_are_set,
+	 1 );
+
+	BDE_TEST_ASSERT_EQUAL_SIZE(
+	 "full_volume_encryption_key_size",
+	 ( (libbde_internal_volume_t *) volume )->full_volume_encryption_key_size,
+	 (size_t) 32 );
+
+	result = memory_compare(
+	          ( (libbde_internal_volume_t *) volume )->full_volume_encryption_key,
+	          full_volume_encryption_key,
+	          32 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          ( (libbde_internal_volume_t *) volume )->tweak_key,
+	          tweak_key,
+	          32 );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
+
+	/* Test error cases
+	 */
+	result = libbde_volume_set_keys_from_volume(
+	          NULL,
+	          source_volume,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_volume_set_keys_from_volume(
+	          volume,
+	          NULL,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbde_volume_set_keys_from_volume(
+	          volume,
+	          volume,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbde_volume_free(
+	          &volume,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbde_volume_free(
+	          &source_volume,
+	          &error );
+
+	BDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "source_volume",
+	 source_volume );
+
+	BDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libbde_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( source_volume != NULL )
+	{
+		libbde_volume_free(
+		 &source_volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -4101,6 +6282,26 @@ int main(
 	 "libbde_volume_free",
 	 bde_test_volume_free );
 
+	BDE_TEST_RUN(
+	 "libbde_volume_set_keys_from_volume",
+	 bde_test_volume_set_keys_from_volume );
+
+#if defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT )
+
+	BDE_TEST_RUN(
+	 "libbde_internal_volume_read_unencrypted_buffer_from_file_io_handle",
+	 bde_test_internal_volume_read_unencrypted_buffer_from_file_io_handle );
+
+	BDE_TEST_RUN(
+	 "libbde_internal_volume_open_file_io_handle",
+	 bde_test_internal_volume_open_file_io_handle );
+
+	BDE_TEST_RUN(
+	 "libbde_internal_volume_warmup",
+	 bde_test_internal_volume_warmup );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBDE_DLL_IMPORT ) */
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -4280,6 +6481,16 @@ int main(
 		 bde_test_volume_read_buffer_at_offset,
 		 volume );
 
+		BDE_TEST_RUN_WITH_ARGS(
+		 "libbde_volume_read_buffer_at_offset_with_flags",
+		 bde_test_volume_read_buffer_at_offset_with_flags,
+		 volume );
+
+		BDE_TEST_RUN_WITH_ARGS(
+		 "libbde_volume_read_buffers_at_offsets",
+		 bde_test_volume_read_buffers_at_offsets,
+		 volume );
+
 		/* TODO: add tests for libbde_volume_write_buffer */
 
 		/* TODO: add tests for libbde_volume_write_buffer_at_offset */
@@ -4310,6 +6521,26 @@ int main(
 		 bde_test_volume_get_encryption_method,
 		 volume );
 
+		BDE_TEST_RUN_WITH_ARGS(
+		 "libbde_volume_get_statistics",
+		 bde_test_volume_get_statistics,
+		 volume );
+
+		BDE_TEST_RUN_WITH_ARGS(
+		 "libbde_volume_set_trace_function",
+		 bde_test_volume_set_trace_function,
+		 volume );
+
+		BDE_TEST_RUN_WITH_ARGS(
+		 "libbde_volume_set_warmup_size",
+		 bde_test_volume_set_warmup_size,
+		 volume );
+
+		BDE_TEST_RUN_WITH_ARGS(
+		 "libbde_volume_get_extents",
+		 bde_test_volume_get_extents,
+		 volume );
+
 		/* TODO: add tests for libbde_volume_get_volume_identifier */
 
 		BDE_TEST_RUN_WITH_ARGS(
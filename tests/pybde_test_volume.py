@@ -481,6 +481,53 @@ class VolumeTypeTests(unittest.TestCase):
 
       bde_volume.close()
 
+  def test_read_buffer_at_offset_file_object(self):
+    """Tests the read_buffer_at_offset function on file-like objects."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    if not os.path.isfile(test_source):
+      raise unittest.SkipTest("source not a regular file")
+
+    test_offset = getattr(unittest, "offset", None)
+    if test_offset:
+      raise unittest.SkipTest("source defines offset")
+
+    password = getattr(unittest, "password", None)
+    recovery_password = getattr(unittest, "recovery_password", None)
+    startup_key = getattr(unittest, "startup_key", None)
+
+    data_per_file_object = []
+
+    # The built-in file object supports readinto, the data range file
+    # object only supports read.
+    with open(test_source, "rb") as file_object_with_readinto:
+      with DataRangeFileObject(test_source, 0, None) as file_object:
+        for test_file_object in (file_object_with_readinto, file_object):
+          bde_volume = pybde.volume()
+
+          if password:
+            bde_volume.set_password(password)
+          if recovery_password:
+            bde_volume.set_recovery_password(recovery_password)
+          if startup_key:
+            bde_volume.read_startup_key(startup_key)
+
+          bde_volume.open_file_object(test_file_object)
+
+          size = bde_volume.get_size()
+
+          data = []
+          for media_offset in (0, 512, size // 2, max(size - 8, 0)):
+            data.append(bde_volume.read_buffer_at_offset(4096, media_offset))
+
+          data_per_file_object.append(data)
+
+          bde_volume.close()
+
+    self.assertEqual(data_per_file_object[0], data_per_file_object[1])
+
   def test_read_buffer_at_offset(self):
     """Tests the read_buffer_at_offset function."""
     test_source = getattr(unittest, "source", None)
@@ -565,6 +612,220 @@ class VolumeTypeTests(unittest.TestCase):
     with self.assertRaises(IOError):
       bde_volume.read_buffer_at_offset(4096, 0)
 
+  def test_read_buffer_into(self):
+    """Tests the read_buffer_into and read_buffer_at_offset_into functions."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    test_offset = getattr(unittest, "offset", None)
+    if test_offset:
+      raise unittest.SkipTest("source defines offset")
+
+    bde_volume = pybde.volume()
+
+    password = getattr(unittest, "password", None)
+    if password:
+      bde_volume.set_password(password)
+
+    recovery_password = getattr(unittest, "recovery_password", None)
+    if recovery_password:
+      bde_volume.set_recovery_password(recovery_password)
+
+    startup_key = getattr(unittest, "startup_key", None)
+    if startup_key:
+      bde_volume.read_startup_key(startup_key)
+
+    bde_volume.open(test_source)
+
+    size = bde_volume.get_size()
+
+    # Test normal read.
+    expected_data = bde_volume.read_buffer_at_offset(4096, 0)
+
+    buffer = bytearray(4096)
+    read_count = bde_volume.read_buffer_at_offset_into(buffer, 0)
+
+    self.assertEqual(read_count, min(size, 4096))
+    self.assertEqual(bytes(buffer[:read_count]), expected_data)
+
+    bde_volume.seek_offset(0, os.SEEK_SET)
+
+    buffer = bytearray(4096)
+    read_count = bde_volume.readinto(memoryview(buffer))
+
+    self.assertEqual(read_count, min(size, 4096))
+    self.assertEqual(bytes(buffer[:read_count]), expected_data)
+    self.assertEqual(bde_volume.get_offset(), read_count)
+
+    if size > 8:
+      # Read buffer on size boundary.
+      read_count = bde_volume.read_buffer_at_offset_into(buffer, size - 8)
+
+      self.assertEqual(read_count, 8)
+
+      # Read buffer beyond size boundary.
+      read_count = bde_volume.read_buffer_at_offset_into(buffer, size + 8)
+
+      self.assertEqual(read_count, 0)
+
+    with self.assertRaises(TypeError):
+      bde_volume.read_buffer_into(b"read-only")
+
+    with self.assertRaises(ValueError):
+      bde_volume.read_buffer_at_offset_into(buffer, -1)
+
+    bde_volume.close()
+
+    # Test the read without open.
+    with self.assertRaises(IOError):
+      bde_volume.read_buffer_at_offset_into(buffer, 0)
+
+  def test_read_buffers(self):
+    """Tests the read_buffers function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    test_offset = getattr(unittest, "offset", None)
+    if test_offset:
+      raise unittest.SkipTest("source defines offset")
+
+    bde_volume = pybde.volume()
+
+    password = getattr(unittest, "password", None)
+    if password:
+      bde_volume.set_password(password)
+
+    recovery_password = getattr(unittest, "recovery_password", None)
+    if recovery_password:
+      bde_volume.set_recovery_password(recovery_password)
+
+    startup_key = getattr(unittest, "startup_key", None)
+    if startup_key:
+      bde_volume.read_startup_key(startup_key)
+
+    bde_volume.open(test_source)
+
+    size = bde_volume.get_size()
+
+    ranges = [(0, 4096), (size // 2, 4096), (1, 511), (size - 8, 16),
+              (size + 8, 16)]
+
+    expected_data = [
+        bde_volume.read_buffer_at_offset(range_size, range_offset)
+        for range_offset, range_size in ranges]
+
+    # Test normal read with and without threads.
+    for number_of_threads in (1, 4):
+      data = bde_volume.read_buffers(
+          ranges, number_of_threads=number_of_threads)
+
+      self.assertEqual(data, expected_data)
+
+    # Test read into caller provided buffers.
+    buffers = [bytearray(range_size) for _, range_size in ranges]
+
+    read_counts = bde_volume.read_buffers(ranges, buffers=buffers)
+
+    self.assertEqual(
+        read_counts, [len(range_data) for range_data in expected_data])
+
+    for buffer, read_count, range_data in zip(
+        buffers, read_counts, expected_data):
+      self.assertEqual(bytes(buffer[:read_count]), range_data)
+
+    self.assertEqual(bde_volume.read_buffers([]), [])
+
+    with self.assertRaises(ValueError):
+      bde_volume.read_buffers([(-1, 16)])
+
+    with self.assertRaises(ValueError):
+      bde_volume.read_buffers([(0, 16)], buffers=[bytearray(8)])
+
+    with self.assertRaises(ValueError):
+      bde_volume.read_buffers([(0, 16)], buffers=[])
+
+    with self.assertRaises(TypeError):
+      bde_volume.read_buffers([(0, 16)], buffers=[b"read-only-buffer"])
+
+    with self.assertRaises(ValueError):
+      bde_volume.read_buffers([(0, 16)], number_of_threads=0)
+
+    bde_volume.close()
+
+    # Test the read without open.
+    with self.assertRaises(IOError):
+      bde_volume.read_buffers([(0, 16)])
+
+  def test_iter_chunks(self):
+    """Tests the iter_chunks function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    test_offset = getattr(unittest, "offset", None)
+    if test_offset:
+      raise unittest.SkipTest("source defines offset")
+
+    bde_volume = pybde.volume()
+
+    password = getattr(unittest, "password", None)
+    if password:
+      bde_volume.set_password(password)
+
+    recovery_password = getattr(unittest, "recovery_password", None)
+    if recovery_password:
+      bde_volume.set_recovery_password(recovery_password)
+
+    startup_key = getattr(unittest, "startup_key", None)
+    if startup_key:
+      bde_volume.read_startup_key(startup_key)
+
+    bde_volume.open(test_source)
+
+    size = bde_volume.get_size()
+
+    start_offset = min(size, 1000)
+    end_offset = min(size, start_offset + (64 * 1024) + 17)
+
+    expected_data = bde_volume.read_buffer_at_offset(
+        end_offset - start_offset, start_offset)
+
+    chunks = list(bde_volume.iter_chunks(
+        chunk_size=4096, start=start_offset, end=end_offset))
+
+    for chunk in chunks[:-1]:
+      self.assertEqual(len(chunk), 4096)
+
+    self.assertEqual(b"".join(chunks), expected_data)
+
+    # Test iterating up to the end of the volume.
+    total_size = 0
+    for chunk in bde_volume.iter_chunks(start=max(0, size - 8192)):
+      total_size += len(chunk)
+
+    self.assertEqual(total_size, min(size, 8192))
+
+    # Test that an iterator beyond the end of the volume is empty.
+    self.assertEqual(list(bde_volume.iter_chunks(start=size + 8)), [])
+
+    # Test that an iterator can be released before it is exhausted.
+    chunk_iterator = bde_volume.iter_chunks(chunk_size=512)
+    next(chunk_iterator)
+    del chunk_iterator
+
+    with self.assertRaises(ValueError):
+      bde_volume.iter_chunks(chunk_size=0)
+
+    with self.assertRaises(ValueError):
+      bde_volume.iter_chunks(start=-1)
+
+    with self.assertRaises(ValueError):
+      bde_volume.iter_chunks(end=-1)
+
+    bde_volume.close()
+
   def test_seek_offset(self):
     """Tests the seek_offset function."""
     test_source = getattr(unittest, "source", None)
@@ -741,6 +1002,43 @@ class VolumeTypeTests(unittest.TestCase):
 
       bde_volume.close()
 
+  def test_get_statistics(self):
+    """Tests the get_statistics function and statistics property."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    bde_volume = pybde.volume()
+
+    password = getattr(unittest, "password", None)
+    if password:
+      bde_volume.set_password(password)
+
+    recovery_password = getattr(unittest, "recovery_password", None)
+    if recovery_password:
+      bde_volume.set_recovery_password(recovery_password)
+
+    startup_key = getattr(unittest, "startup_key", None)
+    if startup_key:
+      bde_volume.read_startup_key(startup_key)
+
+    test_offset = getattr(unittest, "offset", None)
+
+    with DataRangeFileObject(
+        test_source, test_offset or 0, None) as file_object:
+
+      bde_volume.open_file_object(file_object)
+
+      statistics = bde_volume.get_statistics()
+      self.assertIsNotNone(statistics)
+      self.assertIn("number_of_cache_hits", statistics)
+      self.assertIn("number_of_cache_misses", statistics)
+      self.assertIn("number_of_bytes_decrypted_aes_xts", statistics)
+
+      self.assertIsNotNone(bde_volume.statistics)
+
+      bde_volume.close()
+
   def test_get_creation_time(self):
     """Tests the get_creation_time function and creation_time property."""
     test_source = getattr(unittest, "source", None)
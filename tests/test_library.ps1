@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "aes_ccm_encrypted_key encryption_context error external_key io_handle key key_protector metadata metadata_block_header metadata_entry metadata_header notify password password_keep sector_data sector_data_vector stretch_key volume_header volume_master_key"
+$LibraryTests = "aes_ccm_encrypted_key block_cache direct_file_io_handle encryption_context error extent external_key io_handle key key_protector mapped_file_io_handle metadata metadata_block_header metadata_entry metadata_header notify ntfs_volume_header password password_keep positional_file read_worker sector_data sector_data_vector statistics stretch_key volume_header volume_master_key"
 $LibraryTestsWithInput = "support volume"
 $OptionSets = "keys password recovery_password startup_key" -split " "
 